@@ -0,0 +1,595 @@
+/* conf-catalog.c --- all of the hacks' XML settings files, in one file.
+ * xscreensaver, Copyright © 2026 Jamie Zawinski <jwz@jwz.org>
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ *
+ * The settings dialog reads the XML file of every hack in the list, to get
+ * their names and descriptions, and then reads it again when the settings
+ * of that hack are opened.  That is several hundred small files, which is
+ * slow when the config directory is on a network file system.  So at
+ * install time, all of them are parsed and written into one file, which
+ * is mapped in with a single mmap() and turned back into an XML tree on
+ * demand.  If the catalog is missing, the settings dialog just reads the
+ * XML files as before.  Each file's size and date are recorded too, and
+ * a file that has been edited since the catalog was built, or that isn't
+ * in it, is read from disk instead; that costs a stat() per file, but
+ * that is still much less than reading it.  (The date of the directory
+ * is no use for this: package managers give the catalog the date it was
+ * built, but the directory the date it was installed.)
+ *
+ * The file is written in the native byte order and word size, since it is
+ * only ever read on the machine where it was installed; if the header
+ * doesn't match, it is ignored.  Nodes are stored in document order, so
+ * a node's children and next sibling always come after it, and any index
+ * that doesn't is rejected: a corrupted file can't make us loop.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#ifdef HAVE_GTK /* whole file */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <libxml/parser.h>
+
+#include "blurb.h"
+#include "conf-catalog.h"
+
+#define CATALOG_MAGIC      "XSSCAT2\n"
+#define CATALOG_BYTE_ORDER 0x01020304
+
+typedef struct {
+  char magic[8];
+  unsigned int byte_order;	/* CATALOG_BYTE_ORDER, as written */
+  unsigned int size;		/* of the whole file */
+  unsigned int nfiles, files;	/* count, and offset of cat_file[] */
+  unsigned int nnodes, nodes;	/* count, and offset of cat_node[] */
+  unsigned int nattrs, attrs;	/* count, and offset of cat_attr[] */
+  unsigned int nstrings, strings; /* bytes, and offset of the string pool */
+} cat_header;
+
+typedef struct {
+  unsigned int name;		/* string: "foo.xml" */
+  unsigned int root;		/* node: its <screensaver> element */
+  unsigned int size, mtime;	/* of the XML file, when it was read */
+} cat_file;
+
+enum { CAT_ELEMENT = 1, CAT_TEXT };
+
+typedef struct {
+  unsigned int type;
+  unsigned int name;		/* string: tag name, of elements */
+  unsigned int content;		/* string: text, of text nodes */
+  unsigned int attrs, nattrs;	/* first attribute, and how many */
+  unsigned int kids;		/* node: first child, or 0 */
+  unsigned int next;		/* node: next sibling, or 0 */
+} cat_node;
+
+typedef struct {
+  unsigned int name, value;	/* strings */
+} cat_attr;
+
+/* Node 0 is never used, so that 0 can mean "none".  String 0 is "". */
+
+struct conf_catalog {
+  void *base;
+  size_t size;
+  const cat_header *header;
+  const cat_file *files;
+  const cat_node *nodes;
+  const cat_attr *attrs;
+  const char *strings;
+};
+
+
+/* Reading.
+ */
+
+static int
+catalog_valid_p (const conf_catalog *cat)
+{
+  const cat_header *h = cat->header;
+  size_t size = cat->size;
+  unsigned int i;
+
+# define SECTION_OK(OFF,N,TYPE) \
+    ((OFF) <= size && \
+     (OFF) % sizeof(unsigned int) == 0 && \
+     (N) <= (size - (OFF)) / sizeof(TYPE))
+# define STRING_OK(S) ((S) < h->nstrings)
+
+  if (memcmp (h->magic, CATALOG_MAGIC, sizeof(h->magic)) ||
+      h->byte_order != CATALOG_BYTE_ORDER ||
+      h->size != size ||
+      !SECTION_OK (h->files,   h->nfiles,   cat_file) ||
+      !SECTION_OK (h->nodes,   h->nnodes,   cat_node) ||
+      !SECTION_OK (h->attrs,   h->nattrs,   cat_attr) ||
+      !SECTION_OK (h->strings, h->nstrings, char) ||
+      h->nnodes < 1 ||
+      h->nstrings < 1 ||
+      cat->strings[h->nstrings - 1] != 0)
+    return 0;
+
+  for (i = 0; i < h->nfiles; i++)
+    {
+      const cat_file *f = &cat->files[i];
+      if (!STRING_OK (f->name) ||
+          f->root < 1 || f->root >= h->nnodes ||
+          (i > 0 && strcmp (cat->strings + cat->files[i-1].name,
+                            cat->strings + f->name) >= 0))
+        return 0;
+    }
+
+  for (i = 1; i < h->nnodes; i++)
+    {
+      const cat_node *n = &cat->nodes[i];
+      if ((n->type != CAT_ELEMENT && n->type != CAT_TEXT) ||
+          !STRING_OK (n->name) ||
+          !STRING_OK (n->content) ||
+          n->nattrs > h->nattrs ||
+          n->attrs > h->nattrs - n->nattrs ||
+          (n->kids && (n->kids <= i || n->kids >= h->nnodes)) ||
+          (n->next && (n->next <= i || n->next >= h->nnodes)))
+        return 0;
+    }
+
+  for (i = 0; i < h->nattrs; i++)
+    if (!STRING_OK (cat->attrs[i].name) ||
+        !STRING_OK (cat->attrs[i].value))
+      return 0;
+
+# undef SECTION_OK
+# undef STRING_OK
+  return 1;
+}
+
+
+conf_catalog *
+conf_catalog_open (const char *dir, int verbose_p)
+{
+  char *file = (char *) malloc (strlen (dir) + strlen (CONF_CATALOG_FILE) + 2);
+  conf_catalog *cat = 0;
+  struct stat cst;
+  void *base = MAP_FAILED;
+  int fd;
+
+  sprintf (file, "%s/%s", dir, CONF_CATALOG_FILE);
+  fd = open (file, O_RDONLY);
+  if (fd < 0)
+    {
+      if (verbose_p)
+        fprintf (stderr, "%s: %s: %s\n", blurb(), file, strerror (errno));
+      goto FAIL;
+    }
+
+  if (fstat (fd, &cst))
+    goto FAIL;
+
+  if (cst.st_size < (off_t) sizeof(cat_header) ||
+      cst.st_size != (unsigned int) cst.st_size)
+    goto BAD;
+
+  base = mmap (0, cst.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (base == MAP_FAILED)
+    {
+      if (verbose_p)
+        fprintf (stderr, "%s: %s: mmap: %s\n", blurb(), file,
+                 strerror (errno));
+      goto FAIL;
+    }
+
+  cat = (conf_catalog *) calloc (1, sizeof(*cat));
+  cat->base    = base;
+  cat->size    = cst.st_size;
+  cat->header  = (const cat_header *) base;
+  cat->files   = (const cat_file *) ((char *) base + cat->header->files);
+  cat->nodes   = (const cat_node *) ((char *) base + cat->header->nodes);
+  cat->attrs   = (const cat_attr *) ((char *) base + cat->header->attrs);
+  cat->strings = (const char *)     ((char *) base + cat->header->strings);
+
+  if (! catalog_valid_p (cat))
+    goto BAD;
+
+  if (verbose_p)
+    fprintf (stderr, "%s: mapped %s: %u files\n", blurb(), file,
+             cat->header->nfiles);
+  close (fd);
+  free (file);
+  return cat;
+
+ BAD:
+  if (verbose_p)
+    fprintf (stderr, "%s: %s: unrecognized catalog\n", blurb(), file);
+ FAIL:
+  if (cat) free (cat);
+  if (base != MAP_FAILED) munmap (base, cst.st_size);
+  if (fd >= 0) close (fd);
+  free (file);
+  return 0;
+}
+
+
+void
+conf_catalog_close (conf_catalog *cat)
+{
+  if (!cat) return;
+  munmap (cat->base, cat->size);
+  free (cat);
+}
+
+
+static xmlNodePtr
+catalog_node (const conf_catalog *cat, xmlDocPtr doc, unsigned int i)
+{
+  const cat_node *n = &cat->nodes[i];
+  xmlNodePtr node;
+  unsigned int j;
+
+  if (n->type == CAT_TEXT)
+    return xmlNewDocText (doc, (const xmlChar *) cat->strings + n->content);
+
+  node = xmlNewDocNode (doc, NULL, (const xmlChar *) cat->strings + n->name,
+                        NULL);
+  for (j = 0; j < n->nattrs; j++)
+    {
+      const cat_attr *a = &cat->attrs[n->attrs + j];
+      xmlNewProp (node,
+                  (const xmlChar *) cat->strings + a->name,
+                  (const xmlChar *) cat->strings + a->value);
+    }
+  for (j = n->kids; j; j = cat->nodes[j].next)
+    xmlAddChild (node, catalog_node (cat, doc, j));
+  return node;
+}
+
+
+xmlDocPtr
+conf_catalog_doc (conf_catalog *cat, const char *xml_file)
+{
+  const char *name = strrchr (xml_file, '/');
+  int lo = 0, hi;
+  name = name ? name + 1 : xml_file;
+
+  if (!cat) return 0;
+  hi = cat->header->nfiles - 1;
+  while (lo <= hi)
+    {
+      int mid = (lo + hi) / 2;
+      const cat_file *f = &cat->files[mid];
+      int c = strcmp (name, cat->strings + f->name);
+      if (c < 0)
+        hi = mid - 1;
+      else if (c > 0)
+        lo = mid + 1;
+      else
+        {
+          struct stat st;
+          xmlDocPtr doc;
+          if (stat (xml_file, &st) ||
+              (unsigned int) st.st_size  != f->size ||
+              (unsigned int) st.st_mtime != f->mtime)
+            return 0;	/* Changed since the catalog was built */
+          doc = xmlNewDoc ((const xmlChar *) "1.0");
+          xmlDocSetRootElement (doc, catalog_node (cat, doc, f->root));
+          return doc;
+        }
+    }
+  return 0;
+}
+
+
+/* Writing.
+ */
+
+typedef struct {
+  cat_file *files;  unsigned int nfiles, files_size;
+  cat_node *nodes;  unsigned int nnodes, nodes_size;
+  cat_attr *attrs;  unsigned int nattrs, attrs_size;
+  char *strings;    unsigned int nstrings, strings_size;
+  unsigned int *hash; unsigned int hash_size, hash_count;  /* ~0 = empty */
+} catalog_builder;
+
+
+static void *
+grow (void *array, unsigned int *size, unsigned int want, size_t elt)
+{
+  if (want <= *size) return array;
+  *size = (*size ? *size * 2 : 256);
+  if (*size < want) *size = want;
+  array = realloc (array, *size * elt);
+  if (!array)
+    {
+      fprintf (stderr, "%s: out of memory\n", blurb());
+      exit (1);
+    }
+  return array;
+}
+
+#define GROW(B,FIELD,N) \
+  ((B)->FIELD = grow ((B)->FIELD, &(B)->FIELD##_size, (N), \
+                      sizeof(*(B)->FIELD)))
+
+
+static unsigned int
+string_hash (const char *s)
+{
+  unsigned int h = 2166136261U;		/* FNV-1a */
+  for (; *s; s++)
+    h = (h ^ (unsigned char) *s) * 16777619U;
+  return h;
+}
+
+
+static void
+rehash (catalog_builder *b, unsigned int size)
+{
+  unsigned int i;
+  free (b->hash);
+  b->hash_size = size;
+  b->hash = (unsigned int *) malloc (size * sizeof(*b->hash));
+  if (!b->hash)
+    {
+      fprintf (stderr, "%s: out of memory\n", blurb());
+      exit (1);
+    }
+  memset (b->hash, ~0, size * sizeof(*b->hash));
+
+  for (i = 0; i < b->nstrings; i += strlen (b->strings + i) + 1)
+    {
+      unsigned int j = string_hash (b->strings + i) & (size - 1);
+      while (b->hash[j] != ~0U)
+        j = (j + 1) & (size - 1);
+      b->hash[j] = i;
+    }
+}
+
+
+/* Returns the offset of the string in the pool, adding it if it is not
+   already there.  Most attribute names and values are repeated hundreds
+   of times. */
+static unsigned int
+intern (catalog_builder *b, const char *s)
+{
+  unsigned int L, j;
+  if (!s || !*s) return 0;
+
+  if (b->hash_count * 2 >= b->hash_size)
+    rehash (b, b->hash_size ? b->hash_size * 2 : 4096);
+
+  j = string_hash (s) & (b->hash_size - 1);
+  while (b->hash[j] != ~0U)
+    {
+      if (!strcmp (b->strings + b->hash[j], s))
+        return b->hash[j];
+      j = (j + 1) & (b->hash_size - 1);
+    }
+
+  L = strlen (s) + 1;
+  GROW (b, strings, b->nstrings + L);
+  memcpy (b->strings + b->nstrings, s, L);
+  b->hash[j] = b->nstrings;
+  b->hash_count++;
+  b->nstrings += L;
+  return b->hash[j];
+}
+
+
+/* Adds the node and everything under it.  Returns its index, or 0 if it
+   is a comment or something else that the settings dialog doesn't use. */
+static unsigned int
+add_node (catalog_builder *b, xmlNodePtr node)
+{
+  unsigned int i, prev = 0;
+  xmlAttrPtr a;
+  xmlNodePtr kid;
+
+  if (node->type != XML_ELEMENT_NODE && node->type != XML_TEXT_NODE)
+    return 0;
+
+  i = b->nnodes;
+  GROW (b, nodes, ++b->nnodes);
+  memset (&b->nodes[i], 0, sizeof(b->nodes[i]));
+
+  if (node->type == XML_TEXT_NODE)
+    {
+      b->nodes[i].type = CAT_TEXT;
+      b->nodes[i].content = intern (b, (char *) node->content);
+      return i;
+    }
+
+  b->nodes[i].type  = CAT_ELEMENT;
+  b->nodes[i].name  = intern (b, (char *) node->name);
+  b->nodes[i].attrs = b->nattrs;
+  for (a = node->properties; a; a = a->next)
+    {
+      xmlChar *value = xmlGetProp (node, a->name);
+      GROW (b, attrs, b->nattrs + 1);
+      b->attrs[b->nattrs].name  = intern (b, (char *) a->name);
+      b->attrs[b->nattrs].value = intern (b, (char *) value);
+      b->nattrs++;
+      b->nodes[i].nattrs++;
+      if (value) xmlFree (value);
+    }
+
+  /* Children are added after their parent, and each one before its next
+     sibling.  Note that b->nodes may move while recursing. */
+  for (kid = node->children; kid; kid = kid->next)
+    {
+      unsigned int k = add_node (b, kid);
+      if (!k) continue;
+      if (prev)
+        b->nodes[prev].next = k;
+      else
+        b->nodes[i].kids = k;
+      prev = k;
+    }
+
+  return i;
+}
+
+
+static int
+compare_strings (const void *a, const void *b)
+{
+  return strcmp (*(char **) a, *(char **) b);
+}
+
+
+static int
+write_catalog (catalog_builder *b, const char *file)
+{
+  cat_header h;
+  FILE *out = fopen (file, "wb");
+  if (!out) return 0;
+
+  memset (&h, 0, sizeof(h));
+  memcpy (h.magic, CATALOG_MAGIC, sizeof(h.magic));
+  h.byte_order = CATALOG_BYTE_ORDER;
+  h.nfiles   = b->nfiles;
+  h.files    = sizeof(h);
+  h.nnodes   = b->nnodes;
+  h.nodes    = h.files + b->nfiles * sizeof(*b->files);
+  h.nattrs   = b->nattrs;
+  h.attrs    = h.nodes + b->nnodes * sizeof(*b->nodes);
+  h.nstrings = b->nstrings;
+  h.strings  = h.attrs + b->nattrs * sizeof(*b->attrs);
+  h.size     = h.strings + b->nstrings;
+
+  fwrite (&h, sizeof(h), 1, out);
+  fwrite (b->files,   sizeof(*b->files), b->nfiles, out);
+  fwrite (b->nodes,   sizeof(*b->nodes), b->nnodes, out);
+  fwrite (b->attrs,   sizeof(*b->attrs), b->nattrs, out);
+  fwrite (b->strings, 1,                 b->nstrings, out);
+
+  if (ferror (out))
+    {
+      fclose (out);
+      return 0;
+    }
+  return (fclose (out) == 0);
+}
+
+
+int
+conf_catalog_compile (const char *dir)
+{
+  catalog_builder b;
+  DIR *d = opendir (dir);
+  struct dirent *de;
+  char **names = 0;
+  unsigned int nnames = 0, names_size = 0;
+  char *file, *tmp;
+  unsigned int i;
+  int ok;
+
+  if (!d)
+    {
+      fprintf (stderr, "%s: %s: %s\n", blurb(), dir, strerror (errno));
+      return 0;
+    }
+
+  while ((de = readdir (d)))
+    {
+      int L = strlen (de->d_name);
+      if (L <= 4 || strcmp (de->d_name + L - 4, ".xml"))
+        continue;
+      names = grow (names, &names_size, nnames + 1, sizeof(*names));
+      names[nnames++] = strdup (de->d_name);
+    }
+  closedir (d);
+
+  /* The file table is searched by name, so add them in order. */
+  qsort (names, nnames, sizeof(*names), compare_strings);
+
+  memset (&b, 0, sizeof(b));
+  GROW (&b, nodes, 1);
+  memset (&b.nodes[0], 0, sizeof(b.nodes[0]));
+  b.nnodes = 1;
+  GROW (&b, strings, 1);
+  b.strings[0] = 0;
+  b.nstrings = 1;
+
+  file = (char *) malloc (strlen (dir) + 256 + strlen (CONF_CATALOG_FILE));
+  for (i = 0; i < nnames; i++)
+    {
+      xmlDocPtr doc = 0;
+      xmlNodePtr root;
+      struct stat st;
+
+      /* Stat it first, so that if it changes while we read it, it will
+         look changed. */
+      sprintf (file, "%.200s/%.200s", dir, names[i]);
+      if (! stat (file, &st))
+        doc = xmlReadFile (file, NULL, 0);
+      root = doc ? xmlDocGetRootElement (doc) : 0;
+      if (!root || strcmp ((char *) root->name, "screensaver"))
+        fprintf (stderr, "%s: %s: not a screensaver description\n",
+                 blurb(), file);
+      else
+        {
+          GROW (&b, files, b.nfiles + 1);
+          b.files[b.nfiles].name = intern (&b, names[i]);
+          b.files[b.nfiles].root = add_node (&b, root);
+          b.files[b.nfiles].size  = st.st_size;
+          b.files[b.nfiles].mtime = st.st_mtime;
+          b.nfiles++;
+        }
+      if (doc) xmlFreeDoc (doc);
+      free (names[i]);
+    }
+  free (names);
+
+  sprintf (file, "%s/%s", dir, CONF_CATALOG_FILE);
+  tmp = (char *) malloc (strlen (file) + 10);
+  sprintf (tmp, "%s.tmp", file);
+
+  ok = write_catalog (&b, tmp);
+  if (ok && rename (tmp, file))
+    ok = 0;
+  if (!ok)
+    {
+      fprintf (stderr, "%s: %s: %s\n", blurb(), file, strerror (errno));
+      unlink (tmp);
+    }
+  else
+    {
+      fprintf (stderr, "%s: wrote %s: %u files, %u bytes\n", blurb(), file,
+               b.nfiles, (unsigned int)
+               (sizeof(cat_header) +
+                b.nfiles * sizeof(*b.files) +
+                b.nnodes * sizeof(*b.nodes) +
+                b.nattrs * sizeof(*b.attrs) + b.nstrings));
+    }
+
+  free (tmp);
+  free (file);
+  free (b.files);
+  free (b.nodes);
+  free (b.attrs);
+  free (b.strings);
+  free (b.hash);
+  return ok;
+}
+
+#endif /* HAVE_GTK -- whole file */
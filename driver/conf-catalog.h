@@ -0,0 +1,41 @@
+/* conf-catalog.h --- all of the hacks' XML settings files, in one file.
+ * xscreensaver, Copyright © 2026 Jamie Zawinski <jwz@jwz.org>
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+#ifndef _CONF_CATALOG_H_
+#define _CONF_CATALOG_H_
+
+/* The name of the catalog file, in the same directory as the XML files. */
+#define CONF_CATALOG_FILE "xscreensaver.catalog"
+
+typedef struct conf_catalog conf_catalog;
+
+/* Maps the catalog in the given directory.  Returns 0 if there is no
+   catalog, or if it is unreadable.
+ */
+extern conf_catalog *conf_catalog_open (const char *dir, int verbose_p);
+extern void conf_catalog_close (conf_catalog *);
+
+/* Returns a newly-allocated copy of the document that was in the XML file
+   with the given name, or 0 if that file is not in the catalog, or has
+   been changed or removed since the catalog was built.  The name is looked up without its
+   directory part, but the file itself is what is checked for changes.
+   The document contains the <screensaver> element and everything below
+   it, except comments.
+ */
+extern xmlDocPtr conf_catalog_doc (conf_catalog *, const char *xml_file);
+
+/* Parses every .xml file in the directory, and writes the catalog there.
+   Returns 0 on failure.
+ */
+extern int conf_catalog_compile (const char *dir);
+
+#endif /* _CONF_CATALOG_H_ */
@@ -48,6 +48,7 @@
 
 #include "blurb.h"
 #include "demo-Gtk-conf.h"
+#include "conf-catalog.h"
 
 /* Deal with deprecation of direct access to struct fields on the way to GTK3
    See http://live.gnome.org/GnomeGoals/UseGseal
@@ -1916,6 +1917,69 @@ hack_xml_file (const char *program)
 }
 
 
+/* Returns the parsed contents of the file, or 0.  If the catalog of all
+   of the XML files is installed and up to date, it comes from that instead
+   of from the file itself.
+ */
+static xmlDocPtr
+read_hack_xml (const char *file, gboolean verbose_p)
+{
+  static conf_catalog *catalog = 0;
+  static gboolean catalog_tried_p = FALSE;
+  int res, size = 1024;
+  char chars[1024];
+  xmlParserCtxtPtr ctxt;
+  xmlDocPtr doc;
+  FILE *f;
+
+  if (!catalog_tried_p)
+    {
+      catalog_tried_p = TRUE;
+      if (*HACK_CONFIGURATION_PATH)
+        catalog = conf_catalog_open (HACK_CONFIGURATION_PATH, verbose_p);
+    }
+
+  doc = conf_catalog_doc (catalog, file);
+  if (doc) return doc;
+
+  f = fopen (file, "r");
+  if (!f)
+    {
+      if (verbose_p)
+        fprintf (stderr, "%s: %s does not exist.\n", blurb(), file);
+      return 0;
+    }
+
+  if (verbose_p)
+    fprintf (stderr, "%s: reading %s...\n", blurb(), file);
+
+  res = fread (chars, 1, 4, f);
+  if (res <= 0)
+    {
+      fclose (f);
+      return 0;
+    }
+
+  ctxt = xmlCreatePushParserCtxt (NULL, NULL, chars, res, file);
+  while ((res = fread(chars, 1, size, f)) > 0)
+    xmlParseChunk (ctxt, chars, res, 0);
+  xmlParseChunk (ctxt, chars, 0, 1);
+  doc = ctxt->myDoc;
+  xmlFreeParserCtxt (ctxt);
+  fclose (f);
+  return doc;
+}
+
+
+/* Writes the catalog of the XML files in the directory.
+ */
+gboolean
+compile_conf_catalog (const char *dir)
+{
+  return conf_catalog_compile (dir) ? TRUE : FALSE;
+}
+
+
 /* External interface.
  */
 
@@ -1927,36 +1991,13 @@ load_configurator_1 (const char *program, const char *arguments,
 {
   conf_data *data = (conf_data *) calloc (1, sizeof(*data));
   char *file = hack_xml_file (program);
-  FILE *f = file ? fopen (file, "r") : 0;
+  xmlDocPtr doc = file ? read_hack_xml (file, verbose_p) : 0;
 
-  if (f)
+  if (doc)
     {
-      int res, size = 1024;
-      char chars[1024];
-      xmlParserCtxtPtr ctxt;
-      xmlDocPtr doc = 0;
       GtkWidget *vbox0;
       GList *parms;
 
-      if (verbose_p)
-        fprintf (stderr, "%s: reading %s...\n", blurb(), file);
-
-      res = fread (chars, 1, 4, f);
-      if (res <= 0)
-        {
-          free (data);
-          data = 0;
-          goto DONE;
-        }
-
-      ctxt = xmlCreatePushParserCtxt(NULL, NULL, chars, res, file);
-      while ((res = fread(chars, 1, size, f)) > 0)
-        xmlParseChunk (ctxt, chars, res, 0);
-      xmlParseChunk (ctxt, chars, 0, 1);
-      doc = ctxt->myDoc;
-      xmlFreeParserCtxt (ctxt);
-      fclose (f);
-
       /* Parsed the XML file.  Now make some widgets. */
 
       vbox0 = gtk_box_new (GTK_ORIENTATION_VERTICAL, 0);
@@ -1979,12 +2020,7 @@ load_configurator_1 (const char *program, const char *arguments,
     }
   else
     {
-      parameter *p;
-
-      if (verbose_p)
-        fprintf (stderr, "%s: %s does not exist.\n", blurb(), file);
-
-      p = calloc (1, sizeof(*p));
+      parameter *p = calloc (1, sizeof(*p));
       p->type = COMMAND;
       p->arg = (xmlChar *) strdup (arguments);
 
@@ -1993,8 +2029,7 @@ load_configurator_1 (const char *program, const char *arguments,
 
   data->progname = strdup (program);
 
- DONE:
-  free (file);
+  if (file) free (file);
   return data;
 }
 
@@ -2114,10 +2149,6 @@ load_description (const char *program)
 {
   char *prog, *args;
   char *file;
-  FILE *f;
-  int res, size = 1024;
-  char chars[1024];
-  xmlParserCtxtPtr ctxt;
   xmlDocPtr doc = 0;
   xmlNodePtr node;
   const char *name = 0, *desc = 0;
@@ -2126,23 +2157,8 @@ load_description (const char *program)
   file = hack_xml_file (prog);
 
   if (!file) goto DONE;
-  f = fopen (file, "r");
-  if (!f) goto DONE;
-
-  if (verbose_p)
-    fprintf (stderr, "%s: reading %s...\n", blurb(), file);
-
-  res = fread (chars, 1, 4, f);
-  if (res <= 0)
-    goto DONE;
-
-  ctxt = xmlCreatePushParserCtxt (NULL, NULL, chars, res, file);
-  while ((res = fread(chars, 1, size, f)) > 0)
-    xmlParseChunk (ctxt, chars, res, 0);
-  xmlParseChunk (ctxt, chars, 0, 1);
-  doc = ctxt->myDoc;
-  xmlFreeParserCtxt (ctxt);
-  fclose (f);
+  doc = read_hack_xml (file, verbose_p);
+  if (!doc) goto DONE;
 
   for (node = doc->xmlRootNode; node; node = node->next)
     if (!strcmp ((char *) node->name, "screensaver"))
@@ -32,6 +32,7 @@ extern char *get_configurator_command_line (conf_data *, gboolean default_p);
 extern void  set_configurator_command_line (conf_data *, const char *cmd_line);
 extern void free_conf_data (conf_data *);
 extern char *load_description (const char *program);
+extern gboolean compile_conf_catalog (const char *dir);
 
 /* Referenced from demo.ui and prefs.ui; defined in demo-Gtk.c.
  */
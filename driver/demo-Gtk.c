@@ -114,6 +114,18 @@ static int mode_menu_order[] = {
 enum { COL_ENABLED, COL_NAME, COL_LAST };
 typedef enum { D_NONE, D_LAUNCH, D_GNOME, D_KDE } dialog_button;
 
+/* The last frame drawn by a recent preview, to show while that hack is
+   starting up again. */
+typedef struct {
+  char *name;			/* program name, without directory or args */
+  Pixmap pixmap;
+  int width, height, depth;
+  unsigned long used;		/* for discarding the least recently used */
+  Bool poster_p;		/* loaded from a file, not from a preview */
+} still_frame;
+
+#define STILL_FRAMES 16
+
 
 typedef struct {
 
@@ -148,6 +160,13 @@ typedef struct {
   char *running_preview_cmd;	/* subprocess we are currently running */
   pid_t running_preview_pid;	/* pid of forked subproc (might be dead) */
   Bool running_preview_error_p;	/* whether the pid died abnormally */
+  gint64 running_preview_start;	/* when it was forked */
+  pid_t dying_preview_pid;	/* killed, but has not yet exited */
+  int dying_preview_ticks;	/* how long we have been waiting for it */
+
+  Bool still_frames_p;		/* whether to save and show still frames */
+  still_frame still_frames[STILL_FRAMES];
+  unsigned long still_frames_clock;
 
   Bool preview_suppressed_p;	/* flag meaning "don't launch subproc" */
   int subproc_timer_id;		/* timer to delay subproc launch */
@@ -186,6 +205,7 @@ G_DECLARE_FINAL_TYPE (XScreenSaverApp, xscreensaver_app, XSCREENSAVER, APP,
 struct _XScreenSaverApp {
   GtkApplication parent;
   Bool cmdline_debug_p;
+  Bool cmdline_no_still_frames_p;
 };
 
 
@@ -3517,24 +3537,30 @@ fix_preview_visual (state *s)
 /* Subprocesses
  */
 
+/* The program name from the command line, without directory or args. */
+static char *
+preview_program_name (const char *cmd)
+{
+  char *ps = strdup (cmd);
+  char *ss = strchr (ps, ' ');
+  if (ss) *ss = 0;
+  ss = strrchr (ps, '/');
+  if (!ss)
+    ss = ps;
+  else
+    {
+      ss = strdup (ss+1);
+      free (ps);
+    }
+  return ss;
+}
+
+
 static char *
 subproc_pretty_name (state *s)
 {
   if (s->running_preview_cmd)
-    {
-      char *ps = strdup (s->running_preview_cmd);
-      char *ss = strchr (ps, ' ');
-      if (ss) *ss = 0;
-      ss = strrchr (ps, '/');
-      if (!ss)
-        ss = ps;
-      else
-        {
-          ss = strdup (ss+1);
-          free (ps);
-        }
-      return ss;
-    }
+    return preview_program_name (s->running_preview_cmd);
   else
     return strdup ("???");
 }
@@ -3547,6 +3573,8 @@ reap_zombies (state *s)
   pid_t pid;
   while ((pid = waitpid (-1, &wait_status, WNOHANG|WUNTRACED)) > 0)
     {
+      if (pid == s->dying_preview_pid)
+        s->dying_preview_pid = 0;
       if (s->debug_p)
         {
           if (pid == s->running_preview_pid)
@@ -3689,9 +3717,271 @@ get_best_gl_visual (state *s)
 }
 
 
+/* Returns the saved frame of the given program, or 0.  If create_p, and
+   there isn't one, returns an empty slot for it, discarding the least
+   recently used one if all are full.
+ */
+static still_frame *
+find_still_frame (state *s, const char *name, Bool create_p)
+{
+  still_frame *oldest = &s->still_frames[0];
+  int i;
+
+  for (i = 0; i < STILL_FRAMES; i++)
+    {
+      still_frame *f = &s->still_frames[i];
+      if (f->name && !strcmp (f->name, name))
+        {
+          f->used = ++s->still_frames_clock;
+          return f;
+        }
+      if (f->used < oldest->used)
+        oldest = f;
+    }
+
+  if (! create_p) return 0;
+
+  if (oldest->pixmap) XFreePixmap (s->dpy, oldest->pixmap);
+  if (oldest->name) free (oldest->name);
+  memset (oldest, 0, sizeof(*oldest));
+  oldest->name = strdup (name);
+  oldest->used = ++s->still_frames_clock;
+  return oldest;
+}
+
+
+/* Copies the contents of the preview window, before killing the hack
+   that is drawing in it, so that if that hack is selected again, we
+   have something to show immediately.
+ */
+static void
+save_still_frame (state *s, Window id)
+{
+  XWindowAttributes xgwa;
+  still_frame *f;
+  char *name;
+  GC gc;
+
+  if (!s->still_frames_p || !id || s->running_preview_error_p)
+    return;
+
+  /* Don't bother if it hasn't been running long enough to draw anything. */
+  if (g_get_monotonic_time() - s->running_preview_start < 1000000)
+    return;
+
+  XGetWindowAttributes (s->dpy, id, &xgwa);
+  if (xgwa.map_state != IsViewable)
+    return;
+
+  name = subproc_pretty_name (s);
+  f = find_still_frame (s, name, TRUE);
+  free (name);
+
+  if (f->pixmap &&
+      (f->width  != xgwa.width ||
+       f->height != xgwa.height ||
+       f->depth  != xgwa.depth))
+    {
+      XFreePixmap (s->dpy, f->pixmap);
+      f->pixmap = 0;
+    }
+
+  if (! f->pixmap)
+    {
+      f->pixmap = XCreatePixmap (s->dpy, id, xgwa.width, xgwa.height,
+                                 xgwa.depth);
+      f->width  = xgwa.width;
+      f->height = xgwa.height;
+      f->depth  = xgwa.depth;
+    }
+
+  f->poster_p = FALSE;
+  gc = XCreateGC (s->dpy, f->pixmap, 0, 0);
+  XCopyArea (s->dpy, id, f->pixmap, gc, 0, 0, f->width, f->height, 0, 0);
+  XFreeGC (s->dpy, gc);
+}
+
+
+/* Converts an 8-bit color component to its bits in a TrueColor pixel. */
+static unsigned long
+scale_to_mask (unsigned long c, unsigned long mask)
+{
+  int shift = 0, bits = 0;
+  if (!mask) return 0;
+  while (! (mask & 1)) { mask >>= 1; shift++; }
+  while (mask & 1)     { mask >>= 1; bits++;  }
+  c = (bits >= 8 ? c << (bits - 8) : c >> (8 - bits));
+  return c << shift;
+}
+
+
+/* Loads the poster frame of the program that "make previews" wrote,
+   if it has been installed, scaled to the size of the window.  This is
+   what we show the first time a hack is previewed.
+ */
+static still_frame *
+load_poster_frame (state *s, Window id, const char *name,
+                   const XWindowAttributes *xgwa)
+{
+  const char *dir = HACK_CONFIGURATION_PATH;
+  Visual *v = xgwa->visual;
+  int w = 0, h = 0, maxval = 0;
+  unsigned char *rgb = 0;
+  XImage *image = 0;
+  still_frame *f = 0;
+  char *file;
+  FILE *in;
+  int x, y;
+  GC gc;
+
+  if (!*dir || v->class != TrueColor ||
+      xgwa->width <= 0 || xgwa->height <= 0)
+    return 0;
+
+  file = (char *) malloc (strlen (dir) + strlen (name) + 20);
+  sprintf (file, "%s/previews/%s.ppm", dir, name);
+  in = fopen (file, "rb");
+  free (file);
+  if (!in) return 0;
+
+  /* A single whitespace character follows the header. */
+  if (fscanf (in, "P6 %d %d %d", &w, &h, &maxval) != 3 ||
+      fgetc (in) == EOF ||
+      w <= 0 || h <= 0 || w > 4096 || h > 4096 || maxval != 255)
+    goto DONE;
+
+  rgb = (unsigned char *) malloc (w * h * 3);
+  if (!rgb || fread (rgb, 3, w * h, in) != (size_t) (w * h))
+    goto DONE;
+
+  image = XCreateImage (s->dpy, v, xgwa->depth, ZPixmap, 0, 0,
+                        xgwa->width, xgwa->height, 32, 0);
+  if (!image) goto DONE;
+  image->data = (char *) malloc (image->bytes_per_line * image->height);
+  if (!image->data) goto DONE;
+
+  for (y = 0; y < xgwa->height; y++)
+    {
+      const unsigned char *row = rgb + (y * h / xgwa->height) * w * 3;
+      for (x = 0; x < xgwa->width; x++)
+        {
+          const unsigned char *p = row + (x * w / xgwa->width) * 3;
+          XPutPixel (image, x, y,
+                     scale_to_mask (p[0], v->red_mask)   |
+                     scale_to_mask (p[1], v->green_mask) |
+                     scale_to_mask (p[2], v->blue_mask));
+        }
+    }
+
+  f = find_still_frame (s, name, TRUE);
+  if (f->pixmap) XFreePixmap (s->dpy, f->pixmap);
+  f->width  = xgwa->width;
+  f->height = xgwa->height;
+  f->depth  = xgwa->depth;
+  f->poster_p = TRUE;
+  f->pixmap = XCreatePixmap (s->dpy, id, f->width, f->height, f->depth);
+  gc = XCreateGC (s->dpy, f->pixmap, 0, 0);
+  XPutImage (s->dpy, f->pixmap, gc, image, 0, 0, 0, 0, f->width, f->height);
+  XFreeGC (s->dpy, gc);
+
+ DONE:
+  fclose (in);
+  if (rgb) free (rgb);
+  if (image) XDestroyImage (image);
+  return f;
+}
+
+
+/* If we have a saved frame of this program at this size, draw it into
+   the new preview window while the program is starting up.
+ */
+static void
+draw_still_frame (state *s, Window id, const char *cmd)
+{
+  XWindowAttributes xgwa;
+  still_frame *f;
+  char *name;
+  GC gc;
+
+  if (!s->still_frames_p || !id)
+    return;
+
+  XGetWindowAttributes (s->dpy, id, &xgwa);
+
+  name = preview_program_name (cmd);
+  f = find_still_frame (s, name, FALSE);
+  if (!f || !f->pixmap ||
+      (f->poster_p && (f->width != xgwa.width || f->height != xgwa.height)))
+    f = load_poster_frame (s, id, name, &xgwa);
+  free (name);
+  if (!f || !f->pixmap)
+    return;
+
+  if (f->width  != xgwa.width ||
+      f->height != xgwa.height ||
+      f->depth  != xgwa.depth)
+    return;
+
+  if (s->debug_p)
+    fprintf (stderr, "%s: showing still frame of %s\n", blurb(), f->name);
+
+  gc = XCreateGC (s->dpy, id, 0, 0);
+  XCopyArea (s->dpy, f->pixmap, id, gc, 0, 0, f->width, f->height, 0, 0);
+  XFreeGC (s->dpy, gc);
+  XFlush (s->dpy);
+}
+
+
+/* Whether a preview that we have killed has not exited yet.  We don't
+   start another one until it has, so that there is only ever one of
+   them drawing on the window, and one of them using the GPU.  If it is
+   ignoring SIGTERM, it gets SIGKILL; if even that doesn't work, we
+   give up on it.
+ */
+#define PREVIEW_POLL_MS    100
+#define PREVIEW_KILL_TICKS (2000 / PREVIEW_POLL_MS)
+
+static Bool
+preview_dying_p (state *s)
+{
+  reap_zombies (s);
+  if (! s->dying_preview_pid)
+    return FALSE;
+
+  s->dying_preview_ticks++;
+  if (s->dying_preview_ticks == PREVIEW_KILL_TICKS)
+    {
+      if (s->debug_p)
+        fprintf (stderr, "%s: pid %lu won't die: SIGKILL\n", blurb(),
+                 (unsigned long) s->dying_preview_pid);
+      kill (s->dying_preview_pid, SIGKILL);
+    }
+  else if (s->dying_preview_ticks >= PREVIEW_KILL_TICKS * 2)
+    {
+      if (s->debug_p)
+        fprintf (stderr, "%s: pid %lu still hasn't died: ignoring it\n",
+                 blurb(), (unsigned long) s->dying_preview_pid);
+      s->dying_preview_pid = 0;
+      return FALSE;
+    }
+  return TRUE;
+}
+
+
+/* Sends SIGTERM to the running preview, if any.  This does not wait for
+   it to exit: preview_dying_p() says whether it has.
+ */
 static void
 kill_preview_subproc (state *s, Bool reset_p)
 {
+  if (s->running_preview_pid && s->dpy && s->backend != WAYLAND_BACKEND)
+    {
+      XScreenSaverWindow *win = XSCREENSAVER_WINDOW (s->window);
+      GdkWindow *window = gtk_widget_get_window (win->preview);
+      if (window)
+        save_still_frame (s, gdk_x11_window_get_xid (window));
+    }
+
   s->running_preview_error_p = FALSE;
 
   reap_zombies (s);
@@ -3725,13 +4015,14 @@ kill_preview_subproc (state *s, Bool reset_p)
               perror (buf);
             }
         }
-      else {
-	int endstatus;
-	waitpid(s->running_preview_pid, &endstatus, 0);
-	if (s->debug_p)
-	  fprintf (stderr, "%s: killed pid %lu (%s)\n", blurb(),
-		   (unsigned long) s->running_preview_pid, ss);
-      }
+      else
+        {
+          s->dying_preview_pid = s->running_preview_pid;
+          s->dying_preview_ticks = 0;
+          if (s->debug_p)
+            fprintf (stderr, "%s: killed pid %lu (%s)\n", blurb(),
+                     (unsigned long) s->running_preview_pid, ss);
+        }
 
       free (ss);
       s->running_preview_pid = 0;
@@ -3803,6 +4094,9 @@ launch_preview_subproc (state *s)
   if (id && s->screenshot)
     screenshot_save (s->dpy, id, s->screenshot);
 
+  if (id)
+    draw_still_frame (s, id, cmd);
+
   kill_preview_subproc (s, FALSE);
   if (! new_cmd)
     {
@@ -3851,6 +4145,7 @@ launch_preview_subproc (state *s)
         if (s->running_preview_cmd) free (s->running_preview_cmd);
         s->running_preview_cmd = strdup (s->desired_preview_cmd);
         s->running_preview_pid = forked;
+        s->running_preview_start = g_get_monotonic_time();
 
         if (s->debug_p)
           {
@@ -3953,19 +4248,31 @@ hack_subproc_environment (Window preview_window_id, Bool debug_p)
 
 /* Called from a timer:
    Launches the currently-chosen subprocess, if it's not already running.
-   If there's a different process running, kills it.
+   If there's a different process running, kills it, and comes back
+   when it has exited.
  */
 static int
 update_subproc_timer (gpointer data)
 {
   state *s = (state *) data;
+  s->subproc_timer_id = 0;
+
   if (! s->desired_preview_cmd)
     kill_preview_subproc (s, TRUE);
-  else if (!s->running_preview_cmd ||
-           !!strcmp (s->desired_preview_cmd, s->running_preview_cmd))
-    launch_preview_subproc (s);
+  else if (s->running_preview_cmd &&
+           !strcmp (s->desired_preview_cmd, s->running_preview_cmd))
+    ;  /* Already running it. */
+  else
+    {
+      if (s->running_preview_pid)
+        kill_preview_subproc (s, FALSE);
+      if (preview_dying_p (s))
+        s->subproc_timer_id =
+          g_timeout_add (PREVIEW_POLL_MS, update_subproc_timer, s);
+      else
+        launch_preview_subproc (s);
+    }
 
-  s->subproc_timer_id = 0;
   return FALSE;  /* do not re-execute timer */
 }
 
@@ -3974,12 +4281,23 @@ update_subproc_timer (gpointer data)
    It will set a timer that will actually launch that program a second
    from now, if you haven't changed your mind (to avoid double-click
    spazzing, etc.)  `cmd' may be null meaning "no process".
+
+   Each call pushes the launch back, so dragging a slider or holding
+   down an arrow key in the list runs nothing until it stops.  Asking
+   for the same thing again doesn't, so that redundant change callbacks
+   don't keep postponing it.
  */
 static void
 schedule_preview (state *s, const char *cmd)
 {
   int delay = 1000 * 0.5;   /* 1/2 second hysteresis */
 
+  if (s->subproc_timer_id &&
+      (cmd && s->desired_preview_cmd
+       ? !strcmp (cmd, s->desired_preview_cmd)
+       : cmd == s->desired_preview_cmd))
+    return;
+
   if (s->debug_p)
     {
       if (cmd)
@@ -5657,6 +5975,8 @@ xscreensaver_app_activate (GApplication *app)
   XScreenSaverWindow *win =
     g_object_new (XSCREENSAVER_WINDOW_TYPE, "application", app, NULL);
   win->state.debug_p = XSCREENSAVER_APP (app)->cmdline_debug_p;
+  win->state.still_frames_p =
+    !XSCREENSAVER_APP (app)->cmdline_no_still_frames_p;
   gtk_widget_show_all (GTK_WIDGET (win));
   gtk_window_present (GTK_WINDOW (win));
 }
@@ -5678,6 +5998,9 @@ xscreensaver_app_open (GApplication *app,
 static int
 opts_cb (GApplication *app, GVariantDict *opts, gpointer data)
 {
+  if (g_variant_dict_contains (opts, "no-still-frames"))
+    XSCREENSAVER_APP (app)->cmdline_no_still_frames_p = TRUE;
+
   if (g_variant_dict_contains (opts, "version")) {
     fprintf (stderr, "%s\n", screensaver_id+4);
     return 0;
@@ -5714,6 +6037,11 @@ xscreensaver_app_new (void)
                                  G_OPTION_FLAG_NONE, G_OPTION_ARG_NONE,
                                  "Print diagnostics to stderr",
                                  NULL);
+  g_application_add_main_option (G_APPLICATION (app), "no-still-frames", 0,
+                                 G_OPTION_FLAG_NONE, G_OPTION_ARG_NONE,
+                                 "Don't show the last frame of a preview "
+                                 "while restarting it",
+                                 NULL);
   g_signal_connect (app, "handle-local-options", G_CALLBACK (opts_cb), app);
 
   /* If we are under Wayland, tell GDK to use XWayland as the backend rather
@@ -5743,6 +6071,11 @@ main (int argc, char *argv[])
   bind_textdomain_codeset (GETTEXT_PACKAGE, "UTF-8");
 # endif /* ENABLE_NLS */
 
+  /* "make install" runs this after installing the hacks' XML files, to
+     pack them all into one file that loads faster. */
+  if (argc == 3 && !strcmp (argv[1], "--compile-catalog"))
+    return compile_conf_catalog (argv[2]) ? 0 : 1;
+
   return g_application_run (G_APPLICATION (xscreensaver_app_new()),
                             argc, argv);
 }
@@ -1525,6 +1525,8 @@ typedef struct {
   XImage *intermediate;
   GC gc;
 # else /* USE_GL */
+  Screen *screen;
+  XShmSegmentInfo shm_info;
   GLuint texid;
   GLfloat texw, texh;
 #  ifdef HAVE_EGL
@@ -1537,6 +1539,7 @@ typedef struct {
 
 
 #ifdef USE_GL
+static int opengl_load_screenshot (Display *, xshm_fade_info *);
 static int opengl_whack (Display *, xshm_fade_info *, float ratio);
 #else
 static int xshm_whack (Display *, XShmSegmentInfo *,
@@ -1793,14 +1796,13 @@ xshm_fade (XtAppContext app, Display *dpy,
 # endif /* !USE_GL */
 
 # ifdef USE_GL
+      /* This is read back from the screenshot pixmap, so it has the
+         pixmap's depth and visual rather than the GL visual. */
+      info[screen].screen = xgwa.screen;
       info[screen].src =
-        XCreateImage (dpy, visual, 32, ZPixmap, 0, NULL,
-                      xgwa.width, xgwa.height, 32, 0);
+        create_xshm_image (dpy, xgwa.visual, xgwa.depth, ZPixmap,
+                           &info[screen].shm_info, xgwa.width, xgwa.height);
       if (!info[screen].src) goto FAIL;
-      info[screen].src->data = (char *)
-        malloc (info[screen].src->height * info[screen].src->bytes_per_line);
-      info[screen].src->bitmap_bit_order =
-        info[screen].src->byte_order = MSBFirst;
 
       while (glGetError() != GL_NO_ERROR)
         ;  /* Flush */
@@ -1844,79 +1846,7 @@ xshm_fade (XtAppContext app, Display *dpy,
       /* XSelectInput (dpy, info[screen].window,
                        KeyPressMask | ButtonPressMask); */
 
-# ifdef USE_GL
-#  ifndef HAVE_JWZGLES
-      /* Copy the screenshot pixmap to the texture XImage */
-      XGetSubImage (dpy, info[screen].screenshot,
-                    0, 0, xgwa.width, xgwa.height,
-                    ~0L, ZPixmap, info[screen].src, 0, 0);
-
-      /* Convert 0RGB to RGBA */
-      {
-        XImage *ximage = info[screen].src;
-        int x, y;
-        for (y = 0; y < ximage->height; y++)
-          for (x = 0; x < ximage->width; x++)
-            {
-              unsigned long p = XGetPixel (ximage, x, y);
-              unsigned long a = 0xFF;
-           /* unsigned long a = (p >> 24) & 0xFF; */
-              unsigned long r = (p >> 16) & 0xFF;
-              unsigned long g = (p >>  8) & 0xFF;
-              unsigned long b = (p >>  0) & 0xFF;
-              p = (r << 24) | (g << 16) | (b << 8) | (a << 0);
-              XPutPixel (ximage, x, y, p);
-            }
-      }
-
-      /* Connect the window to an OpenGL context */
-      info[screen].glx_context =
-        openGL_context_for_window (xgwa.screen, info[screen].window);
-      if (!info[screen].glx_context) goto FAIL;
-      opengl_make_current (dpy, &info[screen]);
-      if (check_gl_error ("connect")) goto FAIL;
-
-      glEnable (GL_TEXTURE_2D);
-      glEnable (GL_NORMALIZE);
-      glGenTextures (1, &info[screen].texid);
-      glBindTexture (GL_TEXTURE_2D, info[screen].texid);
-      glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-      glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-      glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-      glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-      glTexEnvi (GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-      glPixelStorei (GL_UNPACK_ALIGNMENT, 1);
-      if (check_gl_error ("bind texture")) goto FAIL;
-
-      {
-        int tex_width  = (GLsizei) to_pow2 (info[screen].src->width);
-        int tex_height = (GLsizei) to_pow2 (info[screen].src->height);
-        /* Create power of 2 empty texture */
-        glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA, tex_width, tex_height, 0,
-                      GL_RGBA, GL_UNSIGNED_BYTE, 0);
-        if (check_gl_error ("glTexImage2D")) goto FAIL;
-        /* Load our non-power-of-2 image data into it. */
-        glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0,
-                         info[screen].src->width, info[screen].src->height,
-                           GL_RGBA, GL_UNSIGNED_BYTE, info[screen].src->data);
-        if (check_gl_error ("glTexSubImage2D")) goto FAIL;
-        info[screen].texw = info[screen].src->width  / (GLfloat) tex_width;
-        info[screen].texh = info[screen].src->height / (GLfloat) tex_height;
-      }
-
-      glViewport (0, 0, xgwa.width, xgwa.height);
-      glMatrixMode(GL_PROJECTION);
-      glLoadIdentity();
-      glOrtho (0, 1, 1, 0, -1, 1);
-      glMatrixMode (GL_MODELVIEW);
-      glLoadIdentity();
-      glClearColor (0, 0, 0, 1);
-      glClear (GL_COLOR_BUFFER_BIT);
-      glFrontFace (GL_CCW);
-      if (check_gl_error ("GL setup")) goto FAIL;
-
-#  endif /* !HAVE_JWZGLES */
-# else /* !USE_GL */
+# ifndef USE_GL
       /* Copy the screenshot pixmap to the source image */
       if (! get_xshm_image (dpy, info[screen].screenshot, info[screen].src,
                             0, 0, ~0L, &shm_info))
@@ -1927,6 +1857,16 @@ xshm_fade (XtAppContext app, Display *dpy,
 # endif /* !USE_GL */
     }
 
+# ifdef USE_GL
+  /* The screenshots of every screen have now been requested without
+     waiting for any of them.  Wait once, then read each one back and turn
+     it into a texture. */
+  XSync (dpy, False);
+  for (screen = 0; screen < nwindows; screen++)
+    if (opengl_load_screenshot (dpy, &info[screen]))
+      goto FAIL;
+# endif /* USE_GL */
+
   /* If we're fading out from the desktop, save our screen shots for later use.
      But not if we're fading out from the savers to black.  In that case we
      don't want to overwrite the desktop screenshot with the current screenshot
@@ -2060,7 +2000,8 @@ xshm_fade (XtAppContext app, Display *dpy,
         {
 # ifdef USE_GL
           if (info[screen].src)
-            XDestroyImage (info[screen].src);
+            destroy_xshm_image (dpy, info[screen].src,
+                                &info[screen].shm_info);
           if (info[screen].texid)
             glDeleteTextures (1, &info[screen].texid);
           if (info[screen].glx_context)
@@ -2111,6 +2052,163 @@ xshm_fade (XtAppContext app, Display *dpy,
 
 #ifdef USE_GL
 
+#ifndef HAVE_JWZGLES
+
+/* Whether the XImage's pixels are already laid out the way GL wants
+   GL_BGRA / GL_UNSIGNED_INT_8_8_8_8_REV: 0xXXRRGGBB in host byte order.
+   This is the case for nearly every 24 and 32 bit TrueColor visual.
+ */
+static Bool
+bgra_ximage_p (XImage *image)
+{
+  union { int i; char c[sizeof(int)]; } u;
+  u.i = 1;
+  return (image->bits_per_pixel == 32 &&
+          image->red_mask   == 0xFF0000 &&
+          image->green_mask == 0x00FF00 &&
+          image->blue_mask  == 0x0000FF &&
+          image->byte_order == (u.c[0] ? LSBFirst : MSBFirst));
+}
+
+
+static Bool
+npot_textures_p (void)
+{
+  const char *ver = (const char *) glGetString (GL_VERSION);
+  const char *ext = (const char *) glGetString (GL_EXTENSIONS);
+  return ((ver && atof (ver) >= 2.0) ||
+          (ext && strstr (ext, "GL_ARB_texture_non_power_of_two")));
+}
+
+#endif /* !HAVE_JWZGLES */
+
+
+/* Read the screenshot pixmap back into memory, create a GL context for
+   the fader window, and load the screenshot into a texture.  After this,
+   each frame of the fade is a single textured quad whose color is the
+   fade ratio, so the per-frame cost does not depend on how large the
+   screenshot was.
+ */
+static int
+opengl_load_screenshot (Display *dpy, xshm_fade_info *info)
+{
+# ifndef HAVE_JWZGLES
+  XImage *ximage = info->src;
+  XImage *rgba = 0;
+  int tex_width, tex_height;
+  GLenum format, type;
+  Bool status = True;
+
+  /* Over MIT-SHM the server writes the pixels straight into our memory
+     instead of sending them down the socket. */
+  if (! get_xshm_image (dpy, info->screenshot, ximage, 0, 0, ~0L,
+                        &info->shm_info))
+    return True;
+
+  if (bgra_ximage_p (ximage))
+    {
+      format = GL_BGRA;
+      type   = GL_UNSIGNED_INT_8_8_8_8_REV;
+    }
+  else
+    {
+      /* Some other visual: convert to RGBA by hand. */
+      int x, y;
+      rgba = XCreateImage (dpy, DefaultVisualOfScreen (info->screen), 32,
+                           ZPixmap, 0, NULL, ximage->width, ximage->height,
+                           32, 0);
+      if (!rgba) return True;
+      rgba->data = (char *) malloc (rgba->height * rgba->bytes_per_line);
+      if (!rgba->data) goto FAIL;
+      rgba->bitmap_bit_order = rgba->byte_order = MSBFirst;
+      for (y = 0; y < ximage->height; y++)
+        for (x = 0; x < ximage->width; x++)
+          {
+            unsigned long p = XGetPixel (ximage, x, y);
+            unsigned long a = 0xFF;
+         /* unsigned long a = (p >> 24) & 0xFF; */
+            unsigned long r = (p >> 16) & 0xFF;
+            unsigned long g = (p >>  8) & 0xFF;
+            unsigned long b = (p >>  0) & 0xFF;
+            p = (r << 24) | (g << 16) | (b << 8) | (a << 0);
+            XPutPixel (rgba, x, y, p);
+          }
+      ximage = rgba;
+      format = GL_RGBA;
+      type   = GL_UNSIGNED_BYTE;
+    }
+
+  /* Connect the window to an OpenGL context */
+  info->glx_context = openGL_context_for_window (info->screen, info->window);
+  if (!info->glx_context) goto FAIL;
+  opengl_make_current (dpy, info);
+  if (check_gl_error ("connect")) goto FAIL;
+
+  glEnable (GL_TEXTURE_2D);
+  glDisable (GL_DITHER);
+  glGenTextures (1, &info->texid);
+  glBindTexture (GL_TEXTURE_2D, info->texid);
+
+  /* The texture is drawn 1:1 with the screen, so don't bother filtering. */
+  glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexEnvi (GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+  glPixelStorei (GL_UNPACK_ALIGNMENT, 1);
+  glPixelStorei (GL_UNPACK_ROW_LENGTH,
+                 ximage->bytes_per_line / (ximage->bits_per_pixel / 8));
+  if (check_gl_error ("bind texture")) goto FAIL;
+
+  if (npot_textures_p())
+    {
+      tex_width  = ximage->width;
+      tex_height = ximage->height;
+    }
+  else
+    {
+      tex_width  = (GLsizei) to_pow2 (ximage->width);
+      tex_height = (GLsizei) to_pow2 (ximage->height);
+    }
+
+  /* Create empty texture */
+  glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA, tex_width, tex_height, 0,
+                format, type, 0);
+  if (check_gl_error ("glTexImage2D")) goto FAIL;
+  /* Load our possibly-non-power-of-2 image data into it. */
+  glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, ximage->width, ximage->height,
+                   format, type, ximage->data);
+  if (check_gl_error ("glTexSubImage2D")) goto FAIL;
+  glPixelStorei (GL_UNPACK_ROW_LENGTH, 0);
+  info->texw = ximage->width  / (GLfloat) tex_width;
+  info->texh = ximage->height / (GLfloat) tex_height;
+
+  glViewport (0, 0, ximage->width, ximage->height);
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  glOrtho (0, 1, 1, 0, -1, 1);
+  glMatrixMode (GL_MODELVIEW);
+  glLoadIdentity();
+  glClearColor (0, 0, 0, 1);
+  glClear (GL_COLOR_BUFFER_BIT);
+  glFrontFace (GL_CCW);
+  if (check_gl_error ("GL setup")) goto FAIL;
+
+  /* The texture has its own copy now. */
+  destroy_xshm_image (dpy, info->src, &info->shm_info);
+  info->src = 0;
+  status = False;
+
+ FAIL:
+  if (rgba)
+    XDestroyImage (rgba);
+  return status;
+# else /* HAVE_JWZGLES */
+  return True;
+# endif /* HAVE_JWZGLES */
+}
+
+
 static int
 opengl_whack (Display *dpy, xshm_fade_info *info, float ratio)
 {
@@ -2120,11 +2218,14 @@ opengl_whack (Display *dpy, xshm_fade_info *info, float ratio)
 
   opengl_make_current (dpy, info);
   glBindTexture (GL_TEXTURE_2D, info->texid);
-  glClear (GL_COLOR_BUFFER_BIT);
 
   if (ratio < 0) ratio = 0;
   if (ratio > 1) ratio = 1;
 
+  /* The quad covers the whole window, so there's no need to glClear first:
+     with software rendering, that would double the cost of each frame.
+     Nor glFinish: the swap does that, and with multiple screens, we'd
+     rather not wait for each one in turn. */
   glColor3f (ratio, ratio, ratio);
 
   glBegin (GL_QUADS);
@@ -2133,7 +2234,6 @@ opengl_whack (Display *dpy, xshm_fade_info *info, float ratio)
   glTexCoord2f (w, h); glVertex3f (1, 1, 0);
   glTexCoord2f (w, 0); glVertex3f (1, 0, 0);
   glEnd();
-  glFinish();
 
 # ifdef HAVE_EGL
   if (! eglSwapBuffers (info->glx_context->egl_display,
@@ -109,6 +109,7 @@ struct bsod_state {
   char word_buf[80];
   Bool scroll_p;
   Bool crop_p;                  /* If True, chops off extra text vertically */
+  Bool fast_forward_p;		/* Ignore delays until the first loop */
 
   Pixmap pixmap, mask;		/* Source image used by BSOD_PIXMAP */
 
@@ -630,13 +631,74 @@ draw_char (struct bsod_state *bst, const char *s, int char_len)
 }
 
 
+/* Draws as many ordinary characters from the front of `s' as will fit on
+   the current line, with one fill and one XftDrawStringUtf8, instead of
+   one of each per character.  Only for use when there is no delay between
+   characters.  Returns the number of bytes drawn: 0 if the first
+   character needs the special handling in draw_char.
+ */
+static int
+draw_run (struct bsod_state *bst, const char *s)
+{
+  int limit = bst->xgwa.width - bst->right_margin - bst->xoff;
+  int slen, len = 0, w = 0;
+  int x = bst->x;
+
+  if (bst->word_wrap_p ||
+      (bst->crop_p &&
+       bst->y >= bst->xgwa.height - bst->bottom_margin - bst->yoff))
+    return 0;
+
+  if (x < bst->left_margin)
+    x = bst->left_margin;
+
+  slen = strlen (s);
+  while (len < slen)
+    {
+      XGlyphInfo ov;
+      int clen;
+      if (s[len] == '\r' || s[len] == '\n' ||
+          s[len] == '\b' || s[len] == '\033')
+        break;
+      clen = utf8_decode_combining ((unsigned char *) s + len, slen - len,
+                                    NULL);
+      if (clen <= 0)
+        break;
+      XftTextExtentsUtf8 (bst->dpy, bst->font, (FcChar8 *) s + len, clen,
+                          &ov);
+      if (bst->wrap_p && x + w + ov.xOff > limit)
+        break;
+      w += ov.xOff;
+      len += clen;
+    }
+
+  if (len == 0)
+    return 0;
+
+  XSetForeground (bst->dpy, bst->gc, bst->bg);
+  XFillRectangle (bst->dpy, bst->window, bst->gc,
+                  x, bst->y - bst->font->ascent,
+                  w, bst->font->ascent + bst->font->descent);
+  XSetForeground (bst->dpy, bst->gc, bst->fg);
+  XftDrawStringUtf8 (bst->xftdraw, &bst->xft_fg, bst->font,
+                     x, bst->y, (FcChar8 *) s, len);
+  bst->x = x + w;
+  return len;
+}
+
+
 static long
 bsod_pop (struct bsod_state *bst)
 {
   bsod_event_type type = bst->queue[bst->pos].type;
 
   if (bst->draw_cb)
-    return bst->draw_cb (bst);
+    {
+      /* Animated modes never reach a LOOP or RESET event, and their
+         delays are what paces them: don't skip those. */
+      bst->fast_forward_p = False;
+      return bst->draw_cb (bst);
+    }
 
   if (bst->pos < 0)   /* already done */
     abort();
@@ -692,8 +754,15 @@ bsod_pop (struct bsod_state *bst)
       delay = (*s == '\r' || *s == '\n'
                ? bst->line_delay
                : bst->char_delay);
-      char_len = utf8_decode_combining ((unsigned char *) s, strlen (s), NULL);
-      draw_char (bst, s, char_len);
+      char_len = 0;
+      if (delay == 0 || bst->fast_forward_p)
+        char_len = draw_run (bst, s);
+      if (! char_len)
+        {
+          char_len = utf8_decode_combining ((unsigned char *) s, strlen (s),
+                                            NULL);
+          draw_char (bst, s, char_len);
+        }
       s += char_len;
       bst->queue[bst->pos].arg2 = (void *) s;
       bst->queue[bst->pos].arg3 = (void *) 1;  /* "done once" */
@@ -847,6 +916,8 @@ bsod_pop (struct bsod_state *bst)
       long count = (long) bst->queue[bst->pos].arg2;
       int ox = bst->x;
 
+      bst->fast_forward_p = False;
+
       if (type == CURSOR_BLOCK)
         {
           XGlyphInfo ov;
@@ -901,6 +972,7 @@ bsod_pop (struct bsod_state *bst)
   case LOOP:
     {
       long off = (long) bst->queue[bst->pos].arg1;
+      bst->fast_forward_p = False;
       bst->pos += off;
       if (bst->pos < 0 || bst->pos >= bst->queue_size)
         abort();
@@ -909,6 +981,7 @@ bsod_pop (struct bsod_state *bst)
   case RESET:
     {
       int i;
+      bst->fast_forward_p = False;
       for (i = 0; i < bst->queue_size; i++)
         switch (bst->queue[i].type) {
         case LEFT:   case LEFT_FULL:
@@ -7168,7 +7241,7 @@ struct driver_state {
   int mode_duration;
   int delay_remaining;
   time_t start;
-  Bool debug_p, cycle_p;
+  Bool debug_p, cycle_p, fast_forward_p;
   struct bsod_state *bst;
 };
 
@@ -7203,6 +7276,7 @@ bsod_init (Display *dpy, Window window)
   if (dst->mode_duration < 3) dst->mode_duration = 3;
 
   dst->debug_p = get_boolean_resource (dpy, "debug", "Boolean");
+  dst->fast_forward_p = get_boolean_resource (dpy, "fastForward", "Boolean");
 
   dst->only = -1;
   dst->next_one = -1;
@@ -7282,6 +7356,9 @@ bsod_draw (Display *dpy, Window window, void *closure)
       if (time_left > 0)
         this_delay = bsod_pop (dst->bst);
 
+      if (this_delay > 0 && dst->bst->fast_forward_p)
+        this_delay = 0;
+
       /* XSync (dpy, False);  slows down char drawing too much on HAVE_JWXYZ */
 
       if (this_delay == 0){
@@ -7366,6 +7443,7 @@ bsod_draw (Display *dpy, Window window, void *closure)
 
           hack_title (dst);
           dst->bst->pos = 0;
+          dst->bst->fast_forward_p = dst->fast_forward_p;
           dst->bst->x = dst->bst->current_left =
             dst->bst->left_margin + dst->bst->xoff;
 
@@ -7448,6 +7526,7 @@ bsod_free (Display *dpy, Window window, void *closure)
 static const char *bsod_defaults [] = {
   "*delay:		   45",
   "*debug:		   False",
+  "*fastForward:	   False",
 
   "*doOnly:		   ",
   "*doWindows:		   True",
@@ -7722,6 +7801,7 @@ static const XrmOptionDescRec bsod_options [] = {
   { "-delay",		".delay",		XrmoptionSepArg, 0 },
   { "-only",		".doOnly",		XrmoptionSepArg, 0 },
   { "-debug",		".debug",		XrmoptionNoArg,  "True"  },
+  { "-fast-forward",	".fastForward",		XrmoptionNoArg,  "True"  },
   { "-windows",		".doWindows",		XrmoptionNoArg,  "True"  },
   { "-no-windows",	".doWindows",		XrmoptionNoArg,  "False" },
   { "-nt",		".doNT",		XrmoptionNoArg,  "True"  },
@@ -1,96 +1,547 @@
-/* Triangulate
-   Efficient Triangulation Algorithm Suitable for Terrain Modelling
-   or
-   An Algorithm for Interpolating Irregularly-Spaced Data
-   with Applications in Terrain Modelling
-
-   Written by Paul Bourke
-   Presented at Pan Pacific Computer Conference, Beijing, China.
-   January 1989
-   Abstract
-
-   A discussion of a method that has been used with success in terrain
-   modelling to estimate the height at any point on the land surface
-   from irregularly distributed samples. The special requirements of
-   terrain modelling are discussed as well as a detailed description
-   of the algorithm and an example of its application.
-
-   http://paulbourke.net/papers/triangulate/
-   http://paulbourke.net/papers/triangulate/triangulate.c
+/* Delaunay triangulation, and the cells of its dual.
+ *
+ * The interface is that of Paul Bourke's triangulator,
+ *   "Efficient Triangulation Algorithm Suitable for Terrain Modelling",
+ *   Pan Pacific Computer Conference, Beijing, China.  January 1989.
+ *   http://paulbourke.net/papers/triangulate/
+ * which this used to be.  That compared every new point against the
+ * circumcircle of every unfinished triangle, so it took time that grew
+ * much faster than the number of points.
+ *
+ * This is incremental insertion instead, which takes O(n log n):
+ *
+ *   - The points are inserted in the order that they fall along a Hilbert
+ *     curve, so each point is usually near the one before it.
+ *   - The triangle containing each new point is found by walking across
+ *     the mesh from the triangle of the previous one.
+ *   - The containing triangle is split at the point, and then edges are
+ *     flipped outward until everything is Delaunay again (Lawson).
+ *   - The orientation and in-circle tests are done in floating point when
+ *     the result is clear, and exactly (Shewchuk's expansion arithmetic)
+ *     when it is not.  Points on a pixel grid are very often exactly
+ *     cocircular, and inexact tests can make the walk go in circles.
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
+#include <float.h>
 
 #include "delaunay.h"
 
 typedef struct {
-   int p1,p2;
-} IEDGE;
+  int v[3];	/* vertices, counterclockwise */
+  int n[3];	/* n[i] is the triangle across the edge opposite v[i] */
+} DTRI;
 
-#define TRUE 1
-#define FALSE 0
-#define EPSILON 0.000001
+typedef struct {
+  const XYZ *p;
+  DTRI *tris;
+  int ntris;
+  int *stack;
+  int nstack;
+} DSTATE;
 
-/*
-   Return TRUE if a point (xp,yp) is inside the circumcircle made up
-   of the points (x1,y1), (x2,y2), (x3,y3)
-   The circumcircle centre is returned in (xc,yc) and the radius r
-   NOTE: A point on the edge is inside the circumcircle
-*/
+
+/* Exact arithmetic.
+
+   An expansion is a sum of doubles that don't overlap, smallest first,
+   and so represents a value exactly.  See Jonathan Richard Shewchuk,
+   "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric
+   Predicates", Discrete & Computational Geometry 18:305-363, 1997.
+ */
+
+#define MAX_EXPANSION 16	/* longest input to expansion_product */
+#define EPS (DBL_EPSILON / 2)	/* relative error of one operation */
+
+static void
+two_sum (double a, double b, double *x, double *y)
+{
+  double bvirt, avirt, bround, around;
+  *x = a + b;
+  bvirt = *x - a;
+  avirt = *x - bvirt;
+  bround = b - bvirt;
+  around = a - avirt;
+  *y = around + bround;
+}
+
+static void
+fast_two_sum (double a, double b, double *x, double *y)
+{
+  double bvirt;
+  *x = a + b;
+  bvirt = *x - a;
+  *y = b - bvirt;
+}
+
+static void
+two_diff (double a, double b, double *x, double *y)
+{
+  double bvirt, avirt, bround, around;
+  *x = a - b;
+  bvirt = a - *x;
+  avirt = *x + bvirt;
+  bround = bvirt - b;
+  around = a - avirt;
+  *y = around + bround;
+}
+
+static void
+two_product (double a, double b, double *x, double *y)
+{
+  *x = a * b;
+#ifdef __FP_FAST_FMA
+  /* With a fused multiply-add, the compiler might contract the
+     splitting arithmetic below and break it; but then we don't need it. */
+  *y = fma (a, b, -*x);
+#else
+  {
+    const double splitter = 134217729.0;	/* 2^27 + 1 */
+    double c, big, ahi, alo, bhi, blo, err1, err2, err3;
+    c = splitter * a;
+    big = c - a;
+    ahi = c - big;
+    alo = a - ahi;
+    c = splitter * b;
+    big = c - b;
+    bhi = c - big;
+    blo = b - bhi;
+    err1 = *x - (ahi * bhi);
+    err2 = err1 - (alo * bhi);
+    err3 = err2 - (ahi * blo);
+    *y = (alo * blo) - err3;
+  }
+#endif
+}
+
+/* h = e * b.  h has room for 2 * elen. */
+static int
+scale_expansion (int elen, const double *e, double b, double *h)
+{
+  double Q, sum, hh, product1, product0;
+  int eindex, hindex = 0;
+
+  two_product (e[0], b, &Q, &hh);
+  if (hh != 0) h[hindex++] = hh;
+  for (eindex = 1; eindex < elen; eindex++)
+    {
+      two_product (e[eindex], b, &product1, &product0);
+      two_sum (Q, product0, &sum, &hh);
+      if (hh != 0) h[hindex++] = hh;
+      fast_two_sum (product1, sum, &Q, &hh);
+      if (hh != 0) h[hindex++] = hh;
+    }
+  if (Q != 0 || hindex == 0)
+    h[hindex++] = Q;
+  return hindex;
+}
+
+/* h = e + f.  h has room for elen + flen. */
+static int
+expansion_sum (int elen, const double *e, int flen, const double *f,
+               double *h)
+{
+  double Q, Qnew, hh, enow, fnow;
+  int eindex = 0, findex = 0, hindex = 0;
+
+# define NEXT_E() (enow = (++eindex < elen ? e[eindex] : 0))
+# define NEXT_F() (fnow = (++findex < flen ? f[findex] : 0))
+# define E_FIRST() ((fnow > enow) == (fnow > -enow))
+
+  enow = e[0];
+  fnow = f[0];
+  if (E_FIRST())
+    {
+      Q = enow;
+      NEXT_E();
+    }
+  else
+    {
+      Q = fnow;
+      NEXT_F();
+    }
+
+  if (eindex < elen && findex < flen)
+    {
+      if (E_FIRST())
+        {
+          fast_two_sum (enow, Q, &Qnew, &hh);
+          NEXT_E();
+        }
+      else
+        {
+          fast_two_sum (fnow, Q, &Qnew, &hh);
+          NEXT_F();
+        }
+      Q = Qnew;
+      if (hh != 0) h[hindex++] = hh;
+
+      while (eindex < elen && findex < flen)
+        {
+          if (E_FIRST())
+            {
+              two_sum (Q, enow, &Qnew, &hh);
+              NEXT_E();
+            }
+          else
+            {
+              two_sum (Q, fnow, &Qnew, &hh);
+              NEXT_F();
+            }
+          Q = Qnew;
+          if (hh != 0) h[hindex++] = hh;
+        }
+    }
+
+  while (eindex < elen)
+    {
+      two_sum (Q, enow, &Qnew, &hh);
+      NEXT_E();
+      Q = Qnew;
+      if (hh != 0) h[hindex++] = hh;
+    }
+  while (findex < flen)
+    {
+      two_sum (Q, fnow, &Qnew, &hh);
+      NEXT_F();
+      Q = Qnew;
+      if (hh != 0) h[hindex++] = hh;
+    }
+
+  if (Q != 0 || hindex == 0)
+    h[hindex++] = Q;
+  return hindex;
+
+# undef NEXT_E
+# undef NEXT_F
+# undef E_FIRST
+}
+
+/* h = e * f.  h and scratch each have room for 2 * elen * flen. */
 static int
-circumcircle (double xp,double yp,
-              double x1,double y1,double x2,double y2,double x3,double y3,
-              double *xc,double *yc,double *rsqr)
+expansion_product (int elen, const double *e, int flen, const double *f,
+                   double *h, double *scratch)
+{
+  double part[2 * MAX_EXPANSION];
+  int hlen, plen, i;
+
+  if (elen > MAX_EXPANSION) abort();
+  hlen = scale_expansion (elen, e, f[0], h);
+  for (i = 1; i < flen; i++)
+    {
+      plen = scale_expansion (elen, e, f[i], part);
+      hlen = expansion_sum (hlen, h, plen, part, scratch);
+      memcpy (h, scratch, hlen * sizeof(*h));
+    }
+  return hlen;
+}
+
+static void
+negate_expansion (int elen, double *e)
 {
-  double m1,m2,mx1,mx2,my1,my2;
-  double dx,dy,drsqr;
-  double fabsy1y2 = fabs(y1-y2);
-  double fabsy2y3 = fabs(y2-y3);
-
-  /* Check for coincident points */
-  if (fabsy1y2 < EPSILON && fabsy2y3 < EPSILON)
-    return(FALSE);
-
-  if (fabsy1y2 < EPSILON) {
-    m2 = - (x3-x2) / (y3-y2);
-    mx2 = (x2 + x3) / 2.0;
-    my2 = (y2 + y3) / 2.0;
-    *xc = (x2 + x1) / 2.0;
-    *yc = m2 * (*xc - mx2) + my2;
-  } else if (fabsy2y3 < EPSILON) {
-    m1 = - (x2-x1) / (y2-y1);
-    mx1 = (x1 + x2) / 2.0;
-    my1 = (y1 + y2) / 2.0;
-    *xc = (x3 + x2) / 2.0;
-    *yc = m1 * (*xc - mx1) + my1;
-  } else {
-    m1 = - (x2-x1) / (y2-y1);
-    m2 = - (x3-x2) / (y3-y2);
-    mx1 = (x1 + x2) / 2.0;
-    mx2 = (x2 + x3) / 2.0;
-    my1 = (y1 + y2) / 2.0;
-    my2 = (y2 + y3) / 2.0;
-    *xc = (m1 * mx1 - m2 * mx2 + my2 - my1) / (m1 - m2);
-    if (fabsy1y2 > fabsy2y3) {
-      *yc = m1 * (*xc - mx1) + my1;
-    } else {
-      *yc = m2 * (*xc - mx2) + my2;
+  int i;
+  for (i = 0; i < elen; i++)
+    e[i] = -e[i];
+}
+
+/* x*y - z*w, where each is a two-term expansion.  h has room for 16. */
+static int
+cross_expansion (const double *x, const double *y,
+                 const double *z, const double *w, double *h)
+{
+  double a[8], b[8], scratch[8];
+  int alen = expansion_product (2, x, 2, y, a, scratch);
+  int blen = expansion_product (2, z, 2, w, b, scratch);
+  negate_expansion (blen, b);
+  return expansion_sum (alen, a, blen, b, h);
+}
+
+
+/* Positive if a, b, c are counterclockwise; negative if clockwise;
+   zero if collinear.
+ */
+static double
+orient2d (const XYZ *a, const XYZ *b, const XYZ *c)
+{
+  static const double errbound = (3.0 + 16.0 * EPS) * EPS;
+  double detleft  = (a->x - c->x) * (b->y - c->y);
+  double detright = (a->y - c->y) * (b->x - c->x);
+  double det = detleft - detright;
+  double detsum;
+
+  if (detleft > 0)
+    {
+      if (detright <= 0) return det;
+      detsum = detleft + detright;
     }
+  else if (detleft < 0)
+    {
+      if (detright >= 0) return det;
+      detsum = -detleft - detright;
+    }
+  else
+    return det;
+
+  if (det >= errbound * detsum || -det >= errbound * detsum)
+    return det;
+
+  {
+    double acx[2], acy[2], bcx[2], bcy[2], h[16];
+    int hlen;
+    two_diff (a->x, c->x, &acx[1], &acx[0]);
+    two_diff (a->y, c->y, &acy[1], &acy[0]);
+    two_diff (b->x, c->x, &bcx[1], &bcx[0]);
+    two_diff (b->y, c->y, &bcy[1], &bcy[0]);
+    hlen = cross_expansion (acx, bcy, acy, bcx, h);
+    return h[hlen-1];
   }
+}
+
+
+/* Positive if d is inside the circle through a, b, c, which are
+   counterclockwise; negative if outside; zero if on it.
+ */
+static double
+incircle (const XYZ *a, const XYZ *b, const XYZ *c, const XYZ *d)
+{
+  static const double errbound = (10.0 + 96.0 * EPS) * EPS;
+  double adx = a->x - d->x, ady = a->y - d->y;
+  double bdx = b->x - d->x, bdy = b->y - d->y;
+  double cdx = c->x - d->x, cdy = c->y - d->y;
+  double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+  double cdxady = cdx * ady, adxcdy = adx * cdy;
+  double adxbdy = adx * bdy, bdxady = bdx * ady;
+  double alift = adx * adx + ady * ady;
+  double blift = bdx * bdx + bdy * bdy;
+  double clift = cdx * cdx + cdy * cdy;
+  double det = (alift * (bdxcdy - cdxbdy) +
+                blift * (cdxady - adxcdy) +
+                clift * (adxbdy - bdxady));
+  double permanent = ((fabs (bdxcdy) + fabs (cdxbdy)) * alift +
+                      (fabs (cdxady) + fabs (adxcdy)) * blift +
+                      (fabs (adxbdy) + fabs (bdxady)) * clift);
+
+  if (det > errbound * permanent || -det > errbound * permanent)
+    return det;
 
-  dx = x2 - *xc;
-  dy = y2 - *yc;
-  *rsqr = dx*dx + dy*dy;
+  {
+    double ex[2], ey[2], fx[2], fy[2], gx[2], gy[2];
+    double bc[16], ca[16], ab[16];
+    double lift1[8], lift2[8], lift[16];
+    double at[512], bt[512], ct[512], abt[1024], h[1536];
+    double scratch[512];
+    int bclen, calen, ablen, l1, l2, llen, atlen, btlen, ctlen, abtlen, hlen;
 
-  dx = xp - *xc;
-  dy = yp - *yc;
-  drsqr = dx*dx + dy*dy;
+    two_diff (a->x, d->x, &ex[1], &ex[0]);
+    two_diff (a->y, d->y, &ey[1], &ey[0]);
+    two_diff (b->x, d->x, &fx[1], &fx[0]);
+    two_diff (b->y, d->y, &fy[1], &fy[0]);
+    two_diff (c->x, d->x, &gx[1], &gx[0]);
+    two_diff (c->y, d->y, &gy[1], &gy[0]);
 
-  /* Original
-     return((drsqr <= *rsqr) ? TRUE : FALSE);
-     Proposed by Chuck Morris */
-  return((drsqr - *rsqr) <= EPSILON ? TRUE : FALSE);
+    bclen = cross_expansion (fx, gy, gx, fy, bc);
+    calen = cross_expansion (gx, ey, ex, gy, ca);
+    ablen = cross_expansion (ex, fy, fx, ey, ab);
+
+    l1 = expansion_product (2, ex, 2, ex, lift1, scratch);
+    l2 = expansion_product (2, ey, 2, ey, lift2, scratch);
+    llen = expansion_sum (l1, lift1, l2, lift2, lift);
+    atlen = expansion_product (llen, lift, bclen, bc, at, scratch);
+
+    l1 = expansion_product (2, fx, 2, fx, lift1, scratch);
+    l2 = expansion_product (2, fy, 2, fy, lift2, scratch);
+    llen = expansion_sum (l1, lift1, l2, lift2, lift);
+    btlen = expansion_product (llen, lift, calen, ca, bt, scratch);
+
+    l1 = expansion_product (2, gx, 2, gx, lift1, scratch);
+    l2 = expansion_product (2, gy, 2, gy, lift2, scratch);
+    llen = expansion_sum (l1, lift1, l2, lift2, lift);
+    ctlen = expansion_product (llen, lift, ablen, ab, ct, scratch);
+
+    abtlen = expansion_sum (atlen, at, btlen, bt, abt);
+    hlen = expansion_sum (abtlen, abt, ctlen, ct, h);
+    return h[hlen-1];
+  }
+}
+
+
+/* Insertion order.
+ */
+
+typedef struct {
+  unsigned long key;
+  int i;
+} HILBERT;
+
+/* Position of (x, y) along a Hilbert curve filling a 65536 square. */
+static unsigned long
+hilbert_index (unsigned int x, unsigned int y)
+{
+  const unsigned int n = 65536;
+  unsigned long d = 0;
+  unsigned int s;
+  for (s = n/2; s > 0; s /= 2)
+    {
+      unsigned int rx = (x & s) != 0;
+      unsigned int ry = (y & s) != 0;
+      d += (unsigned long) s * s * ((3 * rx) ^ ry);
+      if (ry == 0)
+        {
+          unsigned int t;
+          if (rx == 1)
+            {
+              x = n-1 - x;
+              y = n-1 - y;
+            }
+          t = x; x = y; y = t;
+        }
+    }
+  return d;
+}
+
+static int
+hilbert_compare (const void *v1, const void *v2)
+{
+  const HILBERT *h1 = v1, *h2 = v2;
+  return (h1->key < h2->key ? -1 : h1->key > h2->key ? 1 : 0);
+}
+
+
+/* Mesh surgery.
+ */
+
+/* Make `t' the neighbor of `o' across the edge that, seen from t, runs
+   from vertex x to vertex y. */
+static void
+link_tri (DSTATE *d, int o, int x, int y, int t)
+{
+  DTRI *O;
+  int k;
+  if (o < 0) return;
+  O = &d->tris[o];
+  for (k = 0; k < 3; k++)
+    if (O->v[(k+1)%3] == y && O->v[(k+2)%3] == x)
+      {
+        O->n[k] = t;
+        return;
+      }
+  abort();
+}
+
+/* Fills the polygon x[0..m-1] around the new point p with a fan of
+   triangles (p, x[k], x[k+1]), stored in slots[k].  outer[k] is the
+   triangle across the edge from x[k] to x[k+1].  Each new triangle has p
+   as its vertex 0, and goes on the stack to have its outer edge checked.
+ */
+static void
+make_fan (DSTATE *d, int p, int m, const int *x, const int *outer,
+          const int *slots)
+{
+  int k;
+  for (k = 0; k < m; k++)
+    {
+      DTRI *T = &d->tris[slots[k]];
+      T->v[0] = p;
+      T->v[1] = x[k];
+      T->v[2] = x[(k+1) % m];
+      T->n[0] = outer[k];
+      T->n[1] = slots[(k+1) % m];
+      T->n[2] = slots[(k+m-1) % m];
+    }
+  for (k = 0; k < m; k++)
+    {
+      link_tri (d, outer[k], x[k], x[(k+1) % m], slots[k]);
+      d->stack[d->nstack++] = slots[k];
+    }
+}
+
+/* Restores the Delaunay property around the newly-inserted point p,
+   which is vertex 0 of every triangle on the stack. */
+static void
+legalize (DSTATE *d)
+{
+  while (d->nstack > 0)
+    {
+      int t = d->stack[--d->nstack];
+      DTRI *T = &d->tris[t];
+      int u = T->n[0];
+      DTRI *U;
+      int j, p, b, c, q, A, B, C, D;
+
+      if (u < 0) continue;
+      U = &d->tris[u];
+      for (j = 0; j < 3; j++)
+        if (U->n[j] == t) break;
+      if (j == 3) abort();
+
+      p = T->v[0]; b = T->v[1]; c = T->v[2];
+      q = U->v[j];
+      if (incircle (&d->p[p], &d->p[b], &d->p[c], &d->p[q]) <= 0)
+        continue;
+
+      /* Flip edge b-c to p-q. */
+      A = T->n[1];
+      B = T->n[2];
+      C = U->n[(j+1)%3];
+      D = U->n[(j+2)%3];
+
+      T->v[0] = p; T->v[1] = b; T->v[2] = q;
+      T->n[0] = C; T->n[1] = u; T->n[2] = B;
+      U->v[0] = p; U->v[1] = q; U->v[2] = c;
+      U->n[0] = D; U->n[1] = A; U->n[2] = t;
+
+      link_tri (d, C, b, q, t);
+      link_tri (d, A, c, p, u);
+
+      d->stack[d->nstack++] = t;
+      d->stack[d->nstack++] = u;
+    }
+}
+
+/* Finds the triangle containing point i by walking from triangle t.
+   Sets *edge to -1 if it is strictly inside, to the index of the edge
+   if it is on one, or to -2 if it coincides with a vertex.
+ */
+static int
+locate (DSTATE *d, int t, int i, int *edge)
+{
+  const XYZ *pt = &d->p[i];
+  unsigned int rot = 0;
+
+  for (;;)
+    {
+      DTRI *T = &d->tris[t];
+      int k, next = -1, zero = -1, nzero = 0;
+
+      /* Start with a different edge each time, so that the walk can't
+         get stuck going around in a loop. */
+      rot++;
+      for (k = 0; k < 3; k++)
+        {
+          int e = (k + rot) % 3;
+          double o = orient2d (&d->p[T->v[(e+1)%3]], &d->p[T->v[(e+2)%3]], pt);
+          if (o < 0)
+            {
+              next = T->n[e];
+              break;
+            }
+          else if (o == 0)
+            {
+              zero = e;
+              nzero++;
+            }
+        }
+
+      if (k == 3)
+        {
+          *edge = (nzero == 0 ? -1 : nzero == 1 ? zero : -2);
+          return t;
+        }
+      if (next < 0)	/* outside of the super-triangle: can't happen */
+        abort();
+      t = next;
+    }
 }
 
 
@@ -101,36 +552,31 @@ circumcircle (double xp,double yp,
    These triangles are arranged in a consistent clockwise order.
    The triangle array 'v' should be malloced to 3 * nv
    The vertex array pxyz must be big enough to hold 3 more points
-   The vertex array must be sorted in increasing x values say
-   qsort(p,nv,sizeof(XYZ),XYZCompare);
+   Duplicate vertices are not in any triangle.
 */
 int
-delaunay (int nv,XYZ *pxyz,ITRIANGLE *v,int *ntri)
+delaunay (int nv, XYZ *pxyz, ITRIANGLE *v, int *ntri)
 {
-  int *complete = NULL;
-  IEDGE *edges = NULL;
-  int nedge = 0;
-  int trimax,emax = 200;
+  DSTATE d;
+  HILBERT *order = 0;
   int status = 0;
+  int i, t;
+  double xmin, xmax, ymin, ymax, xmid, ymid;
+  double dx, dy, dmax;
 
-  int inside;
-  int i,j,k;
-  double xp,yp,x1,y1,x2,y2,x3,y3,xc=0,yc=0,r=0;
-  double xmin,xmax,ymin,ymax,xmid,ymid;
-  double dx,dy,dmax;
-
-  /* Allocate memory for the completeness list, flag for each triangle */
-  trimax = 4 * nv;
-  if ((complete = malloc(trimax*sizeof(int))) == NULL) {
-    status = 1;
-    goto skip;
-  }
+  memset (&d, 0, sizeof(d));
+  *ntri = 0;
+  if (nv < 3) return 0;
 
-  /* Allocate memory for the edge list */
-  if ((edges = malloc(emax*(long)sizeof(IEDGE))) == NULL) {
-    status = 2;
-    goto skip;
-  }
+  d.p = pxyz;
+  d.tris  = (DTRI *) malloc ((2 * nv + 2) * sizeof(*d.tris));
+  d.stack = (int *)  malloc ((2 * nv + 8) * sizeof(*d.stack));
+  order   = (HILBERT *) malloc (nv * sizeof(*order));
+  if (!d.tris || !d.stack || !order)
+    {
+      status = 1;
+      goto skip;
+    }
 
   /*
     Find the maximum and minimum vertex bounds.
@@ -149,142 +595,189 @@ delaunay (int nv,XYZ *pxyz,ITRIANGLE *v,int *ntri)
   dx = xmax - xmin;
   dy = ymax - ymin;
   dmax = (dx > dy) ? dx : dy;
+  if (dmax <= 0) dmax = 1;
   xmid = (xmax + xmin) / 2.0;
   ymid = (ymax + ymin) / 2.0;
 
   /*
-    Set up the supertriangle
+    Set up the supertriangle, counterclockwise.
     This is a triangle which encompasses all the sample points.
     The supertriangle coordinates are added to the end of the
-    vertex list. The supertriangle is the first triangle in
-    the triangle list.
+    vertex list.
   */
   pxyz[nv+0].x = xmid - 20 * dmax;
   pxyz[nv+0].y = ymid - dmax;
   pxyz[nv+0].z = 0.0;
-  pxyz[nv+1].x = xmid;
-  pxyz[nv+1].y = ymid + 20 * dmax;
+  pxyz[nv+1].x = xmid + 20 * dmax;
+  pxyz[nv+1].y = ymid - dmax;
   pxyz[nv+1].z = 0.0;
-  pxyz[nv+2].x = xmid + 20 * dmax;
-  pxyz[nv+2].y = ymid - dmax;
+  pxyz[nv+2].x = xmid;
+  pxyz[nv+2].y = ymid + 20 * dmax;
   pxyz[nv+2].z = 0.0;
-  v[0].p1 = nv;
-  v[0].p2 = nv+1;
-  v[0].p3 = nv+2;
-  complete[0] = FALSE;
-  *ntri = 1;
+  d.tris[0].v[0] = nv;
+  d.tris[0].v[1] = nv+1;
+  d.tris[0].v[2] = nv+2;
+  d.tris[0].n[0] = d.tris[0].n[1] = d.tris[0].n[2] = -1;
+  d.ntris = 1;
+
+  for (i = 0; i < nv; i++)
+    {
+      order[i].i = i;
+      order[i].key = hilbert_index ((pxyz[i].x - xmin) * 65535 / dmax,
+                                    (pxyz[i].y - ymin) * 65535 / dmax);
+    }
+  qsort (order, nv, sizeof(*order), hilbert_compare);
 
   /*
     Include each point one at a time into the existing mesh
   */
-  for (i=0;i<nv;i++) {
-
-    xp = pxyz[i].x;
-    yp = pxyz[i].y;
-    nedge = 0;
-
-    /*
-      Set up the edge buffer.
-      If the point (xp,yp) lies inside the circumcircle then the
-      three edges of that triangle are added to the edge buffer
-      and that triangle is removed.
-    */
-    for (j=0;j<(*ntri);j++) {
-      if (complete[j])
+  t = 0;
+  for (i = 0; i < nv; i++)
+    {
+      int p = order[i].i;
+      int edge;
+      DTRI *T;
+
+      t = locate (&d, t, p, &edge);
+      T = &d.tris[t];
+
+      if (edge == -2)		/* duplicate point */
         continue;
-      x1 = pxyz[v[j].p1].x;
-      y1 = pxyz[v[j].p1].y;
-      x2 = pxyz[v[j].p2].x;
-      y2 = pxyz[v[j].p2].y;
-      x3 = pxyz[v[j].p3].x;
-      y3 = pxyz[v[j].p3].y;
-      inside = circumcircle(xp,yp,x1,y1,x2,y2,x3,y3,&xc,&yc,&r);
-      if (xc < xp && ((xp-xc)*(xp-xc)) > r)
-        complete[j] = TRUE;
-      if (inside) {
-        /* Check that we haven't exceeded the edge list size */
-        if (nedge+3 >= emax) {
-          IEDGE *edges_old = edges;
-          emax += 100;
-          if ((edges = realloc(edges,emax*(long)sizeof(IEDGE))) == NULL) {
-            edges = edges_old;
-            status = 3;
-            goto skip;
-          }
+      else if (edge == -1)	/* inside: split into 3 */
+        {
+          int x[3], outer[3], slots[3];
+          x[0] = T->v[0];  outer[0] = T->n[2];
+          x[1] = T->v[1];  outer[1] = T->n[0];
+          x[2] = T->v[2];  outer[2] = T->n[1];
+          slots[0] = t;
+          slots[1] = d.ntris++;
+          slots[2] = d.ntris++;
+          make_fan (&d, p, 3, x, outer, slots);
         }
-        edges[nedge+0].p1 = v[j].p1;
-        edges[nedge+0].p2 = v[j].p2;
-        edges[nedge+1].p1 = v[j].p2;
-        edges[nedge+1].p2 = v[j].p3;
-        edges[nedge+2].p1 = v[j].p3;
-        edges[nedge+2].p2 = v[j].p1;
-        nedge += 3;
-        v[j] = v[(*ntri)-1];
-        complete[j] = complete[(*ntri)-1];
-        (*ntri)--;
-        j--;
-      }
-    }
+      else			/* on an edge: split both sides into 2 */
+        {
+          int u = T->n[edge];
+          DTRI *U;
+          int j, x[4], outer[4], slots[4];
+          if (u < 0) abort();	/* on the super-triangle: can't happen */
+          U = &d.tris[u];
+          for (j = 0; j < 3; j++)
+            if (U->n[j] == t) break;
+          if (j == 3) abort();
 
-    /*
-      Tag multiple edges
-      Note: if all triangles are specified anticlockwise then all
-      interior edges are opposite pointing in direction.
-    */
-    for (j=0;j<nedge-1;j++) {
-      for (k=j+1;k<nedge;k++) {
-        if ((edges[j].p1 == edges[k].p2) && (edges[j].p2 == edges[k].p1)) {
-          edges[j].p1 = -1;
-          edges[j].p2 = -1;
-          edges[k].p1 = -1;
-          edges[k].p2 = -1;
-        }
-        /* Shouldn't need the following, see note above */
-        if ((edges[j].p1 == edges[k].p1) && (edges[j].p2 == edges[k].p2)) {
-          edges[j].p1 = -1;
-          edges[j].p2 = -1;
-          edges[k].p1 = -1;
-          edges[k].p2 = -1;
+          /* The quadrilateral a, b, q, c around the edge b-c. */
+          x[0] = T->v[edge];        outer[0] = T->n[(edge+2)%3];
+          x[1] = T->v[(edge+1)%3];  outer[1] = U->n[(j+1)%3];
+          x[2] = U->v[j];           outer[2] = U->n[(j+2)%3];
+          x[3] = T->v[(edge+2)%3];  outer[3] = T->n[(edge+1)%3];
+          slots[0] = t;
+          slots[1] = u;
+          slots[2] = d.ntris++;
+          slots[3] = d.ntris++;
+          make_fan (&d, p, 4, x, outer, slots);
         }
-      }
-    }
 
-    /*
-      Form new triangles for the current point
-      Skipping over any tagged edges.
-      All edges are arranged in clockwise order.
-    */
-    for (j=0;j<nedge;j++) {
-      if (edges[j].p1 < 0 || edges[j].p2 < 0)
-        continue;
-      if ((*ntri) >= trimax) {
-        status = 4;
-        goto skip;
-      }
-      v[*ntri].p1 = edges[j].p1;
-      v[*ntri].p2 = edges[j].p2;
-      v[*ntri].p3 = i;
-      complete[*ntri] = FALSE;
-      (*ntri)++;
+      legalize (&d);
     }
-  }
 
   /*
     Remove triangles with supertriangle vertices
     These are triangles which have a vertex number greater than nv
   */
-  for (i=0;i<(*ntri);i++) {
-    if (v[i].p1 >= nv || v[i].p2 >= nv || v[i].p3 >= nv) {
-      v[i] = v[(*ntri)-1];
-      (*ntri)--;
-      i--;
+  for (t = 0; t < d.ntris; t++)
+    {
+      DTRI *T = &d.tris[t];
+      if (T->v[0] >= nv || T->v[1] >= nv || T->v[2] >= nv)
+        continue;
+      v[*ntri].p1 = T->v[0];
+      v[*ntri].p2 = T->v[2];
+      v[*ntri].p3 = T->v[1];
+      (*ntri)++;
     }
-  }
 
  skip:
-  free(edges);
-  free(complete);
-  return(status);
+  free (order);
+  free (d.stack);
+  free (d.tris);
+  return status;
+}
+
+
+int
+delaunay_cells (int nv, const ITRIANGLE *v, int ntri,
+                int *cells, int *cell_tris)
+{
+  int *fill = (int *) calloc (nv + 1, sizeof(*fill));
+  int i, j, k;
+
+  if (!fill) return 1;
+
+  /* Count the triangles around each vertex, and bucket them. */
+  for (i = 0; i <= nv; i++)
+    cells[i] = 0;
+  for (i = 0; i < ntri; i++)
+    {
+      cells[v[i].p1 + 1]++;
+      cells[v[i].p2 + 1]++;
+      cells[v[i].p3 + 1]++;
+    }
+  for (i = 0; i < nv; i++)
+    cells[i+1] += cells[i];
+  for (i = 0; i < ntri; i++)
+    {
+      cell_tris[cells[v[i].p1] + fill[v[i].p1]++] = i;
+      cell_tris[cells[v[i].p2] + fill[v[i].p2]++] = i;
+      cell_tris[cells[v[i].p3] + fill[v[i].p3]++] = i;
+    }
+
+  /* Put each bucket in order around its vertex.  Triangle (i, x, y) is
+     followed by the one that starts (i, y, ...).  If the vertex is on
+     the hull, start at the end of the fan that nothing precedes. */
+  for (i = 0; i < nv; i++)
+    {
+      int *tris = cell_tris + cells[i];
+      int n = cells[i+1] - cells[i];
+      int start = 0;
+
+# define NEXT_OF(T,I) \
+      ((T)->p1 == (I) ? (T)->p2 : (T)->p2 == (I) ? (T)->p3 : (T)->p1)
+# define PREV_OF(T,I) \
+      ((T)->p1 == (I) ? (T)->p3 : (T)->p2 == (I) ? (T)->p1 : (T)->p2)
+
+      if (n < 2) continue;
+
+      for (j = 0; j < n; j++)
+        {
+          int x = NEXT_OF (&v[tris[j]], i);
+          for (k = 0; k < n; k++)
+            if (PREV_OF (&v[tris[k]], i) == x)
+              break;
+          if (k == n)
+            {
+              start = j;
+              break;
+            }
+        }
+
+      k = tris[start]; tris[start] = tris[0]; tris[0] = k;
+      for (j = 0; j < n-1; j++)
+        {
+          int y = PREV_OF (&v[tris[j]], i);
+          int m;
+          for (m = j+1; m < n; m++)
+            if (NEXT_OF (&v[tris[m]], i) == y)
+              {
+                k = tris[m]; tris[m] = tris[j+1]; tris[j+1] = k;
+                break;
+              }
+          if (m == n) break;	/* a fan that isn't connected */
+        }
+# undef NEXT_OF
+# undef PREV_OF
+    }
+
+  free (fill);
+  return 0;
 }
 
 
@@ -1,22 +1,7 @@
-/* Triangulate
-   Efficient Triangulation Algorithm Suitable for Terrain Modelling
-   or
-   An Algorithm for Interpolating Irregularly-Spaced Data
-   with Applications in Terrain Modelling
-
-   Written by Paul Bourke
-   Presented at Pan Pacific Computer Conference, Beijing, China.
-   January 1989
-   Abstract
-
-   A discussion of a method that has been used with success in terrain
-   modelling to estimate the height at any point on the land surface
-   from irregularly distributed samples. The special requirements of
-   terrain modelling are discussed as well as a detailed description
-   of the algorithm and an example of its application.
-
+/* Delaunay triangulation, and the cells of its dual.
+   The interface is that of Paul Bourke's triangulator,
    http://paulbourke.net/papers/triangulate/
-   http://paulbourke.net/papers/triangulate/triangulate.c
+   See delaunay.c for how it works now.
  */
 
 #ifndef __DELAUNAY_H__
@@ -36,11 +21,23 @@ typedef struct {
    These triangles are arranged in a consistent clockwise order.
    The triangle array 'v' should be malloced to 3 * nv
    The vertex array pxyz must be big enough to hold 3 more points
-   The vertex array must be sorted in increasing x values
+   The vertices need not be sorted.  Duplicates are left out.
+   Returns nonzero if out of memory.
  */
 extern int delaunay (int nv, XYZ *pxyz, ITRIANGLE *v, int *ntri);
 
-/* qsort(p,nv,sizeof(XYZ), delaunay_xyzcompare); */
+/* The Voronoi cells: the dual of the triangulation.
+   For each vertex i, the triangles that contain it are
+     cell_tris[cells[i]] through cell_tris[cells[i+1] - 1],
+   in order around the vertex.  For a vertex on the hull, the cell is
+   open, and begins and ends at the triangles on the hull.
+   `cells' has room for nv+1 ints, and `cell_tris' for 3 * ntri.
+   Returns nonzero if out of memory.
+ */
+extern int delaunay_cells (int nv, const ITRIANGLE *v, int ntri,
+                           int *cells, int *cell_tris);
+
+/* No longer needed by delaunay(). */
 extern int delaunay_xyzcompare (const void *v1, const void *v2);
 
 
@@ -13,9 +13,6 @@
 /* distort
  * by Jonas Munsin (jmunsin@iki.fi) and Jamie Zawinski <jwz@jwz.org>
  * TODO:
- *	-check the allocations in init_round_lense again, maybe make it possible again
- * 	 to use swamp without pre-allocating/calculating (although that
- *	 makes it slower) - -swamp is memory hungry
  *	-more distortion matrices (fortunately, I'm out of ideas :)
  * Stuff that would be cool but probably too much of a resource hog:
  *	-some kind of interpolation to avoid jaggies
@@ -41,6 +38,7 @@
 #include "screenhack.h"
 /*#include <X11/Xmd.h>*/
 # include "xshm.h"
+# include "thread_util.h"
 
 #define CARD32 unsigned int
 #define CARD16 unsigned short
@@ -54,6 +52,13 @@ struct coo {
 	int xmove, ymove;
 };
 
+struct lens_table;
+
+struct lens_job {
+  int x, y;
+  struct lens_table *table;
+};
+
 struct state {
   Display *dpy;
   Window window;
@@ -69,37 +74,43 @@ struct state {
   unsigned long black_pixel;
 
   XImage *orig_map, *buffer_map;
-  unsigned long *buffer_map_cache;
 
-  int ***from;
-  int ****from_array;
-  int *fast_from;
-  int from_size;
+  int size;				/* of the box around a lens: 2*radius+speed+2 */
+  int table_key[6];
+  int table_radius;
+  struct lens_table **round;	/* [0 .. radius], by size of the lens */
+  struct lens_table *reflect_tables[4];
+  int lens_r;			/* which round lens plain_draw uses */
+
+  struct lens_job jobs[20];
+  int njobs;
 
-  int bpp_size;
+  int fast_bpp;			/* 8, 16 or 32; or 0 for XGetPixel */
 
   XShmSegmentInfo shm_info;
+  struct threadpool threadpool;
 
   void (*effect) (struct state *, int);
   void (*draw) (struct state *, int);
-  void (*draw_routine) (struct state *st, XImage *, XImage *, int, int, int *);
 
   async_load_state *img_loader;
   Pixmap pm;
 };
 
+struct distort_thread {
+  struct state *st;
+  unsigned id;
+};
+
 
 static void move_lense(struct state *, int);
 static void swamp_thing(struct state *, int);
 static void new_rnd_coo(struct state *, int);
-static void init_round_lense(struct state *st);
 static void reflect_draw(struct state *, int);
 static void plain_draw(struct state *, int);
-
-static void fast_draw_8 (struct state *st, XImage *, XImage *, int, int, int *);
-static void fast_draw_16(struct state *st, XImage *, XImage *, int, int, int *);
-static void fast_draw_32(struct state *st, XImage *, XImage *, int, int, int *);
-static void generic_draw(struct state *st, XImage *, XImage *, int, int, int *);
+static void check_lens_tables(struct state *);
+static int distort_thread_create(void *, struct threadpool *, unsigned);
+static void distort_thread_destroy(void *);
 
 
 static void distort_finish_loading (struct state *);
@@ -233,8 +244,10 @@ distort_reset (struct state *st)
     if (st->xgwa.width > 2560 || st->xgwa.height > 2560)
       st->radius *= 2;  /* Retina displays */
 
-    /* -swamp mode consumes vast amounts of memory, proportional to radius --
-       so throttle radius to a small-ish value (60 => ~30MB.)
+    /* -swamp mode pulses its lenses through every size from 0 to radius,
+       and keeps a table for each size once it has been built, each as big
+       as the whole lens: memory grows with the cube of the radius, so
+       throttle radius to a small-ish value (60 => ~7MB.)
      */
     if (st->effect == &swamp_thing && st->radius > 60)
       st->radius = 60;
@@ -285,6 +298,20 @@ distort_init (Display *dpy, Window window)
 	gcflags = GCFunction;
 	st->gc = XCreateGC (st->dpy, st->window, gcflags, &gcv);
 
+    {
+      static const struct threadpool_class cls = {
+        sizeof(struct distort_thread),
+        distort_thread_create,
+        distort_thread_destroy
+      };
+      int err = threadpool_create (&st->threadpool, &cls, dpy,
+                                   hardware_concurrency (dpy));
+      if (err) {
+        fprintf (stderr, "%s: threadpool: %s\n", progname, strerror (err));
+        exit (1);
+      }
+    }
+
     /* On MacOS X11, XGetImage on a Window often gets an inexplicable BadMatch,
        possibly due to the window manager having occluded something?  It seems
        nondeterministic. Loading the image into a pixmap instead fixes it. */
@@ -313,47 +340,39 @@ distort_finish_loading (struct state *st)
 	st->orig_map = XGetImage(st->dpy, st->pm, 0, 0,
                              st->xgwa.width, st->xgwa.height,
                              ~0L, ZPixmap);
-    if (st->buffer_map_cache) free (st->buffer_map_cache);
-	st->buffer_map_cache = malloc(sizeof(unsigned long)*(2*st->radius+st->speed+2)*(2*st->radius+st->speed+2));
-
-	if (st->buffer_map_cache == NULL) {
-		perror("distort");
-		exit(EXIT_FAILURE);
-	}
+    check_lens_tables(st);
+    st->lens_r = st->radius;
+    st->njobs = 0;
 
     if (st->buffer_map)
       destroy_xshm_image (st->dpy, st->buffer_map, &st->shm_info);
 	st->buffer_map = create_xshm_image(st->dpy, st->xgwa.visual, st->orig_map->depth,
-	                                   ZPixmap, &st->shm_info,
-	                                   2*st->radius + st->speed + 2,
-	                                   2*st->radius + st->speed + 2);
+	                                   ZPixmap, &st->shm_info, st->size,
+	                                   st->size * st->number *
+	                                   (st->effect == &swamp_thing ? 2 : 1));
+	if (!st->buffer_map) {
+		perror("distort");
+		exit(EXIT_FAILURE);
+	}
 
+	st->fast_bpp = 0;
 	if ((st->buffer_map->byte_order == st->orig_map->byte_order)
 			&& (st->buffer_map->depth == st->orig_map->depth)
+			&& (st->buffer_map->bits_per_pixel ==
+				st->orig_map->bits_per_pixel)
 			&& (st->buffer_map->format == ZPixmap)
 			&& (st->orig_map->format == ZPixmap)
 			&& !st->slow) {
 		switch (st->orig_map->bits_per_pixel) {
 			case 32:
-				st->draw_routine = &fast_draw_32;
-				st->bpp_size = sizeof(CARD32);
-				break;
 			case 16:
-				st->draw_routine = &fast_draw_16;
-				st->bpp_size = sizeof(CARD16);
-				break;
 			case 8:
-				st->draw_routine = &fast_draw_8;
-				st->bpp_size = sizeof(CARD8);
+				st->fast_bpp = st->orig_map->bits_per_pixel;
 				break;
 			default:
-				st->draw_routine = &generic_draw;
 				break;
 		}
-	} else {
-		st->draw_routine = &generic_draw;
 	}
-	init_round_lense(st);
 
 	for (i = 0; i < st->number; i++) {
 		new_rnd_coo(st,i);
@@ -367,50 +386,98 @@ distort_finish_loading (struct state *st)
 	}
 }
 
-/* example: initializes a "see-trough" matrix */
-/* static void make_null_lense(struct state *st)
-{
-	int i, j;
-	for (i = 0; i < 2*radius+speed+2; i++) {
-		for (j = 0 ; j < 2*radius+speed+2 ; j++) {
-			from[i][j][0]=i;
-			from[i][j][1]=j;
-		}
-	} 
-}
-*/
-static void convert(struct state *st) 
+#ifndef EXIT_FAILURE
+# define EXIT_FAILURE -1
+#endif
+
+/* A lens is described by a table that says, for each pixel of the
+ * (2*radius+speed+2)-square box that it covers, which pixel of the
+ * original image shows through there, as an offset from the corner of
+ * the box.  The tables only depend on the shape of the lens, not on where
+ * it is or on the image, so they are built the first time they're needed
+ * and kept until the radius or the effect changes.
+ */
+
+#define NO_PIXEL (-(1 << 24))	/* an offset that is always off the image */
+
+struct lens_table {
+	int *dx, *dy;		/* size*size each, row-major */
+};
+
+static struct lens_table *alloc_lens_table(struct state *st)
 {
-	int *p;
-	int i, j;
-    if (st->fast_from) free (st->fast_from);
-	st->fast_from = calloc(1, sizeof(int)*((st->buffer_map->bytes_per_line/st->bpp_size)*(2*st->radius+st->speed+2) + 2*st->radius+st->speed+2));
-	if (st->fast_from == NULL) {
+	int n = st->size * st->size;
+	struct lens_table *t = (struct lens_table *) malloc(sizeof(*t));
+	if (t) t->dx = (int *) malloc(2 * n * sizeof(int));
+	if (!t || !t->dx) {
 		perror("distort");
 		exit(EXIT_FAILURE);
 	}
-	p = st->fast_from;
-	for (i = 0; i < 2*st->radius+st->speed+2; i++) {
-		for (j = 0; j < 2*st->radius+st->speed+2; j++) {
-			*(p + i + j*st->buffer_map->bytes_per_line/st->bpp_size)
-				= st->from[i][j][0] + st->xgwa.width*st->from[i][j][1];
-			if (*(p + i + j*st->buffer_map->bytes_per_line/st->bpp_size) < 0
-					|| *(p + i + j*st->buffer_map->bytes_per_line/st->bpp_size) >= st->orig_map->height*st->orig_map->width) {
-				*(p + i + j*st->buffer_map->bytes_per_line/st->bpp_size) = 0;
+	t->dy = t->dx + n;
+	return t;
+}
+
+static void free_lens_tables(struct state *st)
+{
+	int i;
+	if (st->round) {
+		for (i = 0; i <= st->table_radius; i++)
+			if (st->round[i]) {
+				free(st->round[i]->dx);
+				free(st->round[i]);
 			}
+		free(st->round);
+		st->round = 0;
+	}
+	for (i = 0; i < countof(st->reflect_tables); i++)
+		if (st->reflect_tables[i]) {
+			free(st->reflect_tables[i]->dx);
+			free(st->reflect_tables[i]);
+			st->reflect_tables[i] = 0;
 		}
+}
+
+/* Throws away the tables if they were made for a different lens. */
+static void check_lens_tables(struct state *st)
+{
+	int key[6];
+	key[0] = st->radius;
+	key[1] = st->speed;
+	key[2] = st->vortex;
+	key[3] = st->magnify;
+	key[4] = st->blackhole;
+	key[5] = st->reflect;
+	if (st->round && !memcmp(key, st->table_key, sizeof(key)))
+		return;
+
+	free_lens_tables(st);
+	memcpy(st->table_key, key, sizeof(key));
+	st->table_radius = st->radius;
+	st->size = 2*st->radius + st->speed + 2;
+	st->round = (struct lens_table **)
+		calloc(st->radius + 1, sizeof(*st->round));
+	if (!st->round) {
+		perror("distort");
+		exit(EXIT_FAILURE);
 	}
 }
 
 /* makes a lense with the Radius=loop and centred in
  * the point (radius, radius)
  */
-static void make_round_lense(struct state *st, int radius, int loop)
+static struct lens_table *round_lens(struct state *st, int loop)
 {
+	int radius = st->radius;
+	struct lens_table *t = st->round[loop];
 	int i, j;
 
-	for (i = 0; i < 2*radius+st->speed+2; i++) {
-		for(j = 0; j < ((0 == st->bpp_size) ? (2*radius+st->speed+2) : (st->buffer_map->bytes_per_line/st->bpp_size)); j++) {
+	if (t) return t;
+	t = st->round[loop] = alloc_lens_table(st);
+
+	for (j = 0; j < st->size; j++) {
+		for (i = 0; i < st->size; i++) {
+			int *fx = &t->dx[j * st->size + i];
+			int *fy = &t->dy[j * st->size + i];
 			double r, d;
 			r = sqrt ((i-radius)*(i-radius)+(j-radius)*(j-radius));
 			if (loop == 0)
@@ -419,6 +486,7 @@ static void make_round_lense(struct state *st, int radius, int loop)
 			  d=r/loop;
 
 			if (r < loop-1) {
+				double x, y;
 
 				if (st->vortex) { /* vortex-twist effect */
 					double angle;
@@ -431,20 +499,20 @@ static void make_round_lense(struct state *st, int radius, int loop)
 
         /* Avoid atan2: DOMAIN error message */
 					if ((radius-j) == 0.0 && (radius-i) == 0.0) {
-						st->from[i][j][0] = radius + cos(angle)*r;
-						st->from[i][j][1] = radius + sin(angle)*r;
+						x = (int) (radius + cos(angle)*r);
+						y = (int) (radius + sin(angle)*r);
 					} else {
-						st->from[i][j][0] = radius +
-							cos(angle - atan2(radius-j, -(radius-i)))*r;
-						st->from[i][j][1] = radius +
-							sin(angle - atan2(radius-j, -(radius-i)))*r;
+						x = (int) (radius +
+							cos(angle - atan2(radius-j, -(radius-i)))*r);
+						y = (int) (radius +
+							sin(angle - atan2(radius-j, -(radius-i)))*r);
 					}
 					if (st->magnify) {
 						r = sin(d*M_PI_2);
 						if (st->blackhole && r != 0) /* blackhole effect */
 							r = 1/r;
-						st->from[i][j][0] = radius + (st->from[i][j][0]-radius)*r;
-						st->from[i][j][1] = radius + (st->from[i][j][1]-radius)*r;
+						x = radius + (x-radius)*r;
+						y = radius + (y-radius)*r;
 					}
 				} else { /* default is to magnify */
 					r = sin(d*M_PI_2);
@@ -456,211 +524,195 @@ static void make_round_lense(struct state *st, int radius, int loop)
 					if (st->blackhole && r != 0) /* blackhole effect */
 						r = 1/r;
 									/* bubble effect (and blackhole) */
-					st->from[i][j][0] = radius + (i-radius)*r;
-					st->from[i][j][1] = radius + (j-radius)*r;
+					x = radius + (i-radius)*r;
+					y = radius + (j-radius)*r;
+				}
+
+				/* The black hole can throw things very far away. */
+				if (x < NO_PIXEL || x > -NO_PIXEL ||
+					y < NO_PIXEL || y > -NO_PIXEL)
+					*fx = *fy = NO_PIXEL;
+				else {
+					*fx = (int) x;
+					*fy = (int) y;
 				}
 			} else { /* not inside loop */
-				st->from[i][j][0] = i;
-				st->from[i][j][1] = j;
+				*fx = i;
+				*fy = j;
 			}
 		}
 	}
-
-	/* this is really just a quick hack to keep both the compability mode with all depths and still
-	 * allow the custom optimized draw routines with the minimum amount of work */
-	if (0 != st->bpp_size) {
-		convert(st);
-	}
+	return t;
 }
 
-#ifndef EXIT_FAILURE
-# define EXIT_FAILURE -1
-#endif
-
-static void allocate_lense(struct state *st)
+/* The reflect algorithm submitted by Randy Zack <randy@acucorp.com>.
+ * The centre of the lens leads by `speed' in the direction it's moving,
+ * so there is one table for each of the four directions.
+ */
+static struct lens_table *reflect_lens(struct state *st, int k)
 {
 	int i, j;
-	int s = ((0 != st->bpp_size) ? (st->buffer_map->bytes_per_line/st->bpp_size) : (2*st->radius+st->speed+2));
-	/* maybe this should be redone so that from[][][] is in one block;
-	 * then pointers could be used instead of arrays in some places (and
-	 * maybe give a speedup - maybe also consume less memory)
-	 */
-    if (st->from) {
-      for (i = 0; i < st->from_size; i++)
-		if (st->from[i]) {
-          for (j = 0; j < st->from_size; j++) {
-            if (st->from[i][j]) free (st->from[i][j]);
-          }
-          free (st->from[i]);
-        }
-      free (st->from);
-    }
-    st->from_size = s;
-	st->from = (int ***)malloc(s*sizeof(int **));
-	if (st->from == NULL) {
-		perror("distort");
-		exit(EXIT_FAILURE);
-	}
-	for (i = 0; i < s; i++) {
-		st->from[i] = (int **)malloc((2*st->radius+st->speed+2) * sizeof(int *));
-		if (st->from[i] == NULL) {
-			perror("distort");
-			exit(EXIT_FAILURE);
-		}
-		for (j = 0; j < s; j++) {
-			st->from[i][j] = (int *)malloc(2 * sizeof(int));
-			if (st->from[i][j] == NULL) {
-				perror("distort");
-				exit(EXIT_FAILURE);
+	int	cx, cy;
+	int	ly, lysq, lx, dist, rsq = st->radius * st->radius;
+	int dir = (st->xy_coo[k].xmove > 0) + 2 * (st->xy_coo[k].ymove > 0);
+	struct lens_table *t = st->reflect_tables[dir];
+
+	if (t) return t;
+	t = st->reflect_tables[dir] = alloc_lens_table(st);
+
+	cx = cy = st->radius;
+	if (st->xy_coo[k].ymove > 0)
+		cy += st->speed;
+	if (st->xy_coo[k].xmove > 0)
+		cx += st->speed;
+
+	for(i = 0 ; i < st->size; i++) {
+		ly = i - cy;
+		lysq = ly * ly;
+		for(j = 0 ; j < st->size ; j++) {
+			int *fx = &t->dx[i * st->size + j];
+			int *fy = &t->dy[i * st->size + j];
+			lx = j - cx;
+			dist = lx * lx + lysq;
+			if (dist > rsq ||
+				ly < -st->radius || ly > st->radius ||
+				lx < -st->radius || lx > st->radius) {
+				*fx = j;
+				*fy = i;
+			} else if (dist == 0)
+				*fx = *fy = NO_PIXEL;
+			else {
+				*fx = cx + (lx * rsq / dist);
+				*fy = cy + (ly * rsq / dist);
 			}
 		}
 	}
+	return t;
 }
 
-/* from_array in an array containing precalculated from matrices,
- * this is a double faced mem vs speed trade, it's faster, but eats
- * _a lot_ of mem for large radius (is there a bug here? I can't see it)
+
+/* Each frame, the lenses that moved are queued up as jobs.  The job boxes
+ * are stacked one above the other in buffer_map, and the rows of that
+ * are divided among the threads in bands of TILE_ROWS, so that the part
+ * of the lens table and of the image that a thread is working on at any
+ * moment stays in the cache.  Pixels that would come from off the image
+ * are black.
  */
-static void init_round_lense(struct state *st)
-{
-	int k;
-
-	if (st->effect == &swamp_thing) {
-        if (st->from_array) free (st->from_array);
-		st->from_array = (int ****)malloc((st->radius+1)*sizeof(int ***));
-		for (k=0; k <= st->radius; k++) {
-			allocate_lense(st);
-			make_round_lense(st, st->radius, k);
-			st->from_array[k] = st->from;
-		}
-	} else { /* just allocate one from[][][] */
-		allocate_lense(st);
-		make_round_lense(st, st->radius,st->radius);
-	}
+#define TILE_ROWS 16
+
+#define LENS_ROW(NAME, TYPE)									\
+static void NAME(struct state *st, struct lens_job *job, int row, TYPE *u)	\
+{																	\
+	const TYPE *t = (const TYPE *) st->orig_map->data;				\
+	int stride = st->orig_map->bytes_per_line / sizeof(TYPE);		\
+	unsigned w = st->orig_map->width, h = st->orig_map->height;	\
+	const int *dx = job->table->dx + row * st->size;				\
+	const int *dy = job->table->dy + row * st->size;				\
+	TYPE black = st->black_pixel;									\
+	int i;															\
+	for (i = 0; i < st->size; i++) {								\
+		unsigned x = job->x + dx[i];								\
+		unsigned y = job->y + dy[i];								\
+		u[i] = (x < w && y < h ? t[y * stride + x] : black);		\
+	}																\
 }
 
-/* If fast_draw_8, fast_draw_16 or fast_draw_32 are to be used, the following properties
- * of the src and dest XImages must hold (otherwise the generic, slooow, method provided
- * by X is to be used):
- *	src->byte_order == dest->byte_order
- *	src->format == ZPixmap && dest->format == ZPixmap
- *	src->depth == dest->depth == the depth the function in question asumes
- * x and y is the coordinates in src from where to cut out the image from,
- * distort_matrix is a precalculated array of how to distort the matrix
- */
+LENS_ROW(lens_row_8,  CARD8)
+LENS_ROW(lens_row_16, CARD16)
+LENS_ROW(lens_row_32, CARD32)
 
-static void fast_draw_8(struct state *st, XImage *src, XImage *dest, int x, int y, int *distort_matrix)
+static void lens_row_generic(struct state *st, struct lens_job *job, int row,
+							 int dest_y)
 {
-	CARD8 *u = (CARD8 *)dest->data;
-	CARD8 *t = (CARD8 *)src->data + x + y*src->bytes_per_line/sizeof(CARD8);
-
-	while (u < (CARD8 *)(dest->data + sizeof(CARD8)*dest->height
-				*dest->bytes_per_line/sizeof(CARD8))) {
-		*u++ = t[*distort_matrix++];
+	unsigned w = st->orig_map->width, h = st->orig_map->height;
+	const int *dx = job->table->dx + row * st->size;
+	const int *dy = job->table->dy + row * st->size;
+	int i;
+	for (i = 0; i < st->size; i++) {
+		unsigned x = job->x + dx[i];
+		unsigned y = job->y + dy[i];
+		XPutPixel(st->buffer_map, i, dest_y,
+				  (x < w && y < h
+				   ? XGetPixel(st->orig_map, x, y)
+				   : st->black_pixel));
 	}
 }
 
-static void fast_draw_16(struct state *st, XImage *src, XImage *dest, int x, int y, int *distort_matrix)
+static int distort_thread_create(void *self, struct threadpool *pool,
+								 unsigned id)
 {
-	CARD16 *u = (CARD16 *)dest->data;
-	CARD16 *t = (CARD16 *)src->data + x + y*src->bytes_per_line/sizeof(CARD16);
-
-	while (u < (CARD16 *)(dest->data + sizeof(CARD16)*dest->height
-				*dest->bytes_per_line/sizeof(CARD16))) {
-		*u++ = t[*distort_matrix++];
-	}
+	struct distort_thread *t = (struct distort_thread *) self;
+	t->st = GET_PARENT_OBJ(struct state, threadpool, pool);
+	t->id = id;
+	return 0;
 }
 
-static void fast_draw_32(struct state *st, XImage *src, XImage *dest, int x, int y, int *distort_matrix)
+static void distort_thread_destroy(void *self)
 {
-	CARD32 *u = (CARD32 *)dest->data;
-	CARD32 *t = (CARD32 *)src->data + x + y*src->bytes_per_line/sizeof(CARD32);
+}
 
-	while (u < (CARD32 *)(dest->data + sizeof(CARD32)*dest->height
-				*dest->bytes_per_line/sizeof(CARD32))) {
-		*u++ = t[*distort_matrix++];
-	}
+static void distort_thread_run(void *self)
+{
+	struct distort_thread *t = (struct distort_thread *) self;
+	struct state *st = t->st;
+	int rows = st->njobs * st->size;
+	int y0, y;
+
+	for (y0 = t->id * TILE_ROWS; y0 < rows;
+		 y0 += st->threadpool.count * TILE_ROWS)
+		for (y = y0; y < y0 + TILE_ROWS && y < rows; y++) {
+			struct lens_job *job = &st->jobs[y / st->size];
+			char *u = (st->buffer_map->data +
+					   y * st->buffer_map->bytes_per_line);
+			switch (st->fast_bpp) {
+			case 32: lens_row_32(st, job, y % st->size, (CARD32 *) u); break;
+			case 16: lens_row_16(st, job, y % st->size, (CARD16 *) u); break;
+			case 8:  lens_row_8 (st, job, y % st->size, (CARD8 *)  u); break;
+			default: lens_row_generic(st, job, y % st->size, y); break;
+			}
+		}
 }
 
-static void generic_draw(struct state *st, XImage *src, XImage *dest, int x, int y, int *distort_matrix)
+static void queue_lens(struct state *st, int k, struct lens_table *table)
 {
-	int i, j;
-	for (i = 0; i < dest->width; i++)
-		for (j = 0; j < dest->height; j++)
-			if (st->from[i][j][0] + x >= 0 &&
-					st->from[i][j][0] + x < src->width &&
-					st->from[i][j][1] + y >= 0 &&
-					st->from[i][j][1] + y < src->height)
-				XPutPixel(dest, i, j,
-						XGetPixel(src,
-							st->from[i][j][0] + x,
-							st->from[i][j][1] + y));
+	struct lens_job *job;
+	if (st->njobs >= countof(st->jobs)) abort();
+	job = &st->jobs[st->njobs++];
+	job->x = st->xy_coo[k].x;
+	job->y = st->xy_coo[k].y;
+	job->table = table;
 }
 
-/* generate an XImage of from[][][] and draw it on the screen */
-static void plain_draw(struct state *st, int k)
+/* Renders all of this frame's jobs, and puts them on the screen. */
+static void draw_lenses(struct state *st)
 {
-	if (st->xy_coo[k].x+2*st->radius+st->speed+2 > st->orig_map->width ||
-			st->xy_coo[k].y+2*st->radius+st->speed+2 > st->orig_map->height)
-		return;
+	int i;
+	if (!st->njobs) return;
 
-	st->draw_routine(st, st->orig_map, st->buffer_map, st->xy_coo[k].x, st->xy_coo[k].y, st->fast_from);
+	threadpool_run(&st->threadpool, distort_thread_run);
+	threadpool_wait(&st->threadpool);
 
-	put_xshm_image(st->dpy, st->window, st->gc, st->buffer_map, 0, 0, st->xy_coo[k].x, st->xy_coo[k].y,
-	               2*st->radius+st->speed+2, 2*st->radius+st->speed+2, &st->shm_info);
+	for (i = 0; i < st->njobs; i++)
+		put_xshm_image(st->dpy, st->window, st->gc, st->buffer_map,
+					   0, i * st->size, st->jobs[i].x, st->jobs[i].y,
+					   st->size, st->size, &st->shm_info);
+	st->njobs = 0;
 }
 
+static void plain_draw(struct state *st, int k)
+{
+	if (st->xy_coo[k].x+st->size > st->orig_map->width ||
+			st->xy_coo[k].y+st->size > st->orig_map->height)
+		return;
+	queue_lens(st, k, round_lens(st, st->lens_r));
+}
 
-/* generate an XImage from the reflect algoritm submitted by
- * Randy Zack <randy@acucorp.com>
- * draw really got too big and ugly so I split it up
- * it should be possible to use the from[][] to speed it up
- * (once I figure out the algorithm used :)
- */
 static void reflect_draw(struct state *st, int k)
 {
-	int i, j;
-	int	cx, cy;
-	int	ly, lysq, lx, ny, dist, rsq = st->radius * st->radius;
-
-	cx = cy = st->radius;
-	if (st->xy_coo[k].ymove > 0)
-		cy += st->speed;
-	if (st->xy_coo[k].xmove > 0)
-		cx += st->speed;
-
-	for(i = 0 ; i < 2*st->radius+st->speed+2; i++) {
-		ly = i - cy;
-		lysq = ly * ly;
-		ny = st->xy_coo[k].y + i;
-		if (ny >= st->orig_map->height) ny = st->orig_map->height-1;
-		for(j = 0 ; j < 2*st->radius+st->speed+2 ; j++) {
-			lx = j - cx;
-			dist = lx * lx + lysq;
-			if (dist > rsq ||
-				ly < -st->radius || ly > st->radius ||
-				lx < -st->radius || lx > st->radius)
-				XPutPixel( st->buffer_map, j, i,
-						   XGetPixel( st->orig_map, st->xy_coo[k].x + j, ny ));
-			else if (dist == 0)
-				XPutPixel( st->buffer_map, j, i, st->black_pixel );
-			else {
-				int	x = st->xy_coo[k].x + cx + (lx * rsq / dist);
-				int	y = st->xy_coo[k].y + cy + (ly * rsq / dist);
-				if (x < 0 || x >= st->xgwa.width ||
-					y < 0 || y >= st->xgwa.height)
-					XPutPixel( st->buffer_map, j, i, st->black_pixel );
-				else
-					XPutPixel( st->buffer_map, j, i,
-							   XGetPixel( st->orig_map, x, y ));
-			}
-		}
-	}
-
-	XPutImage(st->dpy, st->window, st->gc, st->buffer_map, 0, 0, st->xy_coo[k].x, st->xy_coo[k].y,
-			2*st->radius+st->speed+2, 2*st->radius+st->speed+2);
+	queue_lens(st, k, reflect_lens(st, k));
 }
 
+
 /* create a new, random coordinate, that won't interfer with any other
  * coordinates, as the drawing routines would be significantly slowed
  * down if they were to handle serveral layers of distortions
@@ -735,7 +787,7 @@ static void swamp_thing(struct state *st, int k)
 		st->xy_coo[k].r_change = -abs(st->xy_coo[k].r_change);
 	
 	if (st->xy_coo[k].r <= 0) {
-		st->from = st->from_array[0];
+		st->lens_r = 0;
 		st->draw(st,k); 
 		st->xy_coo[k].r_change = abs(st->xy_coo[k].r_change);
 		new_rnd_coo(st,k);
@@ -750,7 +802,7 @@ static void swamp_thing(struct state *st, int k)
 	if (st->xy_coo[k].r <= 0)
 		st->xy_coo[k].r=0;
 
-	st->from = st->from_array[st->xy_coo[k].r];
+	st->lens_r = st->xy_coo[k].r;
 }
 
 
@@ -783,6 +835,7 @@ distort_draw (Display *dpy, Window window, void *closure)
     st->effect(st,k);
     st->draw(st,k);
   }
+  draw_lenses(st);
   return st->delay;
 }
 
@@ -815,27 +868,13 @@ static void
 distort_free (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
-  int i, j;
+  threadpool_destroy (&st->threadpool);
   XFreeGC (st->dpy, st->gc);
   if (st->pm) XFreePixmap (dpy, st->pm);
   if (st->orig_map) XDestroyImage (st->orig_map);
   if (st->buffer_map)
     destroy_xshm_image (st->dpy, st->buffer_map, &st->shm_info);
-  if (st->fast_from) free (st->fast_from);
-  if (st->from_array) free (st->from_array);
-  if (st->buffer_map_cache) free (st->buffer_map_cache);
-
-  if (st->from) {
-    for (i = 0; i < st->from_size; i++)
-      if (st->from[i]) {
-        for (j = 0; j < st->from_size; j++) {
-          if (st->from[i][j]) free (st->from[i][j]);
-        }
-        free (st->from[i]);
-      }
-    free (st->from);
-  }
-
+  free_lens_tables (st);
   free (st);
 }
 
@@ -857,6 +896,7 @@ static const char *distort_defaults [] = {
 	"*reflect:			False",
 	"*blackhole:		False",
 	"*effect:		    none",
+	THREAD_DEFAULTS
 #ifdef HAVE_XSHM_EXTENSION
 	"*useSHM:			False",		/* xshm turns out not to help. */
 #endif /* HAVE_XSHM_EXTENSION */
@@ -887,6 +927,7 @@ static XrmOptionDescRec distort_options [] = {
   { "-shm",       ".useSHM",      XrmoptionNoArg, "True" },
   { "-no-shm",    ".useSHM",      XrmoptionNoArg, "False" },
 #endif /* HAVE_XSHM_EXTENSION */
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
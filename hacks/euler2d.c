@@ -48,6 +48,7 @@ static const char sccsid[] = "@(#)euler2d.c	5.00 2000/11/01 xlockmore";
 					"*ncolors: 64    \n" \
 					"*fpsSolid: true    \n" \
 					"*ignoreRotation: True \n" \
+					THREAD_DEFAULTS_XLOCK
 
 # define SMOOTH_COLORS
 # define release_euler2d 0
@@ -60,6 +61,8 @@ static const char sccsid[] = "@(#)euler2d.c	5.00 2000/11/01 xlockmore";
 
 #ifdef MODE_euler2d
 
+#include "thread_util.h"
+
 #define DEF_EULERTAIL "10"
 
 #define DEBUG_POINTED_REGION    0
@@ -72,6 +75,7 @@ static XrmOptionDescRec opts[] =
 {
   {"-eulertail", ".euler2d.eulertail",   XrmoptionSepArg, NULL},
   {"-eulerpower", ".euler2d.eulerpower", XrmoptionSepArg, NULL},
+  THREAD_OPTIONS
 };
 static argtype vars[] =
 {
@@ -131,23 +135,27 @@ typedef struct {
 	double     *diffx;
 	double     *olddiffx;
 	double     *tempx;
-	double     *tempdiffx;
-/*  (xs[2i+0],xs[2i+1]) is reflection of (x[2i+0],x[2i+1]) about unit circle
-    xs[2i+0] = x[2i+0]/nx
-    xs[2i+1] = x[2i+1]/nx
-    where
-    nx = x[2i+0]*x[2i+0] + x[2i+1]*x[2i+1]
-
-    x_is_zero[i] = (nx < 1e-10)
-*/
-	double     *xs;
-	short      *x_is_zero;
 
 /*  (p[2i+0],p[2i+1]) is image of (x[2i+0],x[2i+1]) under polynomial p.
-    mod_dp2 is |p'(z)|^2 when z = (x[2i+0],x[2i+1]).
 */
 	double	   *p;
-	double	   *mod_dp2;
+
+/*  The vortex points that are still alive, as of the start of the current
+    phase of the step: (va1[j],va2[j]) is the point, vw[j] its vorticity,
+    and (vs1[j],vs2[j]) its reflection about the unit circle, whose
+    vorticity is vrw[j].
+*/
+	int         nv;
+	double      va1[number_of_vortex_points], va2[number_of_vortex_points];
+	double      vs1[number_of_vortex_points], vs2[number_of_vortex_points];
+	double      vw[number_of_vortex_points], vrw[number_of_vortex_points];
+
+/*  The indexes of the tracer particles that are still alive, in order.
+*/
+	int        *live;
+	int         nlive;
+	int         phase;
+	struct threadpool pool;
 
 /* Sometimes in our calculations we get overflow or numbers that are too big.  
    If that happens with the point x[2*i+0], x[2*i+1], we set dead[i].
@@ -170,6 +178,13 @@ typedef struct {
 
 static euler2dstruct *euler2ds = (euler2dstruct *) NULL;
 
+typedef struct {
+	euler2dstruct *sp;
+	unsigned    id;
+} euler2d_thread;
+
+enum { PHASE_AB, PHASE_MID1, PHASE_MID2 };
+
 /*
   If variable_boundary == 1, then we make a variable boundary.
   The way this is done is to map the unit disk under a 
@@ -218,80 +233,6 @@ calc_mod_dp2(double z1, double z2, double p_coef[])
   return mp1*mp1+mp2*mp2;
 }
 
-static void
-calc_all_p(euler2dstruct *sp)
-{
-  int i,j;
-  double temp,p1,p2,z1,z2;
-  for(j=(sp->hide_vortex?sp->Nvortex:0);j<sp->N;j++) if(!sp->dead[j])
-  {
-    p1=0;
-    p2=0;
-    z1=sp->x[2*j+0];
-    z2=sp->x[2*j+1];
-    for(i=deg_p;i>=2;i--)
-    {
-      add(p1,p2,sp->p_coef[(i-2)*2],sp->p_coef[(i-2)*2+1]);
-      mult(p1,p2,z1,z2);
-    }
-    add(p1,p2,1,0);
-    mult(p1,p2,z1,z2);
-    sp->p[2*j+0] = p1;
-    sp->p[2*j+1] = p2;
-  }
-}
-
-static void
-calc_all_mod_dp2(double *x, euler2dstruct *sp)
-{
-  int i,j;
-  double temp,mp1,mp2,z1,z2;
-  for(j=0;j<sp->N;j++) if(!sp->dead[j])
-  {
-    mp1=0;
-    mp2=0;
-    z1=x[2*j+0];
-    z2=x[2*j+1];
-    for(i=deg_p;i>=2;i--)
-    {
-      add(mp1,mp2,i*sp->p_coef[(i-2)*2],i*sp->p_coef[(i-2)*2+1]);
-      mult(mp1,mp2,z1,z2);
-    }
-    add(mp1,mp2,1,0);
-    sp->mod_dp2[j] = mp1*mp1+mp2*mp2;
-  }
-}
-
-static void
-derivs(double *x, euler2dstruct *sp)
-{
-  int i,j;
-  double u1,u2,x1,x2,xij1,xij2,nxij;
-  double nx;
-
-  if (variable_boundary)
-    calc_all_mod_dp2(sp->x,sp);
-
-  for (j=0;j<sp->Nvortex;j++) if (!sp->dead[j])
-  {
-    nx = x[2*j+0]*x[2*j+0] + x[2*j+1]*x[2*j+1];
-    if (nx < 1e-10)
-      sp->x_is_zero[j] = 1;
-    else {
-      sp->x_is_zero[j] = 0;
-      sp->xs[2*j+0] = x[2*j+0]/nx;
-      sp->xs[2*j+1] = x[2*j+1]/nx;
-    }
-  }
-
-  (void) memset(sp->diffx,0,sizeof(double)*2*sp->N);
-
-  for (i=0;i<sp->N;i++) if (!sp->dead[i])
-  {
-    x1 = x[2*i+0];
-    x2 = x[2*i+1];
-    for (j=0;j<sp->Nvortex;j++) if (!sp->dead[j])
-    {
 /*
   Calculate the Biot-Savart kernel, that is, effect of a 
   vortex point at a = (x[2*j+0],x[2*j+1]) at the point 
@@ -312,53 +253,41 @@ derivs(double *x, euler2dstruct *sp)
 
   u = (x-a)/|x-a|^(power+1)  -  |a|^(1-power) (x-as)/|x-as|^(power+1)
 
+  The tracer particles don't affect anything, so given the positions of
+  the vortex points, each of them can be moved independently of all the
+  others.  So we take a snapshot of the vortex points (vortex_table),
+  and then move the tracers in blocks, spread across the threadpool.
+  Within a block, the particles' coordinates are gathered into
+  contiguous arrays, and the loop over the block is innermost, so it can
+  be vectorized.  The vortex points themselves are moved the same way,
+  on the main thread.
 */
 
-      xij1 = x1 - x[2*j+0];
-      xij2 = x2 - x[2*j+1];
-      nxij = (power==1.0) ? xij1*xij1+xij2*xij2 : pow(xij1*xij1+xij2*xij2,(power+1)/2.0);
-
-      if(nxij >= 1e-4)  {
-        u1 =  xij2/nxij;
-        u2 = -xij1/nxij;
-      }
-      else
-        u1 = u2 = 0.0;
-
-      if (!sp->x_is_zero[j])
-      {
-        xij1 = x1 - sp->xs[2*j+0];
-        xij2 = x2 - sp->xs[2*j+1];
-        nxij = (power==1.0) ? xij1*xij1+xij2*xij2 : pow(xij1*xij1+xij2*xij2,(power+1)/2.0);
-
-        if (nxij < 1e-5)
-        {
-          sp->dead[i] = 1;
-          u1 = u2 = 0.0;
-        }
-        else
-        {
-          u1 -= xij2/nxij;
-          u2 += xij1/nxij;
-        }
-      }
+static void
+vortex_table(double *x, euler2dstruct *sp)
+{
+  int j;
+  double nx;
 
-      if (!sp->dead[i])
-      {
-        sp->diffx[2*i+0] += u1*sp->w[j];
-        sp->diffx[2*i+1] += u2*sp->w[j];
-      }
+  sp->nv = 0;
+  for (j=0;j<sp->Nvortex;j++) if (!sp->dead[j])
+  {
+    int v = sp->nv++;
+    sp->va1[v] = x[2*j+0];
+    sp->va2[v] = x[2*j+1];
+    sp->vw[v]  = sp->w[j];
+    nx = x[2*j+0]*x[2*j+0] + x[2*j+1]*x[2*j+1];
+    if (nx < 1e-10)
+    {
+      /* The reflection is at infinity: it contributes nothing. */
+      sp->vs1[v] = sp->vs2[v] = 1e5;
+      sp->vrw[v] = 0;
     }
-
-    if (!sp->dead[i] && variable_boundary)
+    else
     {
-      if (sp->mod_dp2[i] < 1e-5)
-        sp->dead[i] = 1;
-      else
-      {
-        sp->diffx[2*i+0] /= sp->mod_dp2[i];
-        sp->diffx[2*i+1] /= sp->mod_dp2[i];
-      }
+      sp->vs1[v] = x[2*j+0]/nx;
+      sp->vs2[v] = x[2*j+1]/nx;
+      sp->vrw[v] = sp->w[j];
     }
   }
 }
@@ -376,32 +305,31 @@ derivs(double *x, euler2dstruct *sp)
   the edge of the boundary bounce around.
 
   But it seems to be not that effective, so for now switch it off.
+
+  Returns false if the particle died.
 */
 
 #define SUBTLE_PERTURB 0
 
-static void
-perturb(double ret[], double x[], double k[], euler2dstruct *sp)
+static Bool
+perturb(double ret[2], const double x[2], double k1, double k2)
 {
-  int i;
-  double x1,x2,k1,k2;
+  double x1,x2;
+
+  x1 = x[0];
+  x2 = x[1];
 
 #if SUBTLE_PERTURB
-  double d1,d2,t1,t2,mag,mag2,mlog1mmag,memmagdmag,xdotk;
-  for (i=0;i<sp->N;i++) if (!sp->dead[i])
   {
-    x1 = x[2*i+0];
-    x2 = x[2*i+1];
-    k1 = k[2*i+0];
-    k2 = k[2*i+1];
+    double d1,d2,t1,t2,mag,mag2,mlog1mmag,memmagdmag,xdotk;
     mag2 = x1*x1 + x2*x2;
     if (mag2 < 1e-10)
     {
-      ret[2*i+0] = x1+k1;
-      ret[2*i+1] = x2+k2;
+      ret[0] = x1+k1;
+      ret[1] = x2+k2;
     }
     else if (mag2 > 1-1e-5)
-      sp->dead[i] = 1;
+      return False;
     else
     {
       mag = sqrt(mag2);
@@ -411,75 +339,215 @@ perturb(double ret[], double x[], double k[], euler2dstruct *sp)
       t2 = (x2 + k2)*mlog1mmag/mag + x2*xdotk*(1.0/(1-mag)-mlog1mmag/mag)/mag/mag;
       mag = sqrt(t1*t1+t2*t2);
       if (mag > 11.5 /* log(1e5) */)
-        sp->dead[i] = 1;
-      else
-      {
-        memmagdmag = (mag>1e-5) ? ((1.0-exp(-mag))/mag) : (1-mag/2.0);
-        ret[2*i+0] = t1*memmagdmag;
-        ret[2*i+1] = t2*memmagdmag;
-      }
-    }
-    if (!sp->dead[i])
-    {
-      d1 = ret[2*i+0]-x1;
-      d2 = ret[2*i+1]-x2;
-      if (d1*d1+d2*d2 > 0.1)
-        sp->dead[i] = 1;
+        return False;
+      memmagdmag = (mag>1e-5) ? ((1.0-exp(-mag))/mag) : (1-mag/2.0);
+      ret[0] = t1*memmagdmag;
+      ret[1] = t2*memmagdmag;
     }
+    d1 = ret[0]-x1;
+    d2 = ret[1]-x2;
+    if (d1*d1+d2*d2 > 0.1)
+      return False;
   }
 
 #else
 
-  for (i=0;i<sp->N;i++) if (!sp->dead[i])
+  if (k1*k1+k2*k2 > 0.1 || x1*x1+x2*x2 > 1-1e-5)
+    return False;
+  ret[0] = x1+k1;
+  ret[1] = x2+k2;
+#endif
+  return True;
+}
+
+/* Moves the particles whose indexes are in idx[0 .. n-1], n <= BLOCK.
+   How depends on sp->phase: the first or second half of a midpoint
+   step, or an Adams-Bashforth step.  Only touches the entries of the
+   particle arrays belonging to those particles.
+ */
+#define BLOCK 256
+
+static void
+move_block(euler2dstruct *sp, const int *idx, int n)
+{
+  double x1[BLOCK], x2[BLOCK], u1[BLOCK], u2[BLOCK];
+  char bad[BLOCK];
+  const double *pos = (sp->phase == PHASE_MID2 ? sp->tempx : sp->x);
+  int j,k;
+
+  for (k=0;k<n;k++)
   {
-    x1 = x[2*i+0];
-    x2 = x[2*i+1];
-    k1 = k[2*i+0];
-    k2 = k[2*i+1];
-    if (k1*k1+k2*k2 > 0.1 || x1*x1+x2*x2 > 1-1e-5)
-      sp->dead[i] = 1;
+    x1[k] = pos[2*idx[k]+0];
+    x2[k] = pos[2*idx[k]+1];
+    u1[k] = u2[k] = 0;
+    bad[k] = 0;
+  }
+
+  for (j=0;j<sp->nv;j++)
+  {
+    const double a1 = sp->va1[j], a2 = sp->va2[j], w = sp->vw[j];
+    const double s1 = sp->vs1[j], s2 = sp->vs2[j], rw = sp->vrw[j];
+
+    if (power == 1.0)
+      for (k=0;k<n;k++)
+      {
+        double xij1 = x1[k] - a1;
+        double xij2 = x2[k] - a2;
+        double nxij = xij1*xij1+xij2*xij2;
+        double inv  = (nxij >= 1e-4 ? w/nxij : 0);
+        double xsj1 = x1[k] - s1;
+        double xsj2 = x2[k] - s2;
+        double nxsj = xsj1*xsj1+xsj2*xsj2;
+        double invs = (nxsj >= 1e-5 ? rw/nxsj : 0);
+        u1[k] += xij2*inv - xsj2*invs;
+        u2[k] += xsj1*invs - xij1*inv;
+        bad[k] |= (nxsj < 1e-5);
+      }
     else
+      for (k=0;k<n;k++)
+      {
+        double xij1 = x1[k] - a1;
+        double xij2 = x2[k] - a2;
+        double nxij = pow(xij1*xij1+xij2*xij2,(power+1)/2.0);
+        double inv  = (nxij >= 1e-4 ? w/nxij : 0);
+        double xsj1 = x1[k] - s1;
+        double xsj2 = x2[k] - s2;
+        double nxsj = pow(xsj1*xsj1+xsj2*xsj2,(power+1)/2.0);
+        double invs = (nxsj >= 1e-5 ? rw/nxsj : 0);
+        u1[k] += xij2*inv - xsj2*invs;
+        u2[k] += xsj1*invs - xij1*inv;
+        bad[k] |= (nxsj < 1e-5);
+      }
+  }
+
+  for (k=0;k<n;k++)
+  {
+    int i = idx[k];
+    double *diff = sp->diffx + 2*i;
+
+    if (bad[k])
+    {
+      sp->dead[i] = 1;
+      continue;
+    }
+
+    if (variable_boundary)
     {
-      ret[2*i+0] = x1+k1;
-      ret[2*i+1] = x2+k2;
+      double mod_dp2 = calc_mod_dp2(sp->x[2*i+0],sp->x[2*i+1],sp->p_coef);
+      if (mod_dp2 < 1e-5)
+      {
+        sp->dead[i] = 1;
+        continue;
+      }
+      u1[k] /= mod_dp2;
+      u2[k] /= mod_dp2;
+    }
+    diff[0] = u1[k];
+    diff[1] = u2[k];
+
+    switch (sp->phase) {
+    case PHASE_MID1:
+      sp->olddiffx[2*i+0] = diff[0];
+      sp->olddiffx[2*i+1] = diff[1];
+      if (!perturb(sp->tempx+2*i, sp->x+2*i,
+                   0.5*delta_t*diff[0], 0.5*delta_t*diff[1]))
+        sp->dead[i] = 1;
+      break;
+    case PHASE_MID2:
+      if (!perturb(sp->x+2*i, sp->x+2*i,
+                   delta_t*diff[0], delta_t*diff[1]))
+        sp->dead[i] = 1;
+      break;
+    default:
+      if (!perturb(sp->x+2*i, sp->x+2*i,
+                   delta_t*(1.5*diff[0] - 0.5*sp->olddiffx[2*i+0]),
+                   delta_t*(1.5*diff[1] - 0.5*sp->olddiffx[2*i+1])))
+        sp->dead[i] = 1;
+      break;
     }
+
+    if (sp->phase != PHASE_MID1 && !sp->dead[i] && variable_boundary)
+      calc_p(&sp->p[2*i+0],&sp->p[2*i+1],sp->x[2*i+0],sp->x[2*i+1],
+             sp->p_coef);
   }
-#endif
+}
+
+static int
+euler2d_thread_create(void *self, struct threadpool *pool, unsigned id)
+{
+  euler2d_thread *t = (euler2d_thread *) self;
+  t->sp = GET_PARENT_OBJ(euler2dstruct, pool, pool);
+  t->id = id;
+  return 0;
+}
+
+static void
+euler2d_thread_destroy(void *self)
+{
+}
+
+/* Each thread takes every count'th block of the live tracers. */
+static void
+euler2d_thread_run(void *self)
+{
+  euler2d_thread *t = (euler2d_thread *) self;
+  euler2dstruct *sp = t->sp;
+  int b;
+  for (b = t->id * BLOCK; b < sp->nlive; b += sp->pool.count * BLOCK)
+    move_block(sp, sp->live + b,
+               (sp->nlive - b < BLOCK ? sp->nlive - b : BLOCK));
+}
+
+/* Moves every particle that is still alive one phase of a step. */
+static void
+move_all(euler2dstruct *sp, int phase)
+{
+  int idx[number_of_vortex_points];
+  int i,n;
+
+  sp->phase = phase;
+  vortex_table(phase == PHASE_MID2 ? sp->tempx : sp->x, sp);
+
+  threadpool_run(&sp->pool, euler2d_thread_run);
+
+  /* The vortex points, while the threads do the tracers.  This reads the
+     snapshot in the vortex table, not their positions. */
+  for (i=0,n=0;i<sp->Nvortex;i++) if (!sp->dead[i])
+    idx[n++] = i;
+  move_block(sp, idx, n);
+
+  threadpool_wait(&sp->pool);
+}
+
+/* Drops the tracers that died from the list of live ones, keeping the
+   rest in order. */
+static void
+compact_live(euler2dstruct *sp)
+{
+  int i,n;
+  for (i=0,n=0;i<sp->nlive;i++)
+    if (!sp->dead[sp->live[i]])
+      sp->live[n++] = sp->live[i];
+  sp->nlive = n;
 }
 
 static void
 ode_solve(euler2dstruct *sp)
 {
-  int i;
   double *temp;
 
   if (sp->count < 1) {
     /* midpoint method */
-    derivs(sp->x,sp);
-    (void) memcpy(sp->olddiffx,sp->diffx,sizeof(double)*2*sp->N);
-    for (i=0;i<sp->N;i++) if (!sp->dead[i]) {
-      sp->tempdiffx[2*i+0] = 0.5*delta_t*sp->diffx[2*i+0];
-      sp->tempdiffx[2*i+1] = 0.5*delta_t*sp->diffx[2*i+1];
-    }
-    perturb(sp->tempx,sp->x,sp->tempdiffx,sp);
-    derivs(sp->tempx,sp);
-    for (i=0;i<sp->N;i++) if (!sp->dead[i]) {
-      sp->tempdiffx[2*i+0] = delta_t*sp->diffx[2*i+0];
-      sp->tempdiffx[2*i+1] = delta_t*sp->diffx[2*i+1];
-    }
-    perturb(sp->x,sp->x,sp->tempdiffx,sp);
+    move_all(sp, PHASE_MID1);
+    move_all(sp, PHASE_MID2);
   } else {
     /* Adams Basforth */
-    derivs(sp->x,sp);
-    for (i=0;i<sp->N;i++) if (!sp->dead[i]) {
-      sp->tempdiffx[2*i+0] = delta_t*(1.5*sp->diffx[2*i+0] - 0.5*sp->olddiffx[2*i+0]);
-      sp->tempdiffx[2*i+1] = delta_t*(1.5*sp->diffx[2*i+1] - 0.5*sp->olddiffx[2*i+1]);
-    }
-    perturb(sp->x,sp->x,sp->tempdiffx,sp);
+    move_all(sp, PHASE_AB);
     temp = sp->olddiffx;
     sp->olddiffx = sp->diffx;
     sp->diffx = temp;
   }
+  compact_live(sp);
 }
 
 #define deallocate(p,t) if (p!=NULL) {(void) free((void *) p); p=(t*)NULL; }
@@ -498,14 +566,13 @@ free_euler2d(ModeInfo * mi)
 	deallocate(sp->diffx, double);
 	deallocate(sp->w, double);
 	deallocate(sp->olddiffx, double);
-	deallocate(sp->tempdiffx, double);
 	deallocate(sp->tempx, double);
 	deallocate(sp->dead, short);
 	deallocate(sp->boundary, XSegment);
-	deallocate(sp->xs, double);
-	deallocate(sp->x_is_zero, short);
 	deallocate(sp->p, double);
-	deallocate(sp->mod_dp2, double);
+	deallocate(sp->live, int);
+	if (sp->pool.count)
+		threadpool_destroy(&sp->pool);
 }
 
 ENTRYPOINT void
@@ -586,20 +653,35 @@ init_euler2d (ModeInfo * mi)
 		allocate(sp->diffx, double, sp->N * 2);
 		allocate(sp->w, double, sp->Nvortex);
 		allocate(sp->olddiffx, double, sp->N * 2);
-		allocate(sp->tempdiffx, double, sp->N * 2);
 		allocate(sp->tempx, double, sp->N * 2);
 		allocate(sp->dead, short, sp->N);
 		allocate(sp->boundary, XSegment, n_bound_p);
-		allocate(sp->xs, double, sp->Nvortex * 2);
-		allocate(sp->x_is_zero, short, sp->Nvortex);
 		allocate(sp->p, double, sp->N * 2);
-		allocate(sp->mod_dp2, double, sp->N);
+		allocate(sp->live, int, sp->N);
+	}
+
+	if (!sp->pool.count) {
+		static const struct threadpool_class cls = {
+			sizeof(euler2d_thread),
+			euler2d_thread_create,
+			euler2d_thread_destroy
+		};
+		int err = threadpool_create(&sp->pool, &cls, MI_DISPLAY(mi),
+		                            hardware_concurrency(MI_DISPLAY(mi)));
+		if (err) {
+			fprintf(stderr, "%s: threadpool: %s\n", progname,
+			        strerror(err));
+			exit(1);
+		}
 	}
 	for (i=0;i<tail_len;i++) {
 		sp->nold_segs[i] = 0;
 	}
 	sp->c_old_seg = 0;
 	(void) memset(sp->dead,0,sp->N*sizeof(short));
+	sp->nlive = 0;
+	for (i=sp->Nvortex;i<sp->N;i++)
+		sp->live[sp->nlive++] = i;
 
 	if (variable_boundary)
 	{
@@ -776,7 +858,7 @@ draw_euler2d (ModeInfo * mi)
 	Display    *display = MI_DISPLAY(mi);
 	Window      window = MI_WINDOW(mi);
 	GC          gc = MI_GC(mi);
-	int         b, col, n_non_vortex_segs;
+	int         i, b, col, n_non_vortex_segs;
 	euler2dstruct *sp;
 
 	MI_IS_DRAWN(mi) = True;
@@ -788,12 +870,11 @@ draw_euler2d (ModeInfo * mi)
 		return;
 
 	ode_solve(sp);
-	if (variable_boundary)
-		calc_all_p(sp);
 
 	sp->cnsegs = 0;
-	for(b=sp->Nvortex;b<sp->N;b++) if(!sp->dead[b])
+	for(i=0;i<sp->nlive;i++)
 	{
+		b = sp->live[i];
 		sp->csegs[sp->cnsegs].x1 = sp->lastx[2*b+0];
 		sp->csegs[sp->cnsegs].y1 = sp->lastx[2*b+1];
 		if (variable_boundary)
@@ -69,6 +69,19 @@ typedef struct {
   float e;		/* coeficient of elasticity */
   float max_radius;	/* largest radius of any ball */
 
+  /* Broadphase: the window is divided into square cells at least as large
+     as the biggest ball, so a ball can only touch balls in its own cell or
+     the 8 around it.  Rebuilt every step with a counting sort: the balls
+     in cell c are cell_ball[cell_start[c] ... cell_start[c+1]-1]. */
+  float cell_size;
+  int grid_w, grid_h;
+  int ncells_alloc;
+  int *cell_start;	/* ncells + 1 */
+  int *cell_of;		/* cell index of each ball */
+  int *cell_ball;	/* ball indexes, sorted by cell */
+
+  XArc *arcs;		/* count erase arcs, then count draw arcs */
+
   Bool random_sizes_p;  /* Whether balls should be various sizes up to max. */
   Bool shake_p;		/* Whether to mess with gravity when things settle. */
   Bool dbuf;            /* Whether we're using double buffering. */
@@ -376,6 +389,21 @@ fluidballs_init (Display *dpy, Window window)
   state->py  = (float *) malloc (sizeof (*state->py)  * (state->count + 1));
   state->opx = (float *) malloc (sizeof (*state->opx) * (state->count + 1));
   state->opy = (float *) malloc (sizeof (*state->opy) * (state->count + 1));
+  state->cell_of   = (int *) malloc (sizeof (*state->cell_of) *
+                                     (state->count + 1));
+  state->cell_ball = (int *) malloc (sizeof (*state->cell_ball) *
+                                     (state->count + 1));
+  state->arcs = (XArc *) malloc (sizeof (*state->arcs) * state->count * 2);
+
+  /* Cells must be at least one ball diameter across; but if the balls are
+     tiny and few, bigger cells keep the grid from being mostly empty. */
+  state->cell_size = state->max_radius * 2;
+  if (state->count > 0)
+    {
+      float area = (state->xgwa.width * state->xgwa.height) / state->count;
+      if (state->cell_size * state->cell_size < area)
+        state->cell_size = sqrt (area);
+    }
 
   for (i=1; i<=state->count; i++)
     {
@@ -504,15 +532,18 @@ check_wall_clock (b_state *state, float max_d)
 }
 
 /* Erases the balls at their previous positions, and draws the new ones.
+   All of the erasing happens first, so that erasing one ball can't take
+   a bite out of another that was already drawn; then all of the balls
+   go out in one XFillArcs, except the one being dragged, which is in a
+   different color.
  */
 static void
 repaint_balls (b_state *state)
 {
   int a;
-# ifndef HAVE_JWXYZ
-  int x1a, x2a, y1a, y2a;
-# endif
-  int x1b, x2b, y1b, y2b;
+  int nerase = 0, ndraw = 0;
+  XArc *erase = state->arcs;
+  XArc *draw  = state->arcs + state->count;
   float max_d = 0;
 
 #ifdef HAVE_JWXYZ	/* Don't second-guess Quartz's double-buffering */
@@ -521,42 +552,41 @@ repaint_balls (b_state *state)
 
   for (a=1; a <= state->count; a++)
     {
-      GC gc;
-# ifndef HAVE_JWXYZ
-      x1a = (state->opx[a] - state->r[a] - state->xmin);
-      y1a = (state->opy[a] - state->r[a] - state->ymin);
-      x2a = (state->opx[a] + state->r[a] - state->xmin);
-      y2a = (state->opy[a] + state->r[a] - state->ymin);
-# endif
+      int x1, y1, x2, y2;
 
-      x1b = (state->px[a] - state->r[a] - state->xmin);
-      y1b = (state->py[a] - state->r[a] - state->ymin);
-      x2b = (state->px[a] + state->r[a] - state->xmin);
-      y2b = (state->py[a] + state->r[a] - state->ymin);
-
-#ifndef HAVE_JWXYZ	/* Don't second-guess Quartz's double-buffering */
-#ifdef HAVE_DOUBLE_BUFFER_EXTENSION
+# ifndef HAVE_JWXYZ
+#  ifdef HAVE_DOUBLE_BUFFER_EXTENSION
       if (!state->dbeclear_p || !state->backb)
-#endif /* HAVE_DOUBLE_BUFFER_EXTENSION */
-	{
-/*	  if (x1a != x1b || y1a != y1b)   -- leaves turds if we optimize this */
-	    {
-	      gc = state->erase_gc;
-	      XFillArc (state->dpy, state->b, gc,
-			x1a, y1a, x2a-x1a, y2a-y1a,
-			0, 360*64);
-	    }
-	}
-#endif /* !HAVE_JWXYZ */
-
-      if (state->mouse_ball == a)
-        gc = state->draw_gc2;
-      else
-        gc = state->draw_gc;
+#  endif /* HAVE_DOUBLE_BUFFER_EXTENSION */
+        {
+          x1 = (state->opx[a] - state->r[a] - state->xmin);
+          y1 = (state->opy[a] - state->r[a] - state->ymin);
+          x2 = (state->opx[a] + state->r[a] - state->xmin);
+          y2 = (state->opy[a] + state->r[a] - state->ymin);
+          erase[nerase].x = x1;
+          erase[nerase].y = y1;
+          erase[nerase].width  = x2 - x1;
+          erase[nerase].height = y2 - y1;
+          erase[nerase].angle1 = 0;
+          erase[nerase].angle2 = 360*64;
+          nerase++;
+        }
+# endif /* !HAVE_JWXYZ */
 
-      XFillArc (state->dpy, state->b, gc,
-                x1b, y1b, x2b-x1b, y2b-y1b,
-                0, 360*64);
+      if (state->mouse_ball != a)
+        {
+          x1 = (state->px[a] - state->r[a] - state->xmin);
+          y1 = (state->py[a] - state->r[a] - state->ymin);
+          x2 = (state->px[a] + state->r[a] - state->xmin);
+          y2 = (state->py[a] + state->r[a] - state->ymin);
+          draw[ndraw].x = x1;
+          draw[ndraw].y = y1;
+          draw[ndraw].width  = x2 - x1;
+          draw[ndraw].height = y2 - y1;
+          draw[ndraw].angle1 = 0;
+          draw[ndraw].angle2 = 360*64;
+          ndraw++;
+        }
 
       if (state->shake_p)
         {
@@ -567,11 +597,29 @@ repaint_balls (b_state *state)
                      (state->py[a] - state->opy[a]));
           if (d > max_d) max_d = d;
         }
+    }
 
-      state->opx[a] = state->px[a];
-      state->opy[a] = state->py[a];
+  if (nerase)
+    XFillArcs (state->dpy, state->b, state->erase_gc, erase, nerase);
+  if (ndraw)
+    XFillArcs (state->dpy, state->b, state->draw_gc, draw, ndraw);
+
+  if (state->mouse_ball)
+    {
+      a = state->mouse_ball;
+      XFillArc (state->dpy, state->b, state->draw_gc2,
+                (int) (state->px[a] - state->r[a] - state->xmin),
+                (int) (state->py[a] - state->r[a] - state->ymin),
+                (int) (state->px[a] + state->r[a] - state->xmin) -
+                (int) (state->px[a] - state->r[a] - state->xmin),
+                (int) (state->py[a] + state->r[a] - state->ymin) -
+                (int) (state->py[a] - state->r[a] - state->ymin),
+                0, 360*64);
     }
 
+  memcpy (state->opx, state->px, sizeof (*state->opx) * (state->count + 1));
+  memcpy (state->opy, state->py, sizeof (*state->opy) * (state->count + 1));
+
   if (state->fps_p
 #ifdef HAVE_DOUBLE_BUFFER_EXTENSION
       && (state->backb ? state->dbeclear_p : 1)
@@ -609,16 +657,132 @@ repaint_balls (b_state *state)
 }
 
 
-/* Implements the laws of physics: move balls to their new positions.
+/* If balls a and b overlap, push them apart and bounce them.
  */
 static void
-update_balls (b_state *state)
+collide (b_state *state, int a, int b)
 {
-  int a, b;
   float d, vxa, vya, vxb, vyb, dd, cdx, cdy;
   float ma, mb, vca, vcb, dva, dvb;
   float dee2;
 
+  d = ((state->px[a] - state->px[b]) *
+       (state->px[a] - state->px[b]) +
+       (state->py[a] - state->py[b]) *
+       (state->py[a] - state->py[b]));
+  dee2 = (state->r[a] + state->r[b]) *
+         (state->r[a] + state->r[b]);
+  if (d >= dee2)
+    return;
+
+  state->collision_count++;
+  d = sqrt(d);
+  if (d <= 0) return;	/* exactly on top of each other: no axis */
+  dd = state->r[a] + state->r[b] - d;
+
+  cdx = (state->px[b] - state->px[a]) / d;
+  cdy = (state->py[b] - state->py[a]) / d;
+
+  /* Move each ball apart from the other by half the
+   * 'collision' distance.
+   */
+  state->px[a] -= 0.5 * dd * cdx;
+  state->py[a] -= 0.5 * dd * cdy;
+  state->px[b] += 0.5 * dd * cdx;
+  state->py[b] += 0.5 * dd * cdy;
+
+  ma = state->m[a];
+  mb = state->m[b];
+
+  vxa = state->vx[a];
+  vya = state->vy[a];
+  vxb = state->vx[b];
+  vyb = state->vy[b];
+
+  vca = vxa * cdx + vya * cdy; /* the component of each velocity */
+  vcb = vxb * cdx + vyb * cdy; /* along the axis of the collision */
+
+  /* elastic collison */
+  dva = (vca * (ma - mb) + vcb * 2 * mb) / (ma + mb) - vca;
+  dvb = (vcb * (mb - ma) + vca * 2 * ma) / (ma + mb) - vcb;
+
+  dva *= state->e; /* some energy lost to inelasticity */
+  dvb *= state->e;
+
+#if 0
+  dva += (frand (50) - 25) / ma;   /* q: why are elves so chaotic? */
+  dvb += (frand (50) - 25) / mb;   /* a: brownian motion. */
+#endif
+
+  vxa += dva * cdx;
+  vya += dva * cdy;
+  vxb += dvb * cdx;
+  vyb += dvb * cdy;
+
+  state->vx[a] = vxa;
+  state->vy[a] = vya;
+  state->vx[b] = vxb;
+  state->vy[b] = vyb;
+}
+
+
+/* Sorts the balls into grid cells.
+ */
+static void
+build_grid (b_state *state)
+{
+  float cs = state->cell_size;
+  int gw = (state->xmax - state->xmin) / cs + 1;
+  int gh = (state->ymax - state->ymin) / cs + 1;
+  int ncells, a, c;
+
+  if (gw < 1) gw = 1;
+  if (gh < 1) gh = 1;
+  ncells = gw * gh;
+  state->grid_w = gw;
+  state->grid_h = gh;
+
+  if (ncells + 1 > state->ncells_alloc)
+    {
+      state->ncells_alloc = ncells + 1;
+      state->cell_start = (int *)
+        realloc (state->cell_start,
+                 sizeof (*state->cell_start) * state->ncells_alloc);
+      if (! state->cell_start) abort();
+    }
+
+  memset (state->cell_start, 0, sizeof (*state->cell_start) * (ncells + 1));
+
+  for (a = 1; a <= state->count; a++)
+    {
+      int cx = (state->px[a] - state->xmin) / cs;
+      int cy = (state->py[a] - state->ymin) / cs;
+      if (cx < 0) cx = 0; else if (cx >= gw) cx = gw - 1;
+      if (cy < 0) cy = 0; else if (cy >= gh) cy = gh - 1;
+      c = cy * gw + cx;
+      state->cell_of[a] = c;
+      state->cell_start[c]++;
+    }
+
+  /* Running totals: now cell_start[c] is the end of cell c. */
+  for (c = 1; c < ncells; c++)
+    state->cell_start[c] += state->cell_start[c - 1];
+  state->cell_start[ncells] = state->count;
+
+  /* Filling in backward from the end of each cell leaves cell_start[c] at
+     its start, and keeps the balls in index order within a cell. */
+  for (a = state->count; a >= 1; a--)
+    state->cell_ball[--state->cell_start[state->cell_of[a]]] = a;
+}
+
+
+/* Implements the laws of physics: move balls to their new positions.
+ */
+static void
+update_balls (b_state *state)
+{
+  int a, cx, cy;
+
   check_window_moved (state);
 
   /* If we're currently tracking the mouse, update that ball first.
@@ -639,66 +803,40 @@ update_balls (b_state *state)
          state->tc);
     }
 
-  /* For each ball, compute the influence of every other ball. */
-  for (a=1; a <= state->count -  1; a++)
-    for (b=a + 1; b <= state->count; b++)
+  /* For each ball, compute the influence of every other ball that is
+     close enough to touch it.  Each pair of neighboring cells is visited
+     once: a cell against itself, and against the cells to its right,
+     below-left, below and below-right.
+   */
+  build_grid (state);
+  for (cy = 0; cy < state->grid_h; cy++)
+    for (cx = 0; cx < state->grid_w; cx++)
       {
-         d = ((state->px[a] - state->px[b]) *
-              (state->px[a] - state->px[b]) +
-              (state->py[a] - state->py[b]) *
-              (state->py[a] - state->py[b]));
-         dee2 = (state->r[a] + state->r[b]) *
-                (state->r[a] + state->r[b]);
-         if (d < dee2)
-         {
-            state->collision_count++;
-            d = sqrt(d);
-            dd = state->r[a] + state->r[b] - d;
-
-            cdx = (state->px[b] - state->px[a]) / d;
-            cdy = (state->py[b] - state->py[a]) / d;
-
-            /* Move each ball apart from the other by half the
-             * 'collision' distance.
-             */
-            state->px[a] -= 0.5 * dd * cdx;
-            state->py[a] -= 0.5 * dd * cdy;
-            state->px[b] += 0.5 * dd * cdx;
-            state->py[b] += 0.5 * dd * cdy;
-
-            ma = state->m[a];
-            mb = state->m[b];
-
-            vxa = state->vx[a];
-            vya = state->vy[a];
-            vxb = state->vx[b];
-            vyb = state->vy[b];
-
-            vca = vxa * cdx + vya * cdy; /* the component of each velocity */
-            vcb = vxb * cdx + vyb * cdy; /* along the axis of the collision */
-
-            /* elastic collison */
-            dva = (vca * (ma - mb) + vcb * 2 * mb) / (ma + mb) - vca;
-            dvb = (vcb * (mb - ma) + vca * 2 * ma) / (ma + mb) - vcb;
-
-            dva *= state->e; /* some energy lost to inelasticity */
-            dvb *= state->e;
-
-#if 0
-            dva += (frand (50) - 25) / ma;   /* q: why are elves so chaotic? */
-            dvb += (frand (50) - 25) / mb;   /* a: brownian motion. */
-#endif
-
-            vxa += dva * cdx;
-            vya += dva * cdy;
-            vxb += dvb * cdx;
-            vyb += dvb * cdy;
-
-            state->vx[a] = vxa;
-            state->vy[a] = vya;
-            state->vx[b] = vxb;
-            state->vy[b] = vyb;
-         }
+        static const int nbr[4][2] = { { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 } };
+        int c = cy * state->grid_w + cx;
+        int i0 = state->cell_start[c], i1 = state->cell_start[c + 1];
+        int i, j, n;
+
+        if (i0 == i1) continue;
+
+        for (i = i0; i < i1 - 1; i++)
+          for (j = i + 1; j < i1; j++)
+            collide (state, state->cell_ball[i], state->cell_ball[j]);
+
+        for (n = 0; n < countof(nbr); n++)
+          {
+            int nx = cx + nbr[n][0];
+            int ny = cy + nbr[n][1];
+            int c2, j0, j1;
+            if (nx < 0 || nx >= state->grid_w || ny >= state->grid_h)
+              continue;
+            c2 = ny * state->grid_w + nx;
+            j0 = state->cell_start[c2];
+            j1 = state->cell_start[c2 + 1];
+            for (i = i0; i < i1; i++)
+              for (j = j0; j < j1; j++)
+                collide (state, state->cell_ball[i], state->cell_ball[j]);
+          }
       }
 
    /* Force all balls to be on screen.
@@ -828,6 +966,10 @@ fluidballs_free (Display *dpy, Window window, void *closure)
   free (state->py);
   free (state->opx);
   free (state->opy);
+  free (state->cell_start);
+  free (state->cell_of);
+  free (state->cell_ball);
+  free (state->arcs);
   free (state);
 }
 
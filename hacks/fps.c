@@ -110,6 +110,15 @@ fps_slept (fps_state *st, unsigned long usecs)
 }
 
 
+void
+fps_extra (fps_state *st, const char *s)
+{
+  if (! st) return;
+  strncpy (st->extra, s, sizeof(st->extra) - 1);
+  st->extra[sizeof(st->extra) - 1] = 0;
+}
+
+
 double
 fps_compute (fps_state *st, unsigned long polys, double depth)
 {
@@ -218,6 +227,12 @@ fps_compute (fps_state *st, unsigned long polys, double depth)
                 st->string[L-2] = 0;
             }
         }
+
+      if (*st->extra)
+        {
+          strcat (st->string, "\n");
+          strcat (st->string, st->extra);
+        }
     }
 
   return st->last_fps;
@@ -21,6 +21,10 @@ extern void fps_slept (fps_state *, unsigned long usecs);
 extern double fps_compute (fps_state *, unsigned long polys, double depth);
 extern void fps_draw (fps_state *);
 
+/* More lines of text to show below the frame rate, replacing any from
+   the last call.  They appear the next time fps_compute updates. */
+extern void fps_extra (fps_state *, const char *);
+
 /* Doesn't really belong here, but close enough. */
 #ifdef HAVE_MOBILE
   extern double current_device_rotation (void);
@@ -22,6 +22,7 @@ struct fps_state {
   XftFont *font;
   Bool clear_p;
   char string[1024];
+  char extra[256];	/* from fps_extra() */
 
   /* for glx/fps-gl.c */
   void *gl_fps_data;
@@ -46,6 +46,7 @@ static const char sccsid[] = "@(#)galaxy.c 4.04 97/07/28 xlockmore";
 					"*ncolors:  64   \n" \
 					"*fpsSolid:  true   \n" \
 					"*ignoreRotation: True \n" \
+					THREAD_DEFAULTS_XLOCK
 
 /*				    "*lowrez: True \n" \ */
 
@@ -58,13 +59,20 @@ static const char sccsid[] = "@(#)galaxy.c 4.04 97/07/28 xlockmore";
 # include "xlock.h"     /* from the xlockmore distribution */
 #endif /* !STANDALONE */
 
+#include <errno.h>
+#include "thread_util.h"
+
 static Bool tracks;
 static Bool spin;
 static Bool dbufp;
+static Bool barnes_hut;
+static int  max_stars;
 
-#define DEF_TRACKS "True"
-#define DEF_SPIN   "True"
-#define DEF_DBUF   "True"
+#define DEF_TRACKS     "True"
+#define DEF_SPIN       "True"
+#define DEF_DBUF       "True"
+#define DEF_BARNES_HUT "False"
+#define DEF_STARS      "3000"
 
 static XrmOptionDescRec opts[] =
 {
@@ -74,6 +82,10 @@ static XrmOptionDescRec opts[] =
  {"+spin",   ".galaxy.spin",   XrmoptionNoArg, "off"},
  {"-dbuf",   ".galaxy.dbuf",   XrmoptionNoArg, "on"},
  {"+dbuf",   ".galaxy.dbuf",   XrmoptionNoArg, "off"},
+ {"-barnes-hut", ".galaxy.barnesHut", XrmoptionNoArg, "on"},
+ {"+barnes-hut", ".galaxy.barnesHut", XrmoptionNoArg, "off"},
+ {"-stars",  ".galaxy.stars",  XrmoptionSepArg, 0},
+ THREAD_OPTIONS
 };
 
 static argtype vars[] =
@@ -81,6 +93,8 @@ static argtype vars[] =
  {&tracks, "tracks", "Tracks", DEF_TRACKS, t_Bool},
  {&spin,   "spin",   "Spin",   DEF_SPIN,   t_Bool},
  {&dbufp,  "dbuf",   "Dbuf",   DEF_DBUF,   t_Bool}, 
+ {&barnes_hut, "barnesHut", "BarnesHut", DEF_BARNES_HUT, t_Bool},
+ {&max_stars,  "stars",     "Stars",     DEF_STARS,      t_Int},
 };
 
 static OptionStruct desc[] =
@@ -88,6 +102,8 @@ static OptionStruct desc[] =
  {"-/+tracks", "turn on/off star tracks"},
  {"-/+spin",   "do/don't spin viewpoint"},
  {"-/+dbuf",   "turn on/off double buffering."},
+ {"-/+barnes-hut", "turn on/off gravity between the stars themselves"},
+ {"-stars num", "maximum number of stars per galaxy"},
 };
 
 ENTRYPOINT ModeSpecOpt galaxy_opts =
@@ -121,6 +137,15 @@ ENTRYPOINT ModeSpecOpt galaxy_opts =
 #define GALAXYMINSIZE  0.15
 #define QCONS    0.001
 
+/* With -barnes-hut, the stars of each galaxy together weigh this fraction
+   of its core, and pull on each other as well as being pulled by the
+   cores.  Nearby groups of stars are lumped together when they are
+   smaller than BH_THETA times their distance; BH_SOFTEN keeps close
+   encounters from flinging stars across the universe. */
+#define BH_STAR_MASS  0.25
+#define BH_THETA      0.7
+#define BH_SOFTEN     0.01
+#define BH_MAX_DEPTH  24
 
 #define COLORBASE  16
 /* colors per galaxy */
@@ -128,22 +153,33 @@ ENTRYPOINT ModeSpecOpt galaxy_opts =
 # define COLORSTEP (MI_NCOLORS(mi)/COLORBASE)
 
 
-typedef struct {
- double      pos[3], vel[3];
-} Star;
-
-
 typedef struct {
  int         mass;
+ int         first;	/* index of this galaxy's first star */
  int         nstars;
- Star       *stars;
- XRectangle *oldpoints;
- XRectangle *newpoints;
+ float       star_mass;
  double      pos[3], vel[3];
  int         galcol;
 } Galaxy;
 
+/* A node of the Barnes-Hut octree.  While it is being built, (mx, my, mz)
+   is the mass-weighted sum of the positions of the stars under it; then
+   it is divided by the mass to get their center of gravity. */
+#define BH_EMPTY    -1
+#define BH_INTERNAL -2
 typedef struct {
+ float       cx, cy, cz, half;	/* the cube this node covers */
+ float       mx, my, mz, m;
+ int         child[8];
+ int         star;	/* the star in this leaf, or BH_EMPTY / BH_INTERNAL */
+} bh_node;
+
+typedef struct {
+ struct unistruct *gp;
+ unsigned    id;
+} galaxy_thread;
+
+typedef struct unistruct {
  double      mat[3][3]; /* Movement of stars(?) */
  double      scale; /* Scale */
  int         midx; /* Middle of screen, x */
@@ -159,30 +195,65 @@ typedef struct {
 y-axis*/
  double      rot_x; /* rotation of eye around center of universe, around
 x-axis */
+
+ /* The stars of all galaxies, one array per coordinate, so that each
+    thread can sweep through its own range of them. */
+ int         nstars;
+ float      *px, *py, *pz;
+ float      *vx, *vy, *vz;
+ float      *m;
+ XRectangle *oldpoints;
+ XRectangle *newpoints;
+
+ /* Read-only while the threads run: */
+ float     (*cores)[4];	/* x, y, z, mass of each galaxy's core */
+ float       proj[4];	/* cos/sin of the view rotations */
+ bh_node    *tree;
+ int         tree_size, tree_alloc;
+
+ struct threadpool pool;
 } unistruct;
 
 static unistruct *universes = NULL;
 
+
+static void
+free_stars(unistruct *gp)
+{
+ free(gp->px);
+ free(gp->py);
+ free(gp->pz);
+ free(gp->vx);
+ free(gp->vy);
+ free(gp->vz);
+ free(gp->m);
+ free(gp->oldpoints);
+ free(gp->newpoints);
+ gp->px = gp->py = gp->pz = gp->vx = gp->vy = gp->vz = gp->m = NULL;
+ gp->oldpoints = gp->newpoints = NULL;
+ gp->nstars = 0;
+}
+
 ENTRYPOINT void
 free_galaxy(ModeInfo * mi)
 {
  unistruct  *gp = &universes[MI_SCREEN(mi)];
+ free_stars(gp);
  if (gp->galaxies != NULL) {
-  int         i;
-
-  for (i = 0; i < gp->ngalaxies; i++) {
-   Galaxy     *gt = &gp->galaxies[i];
-
-   if (gt->stars != NULL)
-    (void) free((void *) gt->stars);
-   if (gt->oldpoints != NULL)
-       (void) free((void *) gt->oldpoints);
-   if (gt->newpoints != NULL)
-       (void) free((void *) gt->newpoints);
-  }
   (void) free((void *) gp->galaxies);
   gp->galaxies = NULL;
  }
+ if (gp->cores != NULL) {
+  (void) free((void *) gp->cores);
+  gp->cores = NULL;
+ }
+ if (gp->tree != NULL) {
+  (void) free((void *) gp->tree);
+  gp->tree = NULL;
+  gp->tree_alloc = 0;
+ }
+ if (gp->pool.count)
+  threadpool_destroy(&gp->pool);
 }
 
 static void
@@ -192,13 +263,18 @@ startover(ModeInfo * mi)
  int         i, j; /* more tmp */
  double      w1, w2; /* more tmp */
  double      d, v, w, h; /* yet more tmp */
+ int         total;
 
  gp->step = 0;
  gp->rot_y = 0;
  gp->rot_x = 0;
 
- if (MI_BATCHCOUNT(mi) < -MINGALAXIES)
-  free_galaxy(mi);
+ if (MI_BATCHCOUNT(mi) < -MINGALAXIES) {
+  free((void *) gp->galaxies);
+  free((void *) gp->cores);
+  gp->galaxies = NULL;
+  gp->cores = NULL;
+ }
  gp->ngalaxies = MI_BATCHCOUNT(mi);
  if (gp->ngalaxies < -MINGALAXIES)
   gp->ngalaxies = NRAND(-gp->ngalaxies - MINGALAXIES + 1) + MINGALAXIES;
@@ -207,6 +283,33 @@ startover(ModeInfo * mi)
   gp->ngalaxies = MINGALAXIES;
  if (gp->galaxies == NULL)
   gp->galaxies = (Galaxy *) calloc(gp->ngalaxies, sizeof (Galaxy));
+ if (gp->cores == NULL)
+  gp->cores = (float (*)[4]) calloc(gp->ngalaxies, sizeof (*gp->cores));
+
+ total = 0;
+ for (i = 0; i < gp->ngalaxies; ++i) {
+  Galaxy     *gt = &gp->galaxies[i];
+  gt->first = total;
+  gt->nstars = (NRAND(max_stars / 2)) + max_stars / 2;
+  total += gt->nstars;
+ }
+
+ free_stars(gp);
+ gp->nstars = total;
+ gp->px = (float *) malloc(total * sizeof (*gp->px));
+ gp->py = (float *) malloc(total * sizeof (*gp->py));
+ gp->pz = (float *) malloc(total * sizeof (*gp->pz));
+ gp->vx = (float *) malloc(total * sizeof (*gp->vx));
+ gp->vy = (float *) malloc(total * sizeof (*gp->vy));
+ gp->vz = (float *) malloc(total * sizeof (*gp->vz));
+ gp->m  = (float *) malloc(total * sizeof (*gp->m));
+ gp->oldpoints = (XRectangle *) malloc(total * sizeof (*gp->oldpoints));
+ gp->newpoints = (XRectangle *) malloc(total * sizeof (*gp->newpoints));
+ if (!gp->px || !gp->py || !gp->pz || !gp->vx || !gp->vy || !gp->vz ||
+     !gp->m || !gp->oldpoints || !gp->newpoints) {
+  fprintf(stderr, "%s: out of memory for %d stars\n", progname, total);
+  exit(1);
+ }
 
  for (i = 0; i < gp->ngalaxies; ++i) {
   Galaxy     *gt = &gp->galaxies[i];
@@ -217,15 +320,6 @@ startover(ModeInfo * mi)
    gt->galcol += 2; /* Mult 8; 16..31 no green stars */
   /* Galaxies still may have some green stars but are not all green. */
 
-  if (gt->stars != NULL) {
-   (void) free((void *) gt->stars);
-   gt->stars = NULL;
-  }
-  gt->nstars = (NRAND(MAX_STARS / 2)) + MAX_STARS / 2;
-  gt->stars = (Star *) malloc(gt->nstars * sizeof (Star));
-  gt->oldpoints = (XRectangle *) malloc(gt->nstars * sizeof (*gt->oldpoints));
-  gt->newpoints = (XRectangle *) malloc(gt->nstars * sizeof (*gt->newpoints));
-
   w1 = 2.0 * M_PI * FLOATRAND;
   w2 = 2.0 * M_PI * FLOATRAND;
   sinw1 = SINF(w1);
@@ -254,13 +348,13 @@ startover(ModeInfo * mi)
 0.5;
 
   gt->mass = (int) (FLOATRAND * 1000.0) + 1;
+  gt->star_mass = gt->mass * BH_STAR_MASS / gt->nstars;
 
   gp->size = GALAXYRANGESIZE * FLOATRAND + GALAXYMINSIZE;
 
-  for (j = 0; j < gt->nstars; ++j) {
-   Star       *st = &gt->stars[j];
-   XRectangle *oldp = &gt->oldpoints[j];
-   XRectangle *newp = &gt->newpoints[j];
+  for (j = gt->first; j < gt->first + gt->nstars; ++j) {
+   XRectangle *oldp = &gp->oldpoints[j];
+   XRectangle *newp = &gp->newpoints[j];
 
    double      sinw, cosw;
 
@@ -271,24 +365,22 @@ startover(ModeInfo * mi)
    h = FLOATRAND * exp(-2.0 * (d / gp->size)) / 5.0 * gp->size;
    if (FLOATRAND < 0.5)
     h = -h;
-   st->pos[0] = gp->mat[0][0] * d * cosw + gp->mat[1][0] * d * sinw +
+   gp->px[j] = gp->mat[0][0] * d * cosw + gp->mat[1][0] * d * sinw +
 gp->mat[2][0] * h + gt->pos[0];
-   st->pos[1] = gp->mat[0][1] * d * cosw + gp->mat[1][1] * d * sinw +
+   gp->py[j] = gp->mat[0][1] * d * cosw + gp->mat[1][1] * d * sinw +
 gp->mat[2][1] * h + gt->pos[1];
-   st->pos[2] = gp->mat[0][2] * d * cosw + gp->mat[1][2] * d * sinw +
+   gp->pz[j] = gp->mat[0][2] * d * cosw + gp->mat[1][2] * d * sinw +
 gp->mat[2][2] * h + gt->pos[2];
 
    v = sqrt(gt->mass * QCONS / sqrt(d * d + h * h));
-   st->vel[0] = -gp->mat[0][0] * v * sinw + gp->mat[1][0] * v * cosw +
-gt->vel[0];
-   st->vel[1] = -gp->mat[0][1] * v * sinw + gp->mat[1][1] * v * cosw +
-gt->vel[1];
-   st->vel[2] = -gp->mat[0][2] * v * sinw + gp->mat[1][2] * v * cosw +
-gt->vel[2];
+   gp->vx[j] = (-gp->mat[0][0] * v * sinw + gp->mat[1][0] * v * cosw +
+gt->vel[0]) * DELTAT;
+   gp->vy[j] = (-gp->mat[0][1] * v * sinw + gp->mat[1][1] * v * cosw +
+gt->vel[1]) * DELTAT;
+   gp->vz[j] = (-gp->mat[0][2] * v * sinw + gp->mat[1][2] * v * cosw +
+gt->vel[2]) * DELTAT;
 
-   st->vel[0] *= DELTAT;
-   st->vel[1] *= DELTAT;
-   st->vel[2] *= DELTAT;
+   gp->m[j] = gt->star_mass;
 
    oldp->x = 0;
    oldp->y = 0;
@@ -310,10 +402,264 @@ gp->f_hititerations);
 #endif /*0 */
 }
 
+
+/* Building the Barnes-Hut tree.
+ */
+
+static int
+bh_new_node(unistruct *gp, float cx, float cy, float cz, float half)
+{
+  bh_node *nd;
+  int i;
+  if (gp->tree_size >= gp->tree_alloc) {
+    gp->tree_alloc = (gp->tree_alloc ? gp->tree_alloc * 2 : 1024);
+    gp->tree = (bh_node *) realloc(gp->tree,
+                                   gp->tree_alloc * sizeof (*gp->tree));
+    if (!gp->tree) {
+      fprintf(stderr, "%s: out of memory\n", progname);
+      exit(1);
+    }
+  }
+  nd = &gp->tree[gp->tree_size];
+  nd->cx = cx;
+  nd->cy = cy;
+  nd->cz = cz;
+  nd->half = half;
+  nd->mx = nd->my = nd->mz = nd->m = 0;
+  for (i = 0; i < 8; i++)
+    nd->child[i] = -1;
+  nd->star = BH_EMPTY;
+  return gp->tree_size++;
+}
+
+/* Returns the child of node n that the point falls in, creating it. */
+static int
+bh_child(unistruct *gp, int n, float x, float y, float z)
+{
+  bh_node *nd = &gp->tree[n];
+  int o = (x >= nd->cx) | ((y >= nd->cy) << 1) | ((z >= nd->cz) << 2);
+  if (nd->child[o] < 0) {
+    float h = nd->half / 2;
+    int c = bh_new_node(gp,
+                        nd->cx + (o & 1 ? h : -h),
+                        nd->cy + (o & 2 ? h : -h),
+                        nd->cz + (o & 4 ? h : -h),
+                        h);
+    gp->tree[n].child[o] = c;	/* nd may have moved */
+  }
+  return gp->tree[n].child[o];
+}
+
+static void
+bh_add_mass(bh_node *nd, float x, float y, float z, float m)
+{
+  nd->mx += x * m;
+  nd->my += y * m;
+  nd->mz += z * m;
+  nd->m  += m;
+}
+
+static void
+bh_insert(unistruct *gp, int s)
+{
+  float x = gp->px[s], y = gp->py[s], z = gp->pz[s], m = gp->m[s];
+  int n = 0;
+  int depth = 0;
+
+  for (;;) {
+    bh_node *nd = &gp->tree[n];
+
+    if (nd->star == BH_EMPTY) {
+      nd->star = s;
+      bh_add_mass(nd, x, y, z, m);
+      return;
+    }
+
+    if (nd->star >= 0) {
+      int t = nd->star;
+      int c;
+      if (depth >= BH_MAX_DEPTH) {
+        /* Practically on top of each other: just lump them together. */
+        bh_add_mass(nd, x, y, z, m);
+        return;
+      }
+      /* Push the star that was here down a level. */
+      nd->star = BH_INTERNAL;
+      c = bh_child(gp, n, gp->px[t], gp->py[t], gp->pz[t]);
+      nd = &gp->tree[c];
+      nd->star = t;
+      bh_add_mass(nd, gp->px[t], gp->py[t], gp->pz[t], gp->m[t]);
+    }
+
+    bh_add_mass(&gp->tree[n], x, y, z, m);
+    n = bh_child(gp, n, x, y, z);
+    depth++;
+  }
+}
+
+static void
+bh_build(unistruct *gp)
+{
+  float x0, y0, z0, x1, y1, z1, half;
+  int i;
+
+  x0 = x1 = gp->px[0];
+  y0 = y1 = gp->py[0];
+  z0 = z1 = gp->pz[0];
+  for (i = 1; i < gp->nstars; i++) {
+    if (gp->px[i] < x0) x0 = gp->px[i]; else if (gp->px[i] > x1) x1 = gp->px[i];
+    if (gp->py[i] < y0) y0 = gp->py[i]; else if (gp->py[i] > y1) y1 = gp->py[i];
+    if (gp->pz[i] < z0) z0 = gp->pz[i]; else if (gp->pz[i] > z1) z1 = gp->pz[i];
+  }
+  half = x1 - x0;
+  if (half < y1 - y0) half = y1 - y0;
+  if (half < z1 - z0) half = z1 - z0;
+  half = half / 2 * 1.001 + 0.0001;
+
+  gp->tree_size = 0;
+  bh_new_node(gp, (x0 + x1) / 2, (y0 + y1) / 2, (z0 + z1) / 2, half);
+  for (i = 0; i < gp->nstars; i++)
+    bh_insert(gp, i);
+
+  for (i = 0; i < gp->tree_size; i++) {
+    bh_node *nd = &gp->tree[i];
+    if (nd->m > 0) {
+      nd->mx /= nd->m;
+      nd->my /= nd->m;
+      nd->mz /= nd->m;
+    }
+  }
+}
+
+/* The pull of all the other stars on star j, through the tree.
+   Only reads the tree, so many threads can do this at once. */
+static void
+bh_accel(const unistruct *gp, int j, float *axp, float *ayp, float *azp)
+{
+  const float theta2 = BH_THETA * BH_THETA;
+  const float soft2  = BH_SOFTEN * BH_SOFTEN;
+  float x = gp->px[j], y = gp->py[j], z = gp->pz[j];
+  float ax = 0, ay = 0, az = 0;
+  int stack[8 * (BH_MAX_DEPTH + 2)];
+  int sp = 0;
+
+  stack[sp++] = 0;
+  while (sp > 0) {
+    const bh_node *nd = &gp->tree[stack[--sp]];
+    float dx = nd->mx - x;
+    float dy = nd->my - y;
+    float dz = nd->mz - z;
+    float r2 = dx * dx + dy * dy + dz * dz;
+    float size = nd->half * 2;
+
+    if (nd->star == j || nd->m <= 0)
+      continue;
+
+    if (nd->star >= 0 || size * size < theta2 * r2) {
+      float r2s = r2 + soft2;
+      float f = nd->m / (r2s * sqrtf(r2s));
+      ax += dx * f;
+      ay += dy * f;
+      az += dz * f;
+    } else {
+      int i;
+      for (i = 0; i < 8; i++)
+        if (nd->child[i] >= 0)
+          stack[sp++] = nd->child[i];
+    }
+  }
+
+  *axp = ax;
+  *ayp = ay;
+  *azp = az;
+}
+
+
+/* Moving the stars: each thread takes its own slice of the star arrays.
+ */
+
+static int
+galaxy_thread_create(void *self, struct threadpool *pool, unsigned id)
+{
+  galaxy_thread *t = (galaxy_thread *) self;
+  t->gp = GET_PARENT_OBJ(unistruct, pool, pool);
+  t->id = id;
+  return 0;
+}
+
+static void
+galaxy_thread_destroy(void *self)
+{
+}
+
+static void
+galaxy_thread_run(void *self)
+{
+  galaxy_thread *t = (galaxy_thread *) self;
+  unistruct  *gp = t->gp;
+  const float k = DELTAT * DELTAT * QCONS;
+  const float cox = gp->proj[0], six = gp->proj[1];
+  const float cor = gp->proj[2], sir = gp->proj[3];
+  const float scale = gp->scale * gp->pscale;
+  float      *px = gp->px, *py = gp->py, *pz = gp->pz;
+  float      *vx = gp->vx, *vy = gp->vy, *vz = gp->vz;
+  int         j0 = (long) gp->nstars * t->id       / gp->pool.count;
+  int         j1 = (long) gp->nstars * (t->id + 1) / gp->pool.count;
+  int         i, j;
+
+  if (barnes_hut)
+    for (j = j0; j < j1; j++) {
+      float ax, ay, az;
+      bh_accel(gp, j, &ax, &ay, &az);
+      vx[j] += ax * k;
+      vy[j] += ay * k;
+      vz[j] += az * k;
+    }
+
+  /* One galaxy core at a time, so that the inner loop is a straight run
+     over the arrays with nothing in it to stop the compiler from
+     vectorizing it. */
+  for (i = 0; i < gp->ngalaxies; i++) {
+    const float gx = gp->cores[i][0];
+    const float gy = gp->cores[i][1];
+    const float gz = gp->cores[i][2];
+    const float gm = gp->cores[i][3] * k;
+    for (j = j0; j < j1; j++) {
+      float d0 = gx - px[j];
+      float d1 = gy - py[j];
+      float d2 = gz - pz[j];
+      float d = d0 * d0 + d1 * d1 + d2 * d2;
+      float f = (d > EPSILON ? gm / (d * sqrtf(d)) : 0);
+      vx[j] += d0 * f;
+      vy[j] += d1 * f;
+      vz[j] += d2 * f;
+    }
+  }
+
+  for (j = j0; j < j1; j++) {
+    XRectangle *newp = &gp->newpoints[j];
+    px[j] += vx[j];
+    py[j] += vy[j];
+    pz[j] += vz[j];
+    newp->x = (short) (((cox * px[j]) - (six * pz[j])) * scale) + gp->midx;
+    newp->y = (short) (((cor * py[j]) - (sir * ((six * px[j]) +
+                                                (cox * pz[j]))))
+                       * scale) + gp->midy;
+    newp->width = newp->height = gp->pscale;
+  }
+}
+
+
 ENTRYPOINT void
 init_galaxy(ModeInfo * mi)
 {
+ static const struct threadpool_class cls = {
+  sizeof(galaxy_thread),
+  galaxy_thread_create,
+  galaxy_thread_destroy
+ };
  unistruct  *gp;
+ int         err;
 
  MI_INIT (mi, universes);
  gp = &universes[MI_SCREEN(mi)];
@@ -322,6 +668,8 @@ init_galaxy(ModeInfo * mi)
   dbufp = False;
 # endif
 
+ if (max_stars < 2) max_stars = 2;
+
  gp->f_hititerations = MI_CYCLES(mi);
 
  gp->scale = (double) (MI_WIN_WIDTH(mi) + MI_WIN_HEIGHT(mi)) / 8.0;
@@ -335,6 +683,15 @@ init_galaxy(ModeInfo * mi)
      gp->scale /= gp->pscale;
    }
 
+ if (!gp->pool.count) {
+  err = threadpool_create(&gp->pool, &cls, MI_DISPLAY(mi),
+                          hardware_concurrency(MI_DISPLAY(mi)));
+  if (err) {
+   fprintf(stderr, "%s: threadpool: %s\n", progname, strerror(err));
+   exit(1);
+  }
+ }
+
  startover(mi);
 }
 
@@ -345,8 +702,8 @@ draw_galaxy(ModeInfo * mi)
   Window      window = MI_WINDOW(mi);
   GC          gc = MI_GC(mi);
   unistruct  *gp = &universes[MI_SCREEN(mi)];
-  double      d, eps, cox, six, cor, sir;  /* tmp */
-  int         i, j, k; /* more tmp */
+  double      d;  /* tmp */
+  int         i, k; /* more tmp */
   XRectangle *dummy = NULL;
 
   if (! dbufp)
@@ -357,54 +714,27 @@ draw_galaxy(ModeInfo * mi)
     gp->rot_x += 0.004;
   }
 
-  cox = COSF(gp->rot_y);
-  six = SINF(gp->rot_y);
-  cor = COSF(gp->rot_x);
-  sir = SINF(gp->rot_x);
-
-  eps = 1/(EPSILON * sqrt_EPSILON * DELTAT * DELTAT * QCONS);
+  gp->proj[0] = COSF(gp->rot_y);
+  gp->proj[1] = SINF(gp->rot_y);
+  gp->proj[2] = COSF(gp->rot_x);
+  gp->proj[3] = SINF(gp->rot_x);
 
   for (i = 0; i < gp->ngalaxies; ++i) {
     Galaxy     *gt = &gp->galaxies[i];
+    gp->cores[i][0] = gt->pos[0];
+    gp->cores[i][1] = gt->pos[1];
+    gp->cores[i][2] = gt->pos[2];
+    gp->cores[i][3] = gt->mass;
+  }
 
-    for (j = 0; j < gp->galaxies[i].nstars; ++j) {
-      Star       *st = &gt->stars[j];
-      XRectangle *newp = &gt->newpoints[j];
-      double      v0 = st->vel[0];
-      double      v1 = st->vel[1];
-      double      v2 = st->vel[2];
-
-      for (k = 0; k < gp->ngalaxies; ++k) {
-        Galaxy     *gtk = &gp->galaxies[k];
-        double      d0 = gtk->pos[0] - st->pos[0];
-        double      d1 = gtk->pos[1] - st->pos[1];
-        double      d2 = gtk->pos[2] - st->pos[2];
-
-        d = d0 * d0 + d1 * d1 + d2 * d2;
-        if (d > EPSILON)
-          d = gtk->mass / (d * sqrt(d)) * DELTAT * DELTAT * QCONS;
-        else
-          d = gtk->mass / (eps * sqrt(eps));
-        v0 += d0 * d;
-        v1 += d1 * d;
-        v2 += d2 * d;
-      }
-
-      st->vel[0] = v0;
-      st->vel[1] = v1;
-      st->vel[2] = v2;
+  if (barnes_hut)
+    bh_build(gp);
 
-      st->pos[0] += v0;
-      st->pos[1] += v1;
-      st->pos[2] += v2;
+  threadpool_run(&gp->pool, galaxy_thread_run);
+  threadpool_wait(&gp->pool);
 
-      newp->x = (short) (((cox * st->pos[0]) - (six * st->pos[2])) *
-                         gp->scale * gp->pscale) + gp->midx;
-      newp->y = (short) (((cor * st->pos[1]) - (sir * ((six * st->pos[0]) +
-                                                       (cox * st->pos[2]))))
-                         * gp->scale * gp->pscale) + gp->midy;
-      newp->width = newp->height = gp->pscale;
-    }
+  for (i = 0; i < gp->ngalaxies; ++i) {
+    Galaxy     *gt = &gp->galaxies[i];
 
     for (k = i + 1; k < gp->ngalaxies; ++k) {
       Galaxy     *gtk = &gp->galaxies[k];
@@ -432,19 +762,25 @@ draw_galaxy(ModeInfo * mi)
     gt->pos[0] += gt->vel[0] * DELTAT;
     gt->pos[1] += gt->vel[1] * DELTAT;
     gt->pos[2] += gt->vel[2] * DELTAT;
+  }
 
-    if (dbufp) {
-      XSetForeground(display, gc, MI_WIN_BLACK_PIXEL(mi));
-      XFillRectangles(display, window, gc, gt->oldpoints, gt->nstars);
-    }
+  /* Erase all of the old stars before drawing any of the new ones, so
+     that one galaxy doesn't erase another's stars. */
+  if (dbufp) {
+    XSetForeground(display, gc, MI_WIN_BLACK_PIXEL(mi));
+    XFillRectangles(display, window, gc, gp->oldpoints, gp->nstars);
+  }
+  for (i = 0; i < gp->ngalaxies; ++i) {
+    Galaxy     *gt = &gp->galaxies[i];
     XSetForeground(display, gc, MI_PIXEL(mi, COLORSTEP * gt->galcol));
-    XFillRectangles (display, window, gc, gt->newpoints, gt->nstars);
-
-    dummy = gt->oldpoints;
-    gt->oldpoints = gt->newpoints;
-    gt->newpoints = dummy;
+    XFillRectangles(display, window, gc, gp->newpoints + gt->first,
+                    gt->nstars);
   }
 
+  dummy = gp->oldpoints;
+  gp->oldpoints = gp->newpoints;
+  gp->newpoints = dummy;
+
   gp->step++;
   if (gp->step > gp->f_hititerations * 4)
     startover(mi);
@@ -13,6 +13,7 @@
 			"*showFPS:      False       \n" \
 			"*wireframe:    False       \n" \
 			"*suppressRotationAnimation: True\n" \
+			THREAD_DEFAULTS_XLOCK
 
 # define release_crumbler 0
 
@@ -20,6 +21,7 @@
 #include "colors.h"
 #include "rotator.h"
 #include "quickhull.h"
+#include "thread_util.h"
 #include "gltrackball.h"
 #include "easing.h"
 #include <ctype.h>
@@ -57,6 +59,7 @@ typedef struct {
   int nchunks;
   chunk **chunks;
   chunk *ghost;
+  qh_context_t *hull;		/* reused for every chunk */
 
   int ncolors;
   XColor *colors;
@@ -77,7 +80,8 @@ static XrmOptionDescRec opts[] = {
   { "-density", ".density", XrmoptionSepArg, 0 },
   { "-fracture",".fracture",XrmoptionSepArg, 0 },
   { "-wander",  ".wander",  XrmoptionNoArg, "True" },
-  { "+wander",  ".wander",  XrmoptionNoArg, "False" }
+  { "+wander",  ".wander",  XrmoptionNoArg, "False" },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
@@ -135,6 +139,7 @@ make_chunk (void)
 static Bool
 render_chunk (ModeInfo *mi, chunk *c)
 {
+  crumbler_configuration *bp = &bps[MI_SCREEN(mi)];
   int wire = MI_IS_WIREFRAME(mi);
   int i, j;
   qh_mesh_t m;
@@ -178,7 +183,7 @@ render_chunk (ModeInfo *mi, chunk *c)
       abort();
     }
 
-  m = qh_quickhull3d (c->verts, c->nverts);
+  m = qh_quickhull3d_context (bp->hull, c->verts, c->nverts);
 
   if (!m.vertices)  /* out of memory */
     {
@@ -627,6 +632,9 @@ init_crumbler (ModeInfo *mi)
 
   bp->glx_context = init_GL(mi);
 
+  bp->hull = qh_create_context (MI_DISPLAY(mi));
+  if (! bp->hull) crumbler_oom();
+
   reshape_crumbler (mi, MI_WIDTH(mi), MI_HEIGHT(mi));
 
   if (!wire)
@@ -897,6 +905,7 @@ free_crumbler (ModeInfo *mi)
   for (i = 0; i < bp->nchunks; i++)
     free_chunk (bp->chunks[i]);
   if (bp->chunks) free (bp->chunks);
+  if (bp->hull) qh_free_context (bp->hull);
 }
 
 
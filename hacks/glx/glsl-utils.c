@@ -18,6 +18,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 
 #define M_PI_F 3.1415926535898f
@@ -473,6 +477,313 @@ static void print_link_error(GLuint program)
 #endif
 
 
+/* Linked programs are cached on disk with glGetProgramBinary, so that the
+   next run can skip compiling and linking, which on software renderers
+   can take hundreds of milliseconds per program.  The cache file name is
+   a hash of the shader sources and of the driver's vendor, renderer and
+   version strings; a driver upgrade therefore misses rather than loading
+   a binary from the old one, and if the driver rejects a binary anyway,
+   we delete it and compile from source as before.
+
+   Files live in $XDG_CACHE_HOME/xscreensaver/glsl/, or ~/.cache/...
+   Setting $XSCREENSAVER_GLSL_CACHE to "off" disables this.
+
+   Loading a file touches it, and whenever a new file is written, any
+   that haven't been touched in PROGRAM_CACHE_MAX_AGE are deleted: those
+   are from hacks that have been changed, or from an old driver.
+ */
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT) && !defined(HAVE_JWXYZ)
+# define USE_PROGRAM_CACHE
+#endif
+
+#ifdef USE_PROGRAM_CACHE
+
+#include <dirent.h>
+#include <time.h>
+#include <utime.h>
+
+#define PROGRAM_CACHE_MAGIC "XSGLSL1"
+#define PROGRAM_CACHE_MAX_AGE (30 * 24 * 60 * 60)  /* seconds */
+
+struct program_cache_header
+{
+  char magic[8];
+  unsigned long long key;
+  unsigned int format;
+  unsigned int length;
+};
+
+
+/* Whether the driver can hand back program binaries at all.  Mesa returns
+   0 formats when its own shader cache is disabled, in which case
+   glGetProgramBinary would fail. */
+static GLboolean program_cache_available_p(void)
+{
+  static int available = -1;
+  if (available < 0)
+  {
+    GLint nformats = 0;
+    const char *s = getenv("XSCREENSAVER_GLSL_CACHE");
+    while (glGetError() != GL_NO_ERROR)
+      ;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS,&nformats);
+    available = (glGetError() == GL_NO_ERROR && nformats > 0 &&
+                 !(s && (!strcmp(s,"0") || !strcasecmp(s,"off"))));
+  }
+  return available ? GL_TRUE : GL_FALSE;
+}
+
+
+/* FNV-1a. */
+static unsigned long long program_cache_hash(unsigned long long h,
+                                             const char *s)
+{
+  if (!s)
+    s = "(null)";
+  for (; *s; s++)
+  {
+    h ^= (unsigned char) *s;
+    h *= 0x100000001b3ULL;
+  }
+  h ^= 0xFF;  /* separator, so that "ab","c" != "a","bc" */
+  h *= 0x100000001b3ULL;
+  return h;
+}
+
+
+static unsigned long long program_cache_key(GLsizei vertex_shader_count,
+                                         const GLchar **vertex_shader_source,
+                                         GLsizei fragment_shader_count,
+                                         const GLchar **fragment_shader_source)
+{
+  unsigned long long h = 0xcbf29ce484222325ULL;
+  GLsizei i;
+  h = program_cache_hash(h,PROGRAM_CACHE_MAGIC);
+  h = program_cache_hash(h,(const char *) glGetString(GL_VENDOR));
+  h = program_cache_hash(h,(const char *) glGetString(GL_RENDERER));
+  h = program_cache_hash(h,(const char *) glGetString(GL_VERSION));
+  h = program_cache_hash(h,(const char *)
+                         glGetString(GL_SHADING_LANGUAGE_VERSION));
+  for (i = 0; i < vertex_shader_count; i++)
+    h = program_cache_hash(h,vertex_shader_source[i]);
+  h = program_cache_hash(h,"--");
+  for (i = 0; i < fragment_shader_count; i++)
+    h = program_cache_hash(h,fragment_shader_source[i]);
+  return h;
+}
+
+
+/* Returns the cache file for the key, creating the directory if create_p.
+   The result is malloc'ed. */
+static char *program_cache_file(unsigned long long key, GLboolean create_p)
+{
+  const char *xdg = getenv("XDG_CACHE_HOME");
+  const char *home = getenv("HOME");
+  char *dir, *file;
+  size_t L;
+
+  if (xdg && *xdg)
+  {
+    dir = malloc(strlen(xdg) + 40);
+    if (!dir) return NULL;
+    sprintf(dir,"%s",xdg);
+  }
+  else if (home && *home)
+  {
+    dir = malloc(strlen(home) + 40);
+    if (!dir) return NULL;
+    sprintf(dir,"%s/.cache",home);
+  }
+  else
+    return NULL;
+
+  if (create_p)
+  {
+    /* mkdir -p, but only for the last three components. */
+    L = strlen(dir);
+    mkdir(dir,0700);
+    strcat(dir,"/xscreensaver");
+    mkdir(dir,0700);
+    strcat(dir,"/glsl");
+    if (mkdir(dir,0700) != 0 && errno != EEXIST)
+    {
+      free(dir);
+      return NULL;
+    }
+    dir[L] = 0;
+  }
+
+  file = malloc(strlen(dir) + 60);
+  if (file)
+    sprintf(file,"%s/xscreensaver/glsl/%016llx.bin",dir,key);
+  free(dir);
+  return file;
+}
+
+
+/* Try to create the program from a cached binary.  Returns GL_FALSE, and
+   removes the file, if the driver doesn't like it. */
+static GLboolean program_cache_load(unsigned long long key,
+                                    GLuint *shader_program)
+{
+  char *file = program_cache_file(key,GL_FALSE);
+  struct program_cache_header h;
+  void *data = NULL;
+  FILE *in;
+  GLuint program = 0;
+  GLint status = GL_FALSE;
+
+  if (!file)
+    return GL_FALSE;
+  in = fopen(file,"rb");
+  if (!in)
+  {
+    free(file);
+    return GL_FALSE;
+  }
+
+  if (fread(&h,sizeof(h),1,in) != 1 ||
+      memcmp(h.magic,PROGRAM_CACHE_MAGIC,sizeof(h.magic)) ||
+      h.key != key ||
+      h.length == 0 ||
+      h.length > 64 * 1024 * 1024)
+    goto FAIL;
+  data = malloc(h.length);
+  if (!data || fread(data,h.length,1,in) != 1)
+    goto FAIL;
+
+  program = glCreateProgram();
+  if (program == 0)
+    goto FAIL;
+  glProgramBinary(program,h.format,data,h.length);
+  glGetProgramiv(program,GL_LINK_STATUS,&status);
+  while (glGetError() != GL_NO_ERROR)   /* e.g. GL_INVALID_ENUM */
+    status = GL_FALSE;
+  if (status == GL_FALSE)
+    goto FAIL;
+
+  fclose(in);
+  utime(file,NULL);   /* Still in use: don't prune it */
+  free(data);
+  free(file);
+  *shader_program = program;
+  return GL_TRUE;
+
+ FAIL:
+  if (program)
+    glDeleteProgram(program);
+  fclose(in);
+  unlink(file);
+  free(data);
+  free(file);
+  return GL_FALSE;
+}
+
+
+/* Delete the files in the directory of this one that haven't been used
+   in a long time, including temporary files left by a crash. */
+static void program_cache_prune(const char *file)
+{
+  char *dir = strdup(file);
+  char *slash = dir ? strrchr(dir,'/') : NULL;
+  time_t now = time(NULL);
+  struct dirent *de;
+  DIR *d;
+
+  if (!slash)
+  {
+    free(dir);
+    return;
+  }
+  *slash = 0;
+
+  d = opendir(dir);
+  if (d)
+  {
+    char *path = malloc(strlen(dir) + 300);
+    while (path && (de = readdir(d)))
+    {
+      struct stat st;
+      if (!strstr(de->d_name,".bin"))
+        continue;
+      sprintf(path,"%s/%.255s",dir,de->d_name);
+      if (!stat(path,&st) && S_ISREG(st.st_mode) &&
+          now - st.st_mtime > PROGRAM_CACHE_MAX_AGE)
+        unlink(path);
+    }
+    free(path);
+    closedir(d);
+  }
+  free(dir);
+}
+
+
+/* Write the linked program out, atomically, so that a half-written file
+   is never seen by another process. */
+static void program_cache_save(unsigned long long key, GLuint program)
+{
+  struct program_cache_header h;
+  GLint length = 0;
+  GLsizei got = 0;
+  GLenum format = 0;
+  void *data;
+  char *file, *tmp;
+  FILE *out;
+  int ok;
+
+  glGetProgramiv(program,GL_PROGRAM_BINARY_LENGTH,&length);
+  if (glGetError() != GL_NO_ERROR || length <= 0)
+    return;
+  data = malloc(length);
+  if (!data)
+    return;
+  glGetProgramBinary(program,length,&got,&format,data);
+  if (glGetError() != GL_NO_ERROR || got <= 0)
+  {
+    free(data);
+    return;
+  }
+
+  file = program_cache_file(key,GL_TRUE);
+  if (!file)
+  {
+    free(data);
+    return;
+  }
+  tmp = malloc(strlen(file) + 30);
+  if (!tmp)
+  {
+    free(file);
+    free(data);
+    return;
+  }
+  sprintf(tmp,"%s.%lu",file,(unsigned long) getpid());
+
+  memset(&h,0,sizeof(h));
+  memcpy(h.magic,PROGRAM_CACHE_MAGIC,sizeof(h.magic));
+  h.key = key;
+  h.format = format;
+  h.length = got;
+
+  out = fopen(tmp,"wb");
+  ok = (out &&
+        fwrite(&h,sizeof(h),1,out) == 1 &&
+        fwrite(data,got,1,out) == 1);
+  if (out && fclose(out) != 0)
+    ok = 0;
+  if (!ok || rename(tmp,file) != 0)
+    unlink(tmp);
+  else
+    program_cache_prune(file);
+
+  free(tmp);
+  free(file);
+  free(data);
+}
+
+#endif /* USE_PROGRAM_CACHE */
+
+
 /* Compile and link a vertex and a Fragment shader into a GLSL program. */
 GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
                                      const GLchar **vertex_shader_source,
@@ -483,6 +794,18 @@ GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
   GLuint vertex_shader, fragment_shader;
   GLint status;
   const char *err = 0;
+#ifdef USE_PROGRAM_CACHE
+  GLboolean cache_p = program_cache_available_p();
+  unsigned long long key = 0;
+
+  if (cache_p)
+  {
+    key = program_cache_key(vertex_shader_count,vertex_shader_source,
+                            fragment_shader_count,fragment_shader_source);
+    if (program_cache_load(key,shader_program))
+      return GL_TRUE;
+  }
+#endif
 
   /* Create and compile the vertex shader. */
   vertex_shader = glCreateShader(GL_VERTEX_SHADER);
@@ -529,6 +852,11 @@ GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
   }
   glAttachShader(*shader_program,vertex_shader);
   glAttachShader(*shader_program,fragment_shader);
+#ifdef USE_PROGRAM_CACHE
+  if (cache_p)
+    glProgramParameteri(*shader_program,GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                        GL_TRUE);
+#endif
   glLinkProgram(*shader_program);
   glGetProgramiv(*shader_program,GL_LINK_STATUS,&status);
   if (status == GL_FALSE)
@@ -544,6 +872,10 @@ GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
      vertex and fragment shaders. */
   glDeleteShader(vertex_shader);
   glDeleteShader(fragment_shader);
+#ifdef USE_PROGRAM_CACHE
+  if (cache_p)
+    program_cache_save(key,*shader_program);
+#endif
 
  DONE:
   if (err)
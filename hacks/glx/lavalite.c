@@ -69,6 +69,7 @@
 			"*wireframe:    False       \n" \
 			"*geometry:	600x900\n"      \
 			"*count:      " DEF_COUNT " \n" \
+			THREAD_DEFAULTS_XLOCK
 
 # define release_lavalite 0
 
@@ -86,6 +87,8 @@
 
 #include "xlockmore.h"
 #include "marching.h"
+#include "scalarfield.h"
+#include "thread_util.h"
 #include "rotator.h"
 #include "gltrackball.h"
 #include "ximage-loader.h"
@@ -212,6 +215,11 @@ typedef struct {
   int nballs;
   metaball *balls;
 
+  scalar_field *field;		   /* the metaball field, on the grid */
+  double *ball_params;		   /* x, y, z, r, R of each live ball */
+  int nlive;
+  unsigned long ball_poly_count;
+
   GLuint bottle_list;
   GLuint ball_list;
 
@@ -266,6 +274,7 @@ static XrmOptionDescRec opts[] = {
   { "-fluid-texture",".fluidTexture",  XrmoptionSepArg, 0 },
   { "-base-texture", ".baseTexture",   XrmoptionSepArg, 0 },
   { "-table-texture",".tableTexture",  XrmoptionSepArg, 0 },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
@@ -1006,81 +1015,15 @@ move_balls (ModeInfo *mi)   /* for great justice */
 /* Rendering blobbies using marching cubes.
  */
 
-static double
-compute_metaball_influence (lavalite_configuration *bp,
-                            double x, double y, double z,
-                            int nballs, metaball *balls)
-{
-  double vv = 0;
-  int i;
-
-  for (i = 0; i < nballs; i++)
-    {
-      metaball *b = &balls[i];
-      double dx, dy, dz;
-      double d2, r, R, r2, R2;
-
-      if (!b->alive_p) continue;
-
-      dx = x - b->x;
-      dy = y - b->y;
-      dz = z - b->z;
-      R = b->R;
-
-      if (dx > R || dx < -R ||    /* quick check before multiplying */
-          dy > R || dy < -R ||
-          dz > R || dz < -R)
-        continue;
-
-      d2 = (dx*dx + dy*dy + dz*dz);
-      r = b->r;
-
-      r2 = r*r;
-      R2 = R*R;
-
-      if (d2 <= r2)             /* (d <= r)   inside the hard radius */
-        vv += 1;
-      else if (d2 > R2)         /* (d > R)   outside the radius of influence */
-        ;
-      else          /* somewhere in between: linear drop-off from r=1 to R=0 */
-        {
-          /* was: vv += 1 - ((d-r) / (R-r)); */
-          vv += 1 - ((d2-r2) / (R2-r2));
-        }
-    }
-
-  return vv;
-}
-
-
-/* callback for marching_cubes() */
-static void *
-obj_init (double grid_size, void *closure)
-{
-  lavalite_configuration *bp = (lavalite_configuration *) closure;
-  bp->grid_size = grid_size;
-
-  return closure;
-}
-
-
-/* Returns True if the given point is outside of the glass tube.
+/* Returns 0 if the given point is outside of the glass tube, of radius
+   `or' at this height; fades from 1 to 0 approaching the glass.
  */
 static double
-clipped_by_glass_p (double x, double y, double z,
-                    lavalite_configuration *bp)
+clipped_by_glass_p (double x, double y, double or)
 {
-  double d2, or, or2, ir2;
-
-  or = bp->max_bottle_radius;
-
-  if (x > or || x < -or ||    /* quick check before multiplying */
-      y > or || y < -or)
-    return 0;
+  double d2, or2, ir2;
 
   d2 = (x*x + y*y);
-  or = bottle_radius_at (bp, z);
-
   or2 = or*or;
 
   if (d2 > or2)   /* (sqrt(d) > or) */
@@ -1100,33 +1043,87 @@ clipped_by_glass_p (double x, double y, double z,
 }
 
 
-
-/* callback for marching_cubes() */
-static double
-obj_compute (double x, double y, double z, void *closure)
+/* Fills in bp->ball_params with the live balls.  These are both what the
+   field kernel reads, and what scalar_field_compute() compares against
+   the previous frame to decide whether the field needs recomputing.
+ */
+static void
+collect_ball_params (lavalite_configuration *bp)
 {
-  lavalite_configuration *bp = (lavalite_configuration *) closure;
-  double clip;
+  int i;
+  double *p = bp->ball_params;
+  bp->nlive = 0;
+  for (i = 0; i < bp->nballs; i++)
+    {
+      metaball *b = &bp->balls[i];
+      if (!b->alive_p) continue;
+      *p++ = b->x;
+      *p++ = b->y;
+      *p++ = b->z;
+      *p++ = b->r;
+      *p++ = b->R;
+      bp->nlive++;
+    }
+}
 
-  x /= bp->grid_size;	/* convert from 0-N to 0-1. */
-  y /= bp->grid_size;
-  z /= bp->grid_size;
 
-  x -= 0.5;	/* X and Y range from -.5 to +.5; z ranges from 0-1. */
-  y -= 0.5;
+/* Field kernel for scalar_field_compute(): the sum of the influence of
+   every live metaball, faded out near the glass.
 
-  clip = clipped_by_glass_p (x, y, z, bp);
-  if (clip == 0) return 0;
+   The loops run over balls on the outside and points on the inside, and
+   the drop-off is written without branches, so that the inner loop
+   vectorizes.  The drop-off is linear in d^2 from 1 at the hard radius r
+   to 0 at the radius of influence R, which is just (R2 - d2) / (R2 - r2)
+   clamped to [0, 1].
+ */
+static void
+lava_field (int count, const double *xs, const double *ys, const double *zs,
+            double *out, void *closure)
+{
+  lavalite_configuration *bp = (lavalite_configuration *) closure;
+  double max_r = bp->max_bottle_radius;
+  double last_z = -1, or = 0;
+  int i, j;
 
-  return (clip *
-          compute_metaball_influence (bp, x, y, z, bp->nballs, bp->balls));
-}
+  for (i = 0; i < count; i++)
+    out[i] = 0;
 
+  for (j = 0; j < bp->nlive; j++)
+    {
+      const double *b = bp->ball_params + j*5;
+      double bx = b[0], by = b[1], bz = b[2];
+      double r2 = b[3] * b[3];
+      double R2 = b[4] * b[4];
+      double scale = (R2 > r2 ? 1 / (R2 - r2) : 1e30);
+      for (i = 0; i < count; i++)
+        {
+          double dx = xs[i] - bx;
+          double dy = ys[i] - by;
+          double dz = zs[i] - bz;
+          double v = (R2 - (dx*dx + dy*dy + dz*dz)) * scale;
+          out[i] += (v < 0 ? 0 : v > 1 ? 1 : v);
+        }
+    }
 
-/* callback for marching_cubes() */
-static void
-obj_free (void *closure)
-{
+  /* Now fade it out toward the glass, and clip it there. */
+  for (i = 0; i < count; i++)
+    {
+      double x = xs[i], y = ys[i];
+      if (out[i] == 0)
+        continue;
+      if (x > max_r || x < -max_r ||   /* quick check before multiplying */
+          y > max_r || y < -max_r)
+        {
+          out[i] = 0;
+          continue;
+        }
+      if (zs[i] != last_z)          /* constant along a row of the grid */
+        {
+          last_z = zs[i];
+          or = bottle_radius_at (bp, last_z);
+        }
+      out[i] *= clipped_by_glass_p (x, y, or);
+    }
 }
 
 
@@ -1201,41 +1198,54 @@ animate_lava (ModeInfo *mi)
 
   move_balls (mi);
 
-  glNewList (bp->ball_list, GL_COMPILE);
-  glPushMatrix();
-
-  glMaterialfv (GL_FRONT, GL_SPECULAR,            lava_spec);
-  glMateriali  (GL_FRONT, GL_SHININESS,           lava_shininess);
-  glMaterialfv (GL_FRONT, GL_AMBIENT_AND_DIFFUSE, lava_color);
-
-  /* For the blobbies, the origin is on the axis at the bottom of the
-     glass bottle; and the top of the bottle is +1 on Z.
+  /* Recompute the field, unless no ball has moved by more than a tenth of
+     a grid cell since the last time we did: in which case the surface
+     would come out the same, and the display list is still good.
    */
-  glTranslatef (0, 0, -0.5);
-
-  mi->polygon_count = 0;
   {
-    double s;
-    if (bp->grid_size == 0) bp->grid_size = 1;  /* first time through */
-    s = 1.0/bp->grid_size;
+    int changed_p;
+    const double *grid;
+
+    collect_ball_params (bp);
+    grid = scalar_field_compute (bp->field, lava_field, bp,
+                                 bp->ball_params, bp->nlive * 5,
+                                 0.1 / bp->grid_size,
+                                 &changed_p);
+    if (!changed_p) goto DONE_LIST;
 
+    glNewList (bp->ball_list, GL_COMPILE);
     glPushMatrix();
-    glTranslatef (-0.5, -0.5, 0);
-    glScalef (s, s, s);
-    marching_cubes (resolution, isolevel, wire, do_smooth,
-                    obj_init, obj_compute, obj_free, bp,
-                    &mi->polygon_count);
+
+    glMaterialfv (GL_FRONT, GL_SPECULAR,            lava_spec);
+    glMateriali  (GL_FRONT, GL_SHININESS,           lava_shininess);
+    glMaterialfv (GL_FRONT, GL_AMBIENT_AND_DIFFUSE, lava_color);
+
+    /* For the blobbies, the origin is on the axis at the bottom of the
+       glass bottle; and the top of the bottle is +1 on Z.
+     */
+    glTranslatef (0, 0, -0.5);
+
+    {
+      double s = 1.0/bp->grid_size;
+      glPushMatrix();
+      glTranslatef (-0.5, -0.5, 0);
+      glScalef (s, s, s);
+      marching_cubes_grid (bp->grid_size, bp->grid_size, bp->grid_size,
+                           grid, isolevel, wire, do_smooth,
+                           &bp->ball_poly_count);
+      glPopMatrix();
+    }
+
     glPopMatrix();
+    glEndList ();
   }
 
-  mi->polygon_count += bp->bottle_poly_count;
-
-  glPopMatrix();
-  glEndList ();
+ DONE_LIST:
+  mi->polygon_count = bp->ball_poly_count + bp->bottle_poly_count;
 }
 
 
-
+
 /* Startup initialization
  */
 
@@ -1398,6 +1408,18 @@ init_lavalite (ModeInfo *mi)
                 + 2);
   bp->balls = (metaball *) calloc (sizeof(*bp->balls), bp->nballs+1);
 
+  /* Grid point N is at N/resolution, with X and Y ranging from -.5 to +.5,
+     and Z from 0 to 1. */
+  bp->grid_size = (resolution > 1 ? resolution : 1);
+  bp->ball_params = (double *)
+    calloc (sizeof(*bp->ball_params), (bp->nballs+1) * 5);
+  bp->field = scalar_field_create (MI_DISPLAY(mi), bp->grid_size,
+                                   bp->grid_size, bp->grid_size);
+  scalar_field_set_grid (bp->field,
+                         -0.5, 1.0/bp->grid_size,
+                         -0.5, 1.0/bp->grid_size,
+                          0.0, 1.0/bp->grid_size);
+
   bp->bottle_list = glGenLists (1);
   bp->ball_list = glGenLists (1);
 
@@ -1539,6 +1561,8 @@ free_lavalite (ModeInfo *mi)
   if (!bp->glx_context) return;
   glXMakeCurrent(MI_DISPLAY(mi), MI_WINDOW(mi), *bp->glx_context);
   if (bp->balls) free (bp->balls);
+  if (bp->ball_params) free (bp->ball_params);
+  if (bp->field) scalar_field_free (bp->field);
   if (bp->trackball) gltrackball_free (bp->trackball);
   if (bp->rot) free_rotator (bp->rot);
   if (bp->rot2) free_rotator (bp->rot2);
@@ -16,6 +16,15 @@
  * Sadly, this division of labor means that this program won't work on iOS or
  * Android.
  *
+ * If the URL template is a "file:" URL, the helper is not used at all: the
+ * tiles are read directly from a local mirror.
+ *
+ * Either way, the image files are decoded by a small pool of worker threads,
+ * so that the render thread only has to upload finished textures.  Tiles
+ * that scroll off the edge are kept in an LRU cache of textures, and tiles
+ * just beyond the edge in the direction we're heading are requested early,
+ * so that they are usually ready before they become visible.
+ *
  * If we wanted to get this working on iOS and Android, it might be easier to
  * just rewrite the whole thing as a webview running https://openlayers.org/ -
  * it would probably be 50 lines of code.
@@ -30,6 +39,7 @@
 			"*loaderProgram: mapscroller.pl" "\n" \
 			"*cacheSize:     20MB"           "\n" \
 			"*suppressRotationAnimation: True \n" \
+			THREAD_DEFAULTS_XLOCK
 
 # define release_map 0
 # undef DEBUG_TEXTURE
@@ -39,6 +49,7 @@
 #include "texfont.h"
 #include "easing.h"
 #include "utf8wc.h"
+#include "thread_util.h"
 #include "../images/gen/oceantiles_12_png.h"
 
 #ifdef USE_GL /* whole file */
@@ -53,6 +64,8 @@
 #include <signal.h>
 #include <sys/wait.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
 
 #define DEF_URL_TEMPLATE "(default)"
 #define DEF_MAP_LEVEL    "15"
@@ -68,6 +81,13 @@
 #define MIN_LEVEL 5
 #define MAX_LEVEL 18  /* Some servers go to 19, but not all */
 
+#define MAX_WORKERS      4    /* Decoder threads */
+#define TILE_CACHE_SIZE  128  /* Off-grid textures retained, 256KB each */
+#define MAX_PREFETCH     48   /* Outstanding speculative requests */
+#define PREFETCH_DEPTH   2    /* Rows of tiles beyond the grid edge */
+#define MAX_UPLOADS      8    /* Textures created per frame */
+#define PIPE_PREFETCH    4    /* Speculative requests in the helper's queue */
+
 typedef struct { double lat, lon; } LL;
 typedef struct { double x, y; } XY;
 typedef struct { long x, y; } XYi;
@@ -88,6 +108,35 @@ typedef struct {
   GLfloat brightness;
 } tile;
 
+/* A tile that has been requested.  It is created on the render thread,
+   waits for the helper to download it (unless we're reading from file:),
+   is decoded on a worker thread, and is then handed back to the render
+   thread to become a texture, either in the grid or in the cache.
+   The helper handles one request at a time, so prefetches wait in
+   JOB_DEFERRED until it has nothing more urgent to do.
+ */
+typedef struct tile_job tile_job;
+struct tile_job {
+  long x, y;
+  int z;
+  Bool prefetch_p;
+  char *file;
+  XImage *image;
+  GLfloat brightness;
+  enum { JOB_DEFERRED, JOB_DOWNLOADING, JOB_QUEUED, JOB_DONE, JOB_FAILED,
+         JOB_RETRY } status;
+  tile_job *next;       /* All outstanding jobs, render thread only */
+  tile_job *queue_next; /* Jobs waiting for a worker, under the mutex */
+};
+
+typedef struct {
+  long x, y;
+  int z;
+  GLuint texid;
+  GLfloat brightness;
+  unsigned long used;
+} cached_tile;
+
 typedef struct {
   GLXContext *glx_context;
   char *url_template;
@@ -110,10 +159,28 @@ typedef struct {
   time_t start_time, change_time;
   double opacity;
 
+  Bool file_p;          /* Read tiles from disk rather than from helper */
   pid_t pid;
   XtInputId pipe_id;
   int pipe_in, pipe_out;
   Bool input_available_p;
+  char inbuf[4096];
+  int inbuf_fp;
+
+  tile_job *jobs;
+  int prefetch_count;
+  int zoom_dir;
+  cached_tile cache[TILE_CACHE_SIZE];
+  unsigned long cache_tick;
+
+  int nworkers;
+  Bool shutdown_p;
+  tile_job *queue_head, *queue_tail;
+# if HAVE_PTHREAD
+  pthread_t *workers;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+# endif
 
   Bool button_down_p;
   LL drag_start_deg;
@@ -152,6 +219,7 @@ static XrmOptionDescRec opts[] = {
   { "-vvvvv",	     ".verbose",     XrmoptionNoArg, "5" },
   { "-vvvvvv",	     ".verbose",     XrmoptionNoArg, "6" },
   { "-quiet",	     ".verbose",     XrmoptionNoArg, "0" },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
@@ -327,6 +395,653 @@ mostly_ocean_p (ModeInfo *mi)
 }
 
 
+/* Expand a "file:" URL template into a pathname.  Returns a malloc'ed
+   string.  Accepts the same substitutions as mapscroller.pl.
+ */
+static char *
+expand_template (const char *template, long x, long y, int z)
+{
+  int n = 0;
+  char *out, *o;
+  const char *s;
+
+  /* Each {x} can become as many digits as a long has. */
+  for (s = template; *s; s++)
+    if (*s == '{') n++;
+  out = (char *) malloc (strlen (template) + n * 24 + 1);
+  if (!out) abort();
+  o = out;
+  s = template;
+
+  if (!strncasecmp (s, "file://", 7))
+    s += 7;
+  else if (!strncasecmp (s, "file:", 5))
+    s += 5;
+
+  while (*s)
+    {
+      const char *e;
+      if (*s == '$' && s[1] == '{')
+        s++;
+      if (*s != '{' || !(e = strchr (s, '}')))
+        {
+          *o++ = *s++;
+          continue;
+        }
+      s++;
+      if (*s == '$') s++;
+      if (e - s == 1 && (*s == 'x' || *s == 'X'))
+        o += sprintf (o, "%ld", x);
+      else if (e - s == 1 && (*s == 'y' || *s == 'Y'))
+        o += sprintf (o, "%ld", y);
+      else if (e - s == 1 && (*s == 'z' || *s == 'Z'))
+        o += sprintf (o, "%d", z);
+      else if (e - s == 1 && (*s == 'r' || *s == 'R'))
+        ;				/* {r} -- "" or "@2x" */
+      else if (e - s == 1 && (*s == 's' || *s == 'S'))
+        *o++ = 'a';			/* {s} means {a-d} */
+      else if (e - s == 3 && s[1] == '-')
+        *o++ = s[0];			/* {a-c}: mirrors are all alike */
+      s = e + 1;
+    }
+  *o = 0;
+  return out;
+}
+
+
+/* Load and analyze the image.  Runs on a worker thread, so it must not
+   touch the GL context, or anything in bp that the render thread writes.
+   Returns the new status for the job.
+ */
+static int
+decode_tile (ModeInfo *mi, const char *file,
+             XImage **image_ret, GLfloat *brightness_ret)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  struct stat st;
+  XImage *image;
+  int x, y;
+  double total = 0;
+
+  if (stat (file, &st))
+    {
+      /* From the helper, this can happen if mapscroller.pl has a file cached
+         but the cache was cleared by another copy running on another
+         screen.  From a local mirror, the tile just isn't there. */
+      if (verbose_p)
+        fprintf (stderr, "%s: file does not exist: %s\n", progname, file);
+      return (bp->file_p ? JOB_FAILED : JOB_RETRY);
+    }
+
+  image = file_to_ximage (MI_DISPLAY(mi), MI_VISUAL(mi), file);
+  if (!image)
+    {
+      if (verbose_p)
+        fprintf (stderr, "%s: file unloadable: %s\n", progname, file);
+      return (bp->file_p ? JOB_FAILED : JOB_RETRY);
+    }
+
+  for (y = 0; y < image->height; y++)
+    for (x = 0; x < image->width; x++)
+      {
+        unsigned long rgba = XGetPixel (image, x, y);
+     /* int a = (rgba >> 24) & 0xFF; */
+        int r = (rgba >> 16) & 0xFF;
+        int g = (rgba >>  8) & 0xFF;
+        int b = (rgba >>  0) & 0xFF;
+        double gray = r * 0.2126 + g * 0.7152 + b * 0.0722;
+        total += gray / 0xFF;
+      }
+  *brightness_ret = total / (image->width * image->height);
+  *brightness_ret *= 0.7;  /* Tweak cutoff */
+  *image_ret = image;
+  return JOB_DONE;
+}
+
+
+#if HAVE_PTHREAD
+
+static void *
+tile_worker (void *arg)
+{
+  ModeInfo *mi = (ModeInfo *) arg;
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+
+  while (1)
+    {
+      tile_job *job;
+      const char *file;
+      XImage *image = 0;
+      GLfloat brightness = 0;
+      int status;
+
+      PTHREAD_VERIFY (pthread_mutex_lock (&bp->mutex));
+      while (!bp->queue_head && !bp->shutdown_p)
+        PTHREAD_VERIFY (pthread_cond_wait (&bp->cond, &bp->mutex));
+      if (bp->shutdown_p)
+        {
+          PTHREAD_VERIFY (pthread_mutex_unlock (&bp->mutex));
+          break;
+        }
+      job = bp->queue_head;
+      bp->queue_head = job->queue_next;
+      if (!bp->queue_head) bp->queue_tail = 0;
+      job->queue_next = 0;
+      file = job->file;
+      PTHREAD_VERIFY (pthread_mutex_unlock (&bp->mutex));
+
+      status = decode_tile (mi, file, &image, &brightness);
+
+      /* The render thread only looks at the results once the status has
+         changed, and only while holding the lock. */
+      PTHREAD_VERIFY (pthread_mutex_lock (&bp->mutex));
+      job->image      = image;
+      job->brightness = brightness;
+      job->status     = status;
+      PTHREAD_VERIFY (pthread_mutex_unlock (&bp->mutex));
+    }
+  return 0;
+}
+
+#endif /* HAVE_PTHREAD */
+
+
+static void
+start_workers (ModeInfo *mi)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  bp->nworkers = 0;
+# if HAVE_PTHREAD
+  if (threads_available (MI_DISPLAY(mi)) >= 0)
+    {
+      int i, n = hardware_concurrency (MI_DISPLAY(mi));
+      if (n > MAX_WORKERS) n = MAX_WORKERS;
+      if (n < 1) n = 1;
+
+      /* ximage-loader.c does some lazy initialization the first time it is
+         called; we have already loaded oceantiles_12_png on this thread,
+         so that has happened before any worker starts. */
+      bp->mutex = mutex_initializer;
+      bp->cond  = cond_initializer;
+      bp->workers = (pthread_t *) calloc (n, sizeof(*bp->workers));
+      for (i = 0; i < n; i++)
+        {
+          if (pthread_create (&bp->workers[i], 0, tile_worker, mi))
+            break;
+          bp->nworkers++;
+        }
+      if (verbose_p > 1)
+        fprintf (stderr, "%s: %d decoder threads\n", blurb(mi),
+                 bp->nworkers);
+    }
+# endif /* HAVE_PTHREAD */
+}
+
+
+static void
+stop_workers (ModeInfo *mi)
+{
+# if HAVE_PTHREAD
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  int i;
+  if (! bp->nworkers) return;
+  PTHREAD_VERIFY (pthread_mutex_lock (&bp->mutex));
+  bp->shutdown_p = True;
+  PTHREAD_VERIFY (pthread_cond_broadcast (&bp->cond));
+  PTHREAD_VERIFY (pthread_mutex_unlock (&bp->mutex));
+  for (i = 0; i < bp->nworkers; i++)
+    PTHREAD_VERIFY (pthread_join (bp->workers[i], 0));
+  free (bp->workers);
+  bp->workers = 0;
+  bp->nworkers = 0;
+  PTHREAD_VERIFY (pthread_cond_destroy (&bp->cond));
+  PTHREAD_VERIFY (pthread_mutex_destroy (&bp->mutex));
+# endif /* HAVE_PTHREAD */
+}
+
+
+/* The job's image file is known; decode it on a worker thread, or right
+   now if there are no threads.
+ */
+static void
+queue_job (ModeInfo *mi, tile_job *job)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  job->queue_next = 0;
+
+  if (! bp->nworkers)
+    {
+      job->status = decode_tile (mi, job->file, &job->image, &job->brightness);
+      return;
+    }
+
+# if HAVE_PTHREAD
+  PTHREAD_VERIFY (pthread_mutex_lock (&bp->mutex));
+  job->status = JOB_QUEUED;
+  if (bp->queue_tail)
+    bp->queue_tail->queue_next = job;
+  else
+    bp->queue_head = job;
+  bp->queue_tail = job;
+  PTHREAD_VERIFY (pthread_cond_signal (&bp->cond));
+  PTHREAD_VERIFY (pthread_mutex_unlock (&bp->mutex));
+# endif /* HAVE_PTHREAD */
+}
+
+
+static tile_job *
+find_job (ModeInfo *mi, long x, long y, int z)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  tile_job *job;
+  for (job = bp->jobs; job; job = job->next)
+    if (job->x == x && job->y == y && job->z == z)
+      return job;
+  return 0;
+}
+
+
+static void
+free_job (tile_job *job)
+{
+  if (job->image) XDestroyImage (job->image);
+  if (job->file) free (job->file);
+  free (job);
+}
+
+
+/* The LRU cache of textures for tiles that are not currently in the grid:
+   tiles that have scrolled off, tiles from the previous zoom level, and
+   prefetched tiles that have not scrolled on yet.
+ */
+static cached_tile *
+cache_find (ModeInfo *mi, long x, long y, int z)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  int i;
+  for (i = 0; i < TILE_CACHE_SIZE; i++)
+    {
+      cached_tile *c = &bp->cache[i];
+      if (c->texid && c->x == x && c->y == y && c->z == z)
+        return c;
+    }
+  return 0;
+}
+
+
+static void
+cache_put (ModeInfo *mi, long x, long y, int z,
+           GLuint texid, GLfloat brightness)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  cached_tile *c = cache_find (mi, x, y, z);
+  int i;
+
+  if (c)   /* Already have it; this one is redundant */
+    {
+      glDeleteTextures (1, &texid);
+      return;
+    }
+
+  c = &bp->cache[0];
+  for (i = 0; i < TILE_CACHE_SIZE; i++)
+    {
+      if (! bp->cache[i].texid)
+        {
+          c = &bp->cache[i];
+          break;
+        }
+      if (bp->cache[i].used < c->used)
+        c = &bp->cache[i];
+    }
+
+  if (c->texid)
+    glDeleteTextures (1, &c->texid);
+  c->x = x;
+  c->y = y;
+  c->z = z;
+  c->texid = texid;
+  c->brightness = brightness;
+  c->used = ++bp->cache_tick;
+}
+
+
+/* If the tile is in the cache, move its texture into the grid. */
+static Bool
+cache_take (ModeInfo *mi, tile *t)
+{
+  cached_tile *c = cache_find (mi, t->map.x, t->map.y, t->map_level);
+  if (!c) return False;
+  t->texid = c->texid;
+  t->brightness = c->brightness;
+  t->status = OK;
+  c->texid = 0;
+  return True;
+}
+
+
+static void
+free_cache (ModeInfo *mi)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  int i;
+  for (i = 0; i < TILE_CACHE_SIZE; i++)
+    if (bp->cache[i].texid)
+      glDeleteTextures (1, &bp->cache[i].texid);
+  memset (bp->cache, 0, sizeof(bp->cache));
+}
+
+
+/* Write a request for the job's tile to the helper. */
+static void
+send_request (ModeInfo *mi, tile_job *job)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  char buf[100];
+  int L;
+
+  job->status = JOB_DOWNLOADING;
+  sprintf (buf, "%ld %ld %d\n", job->x, job->y, job->z);
+  L = strlen (buf);
+  if (L != write (bp->pipe_out, buf, L))
+    {
+      sprintf (buf, "%.80s: write", blurb(mi));
+      perror (buf);
+      exit (1);
+    }
+  if (verbose_p > 1)
+    fprintf (stderr, "%s: %s tile %s", blurb(mi),
+             (job->prefetch_p ? "prefetching" : "requesting"), buf);
+}
+
+
+/* Ask for a tile: either tell the helper to download it, or go straight
+   to decoding it from the local mirror.  Does nothing if it's already
+   on the way.  Returns False if we're out of room for speculation.
+ */
+static Bool
+request_tile (ModeInfo *mi, long x, long y, int z, Bool prefetch_p)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  tile_job *job = find_job (mi, x, y, z);
+
+  if (job)
+    {
+      if (!prefetch_p && job->prefetch_p)   /* It's wanted for real now */
+        {
+          job->prefetch_p = False;
+          bp->prefetch_count--;
+          if (job->status == JOB_DEFERRED)
+            send_request (mi, job);
+        }
+      return True;
+    }
+
+  if (prefetch_p && bp->prefetch_count >= MAX_PREFETCH)
+    return False;
+
+  job = (tile_job *) calloc (1, sizeof(*job));
+  job->x = x;
+  job->y = y;
+  job->z = z;
+  job->prefetch_p = prefetch_p;
+  job->status = JOB_DEFERRED;
+  job->next = bp->jobs;
+  bp->jobs = job;
+  if (prefetch_p)
+    bp->prefetch_count++;
+
+  if (bp->file_p)
+    {
+      job->file = expand_template (bp->url_template, x, y, z);
+      if (verbose_p > 1)
+        fprintf (stderr, "%s: %s tile %ld %ld %d: %s\n", blurb(mi),
+                 (prefetch_p ? "prefetching" : "reading"), x, y, z,
+                 job->file);
+      queue_job (mi, job);
+    }
+  else if (! prefetch_p)
+    send_request (mi, job);
+
+  return True;
+}
+
+
+/* Feed deferred prefetches to the helper, oldest first, but only while
+   no tile that is actually on screen is waiting for it, and only a few
+   at a time, so that a tile that is needed for real is never stuck
+   behind a long line of speculation.
+ */
+static void
+send_prefetches (ModeInfo *mi)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  int in_flight = 0;
+  tile_job *job, *oldest;
+
+  if (bp->file_p || bp->dead_p) return;
+
+  for (job = bp->jobs; job; job = job->next)
+    if (job->status == JOB_DOWNLOADING)
+      {
+        if (! job->prefetch_p) return;
+        in_flight++;
+      }
+
+  while (in_flight < PIPE_PREFETCH)
+    {
+      oldest = 0;
+      for (job = bp->jobs; job; job = job->next)
+        if (job->status == JOB_DEFERRED)
+          oldest = job;
+      if (! oldest) break;
+      send_request (mi, oldest);
+      in_flight++;
+    }
+}
+
+
+/* Request the tiles that are about to scroll into the grid: a few rows
+   beyond the edge, in a cone around the current heading.  If the level
+   was just changed, also request the middle of the next level in that
+   direction, once.  These end up in the cache rather than the grid.
+ */
+static void
+prefetch_tiles (ModeInfo *mi)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  long map_w = exp2 (bp->map_level);
+  long map_h = map_w;
+  double hx = bp->heading[2].x;
+  double hy = -bp->heading[2].y;	/* Tile Y increases southward */
+  double hd = sqrt (hx*hx + hy*hy);
+  double cx = bp->grid_w / 2.0;
+  double cy = bp->grid_h / 2.0;
+  long x0 = lon2tilex (bp->pos.lon, bp->map_level) - bp->grid_w/2;
+  long y0 = lat2tiley (bp->pos.lat, bp->map_level) - bp->grid_h/2;
+  int d, gx, gy;
+
+  if (bp->dead_p || hd <= 0) return;
+  hx /= hd;
+  hy /= hd;
+
+  for (d = 1; d <= PREFETCH_DEPTH; d++)
+    for (gy = -d; gy < bp->grid_h + d; gy++)
+      for (gx = -d; gx < bp->grid_w + d; gx++)
+        {
+          long x, y;
+          double vx, vy, vd;
+          if (gx != -d && gx != bp->grid_w - 1 + d &&
+              gy != -d && gy != bp->grid_h - 1 + d)
+            continue;				/* Not on this ring */
+          vx = gx + 0.5 - cx;
+          vy = gy + 0.5 - cy;
+          vd = sqrt (vx*vx + vy*vy);
+          if ((vx * hx + vy * hy) / vd < 0.5)	/* Not ahead of us */
+            continue;
+          x = x0 + gx;
+          y = y0 + gy;
+          while (x < 0)      x += map_w;
+          while (x >= map_w) x -= map_w;
+          if (y < 0 || y >= map_h)
+            continue;
+          if (cache_find (mi, x, y, bp->map_level))
+            continue;
+          if (! request_tile (mi, x, y, bp->map_level, True))
+            return;
+        }
+
+  if (bp->zoom_dir)
+    {
+      int z = bp->map_level + bp->zoom_dir;
+      long x1, y1;
+      if (z < MIN_LEVEL || z > MAX_LEVEL)
+        {
+          bp->zoom_dir = 0;
+          return;
+        }
+      map_w = map_h = exp2 (z);
+      x1 = lon2tilex (bp->pos.lon, z);
+      y1 = lat2tiley (bp->pos.lat, z);
+      for (gy = -1; gy <= 1; gy++)
+        for (gx = -1; gx <= 1; gx++)
+          {
+            long x = (x1 + gx + map_w) % map_w;
+            long y = y1 + gy;
+            if (y < 0 || y >= map_h || cache_find (mi, x, y, z))
+              continue;
+            if (! request_tile (mi, x, y, z, True))
+              return;   /* Try the rest next frame */
+          }
+      bp->zoom_dir = 0;   /* All of that block has been asked for */
+    }
+}
+
+
+/* Turn any finished jobs into textures, in the grid if they are still
+   wanted there, or in the cache otherwise.
+ */
+static void
+collect_tiles (ModeInfo *mi)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  tile_job **jp = &bp->jobs;
+  tile_job *done = 0;
+  int uploads = 0;
+
+  /* Only the unlinking needs the lock: once a job is finished, the
+     workers never touch it again, so the textures can be created
+     without holding up the decoding of the next ones. */
+# if HAVE_PTHREAD
+  if (bp->nworkers)
+    PTHREAD_VERIFY (pthread_mutex_lock (&bp->mutex));
+# endif
+
+  while (*jp)
+    {
+      tile_job *job = *jp;
+
+      if (job->status == JOB_DEFERRED ||
+          job->status == JOB_DOWNLOADING ||
+          job->status == JOB_QUEUED ||
+          (job->status == JOB_DONE && uploads >= MAX_UPLOADS))
+        {
+          jp = &job->next;
+          continue;
+        }
+
+      if (job->status == JOB_DONE)
+        uploads++;
+      *jp = job->next;   /* Unlink it */
+      job->next = done;
+      done = job;
+    }
+
+# if HAVE_PTHREAD
+  if (bp->nworkers)
+    PTHREAD_VERIFY (pthread_mutex_unlock (&bp->mutex));
+# endif
+
+  while (done)
+    {
+      tile_job *job = done;
+      tile *t = 0;
+      int i;
+
+      done = job->next;
+      if (job->prefetch_p)
+        bp->prefetch_count--;
+      if (job->status == JOB_DONE || !bp->file_p)
+        bp->tile_count++;
+
+      for (i = 0; i < bp->grid_w * bp->grid_h; i++)
+        if (bp->tiles[i].map.x == job->x &&
+            bp->tiles[i].map.y == job->y &&
+            bp->tiles[i].map_level == job->z &&
+            !bp->tiles[i].texid)
+          {
+            t = &bp->tiles[i];
+            break;
+          }
+
+      if (job->status == JOB_DONE)
+        {
+          XImage *image = job->image;
+          GLuint texid = 0;
+          char buf2[1024];
+
+          glGenTextures (1, &texid);
+          if (!texid) abort();
+          glBindTexture (GL_TEXTURE_2D, texid);
+
+          clear_gl_error();
+          glPixelStorei (GL_UNPACK_ALIGNMENT, 4);
+          glPixelStorei (GL_UNPACK_ROW_LENGTH, image->width);
+          glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA,
+                        image->width, image->height, 0,
+                        GL_RGBA, GL_UNSIGNED_BYTE, image->data);
+          sprintf (buf2, "texture %d: %.100s (%dx%d)", texid,
+                   job->file, image->width, image->height);
+          check_gl_error (buf2);
+
+          if (t)
+            {
+              t->texid = texid;
+              t->brightness = job->brightness;
+              t->status = OK;
+            }
+          else
+            cache_put (mi, job->x, job->y, job->z, texid, job->brightness);
+
+          if (verbose_p > 3)
+            fprintf (stderr, "%s: %s\n", blurb(mi), buf2);
+          else if (verbose_p > 1)
+            fprintf (stderr, "%s: got %stile %ld %ld %d\n", blurb(mi),
+                     (t ? "" : "cached "), job->x, job->y, job->z);
+        }
+      else if (t)
+        t->status = (job->status == JOB_RETRY ? RETRY : FAILED);
+
+      free_job (job);
+    }
+}
+
+
+static void
+free_jobs (ModeInfo *mi)
+{
+  map_configuration *bp = &bps[MI_SCREEN(mi)];
+  while (bp->jobs)
+    {
+      tile_job *job = bp->jobs;
+      bp->jobs = job->next;
+      free_job (job);
+    }
+  bp->queue_head = bp->queue_tail = 0;
+  bp->prefetch_count = 0;
+}
+
+
 static void
 free_tiles (ModeInfo *mi)
 {
@@ -429,10 +1144,15 @@ reshape_tiles (ModeInfo *mi)
         }
     }
 
-  /* Give IDs to the retained new tiles */
+  /* Give IDs to the retained new tiles, and fill in any that we already
+     have textures for. */
   for (i = 0; i < w2 * h2; i++)
     if (bp->tiles[i].id < 0)
-      bp->tiles[i].id = ++tick;
+      {
+        bp->tiles[i].id = ++tick;
+        if (bp->tiles[i].status == BLANK)
+          cache_take (mi, &bp->tiles[i]);
+      }
 
   /* Queue a loader for any tiles that don't have them.
      Enqueue them from the center out, rather than left to right. */
@@ -468,33 +1188,25 @@ reshape_tiles (ModeInfo *mi)
     for (i = 0; i < count; i++)
       {
         tile *t = queue[i];
-        int L;
-        char buf[1024];
 
         if (t->map.x == -1 && t->map.y == -1)	/* Too far North or South */
           continue;
 
         t->status = LOADING;
-        sprintf (buf, "%ld %ld %d\n", t->map.x, t->map.y, t->map_level);
-        L = strlen (buf);
-        if (L != write (bp->pipe_out, buf, L))
-          {
-            sprintf (buf, "%.100s: write", blurb(mi));
-            perror (buf);
-            exit (1);
-          }
-        if (verbose_p > 1)
-         fprintf (stderr, "%s: requesting tile %s", blurb(mi), buf);
+        request_tile (mi, t->map.x, t->map.y, t->map_level, False);
       }
     free (queue);
   }
 
-  /* Free textures of any now-unused tiles. */
+  /* Retain the textures of any now-unused tiles, in case we come back. */
   for (i = 0; i < ow * oh; i++)
     if (otiles[i].texid)
-      glDeleteTextures (1, &otiles[i].texid);
+      cache_put (mi, otiles[i].map.x, otiles[i].map.y, otiles[i].map_level,
+                 otiles[i].texid, otiles[i].brightness);
 
   free (otiles);
+
+  prefetch_tiles (mi);
 }
 
 
@@ -809,173 +1521,94 @@ fork_loader (ModeInfo *mi)
                          loader_cb, (XtPointer) mi);
         bp->pipe_out = fd1[1];
         bp->pipe_in  = fd2[0];
+        fcntl (bp->pipe_in, F_SETFL, fcntl (bp->pipe_in, F_GETFL) | O_NONBLOCK);
         break;
       }
     }
 }
 
 
-/* Process a single line from the Perl helper program.
+/* Process whatever lines are available from the Perl helper program.
+   Each line is "x y z \t FILE", or a 3-digit HTTP error code instead of
+   the file name.
  */
 static void
 read_loader (ModeInfo *mi)
 {
   map_configuration *bp = &bps[MI_SCREEN(mi)];
-  char buf[4096];
-  int L = 0;
+  char *s, *eol;
+  int n;
   bp->input_available_p = False;
 
-  /* Read a single line -- the file name.
-     If there is more data available, leave it there; select will fire again.
-   */
-  while (1)
+  n = read (bp->pipe_in, bp->inbuf + bp->inbuf_fp,
+            sizeof(bp->inbuf) - bp->inbuf_fp - 1);
+  if (n == 0)
     {
-      unsigned char s[2];
-      int n = read (bp->pipe_in, (void *) s, 1);
-      if (n > 0)
-        {
-          if (*s && *s != '\n')
-            {
-              if (L >= sizeof(buf)-1)
-                abort();
-              buf[L++] = *s;
-            }
-          else
-            {
-              buf[L] = 0;
-              break;
-            }
-        }
-      else if (n == 0)
-        {
-          fprintf (stderr, "%s: subprocess died\n", blurb(mi));
-          bp->dead_p = TRUE;
-          bp->mode = FADE_OUT;
-          return;
-        }
-      else
-        {
-          sprintf (buf, "%.100s: read", blurb(mi));
-          perror (buf);
-          exit (1);
-        }
+      fprintf (stderr, "%s: subprocess died\n", blurb(mi));
+      bp->dead_p = TRUE;
+      bp->mode = FADE_OUT;
+      return;
+    }
+  else if (n < 0)
+    {
+      char buf[255];
+      if (errno == EAGAIN || errno == EINTR)
+        return;
+      sprintf (buf, "%.100s: read", blurb(mi));
+      perror (buf);
+      exit (1);
     }
 
-  /* Line looks like "x y z \t FILE"
-     Find the tile it corresponds to and texturize it. */
-  {
-    int i;
-    long x, y, z;
-    char *coords, *file;
-    char *s = strchr (buf, '\t');
-    Bool matched_p = False;
-    if (!s) abort();
-    coords = buf;
-    *s = 0;
-    file = s+1;
-    if (3 != sscanf (coords, " %ld %ld %ld ", &x, &y, &z))
-      abort();
-
-    bp->tile_count++;
-
-    for (i = 0; i < bp->grid_w * bp->grid_h; i++)
-      {
-        tile *t = &bp->tiles[i];
-        if (t->map.x == x &&
-            t->map.y == y &&
-            t->map_level == z &&
-            !t->texid)
-          {
-            char buf2[1024];
-            XImage *image;
-            struct stat st;
-            matched_p = True;
-
-            if (strlen(file) == 3)   /* HTTP error code */
-              {
-                /* 504 timeout error code: retry; all others: don't.
-                   The perl script returns 504 if and only if it did not
-                   get a response. All other codes are from the server.
-                 */
-                t->status = (!strcmp (file, "504") ? RETRY : FAILED);
-                if (verbose_p)
-                  fprintf (stderr, "%s: error %s: tile: %s pos: %.4f, %.4f\n",
-                           blurb(mi), file, buf,
-                           tiley2lat (y, z), tilex2lon (x, z));
-                break;
-              }
-
-            if (stat (file, &st))
-              {
-                /* This can happen if mapscroller.pl has a file cached but
-                   the cache was cleared by another copy running on another
-                   screen. */
-                if (verbose_p)
-                  fprintf (stderr, "%s: file does not exist: %s\n",
-                           blurb(mi), file);
-                t->status = RETRY;
-                break;
-              }
-
-            image = file_to_ximage (MI_DISPLAY(mi), MI_VISUAL(mi), file);
-            if (!image)
-              {
-                if (verbose_p)
-                  fprintf (stderr, "%s: file unloadable: %s\n",
-                           blurb(mi), file);
-                t->status = RETRY;
-                break;
-              }
-
-            t->status = OK;
-
-            {
-              int y;
-              double total = 0;
-              for (y = 0; y < image->height; y++)
-                for (x = 0; x < image->width; x++)
-                  {
-                    unsigned long rgba = XGetPixel (image, x, y);
-                 /* int a = (rgba >> 24) & 0xFF; */
-                    int r = (rgba >> 16) & 0xFF;
-                    int g = (rgba >>  8) & 0xFF;
-                    int b = (rgba >>  0) & 0xFF;
-                    double gray = r * 0.2126 + g * 0.7152 + b * 0.0722;
-                    total += gray / 0xFF;
-                  }
-              t->brightness = total / (image->width * image->height);
-              t->brightness *= 0.7;  /* Tweak cutoff */
-            }
+  bp->inbuf_fp += n;
+  bp->inbuf[bp->inbuf_fp] = 0;
 
-            if (t->texid) abort();
-            glGenTextures (1, &t->texid);
-            if (!t->texid) abort();
-            glBindTexture (GL_TEXTURE_2D, t->texid);
-
-            clear_gl_error();
-            glPixelStorei (GL_UNPACK_ALIGNMENT, 4);
-            glPixelStorei (GL_UNPACK_ROW_LENGTH, image->width);
-            glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA,
-                          image->width, image->height, 0,
-                          GL_RGBA, GL_UNSIGNED_BYTE, image->data);
-            sprintf (buf2, "texture %d: %.100s (%dx%d)", t->texid,
-                     file, image->width, image->height);
-            check_gl_error (buf2);
-            XDestroyImage (image);
-            if (verbose_p > 3)
-              fprintf (stderr, "%s: %s\n", blurb(mi), buf2);
-            else if (verbose_p > 1)
-              fprintf (stderr, "%s: got tile %ld %ld %ld\n", blurb(mi),
-                       x, y, z);
-          }
-      }
+  s = bp->inbuf;
+  while ((eol = strchr (s, '\n')))
+    {
+      long x, y, z;
+      char *file = strchr (s, '\t');
+      tile_job *job;
+
+      *eol = 0;
+      if (!file || file > eol) abort();
+      *file++ = 0;
+      if (3 != sscanf (s, " %ld %ld %ld ", &x, &y, &z))
+        abort();
+      s = eol + 1;
+
+      job = find_job (mi, x, y, z);
+      if (!job || job->file || job->status == JOB_DEFERRED)
+        {
+          if (verbose_p > 2)
+            fprintf (stderr, "%s: got unmatched tile %ld %ld %ld\n",
+                     blurb(mi), x, y, z);
+          continue;
+        }
 
-    if (verbose_p > 2 && !matched_p)
-      fprintf (stderr, "%s: got unmatched tile %ld %ld %ld\n", blurb(mi),
-               x, y, z);
+      if (strlen(file) == 3)   /* HTTP error code */
+        {
+          /* 504 timeout error code: retry; all others: don't.
+             The perl script returns 504 if and only if it did not
+             get a response. All other codes are from the server.
+           */
+          job->status = (!strcmp (file, "504") ? JOB_RETRY : JOB_FAILED);
+          if (verbose_p)
+            fprintf (stderr, "%s: error %s: tile: %ld %ld %ld"
+                     " pos: %.4f, %.4f\n",
+                     blurb(mi), file, x, y, z,
+                     tiley2lat (y, z), tilex2lon (x, z));
+          continue;
+        }
 
+      job->file = strdup (file);
+      queue_job (mi, job);
+    }
 
-  }
+  /* Keep any partial line for next time. */
+  bp->inbuf_fp -= (s - bp->inbuf);
+  memmove (bp->inbuf, s, bp->inbuf_fp + 1);
+  if (bp->inbuf_fp >= sizeof(bp->inbuf) - 1)
+    abort();
 }
 
 
@@ -1012,6 +1645,7 @@ map_handle_event (ModeInfo *mi, XEvent *event)
         {
         WHEEL_UP:
           bp->map_level++;
+          bp->zoom_dir = 1;
           if (bp->map_level > MAX_LEVEL)
             {
               bp->map_level = MAX_LEVEL;
@@ -1024,6 +1658,7 @@ map_handle_event (ModeInfo *mi, XEvent *event)
         {
         WHEEL_DOWN:
           bp->map_level--;
+          bp->zoom_dir = -1;
           if (bp->map_level < MIN_LEVEL)
             {
               bp->map_level = MIN_LEVEL;
@@ -1244,6 +1879,7 @@ init_map (ModeInfo *mi)
       !*bp->url_template ||
       *bp->url_template == '(')
     bp->url_template = FALLBACK_URL;
+  bp->file_p = !strncasecmp (bp->url_template, "file:", 5);
 
   bp->map_level = map_level_arg;
   if (bp->map_level <= MIN_LEVEL) bp->map_level = MIN_LEVEL;
@@ -1337,7 +1973,9 @@ init_map (ModeInfo *mi)
   bp->start_time = time ((time_t *) 0);
   bp->change_time = bp->start_time;
 
-  fork_loader (mi);
+  start_workers (mi);
+  if (! bp->file_p)
+    fork_loader (mi);
   reshape_map (mi, MI_WIDTH(mi), MI_HEIGHT(mi));
 }
 
@@ -1542,6 +2180,8 @@ draw_map (ModeInfo *mi)
 
   if (bp->input_available_p && !bp->dead_p)
     read_loader (mi);
+  send_prefetches (mi);
+  collect_tiles (mi);
 
   if (!MI_IS_WIREFRAME(mi))
     glEnable (GL_TEXTURE_2D);
@@ -1607,15 +2247,17 @@ draw_map (ModeInfo *mi)
       s += strlen (s);
       if (bp->dead_p)
         sprintf (s, "%.100s subprocess died.", bp->loader);
+      else if (bp->file_p)
+        sprintf (s, "No tiles found in %.100s", bp->url_template);
       else
         sprintf (s, "%.100s subprocess produced no tiles.", bp->loader);
       s += strlen (s);
 
-      if (! bp->dead_p)
+      if (! bp->dead_p && ! bp->file_p)
         strcat (s, " Network problem?");
       s += strlen (s);
 
-      if (bp->tile_count < 10)
+      if (bp->tile_count < 10 && ! bp->file_p)
         strcat (s,
                 " Is Perl broken? Maybe try:\n\n"
                 "sudo cpan LWP::Simple LWP::Protocol::https Mozilla::CA");
@@ -1643,6 +2285,9 @@ free_map (ModeInfo *mi)
   map_configuration *bp = &bps[MI_SCREEN(mi)];
   if (!bp->glx_context) return;
   glXMakeCurrent(MI_DISPLAY(mi), MI_WINDOW(mi), *bp->glx_context);
+  stop_workers (mi);
+  free_jobs (mi);
+  free_cache (mi);
   if (bp->font_data)
     free_texture_font (bp->font_data);
   if (bp->tiles)
@@ -1652,6 +2297,8 @@ free_map (ModeInfo *mi)
   if (bp->nearest_city)
     free (bp->nearest_city);
 
+  if (bp->file_p) return;
+
   close (bp->pipe_in);
   close (bp->pipe_out);
 
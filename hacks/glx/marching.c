@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 #undef ABS
@@ -26,10 +27,12 @@
 
 typedef struct {
    XYZ p[3];
+   XYZ n[3];
 } TRIANGLE;
 
 typedef struct {
    XYZ p[8];
+   XYZ n[8];		/* only filled in by marching_cubes_grid() */
    double val[8];
 } GRIDCELL;
 
@@ -347,26 +350,34 @@ static const int triTable[256][16] = {
 
 
 /* Linearly interpolate the position where an isosurface cuts
-   an edge between two vertices, each with their own scalar value
+   an edge between two vertices, each with their own scalar value.
+   The normal is interpolated the same way.
 */
-static XYZ
-interp_vertex (double isolevel, XYZ p1, XYZ p2, double valp1, double valp2)
+static void
+interp_vertex (double isolevel, const GRIDCELL *grid, int v1, int v2,
+               XYZ *p, XYZ *n)
 {
+  double valp1 = grid->val[v1];
+  double valp2 = grid->val[v2];
+  const XYZ *p1 = &grid->p[v1], *p2 = &grid->p[v2];
+  const XYZ *n1 = &grid->n[v1], *n2 = &grid->n[v2];
   double mu;
-  XYZ p;
 
   if (ABS(isolevel-valp1) < 0.00001)
-    return(p1);
-  if (ABS(isolevel-valp2) < 0.00001)
-    return(p2);
-  if (ABS(valp1-valp2) < 0.00001)
-    return(p1);
-  mu = (isolevel - valp1) / (valp2 - valp1);
-  p.x = p1.x + mu * (p2.x - p1.x);
-  p.y = p1.y + mu * (p2.y - p1.y);
-  p.z = p1.z + mu * (p2.z - p1.z);
-
-  return(p);
+    mu = 0;
+  else if (ABS(isolevel-valp2) < 0.00001)
+    mu = 1;
+  else if (ABS(valp1-valp2) < 0.00001)
+    mu = 0;
+  else
+    mu = (isolevel - valp1) / (valp2 - valp1);
+
+  p->x = p1->x + mu * (p2->x - p1->x);
+  p->y = p1->y + mu * (p2->y - p1->y);
+  p->z = p1->z + mu * (p2->z - p1->z);
+  n->x = n1->x + mu * (n2->x - n1->x);
+  n->y = n1->y + mu * (n2->y - n1->y);
+  n->z = n1->z + mu * (n2->z - n1->z);
 }
 
 
@@ -380,25 +391,33 @@ interp_vertex (double isolevel, XYZ p1, XYZ p2, double valp1, double valp2)
   By Paul Bourke <pbourke@swin.edu.au>
 */
 static int
-march_one_cube (GRIDCELL grid, double isolevel, TRIANGLE *triangles)
+cube_index (const GRIDCELL *grid, double isolevel)
+{
+  int cubeindex = 0;
+  if (grid->val[0] < isolevel) cubeindex |= 1;
+  if (grid->val[1] < isolevel) cubeindex |= 2;
+  if (grid->val[2] < isolevel) cubeindex |= 4;
+  if (grid->val[3] < isolevel) cubeindex |= 8;
+  if (grid->val[4] < isolevel) cubeindex |= 16;
+  if (grid->val[5] < isolevel) cubeindex |= 32;
+  if (grid->val[6] < isolevel) cubeindex |= 64;
+  if (grid->val[7] < isolevel) cubeindex |= 128;
+  return cubeindex;
+}
+
+static int
+march_one_cube (const GRIDCELL *grid, double isolevel, TRIANGLE *triangles)
 {
   int i, ntriang;
   int cubeindex;
   XYZ vertlist[12];
+  XYZ normlist[12];
 
   /*
     Determine the index into the edge table which
     tells us which vertices are inside of the surface
   */
-  cubeindex = 0;
-  if (grid.val[0] < isolevel) cubeindex |= 1;
-  if (grid.val[1] < isolevel) cubeindex |= 2;
-  if (grid.val[2] < isolevel) cubeindex |= 4;
-  if (grid.val[3] < isolevel) cubeindex |= 8;
-  if (grid.val[4] < isolevel) cubeindex |= 16;
-  if (grid.val[5] < isolevel) cubeindex |= 32;
-  if (grid.val[6] < isolevel) cubeindex |= 64;
-  if (grid.val[7] < isolevel) cubeindex |= 128;
+  cubeindex = cube_index (grid, isolevel);
 
   /* Cube is entirely in/out of the surface */
   if (edgeTable[cubeindex] == 0)
@@ -406,41 +425,29 @@ march_one_cube (GRIDCELL grid, double isolevel, TRIANGLE *triangles)
 
   /* Find the vertices where the surface intersects the cube */
   if (edgeTable[cubeindex] & 1)
-    vertlist[0] =
-      interp_vertex (isolevel,grid.p[0],grid.p[1],grid.val[0],grid.val[1]);
+    interp_vertex (isolevel, grid, 0, 1, &vertlist[0], &normlist[0]);
   if (edgeTable[cubeindex] & 2)
-    vertlist[1] =
-      interp_vertex (isolevel,grid.p[1],grid.p[2],grid.val[1],grid.val[2]);
+    interp_vertex (isolevel, grid, 1, 2, &vertlist[1], &normlist[1]);
   if (edgeTable[cubeindex] & 4)
-    vertlist[2] =
-      interp_vertex (isolevel,grid.p[2],grid.p[3],grid.val[2],grid.val[3]);
+    interp_vertex (isolevel, grid, 2, 3, &vertlist[2], &normlist[2]);
   if (edgeTable[cubeindex] & 8)
-    vertlist[3] =
-      interp_vertex (isolevel,grid.p[3],grid.p[0],grid.val[3],grid.val[0]);
+    interp_vertex (isolevel, grid, 3, 0, &vertlist[3], &normlist[3]);
   if (edgeTable[cubeindex] & 16)
-    vertlist[4] =
-      interp_vertex (isolevel,grid.p[4],grid.p[5],grid.val[4],grid.val[5]);
+    interp_vertex (isolevel, grid, 4, 5, &vertlist[4], &normlist[4]);
   if (edgeTable[cubeindex] & 32)
-    vertlist[5] =
-      interp_vertex (isolevel,grid.p[5],grid.p[6],grid.val[5],grid.val[6]);
+    interp_vertex (isolevel, grid, 5, 6, &vertlist[5], &normlist[5]);
   if (edgeTable[cubeindex] & 64)
-    vertlist[6] =
-      interp_vertex (isolevel,grid.p[6],grid.p[7],grid.val[6],grid.val[7]);
+    interp_vertex (isolevel, grid, 6, 7, &vertlist[6], &normlist[6]);
   if (edgeTable[cubeindex] & 128)
-    vertlist[7] =
-      interp_vertex (isolevel,grid.p[7],grid.p[4],grid.val[7],grid.val[4]);
+    interp_vertex (isolevel, grid, 7, 4, &vertlist[7], &normlist[7]);
   if (edgeTable[cubeindex] & 256)
-    vertlist[8] =
-      interp_vertex (isolevel,grid.p[0],grid.p[4],grid.val[0],grid.val[4]);
+    interp_vertex (isolevel, grid, 0, 4, &vertlist[8], &normlist[8]);
   if (edgeTable[cubeindex] & 512)
-    vertlist[9] =
-      interp_vertex (isolevel,grid.p[1],grid.p[5],grid.val[1],grid.val[5]);
+    interp_vertex (isolevel, grid, 1, 5, &vertlist[9], &normlist[9]);
   if (edgeTable[cubeindex] & 1024)
-    vertlist[10] =
-      interp_vertex (isolevel,grid.p[2],grid.p[6],grid.val[2],grid.val[6]);
+    interp_vertex (isolevel, grid, 2, 6, &vertlist[10], &normlist[10]);
   if (edgeTable[cubeindex] & 2048)
-    vertlist[11] =
-      interp_vertex (isolevel,grid.p[3],grid.p[7],grid.val[3],grid.val[7]);
+    interp_vertex (isolevel, grid, 3, 7, &vertlist[11], &normlist[11]);
 
   /* Create the triangle */
   ntriang = 0;
@@ -449,6 +456,9 @@ march_one_cube (GRIDCELL grid, double isolevel, TRIANGLE *triangles)
       triangles[ntriang].p[0] = vertlist[triTable[cubeindex][i  ]];
       triangles[ntriang].p[1] = vertlist[triTable[cubeindex][i+1]];
       triangles[ntriang].p[2] = vertlist[triTable[cubeindex][i+2]];
+      triangles[ntriang].n[0] = normlist[triTable[cubeindex][i  ]];
+      triangles[ntriang].n[1] = normlist[triTable[cubeindex][i+1]];
+      triangles[ntriang].n[2] = normlist[triTable[cubeindex][i+2]];
       ntriang++;
     }
 
@@ -557,6 +567,8 @@ marching_cubes (int grid_size,     /* density of the mesh */
             int i, ntri;
             GRIDCELL cell;
 
+            memset (cell.n, 0, sizeof(cell.n));
+
             /* This is kinda hokey, there ought to be a more efficient
                way to do this... */
             cell.p[0].x = x-1; cell.p[0].y = y-1; cell.p[0].z = z-1;
@@ -585,7 +597,7 @@ marching_cubes (int grid_size,     /* density of the mesh */
             /* Now generate the triangles for this cubic segment,
                and emit the GL faces.
             */
-            ntri = march_one_cube (cell, isolevel, tri);
+            ntri = march_one_cube (&cell, isolevel, tri);
             polys += ntri;
             for (i = 0; i < ntri; i++)
               {
@@ -626,3 +638,110 @@ marching_cubes (int grid_size,     /* density of the mesh */
   if (polygon_count)
     *polygon_count = polys;
 }
+
+
+/* Like marching_cubes(), but with the field already evaluated on the
+   grid (e.g., by scalar_field_compute()), so that this is only the
+   tesselation.  Vertex normals come from the gradient of the grid
+   itself, by central differences, rather than from calling the field
+   function again at each emitted vertex.
+ */
+void
+marching_cubes_grid (int nx, int ny, int nz,
+                     const double *grid,
+                     double isolevel,
+                     int wireframe_p,
+                     int smooth_p,
+                     unsigned long *polygon_count)
+{
+  int x, y, z;
+  unsigned long polys = 0;
+  int planesize = nx * ny;
+
+# define GRID(X,Y,Z) grid[((Z) * planesize) + ((Y) * nx) + (X)]
+
+  glFrontFace(GL_CCW);
+  if (!wireframe_p)
+    glBegin (GL_TRIANGLES);
+
+  for (z = 1; z < nz; z++)
+    for (y = 1; y < ny; y++)
+      for (x = 1; x < nx; x++)
+        {
+          TRIANGLE tri[6];
+          int i, ntri;
+          GRIDCELL cell;
+
+          cell.val[0] = GRID (x-1, y-1, z-1);
+          cell.val[1] = GRID (x  , y-1, z-1);
+          cell.val[2] = GRID (x  , y  , z-1);
+          cell.val[3] = GRID (x-1, y  , z-1);
+          cell.val[4] = GRID (x-1, y-1, z  );
+          cell.val[5] = GRID (x  , y-1, z  );
+          cell.val[6] = GRID (x  , y  , z  );
+          cell.val[7] = GRID (x-1, y  , z  );
+
+          /* Most cells are entirely inside or outside: don't bother
+             filling in the rest of the cell for those. */
+          if (edgeTable[cube_index (&cell, isolevel)] == 0)
+            continue;
+
+          cell.p[0].x = x-1; cell.p[0].y = y-1; cell.p[0].z = z-1;
+          cell.p[1].x = x  ; cell.p[1].y = y-1; cell.p[1].z = z-1;
+          cell.p[2].x = x  ; cell.p[2].y = y  ; cell.p[2].z = z-1;
+          cell.p[3].x = x-1; cell.p[3].y = y  ; cell.p[3].z = z-1;
+          cell.p[4].x = x-1; cell.p[4].y = y-1; cell.p[4].z = z  ;
+          cell.p[5].x = x  ; cell.p[5].y = y-1; cell.p[5].z = z  ;
+          cell.p[6].x = x  ; cell.p[6].y = y  ; cell.p[6].z = z  ;
+          cell.p[7].x = x-1; cell.p[7].y = y  ; cell.p[7].z = z  ;
+
+          if (smooth_p)
+            for (i = 0; i < 8; i++)
+              {
+                /* Same sign and scale as do_function_normal(), but with
+                   the samples on the grid, clamped at the edges. */
+                int px = cell.p[i].x, py = cell.p[i].y, pz = cell.p[i].z;
+                int x0 = (px > 0 ? px-1 : px), x1 = (px < nx-1 ? px+1 : px);
+                int y0 = (py > 0 ? py-1 : py), y1 = (py < ny-1 ? py+1 : py);
+                int z0 = (pz > 0 ? pz-1 : pz), z1 = (pz < nz-1 ? pz+1 : pz);
+                cell.n[i].x = ((GRID (x0, py, pz) - GRID (x1, py, pz)) /
+                               (x1 - x0));
+                cell.n[i].y = ((GRID (px, y0, pz) - GRID (px, y1, pz)) /
+                               (y1 - y0));
+                cell.n[i].z = ((GRID (px, py, z0) - GRID (px, py, z1)) /
+                               (z1 - z0));
+              }
+          else
+            memset (cell.n, 0, sizeof(cell.n));
+
+          ntri = march_one_cube (&cell, isolevel, tri);
+          polys += ntri;
+          for (i = 0; i < ntri; i++)
+            {
+              if (wireframe_p) glBegin (GL_LINE_LOOP);
+
+              if (!smooth_p)
+                do_normal (tri[i].p[0].x, tri[i].p[0].y, tri[i].p[0].z,
+                           tri[i].p[1].x, tri[i].p[1].y, tri[i].p[1].z,
+                           tri[i].p[2].x, tri[i].p[2].y, tri[i].p[2].z);
+
+# define VERT(N) \
+              if (smooth_p) \
+                glNormal3f (tri[i].n[N].x, tri[i].n[N].y, tri[i].n[N].z); \
+              glVertex3f (tri[i].p[N].x, tri[i].p[N].y, tri[i].p[N].z)
+
+              VERT (0);
+              VERT (1);
+              VERT (2);
+# undef VERT
+              if (wireframe_p) glEnd ();
+            }
+        }
+# undef GRID
+
+  if (!wireframe_p)
+    glEnd ();
+
+  if (polygon_count)
+    *polygon_count = polys;
+}
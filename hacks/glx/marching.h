@@ -45,4 +45,17 @@ marching_cubes (int grid_size,     /* density of the mesh */
 
                 unsigned long *polygon_count);
 
+
+/* The same, but with the field already evaluated at every point of an
+   nx * ny * nz grid, as laid out by scalar_field_compute().  Vertex
+   normals are computed from the grid, so nothing is called back.
+*/
+extern void
+marching_cubes_grid (int nx, int ny, int nz,
+                     const double *grid,
+                     double isolevel,
+                     int wireframe_p,
+                     int smooth_p,
+                     unsigned long *polygon_count);
+
 #endif /* __MARCHING_H__ */
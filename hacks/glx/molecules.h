@@ -0,0 +1,4680 @@
+"HEADER    Adenine: Vitamin B4; Purine base nucleotide\n"
+"COMPND    jb09aden\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Mon Sep 18 15:35:27 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.394   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.084   1.211   0.000  1.00  0.00 \n"
+"HETATM    4  N           1       1.337   2.342  -0.002  1.00  0.00 \n"
+"HETATM    5  C           1      -0.017   2.313  -0.003  1.00  0.00 \n"
+"HETATM    6  N           1      -0.710   1.149  -0.001  1.00  0.00 \n"
+"HETATM    7  N           1      -0.391  -1.291   0.006  1.00  0.00 \n"
+"HETATM    8  C           1       0.731  -2.049   0.010  1.00  0.00 \n"
+"HETATM    9  N           1       1.843  -1.276   0.007  1.00  0.00 \n"
+"HETATM   10  N           1       3.485   1.257   0.004  1.00  0.00 \n"
+"HETATM   11  H           1      -0.567   3.254  -0.004  1.00  0.00 \n"
+"HETATM   12  H           1      -1.347  -1.630   0.010  1.00  0.00 \n"
+"HETATM   13  H           1       0.738  -3.139   0.017  1.00  0.00 \n"
+"HETATM   14  H           1       3.799   2.220  -0.037  1.00  0.00 \n"
+"HETATM   15  H           1       3.839   0.818   0.847  1.00  0.00 \n"
+"CONECT    1    2    2    6    7\n"
+"CONECT    2    1    1    3    9\n"
+"CONECT    3    2    4    4   10\n"
+"CONECT    4    3    3    5\n"
+"CONECT    5    4    6    6   11\n"
+"CONECT    6    1    5    5\n"
+"CONECT    7    1    8   12\n"
+"CONECT    8    7    9    9   13\n"
+"CONECT    9    2    8    8\n"
+"CONECT   10    3   14   15\n"
+"CONECT   11    5\n"
+"CONECT   12    7\n"
+"CONECT   13    8\n"
+"CONECT   14   10\n"
+"CONECT   15   10\n"
+"MASTER        0    0    0    0    0    0    0    0   15    0   15    0\n"
+"END\n"
+,
+"HEADER    Adrenochrome: a nerve cell transmission inhibitor, and hallucinogen\n"
+"COMPND    adrenochrome\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Tue Aug 29 08:56:34 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.400   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.056   1.235   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.351   2.436  -0.011  1.00  0.00 \n"
+"HETATM    5  C           1      -0.047   2.437  -0.027  1.00  0.00 \n"
+"HETATM    6  C           1      -0.714   1.206  -0.013  1.00  0.00 \n"
+"HETATM    7  O           1      -0.597  -1.046  -0.002  1.00  0.00 \n"
+"HETATM    8  O           1      -1.918   1.181  -0.023  1.00  0.00 \n"
+"HETATM    9  N           1       2.243   3.571  -0.065  1.00  0.00 \n"
+"HETATM   10  C           1       1.825   4.648   0.846  1.00  0.00 \n"
+"HETATM   11  C           1       3.553   3.011   0.321  1.00  0.00 \n"
+"HETATM   12  C           1       3.538   1.506  -0.050  1.00  0.00 \n"
+"HETATM   13  H           1       4.088   0.906   0.675  1.00  0.00 \n"
+"HETATM   14  O           1       4.023   1.295  -1.381  1.00  0.00 \n"
+"HETATM   15  H           1       1.962  -0.934  -0.006  1.00  0.00 \n"
+"HETATM   16  H           1      -0.608   3.370  -0.059  1.00  0.00 \n"
+"HETATM   17  H           1       1.674   4.250   1.849  1.00  0.00 \n"
+"HETATM   18  H           1       0.895   5.089   0.489  1.00  0.00 \n"
+"HETATM   19  H           1       2.596   5.418   0.873  1.00  0.00 \n"
+"HETATM   20  H           1       3.683   3.101   1.400  1.00  0.00 \n"
+"HETATM   21  H           1       4.364   3.531  -0.190  1.00  0.00 \n"
+"HETATM   22  H           1       4.963   1.501  -1.423  1.00  0.00 \n"
+"CONECT    1    2    6    7\n"
+"CONECT    1    7\n"
+"CONECT    2    1    3   15\n"
+"CONECT    2    3\n"
+"CONECT    3    2    4   12\n"
+"CONECT    4    3    5    9\n"
+"CONECT    4    5\n"
+"CONECT    5    4    6   16\n"
+"CONECT    6    1    5    8\n"
+"CONECT    6    8\n"
+"CONECT    7    1\n"
+"CONECT    8    6\n"
+"CONECT    9    4   10   11\n"
+"CONECT   10    9   17   18   19\n"
+"CONECT   11    9   12   20   21\n"
+"CONECT   12    3   11   13   14\n"
+"CONECT   13   12\n"
+"CONECT   14   12   22\n"
+"CONECT   15    2\n"
+"CONECT   16    5\n"
+"CONECT   17   10\n"
+"CONECT   18   10\n"
+"CONECT   19   10\n"
+"CONECT   20   11\n"
+"CONECT   21   11\n"
+"CONECT   22   14\n"
+"MASTER        0    0    0    0    0    0    0    0   22    0   22    0\n"
+"END\n"
+,
+"HEADER    Buckminsterfullerene: Bucky Ball\n"
+"COMPND    bucky\n"
+"AUTHOR\n"
+"GENERATED BY SYMAPPS 1.0\n"
+"ATOM      1  C                   0.994   0.523  -3.137\n"
+"ATOM      2  C                   0.418  -0.689  -3.232\n"
+"ATOM      3  C                   1.239  -1.587  -2.654\n"
+"ATOM      4  C                   2.172   0.376  -2.500\n"
+"ATOM      5  C                   2.323  -0.928  -2.202\n"
+"ATOM      6  C                   1.297  -2.968  -0.779\n"
+"ATOM      7  C                   0.727  -2.610  -1.946\n"
+"ATOM      8  C                  -0.608  -2.733  -1.813\n"
+"ATOM      9  C                  -0.863  -3.172  -0.565\n"
+"ATOM     10  C                   0.315  -3.321   0.074\n"
+"ATOM     11  C                  -1.429  -1.836  -2.393\n"
+"ATOM     12  C                  -0.916  -0.814  -3.106\n"
+"ATOM     13  C                  -1.675   0.277  -2.878\n"
+"ATOM     14  C                  -2.657  -0.070  -2.024\n"
+"ATOM     15  C                  -2.506  -1.376  -1.724\n"
+"ATOM     16  C                  -1.096   1.488  -2.779\n"
+"ATOM     17  C                   0.239   1.614  -2.915\n"
+"ATOM     18  C                   0.658   2.557  -2.049\n"
+"ATOM     19  C                  -0.417   3.018  -1.381\n"
+"ATOM     20  C                  -1.503   2.359  -1.834\n"
+"ATOM     21  C                   1.833   2.405  -1.409\n"
+"ATOM     22  C                   2.596   1.319  -1.640\n"
+"ATOM     23  C                   3.167   0.957  -0.474\n"
+"ATOM     24  C                   2.760   1.823   0.475\n"
+"ATOM     25  C                   1.935   2.717  -0.104\n"
+"ATOM     26  C                   3.314  -0.348  -0.175\n"
+"ATOM     27  C                   2.899  -1.293  -1.041\n"
+"ATOM     28  C                   2.384  -2.314  -0.328\n"
+"ATOM     29  C                   2.486  -2.003   0.979\n"
+"ATOM     30  C                   3.063  -0.788   1.074\n"
+"ATOM     31  C                  -2.321   0.938   2.198\n"
+"ATOM     32  C                  -1.237   1.597   2.651\n"
+"ATOM     33  C                  -0.417   0.699   3.231\n"
+"ATOM     34  C                  -2.170  -0.366   2.497\n"
+"ATOM     35  C                  -0.993  -0.514   3.135\n"
+"ATOM     36  C                   1.671  -0.268   2.871\n"
+"ATOM     37  C                   0.916   0.824   3.104\n"
+"ATOM     38  C                   1.430   1.846   2.390\n"
+"ATOM     39  C                   2.506   1.386   1.722\n"
+"ATOM     40  C                   2.653   0.079   2.018\n"
+"ATOM     41  C                   0.609   2.745   1.813\n"
+"ATOM     42  C                  -0.727   2.622   1.945\n"
+"ATOM     43  C                  -1.298   2.984   0.779\n"
+"ATOM     44  C                  -0.315   3.332  -0.075\n"
+"ATOM     45  C                   0.863   3.183   0.564\n"
+"ATOM     46  C                  -2.378   2.321   0.325\n"
+"ATOM     47  C                  -2.896   1.302   1.038\n"
+"ATOM     48  C                  -3.315   0.358   0.172\n"
+"ATOM     49  C                  -3.062   0.797  -1.076\n"
+"ATOM     50  C                  -2.485   2.012  -0.982\n"
+"ATOM     51  C                  -3.159  -0.945   0.470\n"
+"ATOM     52  C                  -2.593  -1.310   1.637\n"
+"ATOM     53  C                  -1.837  -2.402   1.409\n"
+"ATOM     54  C                  -1.939  -2.714   0.103\n"
+"ATOM     55  C                  -2.759  -1.815  -0.477\n"
+"ATOM     56  C                  -0.658  -2.546   2.045\n"
+"ATOM     57  C                  -0.238  -1.605   2.914\n"
+"ATOM     58  C                   1.097  -1.482   2.780\n"
+"ATOM     59  C                   1.503  -2.349   1.832\n"
+"ATOM     60  C                   0.418  -3.010   1.379\n"
+"CONECT   21   25\n"
+"CONECT   26   27\n"
+"CONECT    2    3\n"
+"CONECT    1    4\n"
+"CONECT    7    8\n"
+"CONECT    8    9\n"
+"CONECT    9   10\n"
+"CONECT   27   28\n"
+"CONECT   28   29\n"
+"CONECT   29   30\n"
+"CONECT   26   30\n"
+"CONECT    6   10\n"
+"CONECT   11   12\n"
+"CONECT    3    7\n"
+"CONECT    8   11\n"
+"CONECT    3    5\n"
+"CONECT    1   17\n"
+"CONECT    5   27\n"
+"CONECT   12   13\n"
+"CONECT   13   14\n"
+"CONECT   14   15\n"
+"CONECT   11   15\n"
+"CONECT   16   17\n"
+"CONECT    6   28\n"
+"CONECT    4    5\n"
+"CONECT   18   21\n"
+"CONECT    1    2\n"
+"CONECT    4   22\n"
+"CONECT   17   18\n"
+"CONECT   18   19\n"
+"CONECT   19   20\n"
+"CONECT   16   20\n"
+"CONECT   21   22\n"
+"CONECT   23   26\n"
+"CONECT    6    7\n"
+"CONECT    2   12\n"
+"CONECT   13   16\n"
+"CONECT   22   23\n"
+"CONECT   23   24\n"
+"CONECT   24   25\n"
+"CONECT   36   40\n"
+"CONECT   41   42\n"
+"CONECT   33   37\n"
+"CONECT   38   41\n"
+"CONECT   33   35\n"
+"CONECT   31   47\n"
+"CONECT   35   57\n"
+"CONECT   42   43\n"
+"CONECT   43   44\n"
+"CONECT   44   45\n"
+"CONECT   41   45\n"
+"CONECT   46   47\n"
+"CONECT   36   58\n"
+"CONECT   34   35\n"
+"CONECT   48   51\n"
+"CONECT   31   32\n"
+"CONECT   34   52\n"
+"CONECT   47   48\n"
+"CONECT   48   49\n"
+"CONECT   49   50\n"
+"CONECT   46   50\n"
+"CONECT   51   52\n"
+"CONECT   53   56\n"
+"CONECT   36   37\n"
+"CONECT   32   42\n"
+"CONECT   43   46\n"
+"CONECT   52   53\n"
+"CONECT   53   54\n"
+"CONECT   54   55\n"
+"CONECT   51   55\n"
+"CONECT   56   57\n"
+"CONECT   32   33\n"
+"CONECT   31   34\n"
+"CONECT   37   38\n"
+"CONECT   38   39\n"
+"CONECT   39   40\n"
+"CONECT   57   58\n"
+"CONECT   58   59\n"
+"CONECT   59   60\n"
+"CONECT   56   60\n"
+"CONECT   10   60\n"
+"CONECT   29   59\n"
+"CONECT   30   40\n"
+"CONECT   24   39\n"
+"CONECT    9   54\n"
+"CONECT   15   55\n"
+"CONECT   14   49\n"
+"CONECT   20   50\n"
+"CONECT   19   44\n"
+"CONECT   25   45\n"
+"MASTER        0    0    0    0    0    0    0    0   60    0    0    0\n"
+"END\n"
+,
+"HEADER    Caffeine: Trimethylxanthine; a cardiac stimulant and diuretic\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep 29 14:53:27 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.392   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  N           1       2.076   1.164   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.373   2.321  -0.003  1.00  0.00 \n"
+"HETATM    5  O           1       1.978   3.365  -0.017  1.00  0.00 \n"
+"HETATM    6  N           1       0.017   2.344   0.003  1.00  0.00 \n"
+"HETATM    7  C           1      -0.710   1.202   0.002  1.00  0.00 \n"
+"HETATM    8  O           1      -1.915   1.218  -0.006  1.00  0.00 \n"
+"HETATM    9  N           1      -0.404  -1.287  -0.019  1.00  0.00 \n"
+"HETATM   10  N           1       1.830  -1.279  -0.020  1.00  0.00 \n"
+"HETATM   11  C           1       0.715  -2.048  -0.031  1.00  0.00 \n"
+"HETATM   12  C           1      -1.795  -1.761  -0.044  1.00  0.00 \n"
+"HETATM   13  C           1       3.546   1.178  -0.016  1.00  0.00 \n"
+"HETATM   14  C           1      -0.690   3.634  -0.013  1.00  0.00 \n"
+"HETATM   15  H           1       0.720  -3.138  -0.055  1.00  0.00 \n"
+"HETATM   16  H           1      -1.813  -2.850  -0.090  1.00  0.00 \n"
+"HETATM   17  H           1      -2.307  -1.428   0.860  1.00  0.00 \n"
+"HETATM   18  H           1      -2.302  -1.352  -0.918  1.00  0.00 \n"
+"HETATM   19  H           1       3.894   1.455  -1.011  1.00  0.00 \n"
+"HETATM   20  H           1       3.929   0.190   0.239  1.00  0.00 \n"
+"HETATM   21  H           1       3.911   1.904   0.710  1.00  0.00 \n"
+"HETATM   22  H           1      -1.557   3.583   0.645  1.00  0.00 \n"
+"HETATM   23  H           1      -0.027   4.428   0.329  1.00  0.00 \n"
+"HETATM   24  H           1      -1.020   3.851  -1.029  1.00  0.00 \n"
+"CONECT    1    2    2    7    9\n"
+"CONECT    2    1    1    3   10\n"
+"CONECT    3    2    4   13\n"
+"CONECT    4    3    5    5    6\n"
+"CONECT    5    4    4\n"
+"CONECT    6    4    7   14\n"
+"CONECT    7    1    6    8    8\n"
+"CONECT    8    7    7\n"
+"CONECT    9    1   11   12\n"
+"CONECT   10    2   11   11\n"
+"CONECT   11    9   10   10   15\n"
+"CONECT   12    9   16   17   18\n"
+"CONECT   13    3   19   20   21\n"
+"CONECT   14    6   22   23   24\n"
+"CONECT   15   11\n"
+"CONECT   16   12\n"
+"CONECT   17   12\n"
+"CONECT   18   12\n"
+"CONECT   19   13\n"
+"CONECT   20   13\n"
+"CONECT   21   13\n"
+"CONECT   22   14\n"
+"CONECT   23   14\n"
+"CONECT   24   14\n"
+"MASTER        0    0    0    0    0    0    0    0   24    0   24    0\n"
+"END\n"
+,
+"HEADER    Capsaicin: 8-methyl-N-vanillyl-6-nonenamide; Pepper; a mucous membrane irritant\n"
+"AUTHOR    Marvin\n"
+"REVDAT   1   05-MAY-09         0                                  \n"
+"HETATM    1  C   UNK     0       3.607  -1.127   0.361  0.00  0.00           C+0\n"
+"HETATM    2  C   UNK     0       4.334   0.075   0.158  0.00  0.00           C+0\n"
+"HETATM    3  C   UNK     0       3.650   1.279  -0.101  0.00  0.00           C+0\n"
+"HETATM    4  C   UNK     0       2.246   1.299  -0.172  0.00  0.00           C+0\n"
+"HETATM    5  C   UNK     0       1.494   0.118   0.015  0.00  0.00           C+0\n"
+"HETATM    6  C   UNK     0       2.190  -1.085   0.285  0.00  0.00           C+0\n"
+"HETATM    7  O   UNK     0       4.263  -2.208   0.588  0.00  0.00           O+0\n"
+"HETATM    8  O   UNK     0       5.598   0.109   0.186  0.00  0.00           O+0\n"
+"HETATM    9  C   UNK     0       3.863  -3.458   0.839  0.00  0.00           C+0\n"
+"HETATM   10  C   UNK     0       0.011   0.136  -0.126  0.00  0.00           C+0\n"
+"HETATM   11  N   UNK     0      -0.660  -0.367   0.987  0.00  0.00           N+0\n"
+"HETATM   12  C   UNK     0      -2.024  -0.105   1.237  0.00  0.00           C+0\n"
+"HETATM   13  C   UNK     0      -2.604  -0.886   2.327  0.00  0.00           C+0\n"
+"HETATM   14  O   UNK     0      -2.896   0.656   0.691  0.00  0.00           O+0\n"
+"HETATM   15  C   UNK     0      -3.159  -0.033   3.504  0.00  0.00           C+0\n"
+"HETATM   16  C   UNK     0      -3.849  -0.911   4.584  0.00  0.00           C+0\n"
+"HETATM   17  C   UNK     0      -4.419  -0.081   5.764  0.00  0.00           C+0\n"
+"HETATM   18  C   UNK     0      -5.132  -0.923   6.711  0.00  0.00           C+0\n"
+"HETATM   19  C   UNK     0      -4.516  -1.628   7.675  0.00  0.00           C+0\n"
+"HETATM   20  C   UNK     0      -5.206  -2.525   8.600  0.00  0.00           C+0\n"
+"HETATM   21  C   UNK     0      -4.662  -3.972   8.454  0.00  0.00           C+0\n"
+"HETATM   22  C   UNK     0      -5.081  -2.006  10.057  0.00  0.00           C+0\n"
+"CONECT    1    2    6    7                                                  \n"
+"CONECT    2    1    3    8                                                  \n"
+"CONECT    3    2    4                                                       \n"
+"CONECT    4    3    5                                                       \n"
+"CONECT    5    4    6   10                                                  \n"
+"CONECT    6    5    1                                                       \n"
+"CONECT    7    1    9                                                       \n"
+"CONECT    8    2                                                            \n"
+"CONECT    9    7                                                            \n"
+"CONECT   10    5   11                                                       \n"
+"CONECT   11   10   12                                                       \n"
+"CONECT   12   11   13   14                                                  \n"
+"CONECT   13   12   15                                                       \n"
+"CONECT   14   12                                                            \n"
+"CONECT   15   13   16                                                       \n"
+"CONECT   16   15   17                                                       \n"
+"CONECT   17   16   18                                                       \n"
+"CONECT   18   17   19                                                       \n"
+"CONECT   19   18   20                                                       \n"
+"CONECT   20   19   21   22                                                  \n"
+"CONECT   21   20                                                            \n"
+"CONECT   22   20                                                            \n"
+"MASTER        0    0    0    0    0    0    0    0   22    0   44    0\n"
+"END\n"
+,
+"HEADER    Chlordecone: Kepone, an insecticide and fungicide\n"
+"COMPND    al1113\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Tue Aug 29 17:54:52 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  O           1       1.206   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1      -0.741   1.303   0.000  1.00  0.00 \n"
+"HETATM    4  C           1      -0.875   1.738  -1.482  1.00  0.00 \n"
+"HETATM    5  C           1      -0.879   0.377  -2.249  1.00  0.00 \n"
+"HETATM    6  C           1      -0.745  -0.666  -1.117  1.00  0.00 \n"
+"HETATM    7  C           1      -2.247   0.958  -0.112  1.00  0.00 \n"
+"HETATM    8  C           1      -2.380   1.999  -1.247  1.00  0.00 \n"
+"HETATM    9  C           1      -2.237  -0.385  -0.887  1.00  0.00 \n"
+"HETATM   10  C           1      -2.379   0.045  -2.350  1.00  0.00 \n"
+"HETATM   11  C           1      -3.162   1.358  -2.394  1.00  0.00 \n"
+"HETATM   12 Cl           1       0.142   3.061  -2.080  1.00  0.00 \n"
+"HETATM   13 Cl           1      -0.299   2.574   1.159  1.00  0.00 \n"
+"HETATM   14 Cl           1      -2.803   3.653  -0.734  1.00  0.00 \n"
+"HETATM   15 Cl           1      -3.272   1.132   1.330  1.00  0.00 \n"
+"HETATM   16 Cl           1      -3.275  -1.723  -0.285  1.00  0.00 \n"
+"HETATM   17 Cl           1      -4.883   1.128  -1.986  1.00  0.00 \n"
+"HETATM   18 Cl           1      -2.936   2.229  -3.931  1.00  0.00 \n"
+"HETATM   19 Cl           1      -2.805  -1.246  -3.509  1.00  0.00 \n"
+"HETATM   20 Cl           1       0.141   0.211  -3.696  1.00  0.00 \n"
+"HETATM   21 Cl           1      -0.301  -2.317  -1.612  1.00  0.00 \n"
+"CONECT    1    2    2    3    6\n"
+"CONECT    2    1    1\n"
+"CONECT    3    1    4    7   13\n"
+"CONECT    4    3    5    8   12\n"
+"CONECT    5    4    6   10   20\n"
+"CONECT    6    1    5    9   21\n"
+"CONECT    7    3    8    9   15\n"
+"CONECT    8    4    7   11   14\n"
+"CONECT    9    6    7   10   16\n"
+"CONECT   10    5    9   11   19\n"
+"CONECT   11    8   10   17   18\n"
+"CONECT   12    4\n"
+"CONECT   13    3\n"
+"CONECT   14    8\n"
+"CONECT   15    7\n"
+"CONECT   16    9\n"
+"CONECT   17   11\n"
+"CONECT   18   11\n"
+"CONECT   19   10\n"
+"CONECT   20    5\n"
+"CONECT   21    6\n"
+"MASTER        0    0    0    0    0    0    0    0   21    0   21    0\n"
+"END\n"
+,
+"HEADER    Cocaine: Carboxylicacid methyl ester, an anesthetic\n"
+"COMPND    al3078\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.399   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.099   1.211   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.400   2.423  -0.002  1.00  0.00 \n"
+"HETATM    5  C           1       0.001   2.423  -0.007  1.00  0.00 \n"
+"HETATM    6  C           1      -0.700   1.213  -0.005  1.00  0.00 \n"
+"HETATM    7  C           1      -2.156   1.218  -0.022  1.00  0.00 \n"
+"HETATM    8  O           1      -2.759   0.175  -0.044  1.00  0.00 \n"
+"HETATM    9  O           1      -2.806   2.379  -0.075  1.00  0.00 \n"
+"HETATM   10  C           1      -4.168   2.239   0.272  1.00  0.00 \n"
+"HETATM   11  C           1      -4.872   3.590   0.031  1.00  0.00 \n"
+"HETATM   12  C           1      -4.061   4.678   0.674  1.00  0.00 \n"
+"HETATM   13  O           1      -4.560   5.346   1.542  1.00  0.00 \n"
+"HETATM   14  O           1      -2.741   4.690   0.497  1.00  0.00 \n"
+"HETATM   15  C           1      -2.091   5.352   1.560  1.00  0.00 \n"
+"HETATM   16  C           1      -6.281   3.587   0.659  1.00  0.00 \n"
+"HETATM   17  N           1      -6.101   3.424   2.109  1.00  0.00 \n"
+"HETATM   18  C           1      -7.084   2.348   0.212  1.00  0.00 \n"
+"HETATM   19  C           1      -6.737   1.277   1.267  1.00  0.00 \n"
+"HETATM   20  C           1      -5.765   1.998   2.226  1.00  0.00 \n"
+"HETATM   21  C           1      -4.304   1.831   1.755  1.00  0.00 \n"
+"HETATM   22  C           1      -7.322   3.768   2.857  1.00  0.00 \n"
+"HETATM   23  H           1      -0.544  -0.944  -0.002  1.00  0.00 \n"
+"HETATM   24  H           1       1.944  -0.944   0.000  1.00  0.00 \n"
+"HETATM   25  H           1       3.189   1.211   0.001  1.00  0.00 \n"
+"HETATM   26  H           1       1.945   3.367  -0.004  1.00  0.00 \n"
+"HETATM   27  H           1      -0.544   3.368  -0.019  1.00  0.00 \n"
+"HETATM   28  H           1      -4.624   1.481  -0.363  1.00  0.00 \n"
+"HETATM   29  H           1      -4.942   3.777  -1.041  1.00  0.00 \n"
+"HETATM   30  H           1      -2.425   6.389   1.609  1.00  0.00 \n"
+"HETATM   31  H           1      -2.320   4.851   2.501  1.00  0.00 \n"
+"HETATM   32  H           1      -1.014   5.330   1.395  1.00  0.00 \n"
+"HETATM   33  H           1      -6.802   4.513   0.416  1.00  0.00 \n"
+"HETATM   34  H           1      -6.806   2.035  -0.795  1.00  0.00 \n"
+"HETATM   35  H           1      -8.152   2.564   0.250  1.00  0.00 \n"
+"HETATM   36  H           1      -6.275   0.397   0.819  1.00  0.00 \n"
+"HETATM   37  H           1      -7.641   0.988   1.803  1.00  0.00 \n"
+"HETATM   38  H           1      -5.872   1.638   3.249  1.00  0.00 \n"
+"HETATM   39  H           1      -3.995   0.793   1.881  1.00  0.00 \n"
+"HETATM   40  H           1      -3.664   2.470   2.364  1.00  0.00 \n"
+"HETATM   41  H           1      -8.166   3.167   2.523  1.00  0.00 \n"
+"HETATM   42  H           1      -7.551   4.823   2.706  1.00  0.00 \n"
+"HETATM   43  H           1      -7.155   3.591   3.920  1.00  0.00 \n"
+"CONECT    1    2    2    6   23\n"
+"CONECT    2    1    1    3   24\n"
+"CONECT    3    2    4    4   25\n"
+"CONECT    4    3    3    5   26\n"
+"CONECT    5    4    6    6   27\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8    8    9\n"
+"CONECT    8    7    7\n"
+"CONECT    9    7   10\n"
+"CONECT   10    9   11   21   28\n"
+"CONECT   11   10   12   16   29\n"
+"CONECT   12   11   13   13   14\n"
+"CONECT   13   12   12\n"
+"CONECT   14   12   15\n"
+"CONECT   15   14   30   31   32\n"
+"CONECT   16   11   17   18   33\n"
+"CONECT   17   16   20   22\n"
+"CONECT   18   16   19   34   35\n"
+"CONECT   19   18   20   36   37\n"
+"CONECT   20   17   19   21   38\n"
+"CONECT   21   10   20   39   40\n"
+"CONECT   22   17   41   42   43\n"
+"CONECT   23    1\n"
+"CONECT   24    2\n"
+"CONECT   25    3\n"
+"CONECT   26    4\n"
+"CONECT   27    5\n"
+"CONECT   28   10\n"
+"CONECT   29   11\n"
+"CONECT   30   15\n"
+"CONECT   31   15\n"
+"CONECT   32   15\n"
+"CONECT   33   16\n"
+"CONECT   34   18\n"
+"CONECT   35   18\n"
+"CONECT   36   19\n"
+"CONECT   37   19\n"
+"CONECT   38   20\n"
+"CONECT   39   21\n"
+"CONECT   40   21\n"
+"CONECT   41   22\n"
+"CONECT   42   22\n"
+"CONECT   43   22\n"
+"MASTER        0    0    0    0    0    0    0    0   43    0   43    0\n"
+"END\n"
+,
+"HEADER    Methylmorphine: Codeine, a cough reflex inhibitor\n"
+"COMPND    al3083\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.400   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.107   1.211   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.445   2.445  -0.038  1.00  0.00 \n"
+"HETATM    5  C           1       0.048   2.457   0.012  1.00  0.00 \n"
+"HETATM    6  C           1      -0.629   1.242   0.047  1.00  0.00 \n"
+"HETATM    7  C           1      -2.076   1.497  -0.256  1.00  0.00 \n"
+"HETATM    8  C           1      -2.718   0.335  -1.023  1.00  0.00 \n"
+"HETATM    9  C           1      -2.362  -0.955  -0.251  1.00  0.00 \n"
+"HETATM   10  C           1      -0.830  -1.234  -0.281  1.00  0.00 \n"
+"HETATM   11  C           1      -1.864   2.827  -1.015  1.00  0.00 \n"
+"HETATM   12  C           1      -2.785   1.642   1.099  1.00  0.00 \n"
+"HETATM   13  C           1      -2.549   0.335   1.888  1.00  0.00 \n"
+"HETATM   14  N           1      -2.944  -0.846   1.100  1.00  0.00 \n"
+"HETATM   15  C           1      -2.815  -2.080   1.892  1.00  0.00 \n"
+"HETATM   16  H           1      -3.800   0.464  -1.011  1.00  0.00 \n"
+"HETATM   17  C           1      -2.286   0.268  -2.470  1.00  0.00 \n"
+"HETATM   18  C           1      -2.002   1.392  -3.142  1.00  0.00 \n"
+"HETATM   19  C           1      -1.354   2.572  -2.453  1.00  0.00 \n"
+"HETATM   20  H           1      -2.774   3.428  -1.022  1.00  0.00 \n"
+"HETATM   21  O           1      -0.789   3.474  -0.352  1.00  0.00 \n"
+"HETATM   22  H           1      -1.514   3.472  -3.047  1.00  0.00 \n"
+"HETATM   23  O           1       0.051   2.305  -2.404  1.00  0.00 \n"
+"HETATM   24  O           1       2.148   3.606  -0.170  1.00  0.00 \n"
+"HETATM   25  H           1       1.942  -0.944  -0.064  1.00  0.00 \n"
+"HETATM   26  H           1       3.196   1.191  -0.044  1.00  0.00 \n"
+"HETATM   27  H           1      -2.856  -1.789  -0.750  1.00  0.00 \n"
+"HETATM   28  H           1      -0.570  -1.581  -1.281  1.00  0.00 \n"
+"HETATM   29  H           1      -0.575  -2.018   0.429  1.00  0.00 \n"
+"HETATM   30  H           1      -3.852   1.800   0.945  1.00  0.00 \n"
+"HETATM   31  H           1      -2.368   2.484   1.653  1.00  0.00 \n"
+"HETATM   32  H           1      -3.143   0.370   2.801  1.00  0.00 \n"
+"HETATM   33  H           1      -1.498   0.252   2.165  1.00  0.00 \n"
+"HETATM   34  H           1      -3.495  -2.034   2.743  1.00  0.00 \n"
+"HETATM   35  H           1      -1.796  -2.189   2.261  1.00  0.00 \n"
+"HETATM   36  H           1      -3.075  -2.943   1.279  1.00  0.00 \n"
+"HETATM   37  H           1      -2.526  -0.630  -3.039  1.00  0.00 \n"
+"HETATM   38  H           1      -1.938   1.338  -4.229  1.00  0.00 \n"
+"HETATM   39  H           1       0.396   2.184  -3.295  1.00  0.00 \n"
+"HETATM   40  C           1       2.068   4.090  -1.493  1.00  0.00 \n"
+"HETATM   41  H           1       2.413   3.325  -2.189  1.00  0.00 \n"
+"HETATM   42  H           1       1.038   4.360  -1.728  1.00  0.00 \n"
+"HETATM   43  H           1       2.699   4.974  -1.590  1.00  0.00 \n"
+"CONECT    1    2    2    6   10\n"
+"CONECT    2    1    1    3   25\n"
+"CONECT    3    2    4    4   26\n"
+"CONECT    4    3    3    5   24\n"
+"CONECT    5    4    6    6   21\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8   11   12\n"
+"CONECT    8    7    9   16   17\n"
+"CONECT    9    8   10   14   27\n"
+"CONECT   10    1    9   28   29\n"
+"CONECT   11    7   19   20   21\n"
+"CONECT   12    7   13   30   31\n"
+"CONECT   13   12   14   32   33\n"
+"CONECT   14    9   13   15\n"
+"CONECT   15   14   34   35   36\n"
+"CONECT   16    8\n"
+"CONECT   17    8   18   18   37\n"
+"CONECT   18   17   17   19   38\n"
+"CONECT   19   11   18   22   23\n"
+"CONECT   20   11\n"
+"CONECT   21    5   11\n"
+"CONECT   22   19\n"
+"CONECT   23   19   39\n"
+"CONECT   24    4   40\n"
+"CONECT   25    2\n"
+"CONECT   26    3\n"
+"CONECT   27    9\n"
+"CONECT   28   10\n"
+"CONECT   29   10\n"
+"CONECT   30   12\n"
+"CONECT   31   12\n"
+"CONECT   32   13\n"
+"CONECT   33   13\n"
+"CONECT   34   15\n"
+"CONECT   35   15\n"
+"CONECT   36   15\n"
+"CONECT   37   17\n"
+"CONECT   38   18\n"
+"CONECT   39   23\n"
+"CONECT   40   24   41   42   43\n"
+"CONECT   41   40\n"
+"CONECT   42   40\n"
+"CONECT   43   40\n"
+"MASTER        0    0    0    0    0    0    0    0   43    0   43    0\n"
+"END\n"
+,
+"HEADER    Cyclohexane: 1,2,3,4,5,6-hexaisopropylcyclohexane\n"
+"COMPND    al3063\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Sun Sep  3 10:20:00 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.565   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.185   1.436   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.565   2.409   1.058  1.00  0.00 \n"
+"HETATM    5  C           1       0.011   2.333   1.199  1.00  0.00 \n"
+"HETATM    6  C           1      -0.636   0.914   1.102  1.00  0.00 \n"
+"HETATM    7  C           1       2.238  -0.920   1.062  1.00  0.00 \n"
+"HETATM    8  C           1       3.676  -1.279   0.632  1.00  0.00 \n"
+"HETATM    9  C           1       1.540  -2.282   1.218  1.00  0.00 \n"
+"HETATM   10  C           1       2.217   2.309   2.471  1.00  0.00 \n"
+"HETATM   11  C           1       1.987   3.605   3.278  1.00  0.00 \n"
+"HETATM   12  C           1       3.745   2.126   2.455  1.00  0.00 \n"
+"HETATM   13  C           1      -0.726   0.166   2.473  1.00  0.00 \n"
+"HETATM   14  C           1      -1.806  -0.942   2.413  1.00  0.00 \n"
+"HETATM   15  C           1      -1.162   1.048   3.662  1.00  0.00 \n"
+"HETATM   16  C           1      -0.814   3.472   0.513  1.00  0.00 \n"
+"HETATM   17  C           1      -0.477   3.821  -0.947  1.00  0.00 \n"
+"HETATM   18  C           1      -0.663   4.782   1.320  1.00  0.00 \n"
+"HETATM   19  C           1      -0.573   0.185  -1.439  1.00  0.00 \n"
+"HETATM   20  C           1      -2.077   0.514  -1.474  1.00  0.00 \n"
+"HETATM   21  C           1      -0.420  -1.124  -2.240  1.00  0.00 \n"
+"HETATM   22  C           1       2.365   2.070  -1.423  1.00  0.00 \n"
+"HETATM   23  C           1       3.380   3.248  -1.378  1.00  0.00 \n"
+"HETATM   24  C           1       2.947   1.067  -2.454  1.00  0.00 \n"
+"HETATM   25  H           1      -0.308  -1.011   0.219  1.00  0.00 \n"
+"HETATM   26  H           1       1.866  -0.481  -0.919  1.00  0.00 \n"
+"HETATM   27  H           1       3.219   1.312   0.276  1.00  0.00 \n"
+"HETATM   28  H           1       1.800   3.418   0.741  1.00  0.00 \n"
+"HETATM   29  H           1      -0.171   2.602   2.221  1.00  0.00 \n"
+"HETATM   30  H           1      -1.683   1.071   0.864  1.00  0.00 \n"
+"HETATM   31  H           1       2.274  -0.432   2.031  1.00  0.00 \n"
+"HETATM   32  H           1       4.296  -0.395   0.523  1.00  0.00 \n"
+"HETATM   33  H           1       3.659  -1.819  -0.314  1.00  0.00 \n"
+"HETATM   34  H           1       4.129  -1.913   1.395  1.00  0.00 \n"
+"HETATM   35  H           1       1.366  -2.731   0.241  1.00  0.00 \n"
+"HETATM   36  H           1       0.598  -2.162   1.743  1.00  0.00 \n"
+"HETATM   37  H           1       2.167  -2.946   1.814  1.00  0.00 \n"
+"HETATM   38  H           1       1.784   1.476   3.021  1.00  0.00 \n"
+"HETATM   39  H           1       0.931   3.795   3.446  1.00  0.00 \n"
+"HETATM   40  H           1       2.426   4.454   2.754  1.00  0.00 \n"
+"HETATM   41  H           1       2.462   3.505   4.254  1.00  0.00 \n"
+"HETATM   42  H           1       4.206   2.819   1.750  1.00  0.00 \n"
+"HETATM   43  H           1       3.992   1.100   2.194  1.00  0.00 \n"
+"HETATM   44  H           1       4.144   2.311   3.452  1.00  0.00 \n"
+"HETATM   45  H           1       0.232  -0.273   2.732  1.00  0.00 \n"
+"HETATM   46  H           1      -1.609  -1.663   1.627  1.00  0.00 \n"
+"HETATM   47  H           1      -2.784  -0.492   2.238  1.00  0.00 \n"
+"HETATM   48  H           1      -1.828  -1.479   3.361  1.00  0.00 \n"
+"HETATM   49  H           1      -1.986   1.697   3.365  1.00  0.00 \n"
+"HETATM   50  H           1      -0.323   1.642   4.019  1.00  0.00 \n"
+"HETATM   51  H           1      -1.487   0.415   4.488  1.00  0.00 \n"
+"HETATM   52  H           1      -1.870   3.206   0.555  1.00  0.00 \n"
+"HETATM   53  H           1      -0.618   2.957  -1.586  1.00  0.00 \n"
+"HETATM   54  H           1       0.544   4.192  -1.014  1.00  0.00 \n"
+"HETATM   55  H           1      -1.151   4.606  -1.289  1.00  0.00 \n"
+"HETATM   56  H           1       0.380   5.094   1.338  1.00  0.00 \n"
+"HETATM   57  H           1      -1.015   4.632   2.341  1.00  0.00 \n"
+"HETATM   58  H           1      -1.262   5.567   0.860  1.00  0.00 \n"
+"HETATM   59  H           1      -0.035   0.957  -1.972  1.00  0.00 \n"
+"HETATM   60  H           1      -2.246   1.523  -1.106  1.00  0.00 \n"
+"HETATM   61  H           1      -2.630  -0.201  -0.864  1.00  0.00 \n"
+"HETATM   62  H           1      -2.439   0.465  -2.501  1.00  0.00 \n"
+"HETATM   63  H           1      -0.991  -1.924  -1.768  1.00  0.00 \n"
+"HETATM   64  H           1       0.625  -1.418  -2.300  1.00  0.00 \n"
+"HETATM   65  H           1      -0.791  -0.971  -3.254  1.00  0.00 \n"
+"HETATM   66  H           1       1.430   2.438  -1.818  1.00  0.00 \n"
+"HETATM   67  H           1       4.327   2.902  -0.962  1.00  0.00 \n"
+"HETATM   68  H           1       3.011   4.079  -0.782  1.00  0.00 \n"
+"HETATM   69  H           1       3.557   3.619  -2.388  1.00  0.00 \n"
+"HETATM   70  H           1       2.183   0.367  -2.790  1.00  0.00 \n"
+"HETATM   71  H           1       3.780   0.521  -2.010  1.00  0.00 \n"
+"HETATM   72  H           1       3.306   1.606  -3.330  1.00  0.00 \n"
+"CONECT    1    2    6   19   25\n"
+"CONECT    2    1    3    7   26\n"
+"CONECT    3    2    4   22   27\n"
+"CONECT    4    3    5   10   28\n"
+"CONECT    5    4    6   16   29\n"
+"CONECT    6    1    5   13   30\n"
+"CONECT    7    2    8    9   31\n"
+"CONECT    8    7   32   33   34\n"
+"CONECT    9    7   35   36   37\n"
+"CONECT   10    4   11   12   38\n"
+"CONECT   11   10   39   40   41\n"
+"CONECT   12   10   42   43   44\n"
+"CONECT   13    6   14   15   45\n"
+"CONECT   14   13   46   47   48\n"
+"CONECT   15   13   49   50   51\n"
+"CONECT   16    5   17   18   52\n"
+"CONECT   17   16   53   54   55\n"
+"CONECT   18   16   56   57   58\n"
+"CONECT   19    1   20   21   59\n"
+"CONECT   20   19   60   61   62\n"
+"CONECT   21   19   63   64   65\n"
+"CONECT   22    3   23   24   66\n"
+"CONECT   23   22   67   68   69\n"
+"CONECT   24   22   70   71   72\n"
+"CONECT   25    1\n"
+"CONECT   26    2\n"
+"CONECT   27    3\n"
+"CONECT   28    4\n"
+"CONECT   29    5\n"
+"CONECT   30    6\n"
+"CONECT   31    7\n"
+"CONECT   32    8\n"
+"CONECT   33    8\n"
+"CONECT   34    8\n"
+"CONECT   35    9\n"
+"CONECT   36    9\n"
+"CONECT   37    9\n"
+"CONECT   38   10\n"
+"CONECT   39   11\n"
+"CONECT   40   11\n"
+"CONECT   41   11\n"
+"CONECT   42   12\n"
+"CONECT   43   12\n"
+"CONECT   44   12\n"
+"CONECT   45   13\n"
+"CONECT   46   14\n"
+"CONECT   47   14\n"
+"CONECT   48   14\n"
+"CONECT   49   15\n"
+"CONECT   50   15\n"
+"CONECT   51   15\n"
+"CONECT   52   16\n"
+"CONECT   53   17\n"
+"CONECT   54   17\n"
+"CONECT   55   17\n"
+"CONECT   56   18\n"
+"CONECT   57   18\n"
+"CONECT   58   18\n"
+"CONECT   59   19\n"
+"CONECT   60   20\n"
+"CONECT   61   20\n"
+"CONECT   62   20\n"
+"CONECT   63   21\n"
+"CONECT   64   21\n"
+"CONECT   65   21\n"
+"CONECT   66   22\n"
+"CONECT   67   23\n"
+"CONECT   68   23\n"
+"CONECT   69   23\n"
+"CONECT   70   24\n"
+"CONECT   71   24\n"
+"CONECT   72   24\n"
+"MASTER        0    0    0    0    0    0    0    0   72    0   72    0\n"
+"END\n"
+,
+"HEADER    Cytosine: Pyrimidine base nucleotide\n"
+"COMPND    jb09cyto\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep 29 12:35:29 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.398   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.070   1.227   0.000  1.00  0.00 \n"
+"HETATM    4  N           1       1.356   2.375   0.001  1.00  0.00 \n"
+"HETATM    5  C           1       0.004   2.350   0.002  1.00  0.00 \n"
+"HETATM    6  N           1      -0.667   1.176   0.001  1.00  0.00 \n"
+"HETATM    7  O           1      -0.611   3.389   0.004  1.00  0.00 \n"
+"HETATM    8  N           1       3.477   1.271   0.003  1.00  0.00 \n"
+"HETATM    9  H           1      -0.548  -0.942   0.000  1.00  0.00 \n"
+"HETATM   10  H           1       1.954  -0.938   0.001  1.00  0.00 \n"
+"HETATM   11  H           1      -1.681   1.178   0.002  1.00  0.00 \n"
+"HETATM   12  H           1       3.791   2.109   0.480  1.00  0.00 \n"
+"HETATM   13  H           1       3.844   0.453   0.477  1.00  0.00 \n"
+"CONECT    1    2    2    6    9\n"
+"CONECT    2    1    1    3   10\n"
+"CONECT    3    2    4    4    8\n"
+"CONECT    4    3    3    5\n"
+"CONECT    5    4    6    7    7\n"
+"CONECT    6    1    5   11\n"
+"CONECT    7    5    5\n"
+"CONECT    8    3   12   13\n"
+"CONECT    9    1\n"
+"CONECT   10    2\n"
+"CONECT   11    6\n"
+"CONECT   12    8\n"
+"CONECT   13    8\n"
+"MASTER        0    0    0    0    0    0    0    0   13    0   13    0\n"
+"END\n"
+,
+"HEADER    DNA: Deoxyribonucleic acid\n"
+"ATOM      1  O   ???     1       4.674  19.391 -10.106\n"
+"ATOM      2  C   ???     1       4.459  17.981  -9.876\n"
+"ATOM      3  C   ???     1       5.288  17.571  -8.673\n"
+"ATOM      4  O   ???     1       4.895  17.956  -7.317\n"
+"ATOM      5  C   ???     1       5.700  16.166  -8.515\n"
+"ATOM      6  O   ???     1       6.993  16.174  -7.868\n"
+"ATOM      7  C   ???     1       4.606  15.591  -7.605\n"
+"ATOM      8  C   ???     1       4.489  16.741  -6.607\n"
+"ATOM      9  N   ???     1       3.143  16.925  -5.903\n"
+"ATOM     10  C   ???     1       3.127  17.319  -4.578\n"
+"ATOM     11  O   ???     1       4.173  17.497  -3.993\n"
+"ATOM     12  N   ???     1       1.955  17.554  -3.958\n"
+"ATOM     13  C   ???     1       0.773  17.466  -4.621\n"
+"ATOM     14  N   ???     1      -0.393  17.691  -3.955\n"
+"ATOM     15  C   ???     1       0.722  17.134  -5.985\n"
+"ATOM     16  C   ???     1       1.945  16.843  -6.625\n"
+"ATOM     17  P   ???     1       7.833  14.873  -7.879\n"
+"ATOM     18  O   ???     1       6.913  13.703  -8.299\n"
+"ATOM     19  O   ???     1       9.116  15.075  -8.639\n"
+"ATOM     20  O   ???     1       8.137  14.505  -6.390\n"
+"ATOM     21  C   ???     1       9.093  15.196  -5.586\n"
+"ATOM     22  C   ???     1       8.913  14.574  -4.231\n"
+"ATOM     23  O   ???     1       7.518  14.735  -3.865\n"
+"ATOM     24  C   ???     1       9.081  13.086  -4.262\n"
+"ATOM     25  O   ???     1      10.078  12.703  -3.397\n"
+"ATOM     26  C   ???     1       7.686  12.473  -4.029\n"
+"ATOM     27  C   ???     1       7.063  13.543  -3.201\n"
+"ATOM     28  N   ???     1       5.563  13.566  -3.134\n"
+"ATOM     29  C   ???     1       4.657  13.394  -4.141\n"
+"ATOM     30  N   ???     1       3.380  13.664  -3.752\n"
+"ATOM     31  C   ???     1       3.485  14.024  -2.465\n"
+"ATOM     32  C   ???     1       2.474  14.525  -1.574\n"
+"ATOM     33  O   ???     1       1.309  14.806  -1.867\n"
+"ATOM     34  N   ???     1       2.958  14.808  -0.289\n"
+"ATOM     35  C   ???     1       4.279  14.700   0.121\n"
+"ATOM     36  N   ???     1       4.596  14.961   1.424\n"
+"ATOM     37  N   ???     1       5.242  14.292  -0.749\n"
+"ATOM     38  C   ???     1       4.801  13.971  -2.035\n"
+"ATOM     39  P   ???     1      10.462  11.185  -3.172\n"
+"ATOM     40  O   ???     1       9.914  10.272  -4.247\n"
+"ATOM     41  O   ???     1      11.949  11.216  -2.975\n"
+"ATOM     42  O   ???     1       9.792  10.862  -1.765\n"
+"ATOM     43  C   ???     1      10.265  11.478  -0.528\n"
+"ATOM     44  C   ???     1       9.204  11.248   0.526\n"
+"ATOM     45  O   ???     1       7.918  11.627   0.016\n"
+"ATOM     46  C   ???     1       9.052   9.838   1.036\n"
+"ATOM     47  O   ???     1       9.614   9.642   2.306\n"
+"ATOM     48  C   ???     1       7.597   9.524   0.982\n"
+"ATOM     49  C   ???     1       6.965  10.887   0.744\n"
+"ATOM     50  N   ???     1       5.832  10.810  -0.183\n"
+"ATOM     51  C   ???     1       4.534  11.009   0.257\n"
+"ATOM     52  O   ???     1       4.306  11.269   1.440\n"
+"ATOM     53  N   ???     1       3.534  10.905  -0.642\n"
+"ATOM     54  C   ???     1       3.770  10.552  -1.926\n"
+"ATOM     55  N   ???     1       2.773  10.591  -2.855\n"
+"ATOM     56  C   ???     1       5.043  10.250  -2.374\n"
+"ATOM     57  C   ???     1       6.091  10.396  -1.479\n"
+"ATOM     58  P   ???     1       9.660   8.226   2.989\n"
+"ATOM     59  O   ???     1       9.518   7.127   1.928\n"
+"ATOM     60  O   ???     1      10.794   8.089   3.999\n"
+"ATOM     61  O   ???     1       8.355   8.291   3.834\n"
+"ATOM     62  C   ???     1       8.139   9.269   4.865\n"
+"ATOM     63  C   ???     1       6.937   8.745   5.644\n"
+"ATOM     64  O   ???     1       5.814   8.819   4.753\n"
+"ATOM     65  C   ???     1       6.948   7.295   6.225\n"
+"ATOM     66  O   ???     1       6.417   7.199   7.512\n"
+"ATOM     67  C   ???     1       6.148   6.464   5.250\n"
+"ATOM     68  C   ???     1       5.222   7.503   4.599\n"
+"ATOM     69  N   ???     1       4.918   7.267   3.140\n"
+"ATOM     70  C   ???     1       5.599   6.623   2.107\n"
+"ATOM     71  N   ???     1       4.919   6.594   0.951\n"
+"ATOM     72  C   ???     1       3.772   7.259   1.254\n"
+"ATOM     73  C   ???     1       2.598   7.558   0.439\n"
+"ATOM     74  O   ???     1       2.404   7.232  -0.737\n"
+"ATOM     75  N   ???     1       1.575   8.214   1.141\n"
+"ATOM     76  C   ???     1       1.613   8.566   2.471\n"
+"ATOM     77  N   ???     1       0.502   9.125   3.046\n"
+"ATOM     78  N   ???     1       2.702   8.309   3.210\n"
+"ATOM     79  C   ???     1       3.753   7.669   2.570\n"
+"ATOM     80  P   ???     1       6.301   5.803   8.277\n"
+"ATOM     81  O   ???     1       6.480   4.589   7.476\n"
+"ATOM     82  O   ???     1       7.156   5.937   9.499\n"
+"ATOM     83  O   ???     1       4.740   5.694   8.620\n"
+"ATOM     84  C   ???     1       3.911   6.858   8.929\n"
+"ATOM     85  C   ???     1       2.515   6.690   8.311\n"
+"ATOM     86  O   ???     1       2.653   6.561   6.911\n"
+"ATOM     87  C   ???     1       1.684   5.487   8.712\n"
+"ATOM     88  O   ???     1       0.539   5.815   9.516\n"
+"ATOM     89  C   ???     1       1.353   4.792   7.399\n"
+"ATOM     90  C   ???     1       1.556   5.869   6.393\n"
+"ATOM     91  N   ???     1       1.967   5.365   5.052\n"
+"ATOM     92  C   ???     1       3.193   4.822   4.658\n"
+"ATOM     93  N   ???     1       3.258   4.448   3.362\n"
+"ATOM     94  C   ???     1       2.043   4.779   2.883\n"
+"ATOM     95  C   ???     1       1.417   4.673   1.562\n"
+"ATOM     96  N   ???     1       2.034   4.100   0.514\n"
+"ATOM     97  N   ???     1       0.156   5.177   1.374\n"
+"ATOM     98  C   ???     1      -0.498   5.699   2.441\n"
+"ATOM     99  N   ???     1      -0.077   5.807   3.720\n"
+"ATOM    100  C   ???     1       1.230   5.336   3.901\n"
+"ATOM    101  P   ???     1      -0.488   4.701  10.028\n"
+"ATOM    102  O   ???     1       0.013   3.297  10.287\n"
+"ATOM    103  O   ???     1      -1.183   5.233  11.229\n"
+"ATOM    104  O   ???     1      -1.483   4.559   8.784\n"
+"ATOM    105  C   ???     1      -2.385   5.609   8.332\n"
+"ATOM    106  C   ???     1      -3.291   4.910   7.309\n"
+"ATOM    107  O   ???     1      -2.610   4.636   6.060\n"
+"ATOM    108  C   ???     1      -3.923   3.568   7.700\n"
+"ATOM    109  O   ???     1      -5.162   3.352   7.126\n"
+"ATOM    110  C   ???     1      -2.961   2.582   7.123\n"
+"ATOM    111  C   ???     1      -2.754   3.200   5.763\n"
+"ATOM    112  N   ???     1      -1.583   2.605   5.066\n"
+"ATOM    113  C   ???     1      -0.368   2.242   5.588\n"
+"ATOM    114  N   ???     1       0.486   1.776   4.665\n"
+"ATOM    115  C   ???     1      -0.189   1.878   3.525\n"
+"ATOM    116  C   ???     1       0.183   1.571   2.180\n"
+"ATOM    117  N   ???     1       1.377   0.958   1.920\n"
+"ATOM    118  N   ???     1      -0.730   1.786   1.174\n"
+"ATOM    119  C   ???     1      -1.964   2.218   1.475\n"
+"ATOM    120  N   ???     1      -2.439   2.500   2.716\n"
+"ATOM    121  C   ???     1      -1.479   2.331   3.718\n"
+"ATOM    122  P   ???     1      -5.924   1.982   7.353\n"
+"ATOM    123  O   ???     1      -5.172   0.938   8.012\n"
+"ATOM    124  O   ???     1      -7.186   2.593   7.897\n"
+"ATOM    125  O   ???     1      -6.252   1.347   5.938\n"
+"ATOM    126  C   ???     1      -6.944   2.135   4.921\n"
+"ATOM    127  C   ???     1      -6.715   1.372   3.651\n"
+"ATOM    128  O   ???     1      -5.286   1.133   3.458\n"
+"ATOM    129  C   ???     1      -7.407   0.057   3.644\n"
+"ATOM    130  O   ???     1      -8.489   0.026   2.771\n"
+"ATOM    131  C   ???     1      -6.310  -0.990   3.438\n"
+"ATOM    132  C   ???     1      -5.156  -0.150   2.865\n"
+"ATOM    133  N   ???     1      -3.757  -0.647   3.037\n"
+"ATOM    134  C   ???     1      -2.979  -0.923   1.905\n"
+"ATOM    135  O   ???     1      -3.374  -0.727   0.747\n"
+"ATOM    136  N   ???     1      -1.687  -1.340   2.116\n"
+"ATOM    137  C   ???     1      -1.144  -1.494   3.381\n"
+"ATOM    138  O   ???     1       0.074  -1.754   3.445\n"
+"ATOM    139  C   ???     1      -1.948  -1.227   4.501\n"
+"ATOM    140  C   ???     1      -1.422  -1.319   5.892\n"
+"ATOM    141  C   ???     1      -3.248  -0.795   4.314\n"
+"ATOM    142  P   ???     1      -9.378  -1.306   2.603\n"
+"ATOM    143  O   ???     1      -9.127  -2.221   3.726\n"
+"ATOM    145  O   ???     1      -8.753  -2.007   1.349\n"
+"ATOM    146  C   ???     1      -8.460  -1.252   0.127\n"
+"ATOM    147  C   ???     1      -7.623  -2.192  -0.688\n"
+"ATOM    148  O   ???     1      -6.477  -2.562   0.073\n"
+"ATOM    149  C   ???     1      -8.255  -3.511  -1.016\n"
+"ATOM    150  O   ???     1      -8.724  -3.527  -2.285\n"
+"ATOM    151  C   ???     1      -7.224  -4.587  -0.757\n"
+"ATOM    152  C   ???     1      -6.004  -3.753  -0.494\n"
+"ATOM    153  N   ???     1      -4.890  -4.263   0.346\n"
+"ATOM    154  C   ???     1      -3.627  -4.303  -0.238\n"
+"ATOM    155  O   ???     1      -3.413  -4.052  -1.439\n"
+"ATOM    156  N   ???     1      -2.559  -4.547   0.575\n"
+"ATOM    157  C   ???     1      -2.672  -4.694   1.927\n"
+"ATOM    158  O   ???     1      -1.603  -4.845   2.510\n"
+"ATOM    159  C   ???     1      -3.962  -4.607   2.537\n"
+"ATOM    160  C   ???     1      -4.169  -4.666   4.067\n"
+"ATOM    161  C   ???     1      -5.072  -4.416   1.690\n"
+"ATOM    162  P   ???     1      -9.083  -4.896  -2.982\n"
+"ATOM    163  O   ???     1      -9.692  -5.915  -2.114\n"
+"ATOM    164  O   ???     1      -9.784  -4.333  -4.195\n"
+"ATOM    165  O   ???     1      -7.769  -5.544  -3.501\n"
+"ATOM    166  C   ???     1      -6.988  -4.787  -4.548\n"
+"ATOM    167  C   ???     1      -5.787  -5.605  -4.680\n"
+"ATOM    168  O   ???     1      -5.186  -5.816  -3.381\n"
+"ATOM    169  C   ???     1      -6.160  -6.983  -5.172\n"
+"ATOM    170  O   ???     1      -5.775  -7.049  -6.554\n"
+"ATOM    171  C   ???     1      -5.475  -7.989  -4.170\n"
+"ATOM    172  C   ???     1      -4.470  -7.095  -3.471\n"
+"ATOM    173  N   ???     1      -4.143  -7.481  -2.064\n"
+"ATOM    174  C   ???     1      -2.880  -7.900  -1.674\n"
+"ATOM    175  O   ???     1      -1.981  -8.028  -2.497\n"
+"ATOM    176  N   ???     1      -2.644  -8.106  -0.357\n"
+"ATOM    177  C   ???     1      -3.593  -7.906   0.580\n"
+"ATOM    178  N   ???     1      -3.294  -8.029   1.897\n"
+"ATOM    179  C   ???     1      -4.887  -7.515   0.234\n"
+"ATOM    180  C   ???     1      -5.144  -7.290  -1.118\n"
+"ATOM    181  P   ???     1      -6.271  -8.185  -7.504\n"
+"ATOM    182  O   ???     1      -7.612  -8.682  -7.077\n"
+"ATOM    183  O   ???     1      -6.109  -7.701  -8.887\n"
+"ATOM    184  O   ???     1      -5.255  -9.348  -7.127\n"
+"ATOM    185  C   ???     1      -3.864  -9.233  -7.443\n"
+"ATOM    186  C   ???     1      -3.265 -10.503  -6.982\n"
+"ATOM    187  O   ???     1      -3.388 -10.408  -5.569\n"
+"ATOM    188  C   ???     1      -3.913 -11.848  -7.400\n"
+"ATOM    189  O   ???     1      -2.906 -12.861  -7.541\n"
+"ATOM    190  C   ???     1      -4.865 -12.134  -6.218\n"
+"ATOM    191  C   ???     1      -3.937 -11.700  -5.115\n"
+"ATOM    192  N   ???     1      -4.370 -11.653  -3.684\n"
+"ATOM    193  C   ???     1      -5.572 -11.359  -3.092\n"
+"ATOM    194  N   ???     1      -5.502 -11.208  -1.750\n"
+"ATOM    195  C   ???     1      -4.184 -11.405  -1.464\n"
+"ATOM    196  C   ???     1      -3.484 -11.398  -0.187\n"
+"ATOM    197  O   ???     1      -3.973 -11.294   0.939\n"
+"ATOM    198  N   ???     1      -2.117 -11.651  -0.293\n"
+"ATOM    199  C   ???     1      -1.432 -11.934  -1.458\n"
+"ATOM    200  N   ???     1      -0.114 -12.247  -1.341\n"
+"ATOM    201  N   ???     1      -2.059 -11.968  -2.664\n"
+"ATOM    202  C   ???     1      -3.452 -11.687  -2.620\n"
+"ATOM    203  P   ???     1      -2.430 -13.413  -8.952\n"
+"ATOM    204  O   ???     1      -3.259 -14.642  -9.185\n"
+"ATOM    205  O   ???     1      -2.433 -12.356 -10.046\n"
+"ATOM    206  O   ???     1      -0.882 -13.756  -8.697\n"
+"ATOM    207  C   ???     1       0.079 -12.685  -8.383\n"
+"ATOM    208  C   ???     1       1.266 -13.194  -7.564\n"
+"ATOM    209  O   ???     1       0.999 -13.349  -6.166\n"
+"ATOM    210  C   ???     1       1.851 -14.504  -7.958\n"
+"ATOM    211  O   ???     1       3.274 -14.536  -7.758\n"
+"ATOM    212  C   ???     1       1.034 -15.479  -7.076\n"
+"ATOM    213  C   ???     1       1.061 -14.732  -5.783\n"
+"ATOM    214  N   ???     1       0.018 -15.063  -4.744\n"
+"ATOM    215  C   ???     1       0.371 -15.193  -3.394\n"
+"ATOM    216  O   ???     1       1.555 -15.059  -3.043\n"
+"ATOM    217  N   ???     1      -0.605 -15.422  -2.469\n"
+"ATOM    218  C   ???     1      -1.903 -15.490  -2.823\n"
+"ATOM    219  N   ???     1      -2.850 -15.626  -1.852\n"
+"ATOM    220  C   ???     1      -2.311 -15.339  -4.167\n"
+"ATOM    221  C   ???     1      -1.315 -15.115  -5.135\n"
+"ATOM    222  P   ???     1       4.029 -15.922  -7.818\n"
+"ATOM    223  O   ???     1       3.416 -16.861  -8.809\n"
+"ATOM    224  O   ???     1       5.487 -15.559  -8.011\n"
+"ATOM    225  O   ???     1       3.714 -16.639  -6.402\n"
+"ATOM    226  C   ???     1       4.699 -16.656  -5.290\n"
+"ATOM    227  C   ???     1       4.464 -17.877  -4.385\n"
+"ATOM    228  O   ???     1       3.153 -17.818  -3.885\n"
+"ATOM    229  C   ???     1       4.685 -19.342  -4.849\n"
+"ATOM    230  O   ???     1       5.420 -20.114  -3.884\n"
+"ATOM    231  C   ???     1       3.295 -19.890  -5.050\n"
+"ATOM    232  C   ???     1       2.531 -19.057  -4.020\n"
+"ATOM    233  N   ???     1       1.056 -18.734  -4.183\n"
+"ATOM    234  C   ???     1       0.273 -18.422  -5.264\n"
+"ATOM    235  N   ???     1      -1.031 -18.317  -4.953\n"
+"ATOM    236  C   ???     1      -1.093 -18.575  -3.620\n"
+"ATOM    237  C   ???     1      -2.226 -18.671  -2.719\n"
+"ATOM    238  O   ???     1      -3.418 -18.578  -2.959\n"
+"ATOM    239  N   ???     1      -1.866 -18.877  -1.414\n"
+"ATOM    240  C   ???     1      -0.581 -18.991  -0.915\n"
+"ATOM    241  N   ???     1      -0.396 -19.286   0.409\n"
+"ATOM    242  N   ???     1       0.472 -18.926  -1.725\n"
+"ATOM    243  C   ???     1       0.163 -18.734  -3.100\n"
+"ATOM    244  O   ???     1      -6.680 -19.825   7.699\n"
+"ATOM    245  C   ???     1      -6.306 -20.194   6.315\n"
+"ATOM    246  C   ???     1      -5.053 -19.445   5.920\n"
+"ATOM    247  O   ???     1      -4.418 -19.699   4.659\n"
+"ATOM    248  C   ???     1      -4.994 -17.972   6.135\n"
+"ATOM    249  O   ???     1      -3.710 -17.604   6.687\n"
+"ATOM    250  C   ???     1      -5.163 -17.510   4.681\n"
+"ATOM    251  C   ???     1      -4.498 -18.548   3.817\n"
+"ATOM    252  N   ???     1      -5.087 -18.713   2.382\n"
+"ATOM    253  C   ???     1      -4.235 -18.653   1.283\n"
+"ATOM    254  O   ???     1      -3.023 -18.634   1.498\n"
+"ATOM    255  N   ???     1      -4.753 -18.618   0.009\n"
+"ATOM    256  C   ???     1      -6.087 -18.707  -0.208\n"
+"ATOM    257  N   ???     1      -6.569 -18.815  -1.491\n"
+"ATOM    258  C   ???     1      -6.991 -18.809   0.869\n"
+"ATOM    259  C   ???     1      -6.468 -18.783   2.177\n"
+"ATOM    260  P   ???     1      -3.519 -16.827   8.069\n"
+"ATOM    261  O   ???     1      -4.231 -15.537   8.035\n"
+"ATOM    262  O   ???     1      -3.821 -17.708   9.240\n"
+"ATOM    263  O   ???     1      -1.956 -16.549   8.073\n"
+"ATOM    264  C   ???     1      -0.947 -17.650   8.003\n"
+"ATOM    265  C   ???     1       0.325 -17.111   7.352\n"
+"ATOM    266  O   ???     1       0.066 -17.132   5.962\n"
+"ATOM    267  C   ???     1       0.613 -15.669   7.661\n"
+"ATOM    268  O   ???     1       1.856 -15.388   8.203\n"
+"ATOM    269  C   ???     1       0.265 -14.853   6.465\n"
+"ATOM    270  C   ???     1       0.285 -15.854   5.380\n"
+"ATOM    271  N   ???     1      -0.824 -15.536   4.452\n"
+"ATOM    272  C   ???     1      -2.113 -15.141   4.752\n"
+"ATOM    273  N   ???     1      -2.810 -14.728   3.684\n"
+"ATOM    274  C   ???     1      -1.957 -14.896   2.652\n"
+"ATOM    275  C   ???     1      -2.142 -14.574   1.260\n"
+"ATOM    276  O   ???     1      -3.179 -14.132   0.774\n"
+"ATOM    277  N   ???     1      -1.001 -14.804   0.451\n"
+"ATOM    278  C   ???     1       0.192 -15.336   0.902\n"
+"ATOM    279  N   ???     1       1.184 -15.515   0.002\n"
+"ATOM    280  N   ???     1       0.382 -15.672   2.205\n"
+"ATOM    281  C   ???     1      -0.729 -15.444   3.059\n"
+"ATOM    282  P   ???     1       2.293 -13.866   8.376\n"
+"ATOM    283  O   ???     1       1.086 -13.042   8.626\n"
+"ATOM    284  O   ???     1       3.396 -13.816   9.377\n"
+"ATOM    285  O   ???     1       2.922 -13.420   7.025\n"
+"ATOM    286  C   ???     1       4.007 -14.108   6.407\n"
+"ATOM    287  C   ???     1       4.054 -13.498   5.013\n"
+"ATOM    288  O   ???     1       2.780 -13.607   4.393\n"
+"ATOM    289  C   ???     1       4.326 -12.019   4.962\n"
+"ATOM    290  O   ???     1       5.715 -11.793   5.178\n"
+"ATOM    291  C   ???     1       3.795 -11.615   3.565\n"
+"ATOM    292  C   ???     1       2.647 -12.603   3.423\n"
+"ATOM    293  N   ???     1       1.244 -12.133   3.536\n"
+"ATOM    294  C   ???     1       0.427 -12.102   2.410\n"
+"ATOM    295  O   ???     1       0.835 -12.492   1.323\n"
+"ATOM    296  N   ???     1      -0.850 -11.713   2.533\n"
+"ATOM    297  C   ???     1      -1.391 -11.421   3.723\n"
+"ATOM    298  N   ???     1      -2.628 -10.831   3.762\n"
+"ATOM    299  C   ???     1      -0.649 -11.574   4.913\n"
+"ATOM    300  C   ???     1       0.708 -11.938   4.796\n"
+"ATOM    301  P   ???     1       6.336 -10.366   5.128\n"
+"ATOM    302  O   ???     1       5.449  -9.428   5.909\n"
+"ATOM    303  O   ???     1       7.745 -10.482   5.620\n"
+"ATOM    304  O   ???     1       6.290 -10.020   3.569\n"
+"ATOM    305  C   ???     1       7.055 -10.811   2.615\n"
+"ATOM    306  C   ???     1       6.734 -10.308   1.217\n"
+"ATOM    307  O   ???     1       5.297 -10.192   1.100\n"
+"ATOM    308  C   ???     1       7.286  -8.975   0.718\n"
+"ATOM    309  O   ???     1       7.393  -8.945  -0.714\n"
+"ATOM    310  C   ???     1       6.225  -7.973   1.221\n"
+"ATOM    311  C   ???     1       4.974  -8.794   0.845\n"
+"ATOM    312  N   ???     1       3.773  -8.455   1.602\n"
+"ATOM    313  C   ???     1       3.640  -7.981   2.890\n"
+"ATOM    314  N   ???     1       2.384  -7.801   3.240\n"
+"ATOM    315  C   ???     1       1.667  -8.192   2.129\n"
+"ATOM    316  C   ???     1       0.216  -8.383   1.898\n"
+"ATOM    317  O   ???     1      -0.692  -8.327   2.724\n"
+"ATOM    318  N   ???     1      -0.115  -8.589   0.569\n"
+"ATOM    319  C   ???     1       0.807  -8.696  -0.461\n"
+"ATOM    320  N   ???     1       0.345  -8.866  -1.749\n"
+"ATOM    321  N   ???     1       2.149  -8.691  -0.209\n"
+"ATOM    322  C   ???     1       2.524  -8.455   1.086\n"
+"ATOM    323  P   ???     1       7.575  -7.564  -1.471\n"
+"ATOM    324  O   ???     1       7.955  -6.449  -0.479\n"
+"ATOM    325  O   ???     1       8.741  -7.728  -2.458\n"
+"ATOM    326  O   ???     1       6.254  -7.373  -2.307\n"
+"ATOM    327  C   ???     1       6.024  -8.272  -3.442\n"
+"ATOM    328  C   ???     1       5.019  -7.727  -4.455\n"
+"ATOM    329  O   ???     1       3.633  -7.467  -4.002\n"
+"ATOM    330  C   ???     1       5.448  -6.462  -5.147\n"
+"ATOM    331  O   ???     1       5.043  -6.461  -6.529\n"
+"ATOM    332  C   ???     1       4.765  -5.380  -4.322\n"
+"ATOM    333  C   ???     1       3.522  -6.055  -3.759\n"
+"ATOM    334  N   ???     1       3.349  -5.765  -2.284\n"
+"ATOM    335  C   ???     1       4.280  -5.485  -1.291\n"
+"ATOM    336  N   ???     1       3.718  -5.218  -0.101\n"
+"ATOM    337  C   ???     1       2.389  -5.311  -0.337\n"
+"ATOM    338  C   ???     1       1.210  -5.068   0.470\n"
+"ATOM    339  N   ???     1       1.297  -4.554   1.713\n"
+"ATOM    340  N   ???     1      -0.018  -5.382  -0.038\n"
+"ATOM    341  C   ???     1      -0.107  -5.816  -1.309\n"
+"ATOM    342  N   ???     1       0.900  -5.988  -2.198\n"
+"ATOM    343  C   ???     1       2.136  -5.713  -1.640\n"
+"ATOM    344  P   ???     1       4.958  -5.104  -7.365\n"
+"ATOM    345  O   ???     1       5.978  -4.099  -6.859\n"
+"ATOM    346  O   ???     1       5.021  -5.615  -8.756\n"
+"ATOM    347  O   ???     1       3.560  -4.533  -7.033\n"
+"ATOM    348  C   ???     1       2.362  -5.321  -7.154\n"
+"ATOM    349  C   ???     1       1.273  -4.376  -6.720\n"
+"ATOM    350  O   ???     1       1.389  -4.141  -5.316\n"
+"ATOM    351  C   ???     1       1.322  -2.993  -7.366\n"
+"ATOM    352  O   ???     1       0.329  -2.831  -8.391\n"
+"ATOM    353  C   ???     1       1.333  -1.991  -6.194\n"
+"ATOM    354  C   ???     1       0.897  -2.852  -5.006\n"
+"ATOM    355  N   ???     1       1.537  -2.528  -3.709\n"
+"ATOM    356  C   ???     1       2.863  -2.388  -3.374\n"
+"ATOM    357  N   ???     1       3.059  -2.100  -2.081\n"
+"ATOM    358  C   ???     1       1.825  -2.100  -1.562\n"
+"ATOM    359  C   ???     1       1.312  -1.785  -0.242\n"
+"ATOM    360  N   ???     1       2.105  -1.419   0.792\n"
+"ATOM    361  N   ???     1      -0.035  -1.681  -0.088\n"
+"ATOM    362  C   ???     1      -0.863  -1.975  -1.112\n"
+"ATOM    363  N   ???     1      -0.516  -2.341  -2.360\n"
+"ATOM    364  C   ???     1       0.871  -2.352  -2.537\n"
+"ATOM    365  P   ???     1       0.096  -1.455  -9.141\n"
+"ATOM    366  O   ???     1       1.403  -0.827  -9.454\n"
+"ATOM    367  O   ???     1      -0.784  -1.681 -10.328\n"
+"ATOM    368  O   ???     1      -0.708  -0.618  -8.042\n"
+"ATOM    369  C   ???     1      -2.026  -1.063  -7.621\n"
+"ATOM    370  C   ???     1      -2.460  -0.283  -6.398\n"
+"ATOM    371  O   ???     1      -1.482  -0.424  -5.323\n"
+"ATOM    372  C   ???     1      -2.702   1.209  -6.627\n"
+"ATOM    373  O   ???     1      -4.034   1.463  -6.980\n"
+"ATOM    374  C   ???     1      -2.262   1.804  -5.316\n"
+"ATOM    375  C   ???     1      -1.039   0.909  -5.075\n"
+"ATOM    376  N   ???     1      -0.210   0.993  -3.836\n"
+"ATOM    377  C   ???     1      -0.736   1.017  -2.546\n"
+"ATOM    378  O   ???     1      -1.957   0.851  -2.314\n"
+"ATOM    379  N   ???     1       0.164   1.108  -1.498\n"
+"ATOM    380  C   ???     1       1.538   1.199  -1.677\n"
+"ATOM    381  O   ???     1       2.250   1.226  -0.672\n"
+"ATOM    382  C   ???     1       2.054   1.179  -2.992\n"
+"ATOM    383  C   ???     1       3.521   1.367  -3.242\n"
+"ATOM    384  C   ???     1       1.153   1.065  -4.071\n"
+"ATOM    385  P   ???     1      -4.609   2.928  -7.269\n"
+"ATOM    386  O   ???     1      -3.623   3.841  -7.848\n"
+"ATOM    387  O   ???     1      -5.862   2.588  -8.032\n"
+"ATOM    388  O   ???     1      -4.884   3.503  -5.838\n"
+"ATOM    389  C   ???     1      -5.822   2.805  -4.954\n"
+"ATOM    390  C   ???     1      -5.829   3.570  -3.680\n"
+"ATOM    391  O   ???     1      -4.506   3.511  -3.227\n"
+"ATOM    392  C   ???     1      -6.172   5.046  -3.735\n"
+"ATOM    393  O   ???     1      -7.441   5.291  -3.123\n"
+"ATOM    394  C   ???     1      -5.006   5.747  -3.052\n"
+"ATOM    395  C   ???     1      -4.274   4.597  -2.370\n"
+"ATOM    396  N   ???     1      -2.767   4.703  -2.324\n"
+"ATOM    397  C   ???     1      -2.085   4.842  -1.117\n"
+"ATOM    398  O   ???     1      -2.678   5.024  -0.043\n"
+"ATOM    399  N   ???     1      -0.697   4.808  -1.172\n"
+"ATOM    400  C   ???     1       0.014   4.669  -2.366\n"
+"ATOM    401  O   ???     1       1.237   4.636  -2.312\n"
+"ATOM    402  C   ???     1      -0.682   4.595  -3.576\n"
+"ATOM    403  C   ???     1       0.027   4.511  -4.924\n"
+"ATOM    404  C   ???     1      -2.079   4.607  -3.526\n"
+"ATOM    405  P   ???     1      -8.018   6.766  -2.948\n"
+"ATOM    406  O   ???     1      -7.635   7.566  -4.152\n"
+"ATOM    407  O   ???     1      -9.476   6.706  -2.680\n"
+"ATOM    408  O   ???     1      -7.320   7.281  -1.652\n"
+"ATOM    409  C   ???     1      -7.634   6.745  -0.332\n"
+"ATOM    410  C   ???     1      -6.740   7.536   0.578\n"
+"ATOM    411  O   ???     1      -5.356   7.300   0.129\n"
+"ATOM    412  C   ???     1      -6.992   9.072   0.483\n"
+"ATOM    413  O   ???     1      -7.500   9.642   1.681\n"
+"ATOM    414  C   ???     1      -5.648   9.640   0.010\n"
+"ATOM    415  C   ???     1      -4.683   8.515   0.475\n"
+"ATOM    416  N   ???     1      -3.379   8.489  -0.149\n"
+"ATOM    417  C   ???     1      -2.166   8.504   0.541\n"
+"ATOM    418  O   ???     1      -2.158   8.517   1.779\n"
+"ATOM    419  N   ???     1      -1.010   8.423  -0.184\n"
+"ATOM    420  C   ???     1      -1.042   8.316  -1.562\n"
+"ATOM    421  N   ???     1       0.083   8.179  -2.370\n"
+"ATOM    422  C   ???     1      -2.249   8.284  -2.244\n"
+"ATOM    423  C   ???     1      -3.426   8.372  -1.520\n"
+"ATOM    424  P   ???     1      -8.072  11.149   1.769\n"
+"ATOM    425  O   ???     1      -8.359  11.946   0.569\n"
+"ATOM    426  O   ???     1      -9.253  11.131   2.697\n"
+"ATOM    427  O   ???     1      -6.842  11.901   2.427\n"
+"ATOM    428  C   ???     1      -6.195  11.442   3.679\n"
+"ATOM    429  C   ???     1      -4.912  12.282   3.817\n"
+"ATOM    430  O   ???     1      -3.876  11.994   2.873\n"
+"ATOM    431  C   ???     1      -5.090  13.728   3.629\n"
+"ATOM    432  O   ???     1      -4.492  14.502   4.643\n"
+"ATOM    433  C   ???     1      -4.542  14.026   2.249\n"
+"ATOM    434  C   ???     1      -3.391  13.126   2.230\n"
+"ATOM    435  N   ???     1      -2.856  12.707   0.897\n"
+"ATOM    436  C   ???     1      -3.473  12.442  -0.319\n"
+"ATOM    437  N   ???     1      -2.637  12.015  -1.293\n"
+"ATOM    438  C   ???     1      -1.436  12.007  -0.688\n"
+"ATOM    439  C   ???     1      -0.127  11.608  -1.179\n"
+"ATOM    440  O   ???     1       0.172  11.212  -2.291\n"
+"ATOM    441  N   ???     1       0.874  11.683  -0.204\n"
+"ATOM    442  C   ???     1       0.686  12.119   1.100\n"
+"ATOM    443  N   ???     1       1.749  12.103   1.939\n"
+"ATOM    444  N   ???     1      -0.519  12.555   1.528\n"
+"ATOM    445  C   ???     1      -1.544  12.446   0.633\n"
+"ATOM    446  P   ???     1      -5.127  15.894   4.858\n"
+"ATOM    447  O   ???     1      -5.425  16.629   3.561\n"
+"ATOM    448  O   ???     1      -6.250  15.527   5.754\n"
+"ATOM    449  O   ???     1      -4.002  16.793   5.584\n"
+"ATOM    450  C   ???     1      -3.238  16.255   6.678\n"
+"ATOM    451  C   ???     1      -1.830  16.039   6.216\n"
+"ATOM    452  O   ???     1      -1.871  15.509   4.883\n"
+"ATOM    453  C   ???     1      -0.873  17.253   6.173\n"
+"ATOM    454  O   ???     1      -0.153  17.520   7.416\n"
+"ATOM    455  C   ???     1       0.090  16.942   5.027\n"
+"ATOM    456  C   ???     1      -0.595  15.819   4.260\n"
+"ATOM    457  N   ???     1      -0.730  16.057   2.785\n"
+"ATOM    458  C   ???     1       0.227  15.578   1.903\n"
+"ATOM    459  O   ???     1       1.293  15.046   2.291\n"
+"ATOM    460  N   ???     1      -0.055  15.614   0.600\n"
+"ATOM    461  C   ???     1      -1.197  16.106   0.107\n"
+"ATOM    462  N   ???     1      -1.457  15.971  -1.213\n"
+"ATOM    463  C   ???     1      -2.157  16.670   0.937\n"
+"ATOM    464  C   ???     1      -1.890  16.634   2.320\n"
+"ATOM    465  P   ???     1       0.085  19.035   7.891\n"
+"ATOM    466  O   ???     1      -1.103  19.918   7.465\n"
+"ATOM    467  O   ???     1       0.455  19.118   9.333\n"
+"ATOM    468  O   ???     1       1.304  19.503   6.967\n"
+"ATOM    469  C   ???     1       2.588  19.092   7.215\n"
+"ATOM    470  C   ???     1       3.346  19.369   5.986\n"
+"ATOM    471  O   ???     1       2.968  18.509   4.924\n"
+"ATOM    472  C   ???     1       3.325  20.751   5.383\n"
+"ATOM    473  O   ???     1       3.907  21.749   6.266\n"
+"ATOM    474  C   ???     1       4.203  20.393   4.162\n"
+"ATOM    475  C   ???     1       3.516  19.074   3.711\n"
+"ATOM    476  N   ???     1       2.407  19.227   2.697\n"
+"ATOM    477  C   ???     1       1.165  19.783   2.799\n"
+"ATOM    478  N   ???     1       0.472  19.784   1.639\n"
+"ATOM    479  C   ???     1       1.290  19.206   0.763\n"
+"ATOM    480  C   ???     1       1.097  18.852  -0.624\n"
+"ATOM    481  O   ???     1       0.123  18.893  -1.321\n"
+"ATOM    482  N   ???     1       2.227  18.334  -1.206\n"
+"ATOM    483  C   ???     1       3.438  18.092  -0.570\n"
+"ATOM    484  N   ???     1       4.500  17.628  -1.280\n"
+"ATOM    485  N   ???     1       3.571  18.322   0.734\n"
+"ATOM    486  C   ???     1       2.483  18.897   1.373\n"
+"CONECT    1    2\n"
+"CONECT    2    1    3\n"
+"CONECT    3    2    4    5\n"
+"CONECT    4    3    8\n"
+"CONECT    5    3    6    7\n"
+"CONECT    6    5   17\n"
+"CONECT    7    5    8\n"
+"CONECT    8    4    7    9\n"
+"CONECT    9    8   10   16\n"
+"CONECT   10    9   11   12\n"
+"CONECT   11   10\n"
+"CONECT   12   10   13\n"
+"CONECT   13   12   14   15\n"
+"CONECT   14   13\n"
+"CONECT   15   13   16\n"
+"CONECT   16    9   15\n"
+"CONECT   17    6   18   19   20\n"
+"CONECT   18   17\n"
+"CONECT   19   17\n"
+"CONECT   20   17   21\n"
+"CONECT   21   20   22\n"
+"CONECT   22   21   23   24\n"
+"CONECT   23   22   27\n"
+"CONECT   24   22   25   26\n"
+"CONECT   25   24   39\n"
+"CONECT   26   24   27\n"
+"CONECT   27   23   26   28\n"
+"CONECT   28   27   29   38\n"
+"CONECT   29   28   30\n"
+"CONECT   30   29   31\n"
+"CONECT   31   30   32   38\n"
+"CONECT   32   31   33   34\n"
+"CONECT   33   32\n"
+"CONECT   34   32   35\n"
+"CONECT   35   34   36   37\n"
+"CONECT   36   35\n"
+"CONECT   37   35   38\n"
+"CONECT   38   28   31   37\n"
+"CONECT   39   25   40   41   42\n"
+"CONECT   40   39\n"
+"CONECT   41   39\n"
+"CONECT   42   39   43\n"
+"CONECT   43   42   44\n"
+"CONECT   44   43   45   46\n"
+"CONECT   45   44   49\n"
+"CONECT   46   44   47   48\n"
+"CONECT   47   46   58\n"
+"CONECT   48   46   49\n"
+"CONECT   49   45   48   50\n"
+"CONECT   50   49   51   57\n"
+"CONECT   51   50   52   53\n"
+"CONECT   52   51\n"
+"CONECT   53   51   54\n"
+"CONECT   54   53   55   56\n"
+"CONECT   55   54\n"
+"CONECT   56   54   57\n"
+"CONECT   57   50   56\n"
+"CONECT   58   47   59   60   61\n"
+"CONECT   59   58\n"
+"CONECT   60   58\n"
+"CONECT   61   58   62\n"
+"CONECT   62   61   63\n"
+"CONECT   63   62   64   65\n"
+"CONECT   64   63   68\n"
+"CONECT   65   63   66   67\n"
+"CONECT   66   65   80\n"
+"CONECT   67   65   68\n"
+"CONECT   68   64   67   69\n"
+"CONECT   69   68   70   79\n"
+"CONECT   70   69   71\n"
+"CONECT   71   70   72\n"
+"CONECT   72   71   73   79\n"
+"CONECT   73   72   74   75\n"
+"CONECT   74   73\n"
+"CONECT   75   73   76\n"
+"CONECT   76   75   77   78\n"
+"CONECT   77   76\n"
+"CONECT   78   76   79\n"
+"CONECT   79   69   72   78\n"
+"CONECT   80   66   81   82   83\n"
+"CONECT   81   80\n"
+"CONECT   82   80\n"
+"CONECT   83   80   84\n"
+"CONECT   84   83   85\n"
+"CONECT   85   84   86   87\n"
+"CONECT   86   85   90\n"
+"CONECT   87   85   88   89\n"
+"CONECT   88   87  101\n"
+"CONECT   89   87   90\n"
+"CONECT   90   86   89   91\n"
+"CONECT   91   90   92  100\n"
+"CONECT   92   91   93\n"
+"CONECT   93   92   94\n"
+"CONECT   94   93   95  100\n"
+"CONECT   95   94   96   97\n"
+"CONECT   96   95\n"
+"CONECT   97   95   98\n"
+"CONECT   98   97   99\n"
+"CONECT   99   98  100\n"
+"CONECT  100   91   94   99\n"
+"CONECT  101   88  102  103  104\n"
+"CONECT  102  101\n"
+"CONECT  103  101\n"
+"CONECT  104  101  105\n"
+"CONECT  105  104  106\n"
+"CONECT  106  105  107  108\n"
+"CONECT  107  106  111\n"
+"CONECT  108  106  109  110\n"
+"CONECT  109  108  122\n"
+"CONECT  110  108  111\n"
+"CONECT  111  107  110  112\n"
+"CONECT  112  111  113  121\n"
+"CONECT  113  112  114\n"
+"CONECT  114  113  115\n"
+"CONECT  115  114  116  121\n"
+"CONECT  116  115  117  118\n"
+"CONECT  117  116\n"
+"CONECT  118  116  119\n"
+"CONECT  119  118  120\n"
+"CONECT  120  119  121\n"
+"CONECT  121  112  115  120\n"
+"CONECT  122  109  123  124  125\n"
+"CONECT  123  122\n"
+"CONECT  124  122\n"
+"CONECT  125  122  126\n"
+"CONECT  126  125  127\n"
+"CONECT  127  126  128  129\n"
+"CONECT  128  127  132\n"
+"CONECT  129  127  130  131\n"
+"CONECT  130  129  142\n"
+"CONECT  131  129  132\n"
+"CONECT  132  128  131  133\n"
+"CONECT  133  132  134  141\n"
+"CONECT  134  133  135  136\n"
+"CONECT  135  134\n"
+"CONECT  136  134  137\n"
+"CONECT  137  136  138  139\n"
+"CONECT  138  137\n"
+"CONECT  139  137  140  141\n"
+"CONECT  140  139\n"
+"CONECT  141  133  139\n"
+"CONECT  142  130  143  145\n"
+"CONECT  143  142\n"
+"CONECT  145  142  146\n"
+"CONECT  146  145  147\n"
+"CONECT  147  146  148  149\n"
+"CONECT  148  147  152\n"
+"CONECT  149  147  150  151\n"
+"CONECT  150  149  162\n"
+"CONECT  151  149  152\n"
+"CONECT  152  148  151  153\n"
+"CONECT  153  152  154  161\n"
+"CONECT  154  153  155  156\n"
+"CONECT  155  154\n"
+"CONECT  156  154  157\n"
+"CONECT  157  156  158  159\n"
+"CONECT  158  157\n"
+"CONECT  159  157  160  161\n"
+"CONECT  160  159\n"
+"CONECT  161  153  159\n"
+"CONECT  162  150  163  164  165\n"
+"CONECT  163  162\n"
+"CONECT  164  162\n"
+"CONECT  165  162  166\n"
+"CONECT  166  165  167\n"
+"CONECT  167  166  168  169\n"
+"CONECT  168  167  172\n"
+"CONECT  169  167  170  171\n"
+"CONECT  170  169  181\n"
+"CONECT  171  169  172\n"
+"CONECT  172  168  171  173\n"
+"CONECT  173  172  174  180\n"
+"CONECT  174  173  175  176\n"
+"CONECT  175  174\n"
+"CONECT  176  174  177\n"
+"CONECT  177  176  178  179\n"
+"CONECT  178  177\n"
+"CONECT  179  177  180\n"
+"CONECT  180  173  179\n"
+"CONECT  181  170  182  183  184\n"
+"CONECT  182  181\n"
+"CONECT  183  181\n"
+"CONECT  184  181  185\n"
+"CONECT  185  184  186\n"
+"CONECT  186  185  187  188\n"
+"CONECT  187  186  191\n"
+"CONECT  188  186  189  190\n"
+"CONECT  189  188  203\n"
+"CONECT  190  188  191\n"
+"CONECT  191  187  190  192\n"
+"CONECT  192  191  193  202\n"
+"CONECT  193  192  194\n"
+"CONECT  194  193  195\n"
+"CONECT  195  194  196  202\n"
+"CONECT  196  195  197  198\n"
+"CONECT  197  196\n"
+"CONECT  198  196  199\n"
+"CONECT  199  198  200  201\n"
+"CONECT  200  199\n"
+"CONECT  201  199  202\n"
+"CONECT  202  192  195  201\n"
+"CONECT  203  189  204  205  206\n"
+"CONECT  204  203\n"
+"CONECT  205  203\n"
+"CONECT  206  203  207\n"
+"CONECT  207  206  208\n"
+"CONECT  208  207  209  210\n"
+"CONECT  209  208  213\n"
+"CONECT  210  208  211  212\n"
+"CONECT  211  210  222\n"
+"CONECT  212  210  213\n"
+"CONECT  213  209  212  214\n"
+"CONECT  214  213  215  221\n"
+"CONECT  215  214  216  217\n"
+"CONECT  216  215\n"
+"CONECT  217  215  218\n"
+"CONECT  218  217  219  220\n"
+"CONECT  219  218\n"
+"CONECT  220  218  221\n"
+"CONECT  221  214  220\n"
+"CONECT  222  211  223  224  225\n"
+"CONECT  223  222\n"
+"CONECT  224  222\n"
+"CONECT  225  222  226\n"
+"CONECT  226  225  227\n"
+"CONECT  227  226  228  229\n"
+"CONECT  228  227  232\n"
+"CONECT  229  227  230  231\n"
+"CONECT  230  229\n"
+"CONECT  231  229  232\n"
+"CONECT  232  228  231  233\n"
+"CONECT  233  232  234  243\n"
+"CONECT  234  233  235\n"
+"CONECT  235  234  236\n"
+"CONECT  236  235  237  243\n"
+"CONECT  237  236  238  239\n"
+"CONECT  238  237\n"
+"CONECT  239  237  240\n"
+"CONECT  240  239  241  242\n"
+"CONECT  241  240\n"
+"CONECT  242  240  243\n"
+"CONECT  243  233  236  242\n"
+"CONECT  244  245\n"
+"CONECT  245  244  246\n"
+"CONECT  246  245  247  248\n"
+"CONECT  247  246  251\n"
+"CONECT  248  246  249  250\n"
+"CONECT  249  248  260\n"
+"CONECT  250  248  251\n"
+"CONECT  251  247  250  252\n"
+"CONECT  252  251  253  259\n"
+"CONECT  253  252  254  255\n"
+"CONECT  254  253\n"
+"CONECT  255  253  256\n"
+"CONECT  256  255  257  258\n"
+"CONECT  257  256\n"
+"CONECT  258  256  259\n"
+"CONECT  259  252  258\n"
+"CONECT  260  249  261  262  263\n"
+"CONECT  261  260\n"
+"CONECT  262  260\n"
+"CONECT  263  260  264\n"
+"CONECT  264  263  265\n"
+"CONECT  265  264  266  267\n"
+"CONECT  266  265  270\n"
+"CONECT  267  265  268  269\n"
+"CONECT  268  267  282\n"
+"CONECT  269  267  270\n"
+"CONECT  270  266  269  271\n"
+"CONECT  271  270  272  281\n"
+"CONECT  272  271  273\n"
+"CONECT  273  272  274\n"
+"CONECT  274  273  275  281\n"
+"CONECT  275  274  276  277\n"
+"CONECT  276  275\n"
+"CONECT  277  275  278\n"
+"CONECT  278  277  279  280\n"
+"CONECT  279  278\n"
+"CONECT  280  278  281\n"
+"CONECT  281  271  274  280\n"
+"CONECT  282  268  283  284  285\n"
+"CONECT  283  282\n"
+"CONECT  284  282\n"
+"CONECT  285  282  286\n"
+"CONECT  286  285  287\n"
+"CONECT  287  286  288  289\n"
+"CONECT  288  287  292\n"
+"CONECT  289  287  290  291\n"
+"CONECT  290  289  301\n"
+"CONECT  291  289  292\n"
+"CONECT  292  288  291  293\n"
+"CONECT  293  292  294  300\n"
+"CONECT  294  293  295  296\n"
+"CONECT  295  294\n"
+"CONECT  296  294  297\n"
+"CONECT  297  296  298  299\n"
+"CONECT  298  297\n"
+"CONECT  299  297  300\n"
+"CONECT  300  293  299\n"
+"CONECT  301  290  302  303  304\n"
+"CONECT  302  301\n"
+"CONECT  303  301\n"
+"CONECT  304  301  305\n"
+"CONECT  305  304  306\n"
+"CONECT  306  305  307  308\n"
+"CONECT  307  306  311\n"
+"CONECT  308  306  309  310\n"
+"CONECT  309  308  323\n"
+"CONECT  310  308  311\n"
+"CONECT  311  307  310  312\n"
+"CONECT  312  311  313  322\n"
+"CONECT  313  312  314\n"
+"CONECT  314  313  315\n"
+"CONECT  315  314  316  322\n"
+"CONECT  316  315  317  318\n"
+"CONECT  317  316\n"
+"CONECT  318  316  319\n"
+"CONECT  319  318  320  321\n"
+"CONECT  320  319\n"
+"CONECT  321  319  322\n"
+"CONECT  322  312  315  321\n"
+"CONECT  323  309  324  325  326\n"
+"CONECT  324  323\n"
+"CONECT  325  323\n"
+"CONECT  326  323  327\n"
+"CONECT  327  326  328\n"
+"CONECT  328  327  329  330\n"
+"CONECT  329  328  333\n"
+"CONECT  330  328  331  332\n"
+"CONECT  331  330  344\n"
+"CONECT  332  330  333\n"
+"CONECT  333  329  332  334\n"
+"CONECT  334  333  335  343\n"
+"CONECT  335  334  336\n"
+"CONECT  336  335  337\n"
+"CONECT  337  336  338  343\n"
+"CONECT  338  337  339  340\n"
+"CONECT  339  338\n"
+"CONECT  340  338  341\n"
+"CONECT  341  340  342\n"
+"CONECT  342  341  343\n"
+"CONECT  343  334  337  342\n"
+"CONECT  344  331  345  346  347\n"
+"CONECT  345  344\n"
+"CONECT  346  344\n"
+"CONECT  347  344  348\n"
+"CONECT  348  347  349\n"
+"CONECT  349  348  350  351\n"
+"CONECT  350  349  354\n"
+"CONECT  351  349  352  353\n"
+"CONECT  352  351  365\n"
+"CONECT  353  351  354\n"
+"CONECT  354  350  353  355\n"
+"CONECT  355  354  356  364\n"
+"CONECT  356  355  357\n"
+"CONECT  357  356  358\n"
+"CONECT  358  357  359  364\n"
+"CONECT  359  358  360  361\n"
+"CONECT  360  359\n"
+"CONECT  361  359  362\n"
+"CONECT  362  361  363\n"
+"CONECT  363  362  364\n"
+"CONECT  364  355  358  363\n"
+"CONECT  365  352  366  367  368\n"
+"CONECT  366  365\n"
+"CONECT  367  365\n"
+"CONECT  368  365  369\n"
+"CONECT  369  368  370\n"
+"CONECT  370  369  371  372\n"
+"CONECT  371  370  375\n"
+"CONECT  372  370  373  374\n"
+"CONECT  373  372  385\n"
+"CONECT  374  372  375\n"
+"CONECT  375  371  374  376\n"
+"CONECT  376  375  377  384\n"
+"CONECT  377  376  378  379\n"
+"CONECT  378  377\n"
+"CONECT  379  377  380\n"
+"CONECT  380  379  381  382\n"
+"CONECT  381  380\n"
+"CONECT  382  380  383  384\n"
+"CONECT  383  382\n"
+"CONECT  384  376  382\n"
+"CONECT  385  373  386  387  388\n"
+"CONECT  386  385\n"
+"CONECT  387  385\n"
+"CONECT  388  385  389\n"
+"CONECT  389  388  390\n"
+"CONECT  390  389  391  392\n"
+"CONECT  391  390  395\n"
+"CONECT  392  390  393  394\n"
+"CONECT  393  392  405\n"
+"CONECT  394  392  395\n"
+"CONECT  395  391  394  396\n"
+"CONECT  396  395  397  404\n"
+"CONECT  397  396  398  399\n"
+"CONECT  398  397\n"
+"CONECT  399  397  400\n"
+"CONECT  400  399  401  402\n"
+"CONECT  401  400\n"
+"CONECT  402  400  403  404\n"
+"CONECT  403  402\n"
+"CONECT  404  396  402\n"
+"CONECT  405  393  406  407  408\n"
+"CONECT  406  405\n"
+"CONECT  407  405\n"
+"CONECT  408  405  409\n"
+"CONECT  409  408  410\n"
+"CONECT  410  409  411  412\n"
+"CONECT  411  410  415\n"
+"CONECT  412  410  413  414\n"
+"CONECT  413  412  424\n"
+"CONECT  414  412  415\n"
+"CONECT  415  411  414  416\n"
+"CONECT  416  415  417  423\n"
+"CONECT  417  416  418  419\n"
+"CONECT  418  417\n"
+"CONECT  419  417  420\n"
+"CONECT  420  419  421  422\n"
+"CONECT  421  420\n"
+"CONECT  422  420  423\n"
+"CONECT  423  416  422\n"
+"CONECT  424  413  425  426  427\n"
+"CONECT  425  424\n"
+"CONECT  426  424\n"
+"CONECT  427  424  428\n"
+"CONECT  428  427  429\n"
+"CONECT  429  428  430  431\n"
+"CONECT  430  429  434\n"
+"CONECT  431  429  432  433\n"
+"CONECT  432  431  446\n"
+"CONECT  433  431  434\n"
+"CONECT  434  430  433  435\n"
+"CONECT  435  434  436  445\n"
+"CONECT  436  435  437\n"
+"CONECT  437  436  438\n"
+"CONECT  438  437  439  445\n"
+"CONECT  439  438  440  441\n"
+"CONECT  440  439\n"
+"CONECT  441  439  442\n"
+"CONECT  442  441  443  444\n"
+"CONECT  443  442\n"
+"CONECT  444  442  445\n"
+"CONECT  445  435  438  444\n"
+"CONECT  446  432  447  448  449\n"
+"CONECT  447  446\n"
+"CONECT  448  446\n"
+"CONECT  449  446  450\n"
+"CONECT  450  449  451\n"
+"CONECT  451  450  452  453\n"
+"CONECT  452  451  456\n"
+"CONECT  453  451  454  455\n"
+"CONECT  454  453  465\n"
+"CONECT  455  453  456\n"
+"CONECT  456  452  455  457\n"
+"CONECT  457  456  458  464\n"
+"CONECT  458  457  459  460\n"
+"CONECT  459  458\n"
+"CONECT  460  458  461\n"
+"CONECT  461  460  462  463\n"
+"CONECT  462  461\n"
+"CONECT  463  461  464\n"
+"CONECT  464  457  463\n"
+"CONECT  465  454  466  467  468\n"
+"CONECT  466  465\n"
+"CONECT  467  465\n"
+"CONECT  468  465  469\n"
+"CONECT  469  468  470\n"
+"CONECT  470  469  471  472\n"
+"CONECT  471  470  475\n"
+"CONECT  472  470  473  474\n"
+"CONECT  473  472\n"
+"CONECT  474  472  475\n"
+"CONECT  475  471  474  476\n"
+"CONECT  476  475  477  486\n"
+"CONECT  477  476  478\n"
+"CONECT  478  477  479\n"
+"CONECT  479  478  480  486\n"
+"CONECT  480  479  481  482\n"
+"CONECT  481  480\n"
+"CONECT  482  480  483\n"
+"CONECT  483  482  484  485\n"
+"CONECT  484  483\n"
+"CONECT  485  483  486\n"
+"CONECT  486  476  479  485\n"
+"END\n"
+,
+"HEADER    Dodecahedrane\n"
+"COMPND    al3056\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Sun Sep  3 10:20:00 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.540   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.016   1.465   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       0.771   2.369   0.000  1.00  0.00 \n"
+"HETATM    5  C           1      -0.476   1.465   0.000  1.00  0.00 \n"
+"HETATM    6  C           1      -0.476  -0.655   1.309  1.00  0.00 \n"
+"HETATM    7  C           1      -1.246   0.404   2.118  1.00  0.00 \n"
+"HETATM    8  C           1      -1.246   1.714   1.309  1.00  0.00 \n"
+"HETATM    9  C           1      -0.476   2.774   2.119  1.00  0.00 \n"
+"HETATM   10  C           1       0.770   3.179   1.310  1.00  0.00 \n"
+"HETATM   11  C           1       2.016   2.774   2.120  1.00  0.00 \n"
+"HETATM   12  C           1       2.786   1.715   1.310  1.00  0.00 \n"
+"HETATM   13  C           1       2.785   0.405   2.120  1.00  0.00 \n"
+"HETATM   14  C           1       2.016  -0.655   1.310  1.00  0.00 \n"
+"HETATM   15  C           1       0.769  -1.059   2.118  1.00  0.00 \n"
+"HETATM   16  C           1       0.770  -0.250   3.428  1.00  0.00 \n"
+"HETATM   17  C           1      -0.476   0.655   3.428  1.00  0.00 \n"
+"HETATM   18  C           1       2.015   0.656   3.429  1.00  0.00 \n"
+"HETATM   19  C           1       0.000   2.119   3.428  1.00  0.00 \n"
+"HETATM   20  C           1       1.539   2.119   3.428  1.00  0.00 \n"
+"HETATM   21  H           1      -0.389  -0.536  -0.866  1.00  0.00 \n"
+"HETATM   22  H           1       1.929  -0.535  -0.866  1.00  0.00 \n"
+"HETATM   23  H           1       2.645   1.669  -0.866  1.00  0.00 \n"
+"HETATM   24  H           1       0.771   3.031  -0.867  1.00  0.00 \n"
+"HETATM   25  H           1      -1.105   1.670  -0.867  1.00  0.00 \n"
+"HETATM   26  H           1      -1.105  -1.521   1.105  1.00  0.00 \n"
+"HETATM   27  H           1      -2.264   0.073   2.321  1.00  0.00 \n"
+"HETATM   28  H           1      -2.264   2.044   1.104  1.00  0.00 \n"
+"HETATM   29  H           1      -1.105   3.639   2.324  1.00  0.00 \n"
+"HETATM   30  H           1       0.771   4.249   1.105  1.00  0.00 \n"
+"HETATM   31  H           1       2.645   3.640   2.327  1.00  0.00 \n"
+"HETATM   32  H           1       3.804   2.046   1.106  1.00  0.00 \n"
+"HETATM   33  H           1       3.803   0.073   2.325  1.00  0.00 \n"
+"HETATM   34  H           1       2.645  -1.522   1.106  1.00  0.00 \n"
+"HETATM   35  H           1       0.769  -2.130   2.322  1.00  0.00 \n"
+"HETATM   36  H           1       0.771  -0.912   4.294  1.00  0.00 \n"
+"HETATM   37  H           1      -1.106   0.451   4.294  1.00  0.00 \n"
+"HETATM   38  H           1       2.644   0.453   4.295  1.00  0.00 \n"
+"HETATM   39  H           1      -0.387   2.655   4.295  1.00  0.00 \n"
+"HETATM   40  H           1       1.928   2.654   4.295  1.00  0.00 \n"
+"CONECT    1    2    5    6   21\n"
+"CONECT    2    1    3   14   22\n"
+"CONECT    3    2    4   12   23\n"
+"CONECT    4    3    5   10   24\n"
+"CONECT    5    1    4    8   25\n"
+"CONECT    6    1    7   15   26\n"
+"CONECT    7    6    8   17   27\n"
+"CONECT    8    5    7    9   28\n"
+"CONECT    9    8   10   19   29\n"
+"CONECT   10    4    9   11   30\n"
+"CONECT   11   10   12   20   31\n"
+"CONECT   12    3   11   13   32\n"
+"CONECT   13   12   14   18   33\n"
+"CONECT   14    2   13   15   34\n"
+"CONECT   15    6   14   16   35\n"
+"CONECT   16   15   17   18   36\n"
+"CONECT   17    7   16   19   37\n"
+"CONECT   18   13   16   20   38\n"
+"CONECT   19    9   17   20   39\n"
+"CONECT   20   11   18   19   40\n"
+"CONECT   21    1\n"
+"CONECT   22    2\n"
+"CONECT   23    3\n"
+"CONECT   24    4\n"
+"CONECT   25    5\n"
+"CONECT   26    6\n"
+"CONECT   27    7\n"
+"CONECT   28    8\n"
+"CONECT   29    9\n"
+"CONECT   30   10\n"
+"CONECT   31   11\n"
+"CONECT   32   12\n"
+"CONECT   33   13\n"
+"CONECT   34   14\n"
+"CONECT   35   15\n"
+"CONECT   36   16\n"
+"CONECT   37   17\n"
+"CONECT   38   18\n"
+"CONECT   39   19\n"
+"CONECT   40   20\n"
+"MASTER        0    0    0    0    0    0    0    0   40    0   40    0\n"
+"END\n"
+,
+"HEADER    Tetrahydrocannabinol: Delta 9-THC, an hallucinogen\n"
+"ATOM      1  O   UNK     0      -1.791  -1.420   0.434\n"
+"ATOM      2  C   UNK     0      -0.536  -1.012   0.033\n"
+"ATOM      3  C   UNK     0       0.565  -1.346   0.828\n"
+"ATOM      4  C   UNK     0       1.855  -0.978   0.446\n"
+"ATOM      5  C   UNK     0       2.038  -0.295  -0.757\n"
+"ATOM      6  C   UNK     0       0.940   0.052  -1.556\n"
+"ATOM      7  C   UNK     0      -0.363  -0.272  -1.148\n"
+"ATOM      8  C   UNK     0      -1.599   0.113  -1.985\n"
+"ATOM      9  C   UNK     0      -1.568   1.523  -2.537\n"
+"ATOM     10  C   UNK     0      -2.681   2.231  -2.781\n"
+"ATOM     11  C   UNK     0      -4.068   1.708  -2.479\n"
+"ATOM     12  C   UNK     0      -4.085   0.222  -2.091\n"
+"ATOM     13  C   UNK     0      -2.892  -0.061  -1.162\n"
+"ATOM     14  C   UNK     0      -2.908  -1.421  -0.435\n"
+"ATOM     15  O   UNK     0       1.151   0.702  -2.747\n"
+"ATOM     16  C   UNK     0      -2.610   3.628  -3.338\n"
+"ATOM     17  C   UNK     0      -2.824  -2.642  -1.364\n"
+"ATOM     18  C   UNK     0      -4.125  -1.570   0.485\n"
+"ATOM     19  C   UNK     0       3.056  -1.332   1.325\n"
+"ATOM     20  C   UNK     0       3.365  -0.156   2.260\n"
+"ATOM     21  C   UNK     0       4.569  -0.467   3.158\n"
+"ATOM     22  C   UNK     0       4.872   0.726   4.074\n"
+"ATOM     23  C   UNK     0       6.079   0.425   4.969\n"
+"ATOM     24  H   UNK     0       0.400  -1.896   1.747\n"
+"ATOM     25  H   UNK     0      -1.626  -0.566  -2.849\n"
+"ATOM     26  H   UNK     0      -4.720   1.866  -3.352\n"
+"ATOM     27  H   UNK     0      -4.004  -0.399  -2.997\n"
+"ATOM     28  H   UNK     0       2.079   0.837  -2.898\n"
+"ATOM     29  H   UNK     0      -3.163   4.315  -2.681\n"
+"ATOM     30  H   UNK     0      -2.839  -3.562  -0.762\n"
+"ATOM     31  H   UNK     0      -3.995  -2.460   1.119\n"
+"ATOM     32  H   UNK     0      -4.210  -0.687   1.134\n"
+"ATOM     33  H   UNK     0       2.828  -2.232   1.917\n"
+"ATOM     34  H   UNK     0       2.480   0.048   2.884\n"
+"ATOM     35  H   UNK     0       4.349  -1.356   3.772\n"
+"ATOM     36  H   UNK     0       3.994   0.938   4.706\n"
+"ATOM     37  H   UNK     0       6.286   1.290   5.618\n"
+"ATOM     38  H   UNK     0       3.036  -0.022  -1.076\n"
+"ATOM     39  H   UNK     0      -0.602   1.973  -2.755\n"
+"ATOM     40  H   UNK     0      -5.037  -0.005  -1.590\n"
+"ATOM     41  H   UNK     0      -2.881   0.709  -0.374\n"
+"ATOM     42  H   UNK     0      -1.565   3.966  -3.407\n"
+"ATOM     43  H   UNK     0      -3.058   3.644  -4.342\n"
+"ATOM     44  H   UNK     0      -1.884  -2.619  -1.933\n"
+"ATOM     45  H   UNK     0      -3.674  -2.652  -2.061\n"
+"ATOM     46  H   UNK     0      -5.048  -1.683  -0.102\n"
+"ATOM     47  H   UNK     0       3.928  -1.546   0.687\n"
+"ATOM     48  H   UNK     0       3.578   0.739   1.654\n"
+"ATOM     49  H   UNK     0       5.449  -0.681   2.531\n"
+"ATOM     50  H   UNK     0       5.086   1.616   3.462\n"
+"ATOM     51  H   UNK     0       5.873  -0.453   5.600\n"
+"ATOM     52  H   UNK     0       6.967   0.224   4.351\n"
+"ATOM     53  H   UNK     0      -4.467   2.295  -1.638\n"
+"CONECT    1    2   14\n"
+"CONECT    2    1    3    7\n"
+"CONECT    3    2    4   24\n"
+"CONECT    4    3    5   19\n"
+"CONECT    5    4    6   38\n"
+"CONECT    6    5    7   15\n"
+"CONECT    7    2    6    8\n"
+"CONECT    8    7    9   13   25\n"
+"CONECT    9    8   10   39\n"
+"CONECT   10    9   11   16\n"
+"CONECT   11   10   12   26   53\n"
+"CONECT   12   11   27   40   13\n"
+"CONECT   13    8   12   41   14\n"
+"CONECT   14    1   13   17   18\n"
+"CONECT   15    6   28\n"
+"CONECT   16   10   29   42   43\n"
+"CONECT   17   14   30   44   45\n"
+"CONECT   18   14   31   32   46\n"
+"CONECT   19    4   20   33   47\n"
+"CONECT   20   19   21   34   48\n"
+"CONECT   21   20   22   35   49\n"
+"CONECT   22   21   23   36   50\n"
+"CONECT   23   22   37   51   52\n"
+"CONECT   24    3\n"
+"CONECT   25    8\n"
+"CONECT   26   11\n"
+"CONECT   27   12\n"
+"CONECT   28   15\n"
+"CONECT   29   16\n"
+"CONECT   30   17\n"
+"CONECT   31   18\n"
+"CONECT   32   18\n"
+"CONECT   33   19\n"
+"CONECT   34   20\n"
+"CONECT   35   21\n"
+"CONECT   36   22\n"
+"CONECT   37   23\n"
+"CONECT   38    5\n"
+"CONECT   39    9\n"
+"CONECT   40   12\n"
+"CONECT   41   13\n"
+"CONECT   42   16\n"
+"CONECT   43   16\n"
+"CONECT   44   17\n"
+"CONECT   45   17\n"
+"CONECT   46   18\n"
+"CONECT   47   19\n"
+"CONECT   48   20\n"
+"CONECT   49   21\n"
+"CONECT   50   22\n"
+"CONECT   51   23\n"
+"CONECT   52   23\n"
+"CONECT   53   11\n"
+,
+"HEADER    Trinitroglycerin: Dynamite, an explosive\n"
+"COMPND    jb09trin\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Tue Sep 19 21:46:02 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.540   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.063   1.449   0.000  1.00  0.00 \n"
+"HETATM    4  O           1       3.467   1.429   0.127  1.00  0.00 \n"
+"HETATM    5  N           1       4.015   2.776  -0.152  1.00  0.00 \n"
+"HETATM    6  O           1       4.998   3.268   0.635  1.00  0.00 \n"
+"HETATM    7  O           1       3.773   3.351  -1.351  1.00  0.00 \n"
+"HETATM    8  O           1       2.004  -0.755   1.098  1.00  0.00 \n"
+"HETATM    9  N           1       2.641  -0.291   2.107  1.00  0.00 \n"
+"HETATM   10  O           1       3.090  -1.154   3.047  1.00  0.00 \n"
+"HETATM   11  O           1       2.879   1.030   2.268  1.00  0.00 \n"
+"HETATM   12  O           1      -0.458  -1.330  -0.079  1.00  0.00 \n"
+"HETATM   13  N           1      -1.911  -1.339  -0.361  1.00  0.00 \n"
+"HETATM   14  O           1      -2.745  -2.029   0.450  1.00  0.00 \n"
+"HETATM   15  O           1      -2.357  -0.902  -1.560  1.00  0.00 \n"
+"HETATM   16  H           1      -0.365   0.561  -0.860  1.00  0.00 \n"
+"HETATM   17  H           1      -0.369   0.458   0.918  1.00  0.00 \n"
+"HETATM   18  H           1       1.886  -0.486  -0.912  1.00  0.00 \n"
+"HETATM   19  H           1       1.620   2.013   0.821  1.00  0.00 \n"
+"HETATM   20  H           1       1.793   1.925  -0.943  1.00  0.00 \n"
+"CONECT    1    2   12   16   17\n"
+"CONECT    2    1    3    8   18\n"
+"CONECT    3    2    4   19   20\n"
+"CONECT    4    3    5\n"
+"CONECT    5    4    6    7\n"
+"CONECT    6    5\n"
+"CONECT    7    5\n"
+"CONECT    8    2    9\n"
+"CONECT    9    8   10   11\n"
+"CONECT   10    9\n"
+"CONECT   11    9\n"
+"CONECT   12    1   13\n"
+"CONECT   13   12   14   15\n"
+"CONECT   14   13\n"
+"CONECT   15   13\n"
+"CONECT   16    1\n"
+"CONECT   17    1\n"
+"CONECT   18    2\n"
+"CONECT   19    3\n"
+"CONECT   20    3\n"
+"MASTER        0    0    0    0    0    0    0    0   20    0   20    0\n"
+"END\n"
+,
+"HEADER    Ethylene Glycol: Ethane-1,2-diol, Anti-freeze\n"
+"COMPND    al2034\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Tue Aug 29 17:54:52 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.542   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  O           1       2.027   1.347   0.000  1.00  0.00 \n"
+"HETATM    4  O           1      -0.485  -1.347  -0.041  1.00  0.00 \n"
+"HETATM    5  H           1      -0.360   0.537  -0.878  1.00  0.00 \n"
+"HETATM    6  H           1      -0.367   0.494   0.900  1.00  0.00 \n"
+"HETATM    7  H           1       1.902  -0.512  -0.893  1.00  0.00 \n"
+"HETATM    8  H           1       1.908  -0.520   0.885  1.00  0.00 \n"
+"HETATM    9  H           1       1.743   1.800   0.802  1.00  0.00 \n"
+"HETATM   10  H           1      -0.202  -1.823   0.747  1.00  0.00 \n"
+"CONECT    1    2    4    5    6\n"
+"CONECT    2    1    3    7    8\n"
+"CONECT    3    2    9\n"
+"CONECT    4    1   10\n"
+"CONECT    5    1\n"
+"CONECT    6    1\n"
+"CONECT    7    2\n"
+"CONECT    8    2\n"
+"CONECT    9    3\n"
+"CONECT   10    4\n"
+"MASTER        0    0    0    0    0    0    0    0   10    0   10    0\n"
+"END\n"
+,
+"HEADER    Guanine: Purine base nucleotide\n"
+"COMPND    jb09guan\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Tue Sep 19 21:46:02 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.392   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.082   1.215   0.000  1.00  0.00 \n"
+"HETATM    4  N           1       1.339   2.346  -0.001  1.00  0.00 \n"
+"HETATM    5  C           1      -0.017   2.313  -0.003  1.00  0.00 \n"
+"HETATM    6  N           1      -0.709   1.149  -0.003  1.00  0.00 \n"
+"HETATM    7  N           1      -0.392  -1.291  -0.028  1.00  0.00 \n"
+"HETATM    8  C           1       0.730  -2.047  -0.044  1.00  0.00 \n"
+"HETATM    9  N           1       1.842  -1.275  -0.028  1.00  0.00 \n"
+"HETATM   10  O           1       3.285   1.253  -0.010  1.00  0.00 \n"
+"HETATM   11  N           1      -0.723   3.523  -0.019  1.00  0.00 \n"
+"HETATM   12  H           1       1.811   3.244  -0.007  1.00  0.00 \n"
+"HETATM   13  H           1      -1.347  -1.629  -0.048  1.00  0.00 \n"
+"HETATM   14  H           1       0.738  -3.137  -0.077  1.00  0.00 \n"
+"HETATM   15  H           1      -1.640   3.377  -0.427  1.00  0.00 \n"
+"HETATM   16  H           1      -0.213   4.205  -0.570  1.00  0.00 \n"
+"CONECT    1    2    2    6    7\n"
+"CONECT    2    1    1    3    9\n"
+"CONECT    3    2    4   10   10\n"
+"CONECT    4    3    5   12\n"
+"CONECT    5    4    6    6   11\n"
+"CONECT    6    1    5    5\n"
+"CONECT    7    1    8   13\n"
+"CONECT    8    7    9    9   14\n"
+"CONECT    9    2    8    8\n"
+"CONECT   10    3    3\n"
+"CONECT   11    5   15   16\n"
+"CONECT   12    4\n"
+"CONECT   13    7\n"
+"CONECT   14    8\n"
+"CONECT   15   11\n"
+"CONECT   16   11\n"
+"MASTER        0    0    0    0    0    0    0    0   16    0   16    0\n"
+"END\n"
+,
+"HEADER    Diacetylmorphine: Heroin, an opiate\n"
+"COMPND    al3084\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.400   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.108   1.210   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.452   2.447  -0.065  1.00  0.00 \n"
+"HETATM    5  C           1       0.055   2.457  -0.018  1.00  0.00 \n"
+"HETATM    6  C           1      -0.624   1.244   0.041  1.00  0.00 \n"
+"HETATM    7  C           1      -2.081   1.501  -0.201  1.00  0.00 \n"
+"HETATM    8  C           1      -2.725   0.343  -0.973  1.00  0.00 \n"
+"HETATM    9  C           1      -2.367  -0.953  -0.210  1.00  0.00 \n"
+"HETATM   10  C           1      -0.836  -1.236  -0.253  1.00  0.00 \n"
+"HETATM   11  C           1      -1.913   2.852  -0.934  1.00  0.00 \n"
+"HETATM   12  C           1      -2.752   1.623   1.177  1.00  0.00 \n"
+"HETATM   13  C           1      -2.503   0.306   1.943  1.00  0.00 \n"
+"HETATM   14  N           1      -2.936  -0.856   1.147  1.00  0.00 \n"
+"HETATM   15  C           1      -2.820  -2.103   1.920  1.00  0.00 \n"
+"HETATM   16  H           1      -3.807   0.473  -0.972  1.00  0.00 \n"
+"HETATM   17  C           1      -2.256   0.283  -2.408  1.00  0.00 \n"
+"HETATM   18  C           1      -1.948   1.398  -3.085  1.00  0.00 \n"
+"HETATM   19  C           1      -1.494   2.675  -2.413  1.00  0.00 \n"
+"HETATM   20  H           1      -2.820   3.452  -0.859  1.00  0.00 \n"
+"HETATM   21  O           1      -0.799   3.480  -0.318  1.00  0.00 \n"
+"HETATM   22  H           1      -1.885   3.520  -2.982  1.00  0.00 \n"
+"HETATM   23  O           1      -0.083   2.674  -2.462  1.00  0.00 \n"
+"HETATM   24  O           1       2.142   3.620  -0.142  1.00  0.00 \n"
+"HETATM   25  H           1       1.942  -0.945  -0.044  1.00  0.00 \n"
+"HETATM   26  H           1       3.198   1.180  -0.006  1.00  0.00 \n"
+"HETATM   27  H           1      -2.866  -1.782  -0.712  1.00  0.00 \n"
+"HETATM   28  H           1      -0.588  -1.599  -1.250  1.00  0.00 \n"
+"HETATM   29  H           1      -0.574  -2.010   0.465  1.00  0.00 \n"
+"HETATM   30  H           1      -3.823   1.785   1.052  1.00  0.00 \n"
+"HETATM   31  H           1      -2.320   2.456   1.731  1.00  0.00 \n"
+"HETATM   32  H           1      -3.068   0.334   2.874  1.00  0.00 \n"
+"HETATM   33  H           1      -1.444   0.211   2.184  1.00  0.00 \n"
+"HETATM   34  H           1      -3.492  -2.057   2.778  1.00  0.00 \n"
+"HETATM   35  H           1      -1.799  -2.234   2.280  1.00  0.00 \n"
+"HETATM   36  H           1      -3.099  -2.953   1.298  1.00  0.00 \n"
+"HETATM   37  H           1      -2.414  -0.639  -2.967  1.00  0.00 \n"
+"HETATM   38  H           1      -1.797   1.313  -4.161  1.00  0.00 \n"
+"HETATM   39  C           1       3.076   3.567  -1.091  1.00  0.00 \n"
+"HETATM   40  O           1       2.786   3.826  -2.230  1.00  0.00 \n"
+"HETATM   41  C           1       4.523   3.509  -0.695  1.00  0.00 \n"
+"HETATM   42  H           1       5.012   2.691  -1.224  1.00  0.00 \n"
+"HETATM   43  H           1       4.600   3.345   0.380  1.00  0.00 \n"
+"HETATM   44  H           1       5.008   4.450  -0.954  1.00  0.00 \n"
+"HETATM   45  C           1       0.390   3.733  -3.117  1.00  0.00 \n"
+"HETATM   46  O           1       0.845   3.595  -4.223  1.00  0.00 \n"
+"HETATM   47  C           1       0.417   5.083  -2.459  1.00  0.00 \n"
+"HETATM   48  H           1       1.199   5.692  -2.913  1.00  0.00 \n"
+"HETATM   49  H           1       0.619   4.970  -1.395  1.00  0.00 \n"
+"HETATM   50  H           1      -0.547   5.574  -2.594  1.00  0.00 \n"
+"CONECT    1    2    2    6   10\n"
+"CONECT    2    1    1    3   25\n"
+"CONECT    3    2    4    4   26\n"
+"CONECT    4    3    3    5   24\n"
+"CONECT    5    4    6    6   21\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8   11   12\n"
+"CONECT    8    7    9   16   17\n"
+"CONECT    9    8   10   14   27\n"
+"CONECT   10    1    9   28   29\n"
+"CONECT   11    7   19   20   21\n"
+"CONECT   12    7   13   30   31\n"
+"CONECT   13   12   14   32   33\n"
+"CONECT   14    9   13   15\n"
+"CONECT   15   14   34   35   36\n"
+"CONECT   16    8\n"
+"CONECT   17    8   18   18   37\n"
+"CONECT   18   17   17   19   38\n"
+"CONECT   19   11   18   22   23\n"
+"CONECT   20   11\n"
+"CONECT   21    5   11\n"
+"CONECT   22   19\n"
+"CONECT   23   19   45\n"
+"CONECT   24    4   39\n"
+"CONECT   25    2\n"
+"CONECT   26    3\n"
+"CONECT   27    9\n"
+"CONECT   28   10\n"
+"CONECT   29   10\n"
+"CONECT   30   12\n"
+"CONECT   31   12\n"
+"CONECT   32   13\n"
+"CONECT   33   13\n"
+"CONECT   34   15\n"
+"CONECT   35   15\n"
+"CONECT   36   15\n"
+"CONECT   37   17\n"
+"CONECT   38   18\n"
+"CONECT   39   24   40   40   41\n"
+"CONECT   40   39   39\n"
+"CONECT   41   39   42   43   44\n"
+"CONECT   42   41\n"
+"CONECT   43   41\n"
+"CONECT   44   41\n"
+"CONECT   45   23   46   46   47\n"
+"CONECT   46   45   45\n"
+"CONECT   47   45   48   49   50\n"
+"CONECT   48   47\n"
+"CONECT   49   47\n"
+"CONECT   50   47\n"
+"MASTER        0    0    0    0    0    0    0    0   50    0   50    0\n"
+"END\n"
+,
+"COMPND    Hexahelicene\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.404   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.104   1.206   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.402   2.413  -0.064  1.00  0.00 \n"
+"HETATM    5  C           1       0.002   2.407  -0.063  1.00  0.00 \n"
+"HETATM    6  C           1      -0.705   1.209   0.071  1.00  0.00 \n"
+"HETATM    7  C           1      -2.102   1.180   0.220  1.00  0.00 \n"
+"HETATM    8  C           1      -2.847   2.295   0.643  1.00  0.00 \n"
+"HETATM    9  C           1      -4.192   2.360   0.266  1.00  0.00 \n"
+"HETATM   10  C           1      -4.858   1.229  -0.190  1.00  0.00 \n"
+"HETATM   11  C           1      -4.166   0.012  -0.273  1.00  0.00 \n"
+"HETATM   12  C           1      -2.782  -0.001  -0.086  1.00  0.00 \n"
+"HETATM   13  C           1      -2.082  -1.204  -0.224  1.00  0.00 \n"
+"HETATM   14  C           1      -0.685  -1.210  -0.107  1.00  0.00 \n"
+"HETATM   15  C           1      -2.318   3.332   1.420  1.00  0.00 \n"
+"HETATM   16  C           1      -1.206   3.177   2.264  1.00  0.00 \n"
+"HETATM   17  C           1      -0.519   4.289   2.729  1.00  0.00 \n"
+"HETATM   18  C           1      -1.052   5.582   2.503  1.00  0.00 \n"
+"HETATM   19  C           1      -2.286   5.716   1.895  1.00  0.00 \n"
+"HETATM   20  C           1      -2.936   4.583   1.371  1.00  0.00 \n"
+"HETATM   21  C           1      -4.216   4.717   0.815  1.00  0.00 \n"
+"HETATM   22  C           1      -4.881   3.585   0.350  1.00  0.00 \n"
+"HETATM   23  C           1      -0.789   1.905   2.707  1.00  0.00 \n"
+"HETATM   24  C           1       0.400   1.759   3.421  1.00  0.00 \n"
+"HETATM   25  C           1       1.155   2.887   3.765  1.00  0.00 \n"
+"HETATM   26  C           1       0.669   4.165   3.443  1.00  0.00 \n"
+"HETATM   27  H           1       1.945  -0.947  -0.019  1.00  0.00 \n"
+"HETATM   28  H           1       3.191   1.206  -0.002  1.00  0.00 \n"
+"HETATM   29  H           1       1.942   3.359  -0.131  1.00  0.00 \n"
+"HETATM   30  H           1      -0.523   3.350  -0.198  1.00  0.00 \n"
+"HETATM   31  H           1      -5.918   1.264  -0.433  1.00  0.00 \n"
+"HETATM   32  H           1      -4.698  -0.901  -0.555  1.00  0.00 \n"
+"HETATM   33  H           1      -2.617  -2.140  -0.409  1.00  0.00 \n"
+"HETATM   34  H           1      -0.142  -2.150  -0.180  1.00  0.00 \n"
+"HETATM   35  H           1      -0.520   6.457   2.886  1.00  0.00 \n"
+"HETATM   36  H           1      -2.751   6.690   1.806  1.00  0.00 \n"
+"HETATM   37  H           1      -4.715   5.680   0.815  1.00  0.00 \n"
+"HETATM   38  H           1      -5.917   3.654   0.008  1.00  0.00 \n"
+"HETATM   39  H           1      -1.407   1.021   2.524  1.00  0.00 \n"
+"HETATM   40  H           1       0.734   0.774   3.725  1.00  0.00 \n"
+"HETATM   41  H           1       2.090   2.777   4.328  1.00  0.00 \n"
+"HETATM   42  H           1       1.225   5.042   3.772  1.00  0.00 \n"
+"CONECT    1    2    2    6   14\n"
+"CONECT    2    1    1    3   27\n"
+"CONECT    3    2    4    4   28\n"
+"CONECT    4    3    3    5   29\n"
+"CONECT    5    4    6    6   30\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8    8   12\n"
+"CONECT    8    7    7    9   15\n"
+"CONECT    9    8   10   10   22\n"
+"CONECT   10    9    9   11   31\n"
+"CONECT   11   10   12   12   32\n"
+"CONECT   12    7   11   11   13\n"
+"CONECT   13   12   14   14   33\n"
+"CONECT   14    1   13   13   34\n"
+"CONECT   15    8   16   16   20\n"
+"CONECT   16   15   15   17   23\n"
+"CONECT   17   16   18   18   26\n"
+"CONECT   18   17   17   19   35\n"
+"CONECT   19   18   20   20   36\n"
+"CONECT   20   15   19   19   21\n"
+"CONECT   21   20   22   22   37\n"
+"CONECT   22    9   21   21   38\n"
+"CONECT   23   16   24   24   39\n"
+"CONECT   24   23   23   25   40\n"
+"CONECT   25   24   26   26   41\n"
+"CONECT   26   17   25   25   42\n"
+"CONECT   27    2\n"
+"CONECT   28    3\n"
+"CONECT   29    4\n"
+"CONECT   30    5\n"
+"CONECT   31   10\n"
+"CONECT   32   11\n"
+"CONECT   33   13\n"
+"CONECT   34   14\n"
+"CONECT   35   18\n"
+"CONECT   36   19\n"
+"CONECT   37   21\n"
+"CONECT   38   22\n"
+"CONECT   39   23\n"
+"CONECT   40   24\n"
+"CONECT   41   25\n"
+"CONECT   42   26\n"
+"MASTER        0    0    0    0    0    0    0    0   42    0   42    0\n"
+"END\n"
+,
+"HEADER    Ibuprofen: Advil/Motrin, an anti-inflammatory\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.399   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.098   1.212   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.391   2.419   0.004  1.00  0.00 \n"
+"HETATM    5  C           1      -0.008   2.417   0.005  1.00  0.00 \n"
+"HETATM    6  C           1      -0.712   1.206  -0.003  1.00  0.00 \n"
+"HETATM    7  C           1      -2.224   1.136  -0.009  1.00  0.00 \n"
+"HETATM    8  C           1      -2.900   2.504  -0.232  1.00  0.00 \n"
+"HETATM    9  C           1       3.611   1.210  -0.042  1.00  0.00 \n"
+"HETATM   10  C           1       4.094   0.909  -1.477  1.00  0.00 \n"
+"HETATM   11  C           1       5.635   0.868  -1.503  1.00  0.00 \n"
+"HETATM   12  C           1       3.590   1.996  -2.450  1.00  0.00 \n"
+"HETATM   13  C           1      -2.686   0.573   1.305  1.00  0.00 \n"
+"HETATM   14  O           1      -3.846   0.297   1.466  1.00  0.00 \n"
+"HETATM   15  O           1      -1.792   0.321   2.277  1.00  0.00 \n"
+"HETATM   16  H           1      -0.539  -0.948  -0.004  1.00  0.00 \n"
+"HETATM   17  H           1       1.943  -0.945  -0.009  1.00  0.00 \n"
+"HETATM   18  H           1       1.930   3.366  -0.006  1.00  0.00 \n"
+"HETATM   19  H           1      -0.533   3.371   0.004  1.00  0.00 \n"
+"HETATM   20  H           1      -2.536   0.461  -0.807  1.00  0.00 \n"
+"HETATM   21  H           1      -2.546   2.944  -1.165  1.00  0.00 \n"
+"HETATM   22  H           1      -2.676   3.171   0.600  1.00  0.00 \n"
+"HETATM   23  H           1      -3.980   2.365  -0.292  1.00  0.00 \n"
+"HETATM   24  H           1       3.986   0.442   0.635  1.00  0.00 \n"
+"HETATM   25  H           1       3.990   2.181   0.277  1.00  0.00 \n"
+"HETATM   26  H           1       3.707  -0.061  -1.792  1.00  0.00 \n"
+"HETATM   27  H           1       5.991   0.094  -0.823  1.00  0.00 \n"
+"HETATM   28  H           1       6.034   1.834  -1.192  1.00  0.00 \n"
+"HETATM   29  H           1       5.978   0.645  -2.513  1.00  0.00 \n"
+"HETATM   30  H           1       3.941   2.975  -2.122  1.00  0.00 \n"
+"HETATM   31  H           1       2.500   1.993  -2.477  1.00  0.00 \n"
+"HETATM   32  H           1       3.970   1.793  -3.451  1.00  0.00 \n"
+"HETATM   33  H           1      -1.689  -0.648   2.383  1.00  0.00 \n"
+"CONECT    1    2    2    6   16\n"
+"CONECT    2    1    1    3   17\n"
+"CONECT    3    2    4    4    9\n"
+"CONECT    4    3    3    5   18\n"
+"CONECT    5    4    6    6   19\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8   13   20\n"
+"CONECT    8    7   21   22   23\n"
+"CONECT    9    3   10   24   25\n"
+"CONECT   10    9   11   12   26\n"
+"CONECT   11   10   27   28   29\n"
+"CONECT   12   10   30   31   32\n"
+"CONECT   13    7   14   14   15\n"
+"CONECT   14   13   13\n"
+"CONECT   15   13   33\n"
+"CONECT   16    1\n"
+"CONECT   17    2\n"
+"CONECT   18    4\n"
+"CONECT   19    5\n"
+"CONECT   20    7\n"
+"CONECT   21    8\n"
+"CONECT   22    8\n"
+"CONECT   23    8\n"
+"CONECT   24    9\n"
+"CONECT   25    9\n"
+"CONECT   26   10\n"
+"CONECT   27   11\n"
+"CONECT   28   11\n"
+"CONECT   29   11\n"
+"CONECT   30   12\n"
+"CONECT   31   12\n"
+"CONECT   32   12\n"
+"CONECT   33   15\n"
+"MASTER        0    0    0    0    0    0    0    0   33    0   33    0\n"
+"END\n"
+,
+"HEADER    Lysergic acid diethylamide, a potent hallucinogen\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.397   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.012   1.258   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.246   2.433  -0.052  1.00  0.00 \n"
+"HETATM    5  C           1      -0.155   2.405  -0.125  1.00  0.00 \n"
+"HETATM    6  C           1      -0.773   1.155  -0.096  1.00  0.00 \n"
+"HETATM    7  N           1      -2.065   0.769  -0.378  1.00  0.00 \n"
+"HETATM    8  C           1      -2.092  -0.602  -0.503  1.00  0.00 \n"
+"HETATM    9  C           1      -0.810  -1.103  -0.242  1.00  0.00 \n"
+"HETATM   10  C           1      -0.159  -2.415  -0.700  1.00  0.00 \n"
+"HETATM   11  C           1       1.178  -2.555   0.075  1.00  0.00 \n"
+"HETATM   12  C           1       2.056  -1.321  -0.019  1.00  0.00 \n"
+"HETATM   13  H           1       0.916  -2.675   1.126  1.00  0.00 \n"
+"HETATM   14  N           1       1.899  -3.768  -0.346  1.00  0.00 \n"
+"HETATM   15  C           1       3.394  -1.430   0.057  1.00  0.00 \n"
+"HETATM   16  C           1       4.101  -2.765   0.134  1.00  0.00 \n"
+"HETATM   17  C           1       3.115  -3.899   0.470  1.00  0.00 \n"
+"HETATM   18  H           1       4.565  -2.960  -0.830  1.00  0.00 \n"
+"HETATM   19  C           1       5.121  -2.704   1.237  1.00  0.00 \n"
+"HETATM   20  O           1       4.720  -2.413   2.335  1.00  0.00 \n"
+"HETATM   21  N           1       6.434  -3.000   1.089  1.00  0.00 \n"
+"HETATM   22  C           1       7.305  -2.925   2.274  1.00  0.00 \n"
+"HETATM   23  C           1       7.755  -4.340   2.686  1.00  0.00 \n"
+"HETATM   24  C           1       7.047  -3.307  -0.215  1.00  0.00 \n"
+"HETATM   25  C           1       6.736  -4.755  -0.646  1.00  0.00 \n"
+"HETATM   26  H           1       3.094   1.350   0.014  1.00  0.00 \n"
+"HETATM   27  H           1       1.757   3.398  -0.079  1.00  0.00 \n"
+"HETATM   28  H           1      -0.732   3.319  -0.249  1.00  0.00 \n"
+"HETATM   29  H           1      -2.858   1.432  -0.658  1.00  0.00 \n"
+"HETATM   30  H           1      -2.917  -1.177  -0.924  1.00  0.00 \n"
+"HETATM   31  H           1       0.025  -2.349  -1.772  1.00  0.00 \n"
+"HETATM   32  H           1      -0.811  -3.260  -0.484  1.00  0.00 \n"
+"HETATM   33  H           1       4.015  -0.538   0.044  1.00  0.00 \n"
+"HETATM   34  H           1       2.844  -3.840   1.524  1.00  0.00 \n"
+"HETATM   35  H           1       3.586  -4.865   0.286  1.00  0.00 \n"
+"HETATM   36  H           1       6.768  -2.468   3.105  1.00  0.00 \n"
+"HETATM   37  H           1       8.181  -2.318   2.047  1.00  0.00 \n"
+"HETATM   38  H           1       8.376  -4.772   1.903  1.00  0.00 \n"
+"HETATM   39  H           1       6.879  -4.969   2.844  1.00  0.00 \n"
+"HETATM   40  H           1       8.332  -4.283   3.609  1.00  0.00 \n"
+"HETATM   41  H           1       8.129  -3.199  -0.132  1.00  0.00 \n"
+"HETATM   42  H           1       6.693  -2.606  -0.971  1.00  0.00 \n"
+"HETATM   43  H           1       5.663  -4.894  -0.765  1.00  0.00 \n"
+"HETATM   44  H           1       7.103  -5.451   0.107  1.00  0.00 \n"
+"HETATM   45  H           1       7.230  -4.962  -1.595  1.00  0.00 \n"
+"HETATM   46  C           1       2.198  -3.813  -1.786  1.00  0.00 \n"
+"HETATM   47  H           1       2.586  -2.854  -2.128  1.00  0.00 \n"
+"HETATM   48  H           1       1.292  -4.053  -2.342  1.00  0.00 \n"
+"HETATM   49  H           1       2.936  -4.591  -1.982  1.00  0.00 \n"
+"CONECT    1    2    2    6    9\n"
+"CONECT    2    1    1    3   12\n"
+"CONECT    3    2    4    4   26\n"
+"CONECT    4    3    3    5   27\n"
+"CONECT    5    4    6    6   28\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8   29\n"
+"CONECT    8    7    9    9   30\n"
+"CONECT    9    1    8    8   10\n"
+"CONECT   10    9   11   31   32\n"
+"CONECT   11   10   12   13   14\n"
+"CONECT   12    2   11   15   15\n"
+"CONECT   13   11\n"
+"CONECT   14   11   17   46\n"
+"CONECT   15   12   12   16   33\n"
+"CONECT   16   15   17   18   19\n"
+"CONECT   17   14   16   34   35\n"
+"CONECT   18   16\n"
+"CONECT   19   16   20   20   21\n"
+"CONECT   20   19   19\n"
+"CONECT   21   19   22   24\n"
+"CONECT   22   21   23   36   37\n"
+"CONECT   23   22   38   39   40\n"
+"CONECT   24   21   25   41   42\n"
+"CONECT   25   24   43   44   45\n"
+"CONECT   26    3\n"
+"CONECT   27    4\n"
+"CONECT   28    5\n"
+"CONECT   29    7\n"
+"CONECT   30    8\n"
+"CONECT   31   10\n"
+"CONECT   32   10\n"
+"CONECT   33   15\n"
+"CONECT   34   17\n"
+"CONECT   35   17\n"
+"CONECT   36   22\n"
+"CONECT   37   22\n"
+"CONECT   38   23\n"
+"CONECT   39   23\n"
+"CONECT   40   23\n"
+"CONECT   41   24\n"
+"CONECT   42   24\n"
+"CONECT   43   25\n"
+"CONECT   44   25\n"
+"CONECT   45   25\n"
+"CONECT   46   14   47   48   49\n"
+"CONECT   47   46\n"
+"CONECT   48   46\n"
+"CONECT   49   46\n"
+"MASTER        0    0    0    0    0    0    0    0   49    0   49    0\n"
+"END\n"
+,
+"HEADER    Menthol: Mentha arvensis oil\n"
+"COMPND    menthol\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  O           1       1.431   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1      -0.501   1.458   0.000  1.00  0.00 \n"
+"HETATM    4  C           1      -2.042   1.485  -0.004  1.00  0.00 \n"
+"HETATM    5  C           1      -2.576   0.746   1.240  1.00  0.00 \n"
+"HETATM    6  C           1      -2.072  -0.710   1.236  1.00  0.00 \n"
+"HETATM    7  C           1      -0.528  -0.726   1.258  1.00  0.00 \n"
+"HETATM    8  C           1      -0.005  -2.181   1.381  1.00  0.00 \n"
+"HETATM    9  C           1       1.486  -2.197   1.780  1.00  0.00 \n"
+"HETATM   10  C           1      -0.183  -2.997   0.081  1.00  0.00 \n"
+"HETATM   11  C           1      -2.539   2.945   0.003  1.00  0.00 \n"
+"HETATM   12  H           1      -0.367  -0.497  -0.898  1.00  0.00 \n"
+"HETATM   13  H           1       1.761   0.410  -0.806  1.00  0.00 \n"
+"HETATM   14  H           1      -0.129   1.968  -0.889  1.00  0.00 \n"
+"HETATM   15  H           1      -0.127   1.969   0.888  1.00  0.00 \n"
+"HETATM   16  H           1      -2.409   0.987  -0.903  1.00  0.00 \n"
+"HETATM   17  H           1      -3.666   0.750   1.224  1.00  0.00 \n"
+"HETATM   18  H           1      -2.229   1.249   2.142  1.00  0.00 \n"
+"HETATM   19  H           1      -2.440  -1.211   0.342  1.00  0.00 \n"
+"HETATM   20  H           1      -2.455  -1.222   2.119  1.00  0.00 \n"
+"HETATM   21  H           1      -0.200  -0.175   2.139  1.00  0.00 \n"
+"HETATM   22  H           1      -0.565  -2.673   2.176  1.00  0.00 \n"
+"HETATM   23  H           1       1.633  -1.600   2.680  1.00  0.00 \n"
+"HETATM   24  H           1       2.100  -1.796   0.975  1.00  0.00 \n"
+"HETATM   25  H           1       1.794  -3.223   1.980  1.00  0.00 \n"
+"HETATM   26  H           1       0.434  -2.578  -0.713  1.00  0.00 \n"
+"HETATM   27  H           1      -1.228  -2.993  -0.228  1.00  0.00 \n"
+"HETATM   28  H           1       0.127  -4.026   0.261  1.00  0.00 \n"
+"HETATM   29  H           1      -2.165   3.462  -0.880  1.00  0.00 \n"
+"HETATM   30  H           1      -2.178   3.451   0.898  1.00  0.00 \n"
+"HETATM   31  H           1      -3.629   2.960  -0.005  1.00  0.00 \n"
+"CONECT    1    2    3    7   12\n"
+"CONECT    2    1   13\n"
+"CONECT    3    1    4   14   15\n"
+"CONECT    4    3    5   11   16\n"
+"CONECT    5    4    6   17   18\n"
+"CONECT    6    5    7   19   20\n"
+"CONECT    7    1    6    8   21\n"
+"CONECT    8    7    9   10   22\n"
+"CONECT    9    8   23   24   25\n"
+"CONECT   10    8   26   27   28\n"
+"CONECT   11    4   29   30   31\n"
+"CONECT   12    1\n"
+"CONECT   13    2\n"
+"CONECT   14    3\n"
+"CONECT   15    3\n"
+"CONECT   16    4\n"
+"CONECT   17    5\n"
+"CONECT   18    5\n"
+"CONECT   19    6\n"
+"CONECT   20    6\n"
+"CONECT   21    7\n"
+"CONECT   22    8\n"
+"CONECT   23    9\n"
+"CONECT   24    9\n"
+"CONECT   25    9\n"
+"CONECT   26   10\n"
+"CONECT   27   10\n"
+"CONECT   28   10\n"
+"CONECT   29   11\n"
+"CONECT   30   11\n"
+"CONECT   31   11\n"
+"MASTER        0    0    0    0    0    0    0    0   31    0   31    0\n"
+"END\n"
+,
+"HEADER    Mescaline: Peyote, an hallucinogen\n"
+"COMPND    jb12mesc\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Sep 20 16:26:54 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.398   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.098   1.213   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.399   2.424  -0.005  1.00  0.00 \n"
+"HETATM    5  C           1      -0.001   2.422   0.013  1.00  0.00 \n"
+"HETATM    6  C           1      -0.700   1.211   0.014  1.00  0.00 \n"
+"HETATM    7  O           1      -2.062   1.209   0.026  1.00  0.00 \n"
+"HETATM    8  C           1      -2.564   1.047  -1.282  1.00  0.00 \n"
+"HETATM    9  O           1      -0.682  -1.180  -0.024  1.00  0.00 \n"
+"HETATM   10  C           1      -0.867  -1.664   1.288  1.00  0.00 \n"
+"HETATM   11  O           1       2.078  -1.180  -0.002  1.00  0.00 \n"
+"HETATM   12  C           1       2.225  -1.657  -1.321  1.00  0.00 \n"
+"HETATM   13  C           1       2.154   3.735  -0.007  1.00  0.00 \n"
+"HETATM   14  C           1       2.388   4.190   1.447  1.00  0.00 \n"
+"HETATM   15  N           1       3.124   5.464   1.464  1.00  0.00 \n"
+"HETATM   16  H           1       3.188   1.207   0.000  1.00  0.00 \n"
+"HETATM   17  H           1      -0.549   3.364   0.023  1.00  0.00 \n"
+"HETATM   18  H           1      -2.231   0.093  -1.690  1.00  0.00 \n"
+"HETATM   19  H           1      -2.208   1.859  -1.916  1.00  0.00 \n"
+"HETATM   20  H           1      -3.653   1.064  -1.252  1.00  0.00 \n"
+"HETATM   21  H           1      -1.432  -0.938   1.873  1.00  0.00 \n"
+"HETATM   22  H           1       0.101  -1.837   1.758  1.00  0.00 \n"
+"HETATM   23  H           1      -1.419  -2.603   1.248  1.00  0.00 \n"
+"HETATM   24  H           1       2.775  -0.929  -1.917  1.00  0.00 \n"
+"HETATM   25  H           1       1.244  -1.825  -1.765  1.00  0.00 \n"
+"HETATM   26  H           1       2.777  -2.597  -1.303  1.00  0.00 \n"
+"HETATM   27  H           1       1.574   4.490  -0.538  1.00  0.00 \n"
+"HETATM   28  H           1       3.114   3.603  -0.507  1.00  0.00 \n"
+"HETATM   29  H           1       2.966   3.432   1.976  1.00  0.00 \n"
+"HETATM   30  H           1       1.427   4.321   1.944  1.00  0.00 \n"
+"HETATM   31  H           1       2.590   6.179   0.982  1.00  0.00 \n"
+"HETATM   32  H           1       4.024   5.350   1.012  1.00  0.00 \n"
+"CONECT    1    2    2    6    9\n"
+"CONECT    2    1    1    3   11\n"
+"CONECT    3    2    4    4   16\n"
+"CONECT    4    3    3    5   13\n"
+"CONECT    5    4    6    6   17\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8\n"
+"CONECT    8    7   18   19   20\n"
+"CONECT    9    1   10\n"
+"CONECT   10    9   21   22   23\n"
+"CONECT   11    2   12\n"
+"CONECT   12   11   24   25   26\n"
+"CONECT   13    4   14   27   28\n"
+"CONECT   14   13   15   29   30\n"
+"CONECT   15   14   31   32\n"
+"CONECT   16    3\n"
+"CONECT   17    5\n"
+"CONECT   18    8\n"
+"CONECT   19    8\n"
+"CONECT   20    8\n"
+"CONECT   21   10\n"
+"CONECT   22   10\n"
+"CONECT   23   10\n"
+"CONECT   24   12\n"
+"CONECT   25   12\n"
+"CONECT   26   12\n"
+"CONECT   27   13\n"
+"CONECT   28   13\n"
+"CONECT   29   14\n"
+"CONECT   30   14\n"
+"CONECT   31   15\n"
+"CONECT   32   15\n"
+"MASTER        0    0    0    0    0    0    0    0   32    0   32    0\n"
+"END\n"
+,
+"HEADER    Methamphetamine: D-Desoxyephedrine\n"
+"ORIGX1      1.000000  0.000000  0.000000        0.00000\n"
+"ORIGX2      0.000000  1.000000  0.000000        0.00000\n"
+"ORIGX3      0.000000  0.000000  1.000000        0.00000\n"
+"SCALE1      0.100000  0.000000  0.000000        0.00000\n"
+"SCALE2      0.000000  0.100000  0.000000        0.00000\n"
+"SCALE3      0.000000  0.000000  0.100000        0.00000\n"
+"ATOM      1  C           1       0.729   4.473  -1.914  1.00  0.00\n"
+"ATOM      2  C           1      -0.451   3.821  -2.014  1.00  0.00\n"
+"ATOM      3  C           1      -0.995   3.421  -3.398  1.00  0.00\n"
+"ATOM      4  C           1      -0.293   3.722  -4.513  1.00  0.00\n"
+"ATOM      5  C           1       1.052   4.465  -4.399  1.00  0.00\n"
+"ATOM      6  C           1       1.529   4.816  -3.184  1.00  0.00\n"
+"ATOM      7  H           1       1.115   4.756  -0.934  1.00  0.00\n"
+"ATOM      8  C           1      -1.251   3.478  -0.743  1.00  0.00\n"
+"ATOM      9  H           1      -1.947   2.896  -3.478  1.00  0.00\n"
+"ATOM     10  H           1      -0.678   3.440  -5.492  1.00  0.00\n"
+"ATOM     11  H           1       1.618   4.708  -5.298  1.00  0.00\n"
+"ATOM     12  H           1       2.481   5.342  -3.104  1.00  0.00\n"
+"ATOM     13  C           1      -0.489   3.986   0.496  1.00  0.00\n"
+"ATOM     14  N           1      -1.279   3.647   1.750  1.00  0.00\n"
+"ATOM     15  H           1      -1.378   2.398  -0.674  1.00  0.00\n"
+"ATOM     19  H           1      -2.229   3.957  -0.790  1.00  0.00\n"
+"ATOM     20  H           1       0.489   3.507   0.542  1.00  0.00\n"
+"ATOM     21  C           1      -0.310   5.512   0.398  1.00  0.00\n"
+"ATOM     22  H           1      -1.403   2.587   1.817  1.00  0.00\n"
+"ATOM     23  C           1      -0.528   4.148   2.972  1.00  0.00\n"
+"ATOM     24  H           1      -0.401   5.229   2.903  1.00  0.00\n"
+"ATOM     25  H           1       0.451   3.670   3.019  1.00  0.00\n"
+"ATOM     26  H           1      -1.094   3.905   3.871  1.00  0.00\n"
+"ATOM     27  H           1       0.229   5.871   1.275  1.00  0.00\n"
+"ATOM     28  H           1      -1.288   5.991   0.352  1.00  0.00\n"
+"ATOM     29  H           1       0.256   5.755  -0.501  1.00  0.00\n"
+"TER      30\n"
+"CONECT    1    2                                                                \n"
+"CONECT    2    1                                                                \n"
+"CONECT    2    3                                                                \n"
+"CONECT    3    2                                                                \n"
+"CONECT    3    4                                                                \n"
+"CONECT    4    3                                                                \n"
+"CONECT    4    5                                                                \n"
+"CONECT    5    4                                                                \n"
+"CONECT    5    6                                                                \n"
+"CONECT    6    5                                                                \n"
+"CONECT    6    1                                                                \n"
+"CONECT    1    6                                                                \n"
+"CONECT    1    7                                                                \n"
+"CONECT    7    1                                                                \n"
+"CONECT    2    8                                                                \n"
+"CONECT    8    2                                                                \n"
+"CONECT    3    9                                                                \n"
+"CONECT    9    3                                                                \n"
+"CONECT    4   10                                                                \n"
+"CONECT   10    4                                                                \n"
+"CONECT    5   11                                                                \n"
+"CONECT   11    5                                                                \n"
+"CONECT    6   12                                                                \n"
+"CONECT   12    6                                                                \n"
+"CONECT    8   13                                                                \n"
+"CONECT   13    8                                                                \n"
+"CONECT   13   14                                                                \n"
+"CONECT   14   13                                                                \n"
+"CONECT    8   15                                                                \n"
+"CONECT   15    8                                                                \n"
+"CONECT    8   19                                                                \n"
+"CONECT   19    8                                                                \n"
+"CONECT   13   20                                                                \n"
+"CONECT   20   13                                                                \n"
+"CONECT   13   21                                                                \n"
+"CONECT   21   13                                                                \n"
+"CONECT   14   22                                                                \n"
+"CONECT   22   14                                                                \n"
+"CONECT   14   23                                                                \n"
+"CONECT   23   14                                                                \n"
+"CONECT   23   24                                                                \n"
+"CONECT   24   23                                                                \n"
+"CONECT   23   25                                                                \n"
+"CONECT   25   23                                                                \n"
+"CONECT   23   26                                                                \n"
+"CONECT   26   23                                                                \n"
+"CONECT   21   27                                                                \n"
+"CONECT   27   21                                                                \n"
+"CONECT   21   28                                                                \n"
+"CONECT   28   21                                                                \n"
+"CONECT   21   29                                                                \n"
+"CONECT   29   21                                                                \n"
+"MASTER        0    0    0    0    0    0    0    6   26    1   52    0\n"
+"END\n"
+,
+"HEADER    Morphine, an opiate\n"
+"COMPND    al3058\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.400   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.106   1.211   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.444   2.446  -0.039  1.00  0.00 \n"
+"HETATM    5  C           1       0.047   2.458   0.013  1.00  0.00 \n"
+"HETATM    6  C           1      -0.629   1.243   0.051  1.00  0.00 \n"
+"HETATM    7  C           1      -2.081   1.500  -0.228  1.00  0.00 \n"
+"HETATM    8  C           1      -2.727   0.342  -0.999  1.00  0.00 \n"
+"HETATM    9  C           1      -2.363  -0.953  -0.239  1.00  0.00 \n"
+"HETATM   10  C           1      -0.832  -1.231  -0.285  1.00  0.00 \n"
+"HETATM   11  C           1      -1.885   2.839  -0.975  1.00  0.00 \n"
+"HETATM   12  C           1      -2.772   1.631   1.137  1.00  0.00 \n"
+"HETATM   13  C           1      -2.525   0.318   1.912  1.00  0.00 \n"
+"HETATM   14  N           1      -2.930  -0.855   1.119  1.00  0.00 \n"
+"HETATM   15  C           1      -2.790  -2.096   1.899  1.00  0.00 \n"
+"HETATM   16  H           1      -3.810   0.470  -0.978  1.00  0.00 \n"
+"HETATM   17  C           1      -2.300   0.287  -2.447  1.00  0.00 \n"
+"HETATM   18  C           1      -2.022   1.415  -3.116  1.00  0.00 \n"
+"HETATM   19  C           1      -1.406   2.612  -2.428  1.00  0.00 \n"
+"HETATM   20  H           1      -2.795   3.439  -0.953  1.00  0.00 \n"
+"HETATM   21  O           1      -0.796   3.478  -0.328  1.00  0.00 \n"
+"HETATM   22  H           1      -1.616   3.510  -3.009  1.00  0.00 \n"
+"HETATM   23  O           1       0.011   2.407  -2.414  1.00  0.00 \n"
+"HETATM   24  O           1       2.143   3.606  -0.184  1.00  0.00 \n"
+"HETATM   25  H           1       1.942  -0.943  -0.066  1.00  0.00 \n"
+"HETATM   26  H           1       3.195   1.192  -0.045  1.00  0.00 \n"
+"HETATM   27  H           1      -2.861  -1.784  -0.739  1.00  0.00 \n"
+"HETATM   28  H           1      -0.580  -1.568  -1.291  1.00  0.00 \n"
+"HETATM   29  H           1      -0.568  -2.021   0.414  1.00  0.00 \n"
+"HETATM   30  H           1      -3.842   1.788   0.997  1.00  0.00 \n"
+"HETATM   31  H           1      -2.350   2.469   1.692  1.00  0.00 \n"
+"HETATM   32  H           1      -3.107   0.346   2.833  1.00  0.00 \n"
+"HETATM   33  H           1      -1.471   0.235   2.174  1.00  0.00 \n"
+"HETATM   34  H           1      -3.461  -2.058   2.757  1.00  0.00 \n"
+"HETATM   35  H           1      -1.767  -2.205   2.257  1.00  0.00 \n"
+"HETATM   36  H           1      -3.054  -2.955   1.282  1.00  0.00 \n"
+"HETATM   37  H           1      -2.529  -0.612  -3.019  1.00  0.00 \n"
+"HETATM   38  H           1      -1.956   1.362  -4.203  1.00  0.00 \n"
+"HETATM   39  H           1       0.343   2.320  -3.313  1.00  0.00 \n"
+"HETATM   40  H           1       2.435   3.917   0.680  1.00  0.00 \n"
+"CONECT    1    2    2    6   10\n"
+"CONECT    2    1    1    3   25\n"
+"CONECT    3    2    4    4   26\n"
+"CONECT    4    3    3    5   24\n"
+"CONECT    5    4    6    6   21\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6    8   11   12\n"
+"CONECT    8    7    9   16   17\n"
+"CONECT    9    8   10   14   27\n"
+"CONECT   10    1    9   28   29\n"
+"CONECT   11    7   19   20   21\n"
+"CONECT   12    7   13   30   31\n"
+"CONECT   13   12   14   32   33\n"
+"CONECT   14    9   13   15\n"
+"CONECT   15   14   34   35   36\n"
+"CONECT   16    8\n"
+"CONECT   17    8   18   18   37\n"
+"CONECT   18   17   17   19   38\n"
+"CONECT   19   11   18   22   23\n"
+"CONECT   20   11\n"
+"CONECT   21    5   11\n"
+"CONECT   22   19\n"
+"CONECT   23   19   39\n"
+"CONECT   24    4   40\n"
+"CONECT   25    2\n"
+"CONECT   26    3\n"
+"CONECT   27    9\n"
+"CONECT   28   10\n"
+"CONECT   29   10\n"
+"CONECT   30   12\n"
+"CONECT   31   12\n"
+"CONECT   32   13\n"
+"CONECT   33   13\n"
+"CONECT   34   15\n"
+"CONECT   35   15\n"
+"CONECT   36   15\n"
+"CONECT   37   17\n"
+"CONECT   38   18\n"
+"CONECT   39   23\n"
+"CONECT   40   24\n"
+"MASTER        0    0    0    0    0    0    0    0   40    0   40    0\n"
+"END\n"
+,
+"HEADER    Nicotine, an insecticide\n"
+"COMPND    nicotine\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.400   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.082   1.223   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.361   2.420  -0.060  1.00  0.00 \n"
+"HETATM    5  C           1      -0.037   2.388  -0.103  1.00  0.00 \n"
+"HETATM    6  N           1      -0.698   1.182  -0.064  1.00  0.00 \n"
+"HETATM    7  C           1       2.135  -1.320   0.103  1.00  0.00 \n"
+"HETATM    8  H           1      -0.543  -0.944   0.043  1.00  0.00 \n"
+"HETATM    9  H           1       3.168   1.256   0.062  1.00  0.00 \n"
+"HETATM   10  H           1       1.886   3.375  -0.067  1.00  0.00 \n"
+"HETATM   11  H           1      -0.604   3.318  -0.148  1.00  0.00 \n"
+"HETATM   12  H           1       2.087  -1.661   1.139  1.00  0.00 \n"
+"HETATM   13  N           1       1.561  -2.374  -0.749  1.00  0.00 \n"
+"HETATM   14  C           1       3.616  -1.255  -0.318  1.00  0.00 \n"
+"HETATM   15  C           1       3.943  -2.708  -0.713  1.00  0.00 \n"
+"HETATM   16  C           1       2.580  -3.434  -0.690  1.00  0.00 \n"
+"HETATM   17  C           1       1.359  -1.946  -2.144  1.00  0.00 \n"
+"HETATM   18  H           1       4.247  -0.910   0.502  1.00  0.00 \n"
+"HETATM   19  H           1       3.736  -0.608  -1.187  1.00  0.00 \n"
+"HETATM   20  H           1       4.627  -3.166   0.001  1.00  0.00 \n"
+"HETATM   21  H           1       4.371  -2.732  -1.715  1.00  0.00 \n"
+"HETATM   22  H           1       2.475  -3.968   0.255  1.00  0.00 \n"
+"HETATM   23  H           1       2.490  -4.135  -1.520  1.00  0.00 \n"
+"HETATM   24  H           1       2.299  -1.632  -2.594  1.00  0.00 \n"
+"HETATM   25  H           1       0.648  -1.122  -2.190  1.00  0.00 \n"
+"HETATM   26  H           1       0.956  -2.781  -2.717  1.00  0.00 \n"
+"CONECT    1    2    2    6    8\n"
+"CONECT    2    1    1    3    7\n"
+"CONECT    3    2    4    4    9\n"
+"CONECT    4    3    3    5   10\n"
+"CONECT    5    4    6    6   11\n"
+"CONECT    6    1    5    5\n"
+"CONECT    7    2   12   13   14\n"
+"CONECT    8    1\n"
+"CONECT    9    3\n"
+"CONECT   10    4\n"
+"CONECT   11    5\n"
+"CONECT   12    7\n"
+"CONECT   13    7   16   17\n"
+"CONECT   14    7   15   18   19\n"
+"CONECT   15   14   16   20   21\n"
+"CONECT   16   13   15   22   23\n"
+"CONECT   17   13   24   25   26\n"
+"CONECT   18   14\n"
+"CONECT   19   14\n"
+"CONECT   20   15\n"
+"CONECT   21   15\n"
+"CONECT   22   16\n"
+"CONECT   23   16\n"
+"CONECT   24   17\n"
+"CONECT   25   17\n"
+"CONECT   26   17\n"
+"MASTER        0    0    0    0    0    0    0    0   26    0   26    0\n"
+"END\n"
+,
+"HEADER    Procaine: Novocaine, a local anesthetic\n"
+"COMPND    al3080\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.399   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.099   1.211   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.398   2.422   0.001  1.00  0.00 \n"
+"HETATM    5  C           1      -0.001   2.421   0.002  1.00  0.00 \n"
+"HETATM    6  C           1      -0.702   1.211   0.002  1.00  0.00 \n"
+"HETATM    7  N           1      -2.104   1.210   0.003  1.00  0.00 \n"
+"HETATM    8  C           1       3.511   1.212   0.000  1.00  0.00 \n"
+"HETATM    9  O           1       4.107   2.255  -0.002  1.00  0.00 \n"
+"HETATM   10  O           1       4.172   0.056   0.011  1.00  0.00 \n"
+"HETATM   11  C           1       5.562   0.269   0.112  1.00  0.00 \n"
+"HETATM   12  C           1       6.275  -1.096   0.162  1.00  0.00 \n"
+"HETATM   13  H           1      -0.542  -0.946   0.000  1.00  0.00 \n"
+"HETATM   14  H           1       1.942  -0.945  -0.001  1.00  0.00 \n"
+"HETATM   15  H           1       1.940   3.368   0.001  1.00  0.00 \n"
+"HETATM   16  H           1      -0.544   3.367   0.004  1.00  0.00 \n"
+"HETATM   17  H           1      -2.613   0.334   0.002  1.00  0.00 \n"
+"HETATM   18  H           1       5.776   0.831   1.021  1.00  0.00 \n"
+"HETATM   19  H           1       5.912   0.827  -0.758  1.00  0.00 \n"
+"HETATM   20  H           1       5.949  -1.682  -0.697  1.00  0.00 \n"
+"HETATM   21  H           1       5.984  -1.614   1.076  1.00  0.00 \n"
+"HETATM   22  N           1       7.741  -0.935   0.107  1.00  0.00 \n"
+"HETATM   23  C           1       8.433  -2.206  -0.184  1.00  0.00 \n"
+"HETATM   24  C           1       8.171  -3.279   0.896  1.00  0.00 \n"
+"HETATM   25  C           1       8.301  -0.239   1.281  1.00  0.00 \n"
+"HETATM   26  C           1       8.683   1.204   0.891  1.00  0.00 \n"
+"HETATM   27  H           1      -2.613   2.087   0.004  1.00  0.00 \n"
+"HETATM   28  H           1       9.505  -2.021  -0.249  1.00  0.00 \n"
+"HETATM   29  H           1       8.091  -2.587  -1.146  1.00  0.00 \n"
+"HETATM   30  H           1       7.118  -3.559   0.896  1.00  0.00 \n"
+"HETATM   31  H           1       8.444  -2.898   1.879  1.00  0.00 \n"
+"HETATM   32  H           1       8.770  -4.162   0.675  1.00  0.00 \n"
+"HETATM   33  H           1       9.205  -0.743   1.624  1.00  0.00 \n"
+"HETATM   34  H           1       7.579  -0.223   2.098  1.00  0.00 \n"
+"HETATM   35  H           1       7.804   1.747   0.546  1.00  0.00 \n"
+"HETATM   36  H           1       9.424   1.176   0.092  1.00  0.00 \n"
+"HETATM   37  H           1       9.105   1.714   1.757  1.00  0.00 \n"
+"CONECT    1    2    2    6   13\n"
+"CONECT    2    1    1    3   14\n"
+"CONECT    3    2    4    4    8\n"
+"CONECT    4    3    3    5   15\n"
+"CONECT    5    4    6    6   16\n"
+"CONECT    6    1    5    5    7\n"
+"CONECT    7    6   17   27\n"
+"CONECT    8    3    9    9   10\n"
+"CONECT    9    8    8\n"
+"CONECT   10    8   11\n"
+"CONECT   11   10   12   18   19\n"
+"CONECT   12   11   20   21   22\n"
+"CONECT   13    1\n"
+"CONECT   14    2\n"
+"CONECT   15    4\n"
+"CONECT   16    5\n"
+"CONECT   17    7\n"
+"CONECT   18   11\n"
+"CONECT   19   11\n"
+"CONECT   20   12\n"
+"CONECT   21   12\n"
+"CONECT   22   12   23   25\n"
+"CONECT   23   22   24   28   29\n"
+"CONECT   24   23   30   31   32\n"
+"CONECT   25   22   26   33   34\n"
+"CONECT   26   25   35   36   37\n"
+"CONECT   27    7\n"
+"CONECT   28   23\n"
+"CONECT   29   23\n"
+"CONECT   30   24\n"
+"CONECT   31   24\n"
+"CONECT   32   24\n"
+"CONECT   33   25\n"
+"CONECT   34   25\n"
+"CONECT   35   26\n"
+"CONECT   36   26\n"
+"CONECT   37   26\n"
+"MASTER        0    0    0    0    0    0    0    0   37    0   37    0\n"
+"END\n"
+,
+"HEADER    Sucrose octaoleate: Olestra-like non-hydrolyzing fat\n"
+"COMPND    jb15oles\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Sep 20 16:26:54 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.543   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.023   1.465   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.448   2.115   1.276  1.00  0.00 \n"
+"HETATM    5  C           1      -0.094   1.986   1.258  1.00  0.00 \n"
+"HETATM    6  O           1      -0.446   0.620   1.189  1.00  0.00 \n"
+"HETATM    7  O           1      -0.682   2.630   0.148  1.00  0.00 \n"
+"HETATM    8  C           1      -0.713   4.011  -0.142  1.00  0.00 \n"
+"HETATM    9  C           1      -1.600   4.135  -1.401  1.00  0.00 \n"
+"HETATM   10  C           1      -1.324   4.924   0.946  1.00  0.00 \n"
+"HETATM   11  O           1       0.576   4.533  -0.389  1.00  0.00 \n"
+"HETATM   12  C           1       0.436   5.938  -0.395  1.00  0.00 \n"
+"HETATM   13  C           1      -0.617   6.269   0.681  1.00  0.00 \n"
+"HETATM   14  C           1       1.756   6.671  -0.084  1.00  0.00 \n"
+"HETATM   15  O           1       2.227   6.278   1.183  1.00  0.00 \n"
+"HETATM   16  O           1      -1.499   7.264   0.209  1.00  0.00 \n"
+"HETATM   17  O           1      -1.029   4.475   2.250  1.00  0.00 \n"
+"HETATM   18  O           1      -1.000   3.465  -2.486  1.00  0.00 \n"
+"HETATM   19  C           1      -0.514  -1.457  -0.089  1.00  0.00 \n"
+"HETATM   20  O           1      -1.922  -1.490   0.008  1.00  0.00 \n"
+"HETATM   21  O           1       2.044  -0.707  -1.115  1.00  0.00 \n"
+"HETATM   22  O           1       3.434   1.488  -0.024  1.00  0.00 \n"
+"HETATM   23  O           1       1.870   3.459   1.361  1.00  0.00 \n"
+"HETATM   24  C           1      -2.482  -2.432  -0.753  1.00  0.00 \n"
+"HETATM   25  O           1      -3.315  -2.099  -1.556  1.00  0.00 \n"
+"HETATM   26  C           1      -2.336  -3.895  -0.434  1.00  0.00 \n"
+"HETATM   27  C           1      -3.583  -4.668  -0.927  1.00  0.00 \n"
+"HETATM   28  C           1      -3.416  -6.194  -0.736  1.00  0.00 \n"
+"HETATM   29  C           1      -4.686  -6.939  -1.212  1.00  0.00 \n"
+"HETATM   30  C           1      -4.492  -8.472  -1.146  1.00  0.00 \n"
+"HETATM   31  C           1      -5.779  -9.194  -1.608  1.00  0.00 \n"
+"HETATM   32  C           1      -5.580 -10.727  -1.651  1.00  0.00 \n"
+"HETATM   33  C           1      -6.868 -11.389  -2.094  1.00  0.00 \n"
+"HETATM   34  C           1      -6.933 -12.683  -2.447  1.00  0.00 \n"
+"HETATM   35  C           1      -5.725 -13.593  -2.433  1.00  0.00 \n"
+"HETATM   36  C           1      -6.164 -15.030  -2.794  1.00  0.00 \n"
+"HETATM   37  C           1      -4.957 -15.993  -2.791  1.00  0.00 \n"
+"HETATM   38  C           1      -5.423 -17.419  -3.153  1.00  0.00 \n"
+"HETATM   39  C           1      -4.225 -18.393  -3.146  1.00  0.00 \n"
+"HETATM   40  C           1      -4.700 -19.818  -3.505  1.00  0.00 \n"
+"HETATM   41  C           1       3.344  -0.983  -0.999  1.00  0.00 \n"
+"HETATM   42  O           1       4.098  -0.665  -1.882  1.00  0.00 \n"
+"HETATM   43  C           1       3.844  -1.849   0.124  1.00  0.00 \n"
+"HETATM   44  C           1       5.081  -2.680  -0.284  1.00  0.00 \n"
+"HETATM   45  C           1       5.532  -3.506   0.946  1.00  0.00 \n"
+"HETATM   46  C           1       6.768  -4.378   0.668  1.00  0.00 \n"
+"HETATM   47  C           1       7.108  -5.157   1.969  1.00  0.00 \n"
+"HETATM   48  C           1       8.283  -6.109   1.808  1.00  0.00 \n"
+"HETATM   49  C           1       8.489  -6.845   3.177  1.00  0.00 \n"
+"HETATM   50  C           1       9.603  -7.867   3.101  1.00  0.00 \n"
+"HETATM   51  C           1       9.838  -8.686   4.139  1.00  0.00 \n"
+"HETATM   52  C           1       8.989  -8.622   5.392  1.00  0.00 \n"
+"HETATM   53  C           1       9.509  -9.601   6.463  1.00  0.00 \n"
+"HETATM   54  C           1       8.612  -9.509   7.718  1.00  0.00 \n"
+"HETATM   55  C           1       9.090 -10.491   8.808  1.00  0.00 \n"
+"HETATM   56  C           1       8.155 -10.395  10.033  1.00  0.00 \n"
+"HETATM   57  C           1       8.599 -11.385  11.130  1.00  0.00 \n"
+"HETATM   58  C           1       3.954   2.643   0.391  1.00  0.00 \n"
+"HETATM   59  O           1       4.364   2.722   1.520  1.00  0.00 \n"
+"HETATM   60  C           1       3.833   3.903  -0.422  1.00  0.00 \n"
+"HETATM   61  C           1       5.113   4.138  -1.254  1.00  0.00 \n"
+"HETATM   62  C           1       5.001   5.470  -2.030  1.00  0.00 \n"
+"HETATM   63  C           1       6.274   5.721  -2.868  1.00  0.00 \n"
+"HETATM   64  C           1       6.142   7.042  -3.658  1.00  0.00 \n"
+"HETATM   65  C           1       7.424   7.302  -4.480  1.00  0.00 \n"
+"HETATM   66  C           1       7.292   8.604  -5.302  1.00  0.00 \n"
+"HETATM   67  C           1       8.567   8.842  -6.080  1.00  0.00 \n"
+"HETATM   68  C           1       8.673   9.819  -6.994  1.00  0.00 \n"
+"HETATM   69  C           1       7.518  10.739  -7.321  1.00  0.00 \n"
+"HETATM   70  C           1       7.962  11.764  -8.388  1.00  0.00 \n"
+"HETATM   71  C           1       6.793  12.704  -8.749  1.00  0.00 \n"
+"HETATM   72  C           1       7.240  13.712  -9.829  1.00  0.00 \n"
+"HETATM   73  C           1       6.069  14.649 -10.192  1.00  0.00 \n"
+"HETATM   74  C           1       6.510  15.654 -11.277  1.00  0.00 \n"
+"HETATM   75  C           1       1.563   4.034   2.524  1.00  0.00 \n"
+"HETATM   76  O           1       0.994   5.094   2.507  1.00  0.00 \n"
+"HETATM   77  C           1       2.204   3.624   3.820  1.00  0.00 \n"
+"HETATM   78  C           1       1.081   3.461   4.864  1.00  0.00 \n"
+"HETATM   79  C           1       1.646   2.985   6.219  1.00  0.00 \n"
+"HETATM   80  C           1       0.495   2.893   7.242  1.00  0.00 \n"
+"HETATM   81  C           1       0.991   2.293   8.574  1.00  0.00 \n"
+"HETATM   82  C           1      -0.180   2.239   9.577  1.00  0.00 \n"
+"HETATM   83  C           1       0.252   1.529  10.878  1.00  0.00 \n"
+"HETATM   84  C           1      -0.909   1.516  11.848  1.00  0.00 \n"
+"HETATM   85  C           1      -1.007   0.609  12.832  1.00  0.00 \n"
+"HETATM   86  C           1       0.023  -0.485  13.013  1.00  0.00 \n"
+"HETATM   87  C           1      -0.255  -1.246  14.326  1.00  0.00 \n"
+"HETATM   88  C           1       0.758  -2.396  14.494  1.00  0.00 \n"
+"HETATM   89  C           1       0.465  -3.168  15.798  1.00  0.00 \n"
+"HETATM   90  C           1       1.443  -4.352  15.937  1.00  0.00 \n"
+"HETATM   91  C           1       1.138  -5.136  17.229  1.00  0.00 \n"
+"HETATM   92  C           1      -1.640   3.717  -3.628  1.00  0.00 \n"
+"HETATM   93  O           1      -1.012   4.078  -4.590  1.00  0.00 \n"
+"HETATM   94  C           1      -3.121   3.488  -3.752  1.00  0.00 \n"
+"HETATM   95  C           1      -3.553   3.549  -5.232  1.00  0.00 \n"
+"HETATM   96  C           1      -5.083   3.368  -5.331  1.00  0.00 \n"
+"HETATM   97  C           1      -5.545   3.449  -6.801  1.00  0.00 \n"
+"HETATM   98  C           1      -7.080   3.295  -6.870  1.00  0.00 \n"
+"HETATM   99  C           1      -7.563   3.372  -8.334  1.00  0.00 \n"
+"HETATM  100  C           1      -9.099   3.230  -8.385  1.00  0.00 \n"
+"HETATM  101  C           1      -9.579   3.302  -9.818  1.00  0.00 \n"
+"HETATM  102  C           1     -10.886   3.239 -10.119  1.00  0.00 \n"
+"HETATM  103  C           1     -11.934   3.095  -9.037  1.00  0.00 \n"
+"HETATM  104  C           1     -13.340   3.036  -9.669  1.00  0.00 \n"
+"HETATM  105  C           1     -14.403   2.883  -8.561  1.00  0.00 \n"
+"HETATM  106  C           1     -15.815   2.830  -9.181  1.00  0.00 \n"
+"HETATM  107  C           1     -16.867   2.668  -8.064  1.00  0.00 \n"
+"HETATM  108  C           1     -18.283   2.619  -8.671  1.00  0.00 \n"
+"HETATM  109  C           1      -2.001   7.975   1.218  1.00  0.00 \n"
+"HETATM  110  O           1      -3.001   7.595   1.768  1.00  0.00 \n"
+"HETATM  111  C           1      -1.156   9.034   1.872  1.00  0.00 \n"
+"HETATM  112  C           1      -1.534  10.432   1.344  1.00  0.00 \n"
+"HETATM  113  C           1      -0.625  11.493   2.001  1.00  0.00 \n"
+"HETATM  114  C           1      -0.976  12.902   1.479  1.00  0.00 \n"
+"HETATM  115  C           1      -0.062  13.955   2.143  1.00  0.00 \n"
+"HETATM  116  C           1      -0.432  15.365   1.636  1.00  0.00 \n"
+"HETATM  117  C           1       0.472  16.432   2.289  1.00  0.00 \n"
+"HETATM  118  C           1       0.070  17.801   1.786  1.00  0.00 \n"
+"HETATM  119  C           1       0.739  18.910   2.133  1.00  0.00 \n"
+"HETATM  120  C           1       1.947  18.864   3.043  1.00  0.00 \n"
+"HETATM  121  C           1       2.466  20.301   3.261  1.00  0.00 \n"
+"HETATM  122  C           1       3.707  20.302   4.178  1.00  0.00 \n"
+"HETATM  123  C           1       4.204  21.750   4.364  1.00  0.00 \n"
+"HETATM  124  C           1       5.448  21.780   5.275  1.00  0.00 \n"
+"HETATM  125  C           1       5.933  23.236   5.440  1.00  0.00 \n"
+"HETATM  126  C           1      -1.676   5.203   3.160  1.00  0.00 \n"
+"HETATM  127  O           1      -1.395   6.362   3.326  1.00  0.00 \n"
+"HETATM  128  C           1      -2.722   4.564   4.031  1.00  0.00 \n"
+"HETATM  129  C           1      -3.529   5.657   4.765  1.00  0.00 \n"
+"HETATM  130  C           1      -4.616   5.007   5.648  1.00  0.00 \n"
+"HETATM  131  C           1      -5.417   6.088   6.405  1.00  0.00 \n"
+"HETATM  132  C           1      -6.505   5.421   7.274  1.00  0.00 \n"
+"HETATM  133  C           1      -7.276   6.485   8.085  1.00  0.00 \n"
+"HETATM  134  C           1      -8.342   5.803   8.967  1.00  0.00 \n"
+"HETATM  135  C           1      -8.999   6.835   9.859  1.00  0.00 \n"
+"HETATM  136  C           1     -10.265   7.250   9.698  1.00  0.00 \n"
+"HETATM  137  C           1     -11.161   6.729   8.595  1.00  0.00 \n"
+"HETATM  138  C           1     -12.519   7.460   8.650  1.00  0.00 \n"
+"HETATM  139  C           1     -13.450   6.941   7.534  1.00  0.00 \n"
+"HETATM  140  C           1     -14.810   7.665   7.610  1.00  0.00 \n"
+"HETATM  141  C           1     -15.745   7.150   6.496  1.00  0.00 \n"
+"HETATM  142  C           1     -17.110   7.866   6.583  1.00  0.00 \n"
+"HETATM  143  C           1       2.842   7.281   1.802  1.00  0.00 \n"
+"HETATM  144  O           1       2.205   8.253   2.118  1.00  0.00 \n"
+"HETATM  145  C           1       4.220   7.092   2.370  1.00  0.00 \n"
+"HETATM  146  C           1       4.473   8.156   3.459  1.00  0.00 \n"
+"HETATM  147  C           1       5.893   8.017   4.051  1.00  0.00 \n"
+"HETATM  148  C           1       6.113   9.105   5.125  1.00  0.00 \n"
+"HETATM  149  C           1       7.536   9.013   5.717  1.00  0.00 \n"
+"HETATM  150  C           1       7.731  10.123   6.772  1.00  0.00 \n"
+"HETATM  151  C           1       9.153  10.065   7.368  1.00  0.00 \n"
+"HETATM  152  C           1       9.319  11.173   8.385  1.00  0.00 \n"
+"HETATM  153  C           1      10.461  11.337   9.067  1.00  0.00 \n"
+"HETATM  154  C           1      11.643  10.413   8.868  1.00  0.00 \n"
+"HETATM  155  C           1      12.819  10.884   9.749  1.00  0.00 \n"
+"HETATM  156  C           1      14.028   9.942   9.572  1.00  0.00 \n"
+"HETATM  157  C           1      15.194  10.418  10.464  1.00  0.00 \n"
+"HETATM  158  C           1      16.397   9.465  10.312  1.00  0.00 \n"
+"HETATM  159  C           1      17.555   9.936  11.217  1.00  0.00 \n"
+"HETATM  160  C           1      18.753   8.973  11.081  1.00  0.00 \n"
+"HETATM  161  C           1      19.907   9.437  11.992  1.00  0.00 \n"
+"HETATM  162  C           1       7.637 -11.294  12.332  1.00  0.00 \n"
+"HETATM  163  C           1       8.066 -12.287  13.432  1.00  0.00 \n"
+"HETATM  164  C           1      -3.503 -20.792  -3.494  1.00  0.00 \n"
+"HETATM  165  C           1      -3.976 -22.215  -3.853  1.00  0.00 \n"
+"HETATM  166  C           1       2.094  -6.341  17.349  1.00  0.00 \n"
+"HETATM  167  C           1       1.786  -7.131  18.637  1.00  0.00 \n"
+"HETATM  168  C           1       5.336  16.589 -11.634  1.00  0.00 \n"
+"HETATM  169  C           1       5.771  17.593 -12.721  1.00  0.00 \n"
+"HETATM  170  C           1       7.177  23.279   6.350  1.00  0.00 \n"
+"HETATM  171  C           1       7.661  24.734   6.509  1.00  0.00 \n"
+"HETATM  172  C           1     -19.327   2.450  -7.548  1.00  0.00 \n"
+"HETATM  173  C           1     -20.747   2.406  -8.149  1.00  0.00 \n"
+"HETATM  174  C           1     -18.044   7.350   5.470  1.00  0.00 \n"
+"HETATM  175  C           1     -19.412   8.057   5.560  1.00  0.00 \n"
+"HETATM  176  H           1      -0.368   0.553  -0.864  1.00  0.00 \n"
+"HETATM  177  H           1       1.874  -0.482   0.920  1.00  0.00 \n"
+"HETATM  178  H           1       1.632   1.978  -0.879  1.00  0.00 \n"
+"HETATM  179  H           1       1.826   1.557   2.131  1.00  0.00 \n"
+"HETATM  180  H           1      -0.503   2.395   2.180  1.00  0.00 \n"
+"HETATM  181  H           1      -1.766   5.183  -1.654  1.00  0.00 \n"
+"HETATM  182  H           1      -2.562   3.672  -1.182  1.00  0.00 \n"
+"HETATM  183  H           1      -2.404   5.015   0.817  1.00  0.00 \n"
+"HETATM  184  H           1       0.079   6.263  -1.372  1.00  0.00 \n"
+"HETATM  185  H           1      -0.107   6.607   1.580  1.00  0.00 \n"
+"HETATM  186  H           1       1.568   7.745  -0.111  1.00  0.00 \n"
+"HETATM  187  H           1       2.495   6.425  -0.844  1.00  0.00 \n"
+"HETATM  188  H           1      -0.089  -2.043   0.726  1.00  0.00 \n"
+"HETATM  189  H           1      -0.191  -1.883  -1.040  1.00  0.00 \n"
+"HETATM  190  H           1      -2.226  -4.025   0.643  1.00  0.00 \n"
+"HETATM  191  H           1      -1.448  -4.280  -0.936  1.00  0.00 \n"
+"HETATM  192  H           1      -3.732  -4.461  -1.987  1.00  0.00 \n"
+"HETATM  193  H           1      -4.457  -4.327  -0.372  1.00  0.00 \n"
+"HETATM  194  H           1      -3.242  -6.413   0.317  1.00  0.00 \n"
+"HETATM  195  H           1      -2.560  -6.535  -1.319  1.00  0.00 \n"
+"HETATM  196  H           1      -4.902  -6.654  -2.241  1.00  0.00 \n"
+"HETATM  197  H           1      -5.527  -6.653  -0.579  1.00  0.00 \n"
+"HETATM  198  H           1      -4.259  -8.767  -0.123  1.00  0.00 \n"
+"HETATM  199  H           1      -3.666  -8.756  -1.799  1.00  0.00 \n"
+"HETATM  200  H           1      -6.047  -8.844  -2.605  1.00  0.00 \n"
+"HETATM  201  H           1      -6.588  -8.955  -0.918  1.00  0.00 \n"
+"HETATM  202  H           1      -5.310 -11.089  -0.659  1.00  0.00 \n"
+"HETATM  203  H           1      -4.783 -10.967  -2.355  1.00  0.00 \n"
+"HETATM  204  H           1      -7.781 -10.795  -2.125  1.00  0.00 \n"
+"HETATM  205  H           1      -7.896 -13.091  -2.754  1.00  0.00 \n"
+"HETATM  206  H           1      -5.275 -13.588  -1.440  1.00  0.00 \n"
+"HETATM  207  H           1      -4.997 -13.243  -3.164  1.00  0.00 \n"
+"HETATM  208  H           1      -6.618 -15.028  -3.785  1.00  0.00 \n"
+"HETATM  209  H           1      -6.898 -15.374  -2.065  1.00  0.00 \n"
+"HETATM  210  H           1      -4.502 -16.000  -1.801  1.00  0.00 \n"
+"HETATM  211  H           1      -4.222 -15.655  -3.522  1.00  0.00 \n"
+"HETATM  212  H           1      -5.875 -17.411  -4.145  1.00  0.00 \n"
+"HETATM  213  H           1      -6.163 -17.753  -2.425  1.00  0.00 \n"
+"HETATM  214  H           1      -3.773 -18.402  -2.155  1.00  0.00 \n"
+"HETATM  215  H           1      -3.486 -18.063  -3.876  1.00  0.00 \n"
+"HETATM  216  H           1      -5.150 -19.810  -4.498  1.00  0.00 \n"
+"HETATM  217  H           1      -5.441 -20.147  -2.777  1.00  0.00 \n"
+"HETATM  218  H           1       3.046  -2.532   0.416  1.00  0.00 \n"
+"HETATM  219  H           1       4.102  -1.216   0.975  1.00  0.00 \n"
+"HETATM  220  H           1       5.884  -2.006  -0.580  1.00  0.00 \n"
+"HETATM  221  H           1       4.829  -3.337  -1.117  1.00  0.00 \n"
+"HETATM  222  H           1       4.717  -4.156   1.264  1.00  0.00 \n"
+"HETATM  223  H           1       5.773  -2.820   1.759  1.00  0.00 \n"
+"HETATM  224  H           1       7.605  -3.757   0.345  1.00  0.00 \n"
+"HETATM  225  H           1       6.511  -5.083  -0.123  1.00  0.00 \n"
+"HETATM  226  H           1       6.244  -5.737   2.294  1.00  0.00 \n"
+"HETATM  227  H           1       7.378  -4.451   2.755  1.00  0.00 \n"
+"HETATM  228  H           1       9.158  -5.517   1.539  1.00  0.00 \n"
+"HETATM  229  H           1       8.056  -6.812   1.007  1.00  0.00 \n"
+"HETATM  230  H           1       7.572  -7.372   3.439  1.00  0.00 \n"
+"HETATM  231  H           1       8.718  -6.129   3.967  1.00  0.00 \n"
+"HETATM  232  H           1      10.222  -7.926   2.206  1.00  0.00 \n"
+"HETATM  233  H           1      10.647  -9.413   4.074  1.00  0.00 \n"
+"HETATM  234  H           1       7.960  -8.886   5.148  1.00  0.00 \n"
+"HETATM  235  H           1       9.015  -7.611   5.799  1.00  0.00 \n"
+"HETATM  236  H           1      10.534  -9.341   6.725  1.00  0.00 \n"
+"HETATM  237  H           1       9.481 -10.616   6.068  1.00  0.00 \n"
+"HETATM  238  H           1       7.586  -9.753   7.443  1.00  0.00 \n"
+"HETATM  239  H           1       8.644  -8.493   8.111  1.00  0.00 \n"
+"HETATM  240  H           1      10.108 -10.239   9.105  1.00  0.00 \n"
+"HETATM  241  H           1       9.070 -11.507   8.415  1.00  0.00 \n"
+"HETATM  242  H           1       7.136 -10.633   9.726  1.00  0.00 \n"
+"HETATM  243  H           1       8.182  -9.380  10.429  1.00  0.00 \n"
+"HETATM  244  H           1       9.611 -11.139  11.453  1.00  0.00 \n"
+"HETATM  245  H           1       8.585 -12.399  10.730  1.00  0.00 \n"
+"HETATM  246  H           1       3.697   4.738   0.262  1.00  0.00 \n"
+"HETATM  247  H           1       2.973   3.837  -1.086  1.00  0.00 \n"
+"HETATM  248  H           1       5.244   3.316  -1.956  1.00  0.00 \n"
+"HETATM  249  H           1       5.973   4.181  -0.585  1.00  0.00 \n"
+"HETATM  250  H           1       4.873   6.289  -1.322  1.00  0.00 \n"
+"HETATM  251  H           1       4.136   5.428  -2.692  1.00  0.00 \n"
+"HETATM  252  H           1       6.415   4.896  -3.567  1.00  0.00 \n"
+"HETATM  253  H           1       7.137   5.781  -2.205  1.00  0.00 \n"
+"HETATM  254  H           1       5.987   7.867  -2.962  1.00  0.00 \n"
+"HETATM  255  H           1       5.288   6.976  -4.332  1.00  0.00 \n"
+"HETATM  256  H           1       7.592   6.466  -5.158  1.00  0.00 \n"
+"HETATM  257  H           1       8.273   7.389  -3.801  1.00  0.00 \n"
+"HETATM  258  H           1       7.117   9.443  -4.629  1.00  0.00 \n"
+"HETATM  259  H           1       6.453   8.510  -5.991  1.00  0.00 \n"
+"HETATM  260  H           1       9.432   8.207  -5.887  1.00  0.00 \n"
+"HETATM  261  H           1       9.620   9.946  -7.519  1.00  0.00 \n"
+"HETATM  262  H           1       7.205  11.266  -6.419  1.00  0.00 \n"
+"HETATM  263  H           1       6.685  10.153  -7.709  1.00  0.00 \n"
+"HETATM  264  H           1       8.285  11.232  -9.283  1.00  0.00 \n"
+"HETATM  265  H           1       8.793  12.353  -8.000  1.00  0.00 \n"
+"HETATM  266  H           1       6.474  13.244  -7.858  1.00  0.00 \n"
+"HETATM  267  H           1       5.958  12.114  -9.129  1.00  0.00 \n"
+"HETATM  268  H           1       7.559  13.171 -10.720  1.00  0.00 \n"
+"HETATM  269  H           1       8.073  14.304  -9.450  1.00  0.00 \n"
+"HETATM  270  H           1       5.753  15.194  -9.302  1.00  0.00 \n"
+"HETATM  271  H           1       5.234  14.057 -10.566  1.00  0.00 \n"
+"HETATM  272  H           1       6.824  15.110 -12.168  1.00  0.00 \n"
+"HETATM  273  H           1       7.346  16.246 -10.905  1.00  0.00 \n"
+"HETATM  274  H           1       2.891   4.405   4.144  1.00  0.00 \n"
+"HETATM  275  H           1       2.753   2.690   3.706  1.00  0.00 \n"
+"HETATM  276  H           1       0.360   2.729   4.502  1.00  0.00 \n"
+"HETATM  277  H           1       0.578   4.420   4.999  1.00  0.00 \n"
+"HETATM  278  H           1       2.396   3.692   6.575  1.00  0.00 \n"
+"HETATM  279  H           1       2.104   2.004   6.094  1.00  0.00 \n"
+"HETATM  280  H           1      -0.293   2.257   6.838  1.00  0.00 \n"
+"HETATM  281  H           1       0.092   3.890   7.420  1.00  0.00 \n"
+"HETATM  282  H           1       1.792   2.910   8.980  1.00  0.00 \n"
+"HETATM  283  H           1       1.366   1.285   8.397  1.00  0.00 \n"
+"HETATM  284  H           1      -1.010   1.689   9.134  1.00  0.00 \n"
+"HETATM  285  H           1      -0.503   3.254   9.807  1.00  0.00 \n"
+"HETATM  286  H           1       1.090   2.062  11.326  1.00  0.00 \n"
+"HETATM  287  H           1       0.555   0.509  10.641  1.00  0.00 \n"
+"HETATM  288  H           1      -1.682   2.279  11.759  1.00  0.00 \n"
+"HETATM  289  H           1      -1.860   0.654  13.508  1.00  0.00 \n"
+"HETATM  290  H           1       1.020  -0.047  13.053  1.00  0.00 \n"
+"HETATM  291  H           1      -0.037  -1.180  12.176  1.00  0.00 \n"
+"HETATM  292  H           1      -1.264  -1.658  14.297  1.00  0.00 \n"
+"HETATM  293  H           1      -0.170  -0.560  15.169  1.00  0.00 \n"
+"HETATM  294  H           1       1.769  -1.990  14.531  1.00  0.00 \n"
+"HETATM  295  H           1       0.675  -3.076  13.646  1.00  0.00 \n"
+"HETATM  296  H           1      -0.557  -3.546  15.772  1.00  0.00 \n"
+"HETATM  297  H           1       0.580  -2.498  16.650  1.00  0.00 \n"
+"HETATM  298  H           1       2.466  -3.977  15.971  1.00  0.00 \n"
+"HETATM  299  H           1       1.331  -5.015  15.078  1.00  0.00 \n"
+"HETATM  300  H           1       0.108  -5.493  17.202  1.00  0.00 \n"
+"HETATM  301  H           1       1.269  -4.481  18.090  1.00  0.00 \n"
+"HETATM  302  H           1      -3.652   4.262  -3.197  1.00  0.00 \n"
+"HETATM  303  H           1      -3.371   2.511  -3.339  1.00  0.00 \n"
+"HETATM  304  H           1      -3.052   2.758  -5.791  1.00  0.00 \n"
+"HETATM  305  H           1      -3.275   4.517  -5.650  1.00  0.00 \n"
+"HETATM  306  H           1      -5.575   4.153  -4.757  1.00  0.00 \n"
+"HETATM  307  H           1      -5.358   2.397  -4.919  1.00  0.00 \n"
+"HETATM  308  H           1      -5.072   2.653  -7.376  1.00  0.00 \n"
+"HETATM  309  H           1      -5.259   4.415  -7.219  1.00  0.00 \n"
+"HETATM  310  H           1      -7.548   4.093  -6.294  1.00  0.00 \n"
+"HETATM  311  H           1      -7.365   2.332  -6.447  1.00  0.00 \n"
+"HETATM  312  H           1      -7.105   2.569  -8.910  1.00  0.00 \n"
+"HETATM  313  H           1      -7.275   4.333  -8.761  1.00  0.00 \n"
+"HETATM  314  H           1      -9.553   4.035  -7.808  1.00  0.00 \n"
+"HETATM  315  H           1      -9.385   2.270  -7.955  1.00  0.00 \n"
+"HETATM  316  H           1      -8.852   3.405 -10.623  1.00  0.00 \n"
+"HETATM  317  H           1     -11.195   3.293 -11.162  1.00  0.00 \n"
+"HETATM  318  H           1     -11.879   3.949  -8.362  1.00  0.00 \n"
+"HETATM  319  H           1     -11.753   2.177  -8.477  1.00  0.00 \n"
+"HETATM  320  H           1     -13.398   2.184 -10.347  1.00  0.00 \n"
+"HETATM  321  H           1     -13.526   3.954 -10.227  1.00  0.00 \n"
+"HETATM  322  H           1     -14.340   3.732  -7.880  1.00  0.00 \n"
+"HETATM  323  H           1     -14.217   1.964  -8.007  1.00  0.00 \n"
+"HETATM  324  H           1     -15.880   1.984  -9.865  1.00  0.00 \n"
+"HETATM  325  H           1     -16.006   3.752  -9.729  1.00  0.00 \n"
+"HETATM  326  H           1     -16.797   3.511  -7.377  1.00  0.00 \n"
+"HETATM  327  H           1     -16.675   1.743  -7.519  1.00  0.00 \n"
+"HETATM  328  H           1     -18.353   1.777  -9.361  1.00  0.00 \n"
+"HETATM  329  H           1     -18.478   3.545  -9.212  1.00  0.00 \n"
+"HETATM  330  H           1      -0.105   8.848   1.652  1.00  0.00 \n"
+"HETATM  331  H           1      -1.308   8.997   2.950  1.00  0.00 \n"
+"HETATM  332  H           1      -2.576  10.642   1.584  1.00  0.00 \n"
+"HETATM  333  H           1      -1.400  10.458   0.262  1.00  0.00 \n"
+"HETATM  334  H           1       0.416  11.272   1.765  1.00  0.00 \n"
+"HETATM  335  H           1      -0.761  11.465   3.082  1.00  0.00 \n"
+"HETATM  336  H           1      -2.016  13.126   1.716  1.00  0.00 \n"
+"HETATM  337  H           1      -0.839  12.933   0.398  1.00  0.00 \n"
+"HETATM  338  H           1       0.978  13.741   1.894  1.00  0.00 \n"
+"HETATM  339  H           1      -0.189  13.915   3.224  1.00  0.00 \n"
+"HETATM  340  H           1      -1.473  15.574   1.885  1.00  0.00 \n"
+"HETATM  341  H           1      -0.309  15.403   0.553  1.00  0.00 \n"
+"HETATM  342  H           1       1.512  16.236   2.027  1.00  0.00 \n"
+"HETATM  343  H           1       0.356  16.395   3.372  1.00  0.00 \n"
+"HETATM  344  H           1      -0.793  17.892   1.125  1.00  0.00 \n"
+"HETATM  345  H           1       0.403  19.871   1.743  1.00  0.00 \n"
+"HETATM  346  H           1       2.729  18.261   2.583  1.00  0.00 \n"
+"HETATM  347  H           1       1.666  18.429   4.003  1.00  0.00 \n"
+"HETATM  348  H           1       1.680  20.901   3.718  1.00  0.00 \n"
+"HETATM  349  H           1       2.733  20.734   2.297  1.00  0.00 \n"
+"HETATM  350  H           1       4.496  19.701   3.725  1.00  0.00 \n"
+"HETATM  351  H           1       3.443  19.879   5.148  1.00  0.00 \n"
+"HETATM  352  H           1       3.412  22.349   4.815  1.00  0.00 \n"
+"HETATM  353  H           1       4.461  22.170   3.391  1.00  0.00 \n"
+"HETATM  354  H           1       6.241  21.182   4.827  1.00  0.00 \n"
+"HETATM  355  H           1       5.192  21.369   6.251  1.00  0.00 \n"
+"HETATM  356  H           1       5.138  23.834   5.886  1.00  0.00 \n"
+"HETATM  357  H           1       6.186  23.646   4.463  1.00  0.00 \n"
+"HETATM  358  H           1      -2.234   3.917   4.760  1.00  0.00 \n"
+"HETATM  359  H           1      -3.391   3.970   3.410  1.00  0.00 \n"
+"HETATM  360  H           1      -3.999   6.312   4.032  1.00  0.00 \n"
+"HETATM  361  H           1      -2.855   6.243   5.391  1.00  0.00 \n"
+"HETATM  362  H           1      -4.143   4.340   6.369  1.00  0.00 \n"
+"HETATM  363  H           1      -5.294   4.431   5.018  1.00  0.00 \n"
+"HETATM  364  H           1      -5.887   6.762   5.689  1.00  0.00 \n"
+"HETATM  365  H           1      -4.741   6.657   7.044  1.00  0.00 \n"
+"HETATM  366  H           1      -6.034   4.719   7.961  1.00  0.00 \n"
+"HETATM  367  H           1      -7.201   4.881   6.631  1.00  0.00 \n"
+"HETATM  368  H           1      -7.762   7.185   7.405  1.00  0.00 \n"
+"HETATM  369  H           1      -6.577   7.027   8.721  1.00  0.00 \n"
+"HETATM  370  H           1      -7.858   5.057   9.599  1.00  0.00 \n"
+"HETATM  371  H           1      -9.075   5.305   8.334  1.00  0.00 \n"
+"HETATM  372  H           1      -8.416   7.259  10.676  1.00  0.00 \n"
+"HETATM  373  H           1     -10.661   7.994  10.389  1.00  0.00 \n"
+"HETATM  374  H           1     -11.324   5.660   8.731  1.00  0.00 \n"
+"HETATM  375  H           1     -10.692   6.909   7.628  1.00  0.00 \n"
+"HETATM  376  H           1     -12.360   8.530   8.520  1.00  0.00 \n"
+"HETATM  377  H           1     -12.985   7.281   9.620  1.00  0.00 \n"
+"HETATM  378  H           1     -13.603   5.869   7.659  1.00  0.00 \n"
+"HETATM  379  H           1     -12.992   7.129   6.563  1.00  0.00 \n"
+"HETATM  380  H           1     -14.657   8.738   7.488  1.00  0.00 \n"
+"HETATM  381  H           1     -15.267   7.476   8.582  1.00  0.00 \n"
+"HETATM  382  H           1     -15.891   6.077   6.614  1.00  0.00 \n"
+"HETATM  383  H           1     -15.293   7.348   5.524  1.00  0.00 \n"
+"HETATM  384  H           1     -16.964   8.939   6.466  1.00  0.00 \n"
+"HETATM  385  H           1     -17.561   7.667   7.556  1.00  0.00 \n"
+"HETATM  386  H           1       4.947   7.200   1.566  1.00  0.00 \n"
+"HETATM  387  H           1       4.294   6.092   2.798  1.00  0.00 \n"
+"HETATM  388  H           1       3.737   8.034   4.255  1.00  0.00 \n"
+"HETATM  389  H           1       4.363   9.148   3.021  1.00  0.00 \n"
+"HETATM  390  H           1       6.629   8.137   3.256  1.00  0.00 \n"
+"HETATM  391  H           1       6.005   7.031   4.501  1.00  0.00 \n"
+"HETATM  392  H           1       5.382   8.976   5.924  1.00  0.00 \n"
+"HETATM  393  H           1       5.977  10.088   4.673  1.00  0.00 \n"
+"HETATM  394  H           1       8.269   9.137   4.920  1.00  0.00 \n"
+"HETATM  395  H           1       7.673   8.038   6.185  1.00  0.00 \n"
+"HETATM  396  H           1       7.001   9.993   7.571  1.00  0.00 \n"
+"HETATM  397  H           1       7.579  11.095   6.302  1.00  0.00 \n"
+"HETATM  398  H           1       9.884  10.192   6.570  1.00  0.00 \n"
+"HETATM  399  H           1       9.304   9.100   7.851  1.00  0.00 \n"
+"HETATM  400  H           1       8.493  11.861   8.565  1.00  0.00 \n"
+"HETATM  401  H           1      10.536  12.152   9.787  1.00  0.00 \n"
+"HETATM  402  H           1      11.947  10.429   7.821  1.00  0.00 \n"
+"HETATM  403  H           1      11.362   9.399   9.150  1.00  0.00 \n"
+"HETATM  404  H           1      12.509  10.880  10.795  1.00  0.00 \n"
+"HETATM  405  H           1      13.103  11.896   9.462  1.00  0.00 \n"
+"HETATM  406  H           1      14.343   9.946   8.529  1.00  0.00 \n"
+"HETATM  407  H           1      13.743   8.930   9.859  1.00  0.00 \n"
+"HETATM  408  H           1      14.872  10.428  11.505  1.00  0.00 \n"
+"HETATM  409  H           1      15.489  11.425  10.168  1.00  0.00 \n"
+"HETATM  410  H           1      16.727   9.459   9.273  1.00  0.00 \n"
+"HETATM  411  H           1      16.099   8.457  10.601  1.00  0.00 \n"
+"HETATM  412  H           1      17.219   9.951  12.254  1.00  0.00 \n"
+"HETATM  413  H           1      17.860  10.940  10.923  1.00  0.00 \n"
+"HETATM  414  H           1      19.093   8.960  10.046  1.00  0.00 \n"
+"HETATM  415  H           1      18.446   7.968  11.372  1.00  0.00 \n"
+"HETATM  416  H           1      19.573   9.448  13.030  1.00  0.00 \n"
+"HETATM  417  H           1      20.221  10.440  11.703  1.00  0.00 \n"
+"HETATM  418  H           1      20.748   8.752  11.891  1.00  0.00 \n"
+"HETATM  419  H           1       6.625 -11.535  12.006  1.00  0.00 \n"
+"HETATM  420  H           1       7.653 -10.282  12.735  1.00  0.00 \n"
+"HETATM  421  H           1       9.075 -12.048  13.767  1.00  0.00 \n"
+"HETATM  422  H           1       8.046 -13.303  13.036  1.00  0.00 \n"
+"HETATM  423  H           1       7.378 -12.215  14.274  1.00  0.00 \n"
+"HETATM  424  H           1      -2.762 -20.465  -4.223  1.00  0.00 \n"
+"HETATM  425  H           1      -3.052 -20.802  -2.502  1.00  0.00 \n"
+"HETATM  426  H           1      -4.423 -22.213  -4.847  1.00  0.00 \n"
+"HETATM  427  H           1      -4.714 -22.551  -3.124  1.00  0.00 \n"
+"HETATM  428  H           1      -3.123 -22.895  -3.842  1.00  0.00 \n"
+"HETATM  429  H           1       3.124  -5.987  17.380  1.00  0.00 \n"
+"HETATM  430  H           1       1.964  -6.995  16.486  1.00  0.00 \n"
+"HETATM  431  H           1       0.758  -7.491  18.610  1.00  0.00 \n"
+"HETATM  432  H           1       1.921  -6.484  19.504  1.00  0.00 \n"
+"HETATM  433  H           1       2.464  -7.981  18.713  1.00  0.00 \n"
+"HETATM  434  H           1       5.023  17.135 -10.744  1.00  0.00 \n"
+"HETATM  435  H           1       4.500  15.996 -12.005  1.00  0.00 \n"
+"HETATM  436  H           1       6.079  17.053 -13.616  1.00  0.00 \n"
+"HETATM  437  H           1       6.604  18.192 -12.354  1.00  0.00 \n"
+"HETATM  438  H           1       4.935  18.248 -12.965  1.00  0.00 \n"
+"HETATM  439  H           1       7.973  22.680   5.906  1.00  0.00 \n"
+"HETATM  440  H           1       6.926  22.873   7.330  1.00  0.00 \n"
+"HETATM  441  H           1       6.871  25.336   6.956  1.00  0.00 \n"
+"HETATM  442  H           1       7.919  25.143   5.532  1.00  0.00 \n"
+"HETATM  443  H           1       8.540  24.757   7.153  1.00  0.00 \n"
+"HETATM  444  H           1     -19.255   3.289  -6.856  1.00  0.00 \n"
+"HETATM  445  H           1     -19.135   1.523  -7.009  1.00  0.00 \n"
+"HETATM  446  H           1     -20.826   1.565  -8.838  1.00  0.00 \n"
+"HETATM  447  H           1     -20.947   3.334  -8.684  1.00  0.00 \n"
+"HETATM  448  H           1     -21.476   2.286  -7.348  1.00  0.00 \n"
+"HETATM  449  H           1     -18.187   6.275   5.583  1.00  0.00 \n"
+"HETATM  450  H           1     -17.597   7.553   4.497  1.00  0.00 \n"
+"HETATM  451  H           1     -19.276   9.132   5.443  1.00  0.00 \n"
+"HETATM  452  H           1     -19.866   7.853   6.529  1.00  0.00 \n"
+"HETATM  453  H           1     -20.065   7.687   4.770  1.00  0.00 \n"
+"CONECT    1    2    6   19  176\n"
+"CONECT    2    1    3   21  177\n"
+"CONECT    3    2    4   22  178\n"
+"CONECT    4    3    5   23  179\n"
+"CONECT    5    4    6    7  180\n"
+"CONECT    6    1    5\n"
+"CONECT    7    5    8\n"
+"CONECT    8    7    9   10   11\n"
+"CONECT    9    8   18  181  182\n"
+"CONECT   10    8   13   17  183\n"
+"CONECT   11    8   12\n"
+"CONECT   12   11   13   14  184\n"
+"CONECT   13   10   12   16  185\n"
+"CONECT   14   12   15  186  187\n"
+"CONECT   15   14  143\n"
+"CONECT   16   13  109\n"
+"CONECT   17   10  126\n"
+"CONECT   18    9   92\n"
+"CONECT   19    1   20  188  189\n"
+"CONECT   20   19   24\n"
+"CONECT   21    2   41\n"
+"CONECT   22    3   58\n"
+"CONECT   23    4   75\n"
+"CONECT   24   20   25   25   26\n"
+"CONECT   25   24   24\n"
+"CONECT   26   24   27  190  191\n"
+"CONECT   27   26   28  192  193\n"
+"CONECT   28   27   29  194  195\n"
+"CONECT   29   28   30  196  197\n"
+"CONECT   30   29   31  198  199\n"
+"CONECT   31   30   32  200  201\n"
+"CONECT   32   31   33  202  203\n"
+"CONECT   33   32   34   34  204\n"
+"CONECT   34   33   33   35  205\n"
+"CONECT   35   34   36  206  207\n"
+"CONECT   36   35   37  208  209\n"
+"CONECT   37   36   38  210  211\n"
+"CONECT   38   37   39  212  213\n"
+"CONECT   39   38   40  214  215\n"
+"CONECT   40   39  164  216  217\n"
+"CONECT   41   21   42   42   43\n"
+"CONECT   42   41   41\n"
+"CONECT   43   41   44  218  219\n"
+"CONECT   44   43   45  220  221\n"
+"CONECT   45   44   46  222  223\n"
+"CONECT   46   45   47  224  225\n"
+"CONECT   47   46   48  226  227\n"
+"CONECT   48   47   49  228  229\n"
+"CONECT   49   48   50  230  231\n"
+"CONECT   50   49   51   51  232\n"
+"CONECT   51   50   50   52  233\n"
+"CONECT   52   51   53  234  235\n"
+"CONECT   53   52   54  236  237\n"
+"CONECT   54   53   55  238  239\n"
+"CONECT   55   54   56  240  241\n"
+"CONECT   56   55   57  242  243\n"
+"CONECT   57   56  162  244  245\n"
+"CONECT   58   22   59   59   60\n"
+"CONECT   59   58   58\n"
+"CONECT   60   58   61  246  247\n"
+"CONECT   61   60   62  248  249\n"
+"CONECT   62   61   63  250  251\n"
+"CONECT   63   62   64  252  253\n"
+"CONECT   64   63   65  254  255\n"
+"CONECT   65   64   66  256  257\n"
+"CONECT   66   65   67  258  259\n"
+"CONECT   67   66   68   68  260\n"
+"CONECT   68   67   67   69  261\n"
+"CONECT   69   68   70  262  263\n"
+"CONECT   70   69   71  264  265\n"
+"CONECT   71   70   72  266  267\n"
+"CONECT   72   71   73  268  269\n"
+"CONECT   73   72   74  270  271\n"
+"CONECT   74   73  168  272  273\n"
+"CONECT   75   23   76   76   77\n"
+"CONECT   76   75   75\n"
+"CONECT   77   75   78  274  275\n"
+"CONECT   78   77   79  276  277\n"
+"CONECT   79   78   80  278  279\n"
+"CONECT   80   79   81  280  281\n"
+"CONECT   81   80   82  282  283\n"
+"CONECT   82   81   83  284  285\n"
+"CONECT   83   82   84  286  287\n"
+"CONECT   84   83   85   85  288\n"
+"CONECT   85   84   84   86  289\n"
+"CONECT   86   85   87  290  291\n"
+"CONECT   87   86   88  292  293\n"
+"CONECT   88   87   89  294  295\n"
+"CONECT   89   88   90  296  297\n"
+"CONECT   90   89   91  298  299\n"
+"CONECT   91   90  166  300  301\n"
+"CONECT   92   18   93   93   94\n"
+"CONECT   93   92   92\n"
+"CONECT   94   92   95  302  303\n"
+"CONECT   95   94   96  304  305\n"
+"CONECT   96   95   97  306  307\n"
+"CONECT   97   96   98  308  309\n"
+"CONECT   98   97   99  310  311\n"
+"CONECT   99   98  100  312  313\n"
+"CONECT  100   99  101  314  315\n"
+"CONECT  101  100  102  102  316\n"
+"CONECT  102  101  101  103  317\n"
+"CONECT  103  102  104  318  319\n"
+"CONECT  104  103  105  320  321\n"
+"CONECT  105  104  106  322  323\n"
+"CONECT  106  105  107  324  325\n"
+"CONECT  107  106  108  326  327\n"
+"CONECT  108  107  172  328  329\n"
+"CONECT  109   16  110  110  111\n"
+"CONECT  110  109  109\n"
+"CONECT  111  109  112  330  331\n"
+"CONECT  112  111  113  332  333\n"
+"CONECT  113  112  114  334  335\n"
+"CONECT  114  113  115  336  337\n"
+"CONECT  115  114  116  338  339\n"
+"CONECT  116  115  117  340  341\n"
+"CONECT  117  116  118  342  343\n"
+"CONECT  118  117  119  119  344\n"
+"CONECT  119  118  118  120  345\n"
+"CONECT  120  119  121  346  347\n"
+"CONECT  121  120  122  348  349\n"
+"CONECT  122  121  123  350  351\n"
+"CONECT  123  122  124  352  353\n"
+"CONECT  124  123  125  354  355\n"
+"CONECT  125  124  170  356  357\n"
+"CONECT  126   17  127  127  128\n"
+"CONECT  127  126  126\n"
+"CONECT  128  126  129  358  359\n"
+"CONECT  129  128  130  360  361\n"
+"CONECT  130  129  131  362  363\n"
+"CONECT  131  130  132  364  365\n"
+"CONECT  132  131  133  366  367\n"
+"CONECT  133  132  134  368  369\n"
+"CONECT  134  133  135  370  371\n"
+"CONECT  135  134  136  136  372\n"
+"CONECT  136  135  135  137  373\n"
+"CONECT  137  136  138  374  375\n"
+"CONECT  138  137  139  376  377\n"
+"CONECT  139  138  140  378  379\n"
+"CONECT  140  139  141  380  381\n"
+"CONECT  141  140  142  382  383\n"
+"CONECT  142  141  174  384  385\n"
+"CONECT  143   15  144  144  145\n"
+"CONECT  144  143  143\n"
+"CONECT  145  143  146  386  387\n"
+"CONECT  146  145  147  388  389\n"
+"CONECT  147  146  148  390  391\n"
+"CONECT  148  147  149  392  393\n"
+"CONECT  149  148  150  394  395\n"
+"CONECT  150  149  151  396  397\n"
+"CONECT  151  150  152  398  399\n"
+"CONECT  152  151  153  153  400\n"
+"CONECT  153  152  152  154  401\n"
+"CONECT  154  153  155  402  403\n"
+"CONECT  155  154  156  404  405\n"
+"CONECT  156  155  157  406  407\n"
+"CONECT  157  156  158  408  409\n"
+"CONECT  158  157  159  410  411\n"
+"CONECT  159  158  160  412  413\n"
+"CONECT  160  159  161  414  415\n"
+"CONECT  161  160  416  417  418\n"
+"CONECT  162   57  163  419  420\n"
+"CONECT  163  162  421  422  423\n"
+"CONECT  164   40  165  424  425\n"
+"CONECT  165  164  426  427  428\n"
+"CONECT  166   91  167  429  430\n"
+"CONECT  167  166  431  432  433\n"
+"CONECT  168   74  169  434  435\n"
+"CONECT  169  168  436  437  438\n"
+"CONECT  170  125  171  439  440\n"
+"CONECT  171  170  441  442  443\n"
+"CONECT  172  108  173  444  445\n"
+"CONECT  173  172  446  447  448\n"
+"CONECT  174  142  175  449  450\n"
+"CONECT  175  174  451  452  453\n"
+"CONECT  176    1\n"
+"CONECT  177    2\n"
+"CONECT  178    3\n"
+"CONECT  179    4\n"
+"CONECT  180    5\n"
+"CONECT  181    9\n"
+"CONECT  182    9\n"
+"CONECT  183   10\n"
+"CONECT  184   12\n"
+"CONECT  185   13\n"
+"CONECT  186   14\n"
+"CONECT  187   14\n"
+"CONECT  188   19\n"
+"CONECT  189   19\n"
+"CONECT  190   26\n"
+"CONECT  191   26\n"
+"CONECT  192   27\n"
+"CONECT  193   27\n"
+"CONECT  194   28\n"
+"CONECT  195   28\n"
+"CONECT  196   29\n"
+"CONECT  197   29\n"
+"CONECT  198   30\n"
+"CONECT  199   30\n"
+"CONECT  200   31\n"
+"CONECT  201   31\n"
+"CONECT  202   32\n"
+"CONECT  203   32\n"
+"CONECT  204   33\n"
+"CONECT  205   34\n"
+"CONECT  206   35\n"
+"CONECT  207   35\n"
+"CONECT  208   36\n"
+"CONECT  209   36\n"
+"CONECT  210   37\n"
+"CONECT  211   37\n"
+"CONECT  212   38\n"
+"CONECT  213   38\n"
+"CONECT  214   39\n"
+"CONECT  215   39\n"
+"CONECT  216   40\n"
+"CONECT  217   40\n"
+"CONECT  218   43\n"
+"CONECT  219   43\n"
+"CONECT  220   44\n"
+"CONECT  221   44\n"
+"CONECT  222   45\n"
+"CONECT  223   45\n"
+"CONECT  224   46\n"
+"CONECT  225   46\n"
+"CONECT  226   47\n"
+"CONECT  227   47\n"
+"CONECT  228   48\n"
+"CONECT  229   48\n"
+"CONECT  230   49\n"
+"CONECT  231   49\n"
+"CONECT  232   50\n"
+"CONECT  233   51\n"
+"CONECT  234   52\n"
+"CONECT  235   52\n"
+"CONECT  236   53\n"
+"CONECT  237   53\n"
+"CONECT  238   54\n"
+"CONECT  239   54\n"
+"CONECT  240   55\n"
+"CONECT  241   55\n"
+"CONECT  242   56\n"
+"CONECT  243   56\n"
+"CONECT  244   57\n"
+"CONECT  245   57\n"
+"CONECT  246   60\n"
+"CONECT  247   60\n"
+"CONECT  248   61\n"
+"CONECT  249   61\n"
+"CONECT  250   62\n"
+"CONECT  251   62\n"
+"CONECT  252   63\n"
+"CONECT  253   63\n"
+"CONECT  254   64\n"
+"CONECT  255   64\n"
+"CONECT  256   65\n"
+"CONECT  257   65\n"
+"CONECT  258   66\n"
+"CONECT  259   66\n"
+"CONECT  260   67\n"
+"CONECT  261   68\n"
+"CONECT  262   69\n"
+"CONECT  263   69\n"
+"CONECT  264   70\n"
+"CONECT  265   70\n"
+"CONECT  266   71\n"
+"CONECT  267   71\n"
+"CONECT  268   72\n"
+"CONECT  269   72\n"
+"CONECT  270   73\n"
+"CONECT  271   73\n"
+"CONECT  272   74\n"
+"CONECT  273   74\n"
+"CONECT  274   77\n"
+"CONECT  275   77\n"
+"CONECT  276   78\n"
+"CONECT  277   78\n"
+"CONECT  278   79\n"
+"CONECT  279   79\n"
+"CONECT  280   80\n"
+"CONECT  281   80\n"
+"CONECT  282   81\n"
+"CONECT  283   81\n"
+"CONECT  284   82\n"
+"CONECT  285   82\n"
+"CONECT  286   83\n"
+"CONECT  287   83\n"
+"CONECT  288   84\n"
+"CONECT  289   85\n"
+"CONECT  290   86\n"
+"CONECT  291   86\n"
+"CONECT  292   87\n"
+"CONECT  293   87\n"
+"CONECT  294   88\n"
+"CONECT  295   88\n"
+"CONECT  296   89\n"
+"CONECT  297   89\n"
+"CONECT  298   90\n"
+"CONECT  299   90\n"
+"CONECT  300   91\n"
+"CONECT  301   91\n"
+"CONECT  302   94\n"
+"CONECT  303   94\n"
+"CONECT  304   95\n"
+"CONECT  305   95\n"
+"CONECT  306   96\n"
+"CONECT  307   96\n"
+"CONECT  308   97\n"
+"CONECT  309   97\n"
+"CONECT  310   98\n"
+"CONECT  311   98\n"
+"CONECT  312   99\n"
+"CONECT  313   99\n"
+"CONECT  314  100\n"
+"CONECT  315  100\n"
+"CONECT  316  101\n"
+"CONECT  317  102\n"
+"CONECT  318  103\n"
+"CONECT  319  103\n"
+"CONECT  320  104\n"
+"CONECT  321  104\n"
+"CONECT  322  105\n"
+"CONECT  323  105\n"
+"CONECT  324  106\n"
+"CONECT  325  106\n"
+"CONECT  326  107\n"
+"CONECT  327  107\n"
+"CONECT  328  108\n"
+"CONECT  329  108\n"
+"CONECT  330  111\n"
+"CONECT  331  111\n"
+"CONECT  332  112\n"
+"CONECT  333  112\n"
+"CONECT  334  113\n"
+"CONECT  335  113\n"
+"CONECT  336  114\n"
+"CONECT  337  114\n"
+"CONECT  338  115\n"
+"CONECT  339  115\n"
+"CONECT  340  116\n"
+"CONECT  341  116\n"
+"CONECT  342  117\n"
+"CONECT  343  117\n"
+"CONECT  344  118\n"
+"CONECT  345  119\n"
+"CONECT  346  120\n"
+"CONECT  347  120\n"
+"CONECT  348  121\n"
+"CONECT  349  121\n"
+"CONECT  350  122\n"
+"CONECT  351  122\n"
+"CONECT  352  123\n"
+"CONECT  353  123\n"
+"CONECT  354  124\n"
+"CONECT  355  124\n"
+"CONECT  356  125\n"
+"CONECT  357  125\n"
+"CONECT  358  128\n"
+"CONECT  359  128\n"
+"CONECT  360  129\n"
+"CONECT  361  129\n"
+"CONECT  362  130\n"
+"CONECT  363  130\n"
+"CONECT  364  131\n"
+"CONECT  365  131\n"
+"CONECT  366  132\n"
+"CONECT  367  132\n"
+"CONECT  368  133\n"
+"CONECT  369  133\n"
+"CONECT  370  134\n"
+"CONECT  371  134\n"
+"CONECT  372  135\n"
+"CONECT  373  136\n"
+"CONECT  374  137\n"
+"CONECT  375  137\n"
+"CONECT  376  138\n"
+"CONECT  377  138\n"
+"CONECT  378  139\n"
+"CONECT  379  139\n"
+"CONECT  380  140\n"
+"CONECT  381  140\n"
+"CONECT  382  141\n"
+"CONECT  383  141\n"
+"CONECT  384  142\n"
+"CONECT  385  142\n"
+"CONECT  386  145\n"
+"CONECT  387  145\n"
+"CONECT  388  146\n"
+"CONECT  389  146\n"
+"CONECT  390  147\n"
+"CONECT  391  147\n"
+"CONECT  392  148\n"
+"CONECT  393  148\n"
+"CONECT  394  149\n"
+"CONECT  395  149\n"
+"CONECT  396  150\n"
+"CONECT  397  150\n"
+"CONECT  398  151\n"
+"CONECT  399  151\n"
+"CONECT  400  152\n"
+"CONECT  401  153\n"
+"CONECT  402  154\n"
+"CONECT  403  154\n"
+"CONECT  404  155\n"
+"CONECT  405  155\n"
+"CONECT  406  156\n"
+"CONECT  407  156\n"
+"CONECT  408  157\n"
+"CONECT  409  157\n"
+"CONECT  410  158\n"
+"CONECT  411  158\n"
+"CONECT  412  159\n"
+"CONECT  413  159\n"
+"CONECT  414  160\n"
+"CONECT  415  160\n"
+"CONECT  416  161\n"
+"CONECT  417  161\n"
+"CONECT  418  161\n"
+"CONECT  419  162\n"
+"CONECT  420  162\n"
+"CONECT  421  163\n"
+"CONECT  422  163\n"
+"CONECT  423  163\n"
+"CONECT  424  164\n"
+"CONECT  425  164\n"
+"CONECT  426  165\n"
+"CONECT  427  165\n"
+"CONECT  428  165\n"
+"CONECT  429  166\n"
+"CONECT  430  166\n"
+"CONECT  431  167\n"
+"CONECT  432  167\n"
+"CONECT  433  167\n"
+"CONECT  434  168\n"
+"CONECT  435  168\n"
+"CONECT  436  169\n"
+"CONECT  437  169\n"
+"CONECT  438  169\n"
+"CONECT  439  170\n"
+"CONECT  440  170\n"
+"CONECT  441  171\n"
+"CONECT  442  171\n"
+"CONECT  443  171\n"
+"CONECT  444  172\n"
+"CONECT  445  172\n"
+"CONECT  446  173\n"
+"CONECT  447  173\n"
+"CONECT  448  173\n"
+"CONECT  449  174\n"
+"CONECT  450  174\n"
+"CONECT  451  175\n"
+"CONECT  452  175\n"
+"CONECT  453  175\n"
+"MASTER        0    0    0    0    0    0    0    0  453    0  453    0\n"
+"END\n"
+,
+"HEADER    Penicillin G, an antibiotic\n"
+"COMPND    al3077\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.542   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       1.415   1.509   0.000  1.00  0.00 \n"
+"HETATM    4  O           1       2.209   2.398  -0.083  1.00  0.00 \n"
+"HETATM    5  N           1       0.066   1.475   0.061  1.00  0.00 \n"
+"HETATM    6  N           1       2.125  -0.528   1.243  1.00  0.00 \n"
+"HETATM    7  C           1       2.235  -1.858   1.457  1.00  0.00 \n"
+"HETATM    8  O           1       2.669  -2.251   2.509  1.00  0.00 \n"
+"HETATM    9  C           1       1.827  -2.860   0.414  1.00  0.00 \n"
+"HETATM   10  C           1       1.446  -4.153   1.098  1.00  0.00 \n"
+"HETATM   11  C           1       0.143  -4.328   1.578  1.00  0.00 \n"
+"HETATM   12  C           1      -0.216  -5.521   2.214  1.00  0.00 \n"
+"HETATM   13  C           1       0.729  -6.540   2.373  1.00  0.00 \n"
+"HETATM   14  C           1       2.034  -6.363   1.902  1.00  0.00 \n"
+"HETATM   15  C           1       2.393  -5.168   1.268  1.00  0.00 \n"
+"HETATM   16  S           1      -0.818  -0.450   1.519  1.00  0.00 \n"
+"HETATM   17  C           1      -1.605   1.127   1.810  1.00  0.00 \n"
+"HETATM   18  C           1      -1.800   1.394   3.317  1.00  0.00 \n"
+"HETATM   19  C           1      -2.966   1.138   1.082  1.00  0.00 \n"
+"HETATM   20  C           1      -0.629   2.147   1.173  1.00  0.00 \n"
+"HETATM   21  C           1      -1.351   3.368   0.682  1.00  0.00 \n"
+"HETATM   22  O           1      -1.537   3.505  -0.499  1.00  0.00 \n"
+"HETATM   23  O           1      -2.048   4.114   1.557  1.00  0.00 \n"
+"HETATM   24  H           1      -0.466  -0.363  -0.916  1.00  0.00 \n"
+"HETATM   25  H           1       1.982  -0.387  -0.919  1.00  0.00 \n"
+"HETATM   26  H           1       2.409   0.115   1.973  1.00  0.00 \n"
+"HETATM   27  H           1       2.660  -3.033  -0.268  1.00  0.00 \n"
+"HETATM   28  H           1       0.971  -2.493  -0.151  1.00  0.00 \n"
+"HETATM   29  H           1      -0.596  -3.536   1.454  1.00  0.00 \n"
+"HETATM   30  H           1      -1.232  -5.657   2.584  1.00  0.00 \n"
+"HETATM   31  H           1       0.449  -7.470   2.868  1.00  0.00 \n"
+"HETATM   32  H           1       2.772  -7.155   2.030  1.00  0.00 \n"
+"HETATM   33  H           1       3.412  -5.032   0.906  1.00  0.00 \n"
+"HETATM   34  H           1      -0.839   1.345   3.829  1.00  0.00 \n"
+"HETATM   35  H           1      -2.470   0.644   3.739  1.00  0.00 \n"
+"HETATM   36  H           1      -2.233   2.384   3.459  1.00  0.00 \n"
+"HETATM   37  H           1      -3.586   0.322   1.454  1.00  0.00 \n"
+"HETATM   38  H           1      -2.811   1.012   0.010  1.00  0.00 \n"
+"HETATM   39  H           1      -3.480   2.082   1.263  1.00  0.00 \n"
+"HETATM   40  H           1       0.108   2.446   1.919  1.00  0.00 \n"
+"HETATM   41  H           1      -2.798   4.548   1.098  1.00  0.00 \n"
+"CONECT    1    2    5   16   24\n"
+"CONECT    2    1    3    6   25\n"
+"CONECT    3    2    4    4    5\n"
+"CONECT    4    3    3\n"
+"CONECT    5    1    3   20\n"
+"CONECT    6    2    7   26\n"
+"CONECT    7    6    8    8    9\n"
+"CONECT    8    7    7\n"
+"CONECT    9    7   10   27   28\n"
+"CONECT   10    9   11   11   15\n"
+"CONECT   11   10   10   12   29\n"
+"CONECT   12   11   13   13   30\n"
+"CONECT   13   12   12   14   31\n"
+"CONECT   14   13   15   15   32\n"
+"CONECT   15   10   14   14   33\n"
+"CONECT   16    1   17\n"
+"CONECT   17   16   18   19   20\n"
+"CONECT   18   17   34   35   36\n"
+"CONECT   19   17   37   38   39\n"
+"CONECT   20    5   17   21   40\n"
+"CONECT   21   20   22   22   23\n"
+"CONECT   22   21   21\n"
+"CONECT   23   21   41\n"
+"CONECT   24    1\n"
+"CONECT   25    2\n"
+"CONECT   26    6\n"
+"CONECT   27    9\n"
+"CONECT   28    9\n"
+"CONECT   29   11\n"
+"CONECT   30   12\n"
+"CONECT   31   13\n"
+"CONECT   32   14\n"
+"CONECT   33   15\n"
+"CONECT   34   18\n"
+"CONECT   35   18\n"
+"CONECT   36   18\n"
+"CONECT   37   19\n"
+"CONECT   38   19\n"
+"CONECT   39   19\n"
+"CONECT   40   20\n"
+"CONECT   41   23\n"
+"MASTER        0    0    0    0    0    0    0    0   41    0   41    0\n"
+"END\n"
+,
+"HEADER    Salvinorin A: A dissociative hallucinogen, kappa opioid receptor agonist\n"
+"ATOM      1  O           0      -1.578   3.509   1.054  0.00  0.00           O+0\n"
+"ATOM      2  O           0      -0.661  -3.341  -1.950  0.00  0.00           O+0\n"
+"ATOM      3  O           0      -0.961  -0.736  -2.292  0.00  0.00           O+0\n"
+"ATOM      4  O           0       0.223   4.284   1.789  0.00  0.00           O+0\n"
+"ATOM      5  O           0       4.133  -2.520   1.067  0.00  0.00           O+0\n"
+"ATOM      6  O           0       4.305  -2.225  -1.047  0.00  0.00           O+0\n"
+"ATOM      7  O           0      -5.473   1.972   2.519  0.00  0.00           O+0\n"
+"ATOM      8  O           0      -1.864  -4.598  -3.067  0.00  0.00           O+0\n"
+"ATOM      9  C           0       1.875  -0.263  -0.355  0.00  0.00           C+0\n"
+"ATOM     10  C           0      -0.335   1.379  -0.322  0.00  0.00           C+0\n"
+"ATOM     11  C           0       0.290  -0.090  -0.402  0.00  0.00           C+0\n"
+"ATOM     12  C           0       0.295   2.080   0.949  0.00  0.00           C+0\n"
+"ATOM     13  C           0       2.416   0.613   0.838  0.00  0.00           C+0\n"
+"ATOM     14  C           0       2.218  -1.798  -0.082  0.00  0.00           C+0\n"
+"ATOM     15  C           0       1.854   2.057   0.955  0.00  0.00           C+0\n"
+"ATOM     16  C           0      -1.892   1.349  -0.054  0.00  0.00           C+0\n"
+"ATOM     17  C           0      -0.312  -1.076  -1.312  0.00  0.00           C+0\n"
+"ATOM     18  C           0       1.427  -2.783  -1.008  0.00  0.00           C+0\n"
+"ATOM     19  C           0       2.599   0.182  -1.678  0.00  0.00           C+0\n"
+"ATOM     20  C           0      -0.152   2.242  -1.623  0.00  0.00           C+0\n"
+"ATOM     21  C           0      -0.102  -2.502  -1.056  0.00  0.00           C+0\n"
+"ATOM     22  C           0      -2.483   2.720   0.438  0.00  0.00           C+0\n"
+"ATOM     23  C           0      -0.364   3.344   1.274  0.00  0.00           C+0\n"
+"ATOM     24  C           0       3.632  -2.188  -0.023  0.00  0.00           C+0\n"
+"ATOM     25  C           0      -3.721   2.668   1.259  0.00  0.00           C+0\n"
+"ATOM     26  C           0      -4.516   3.764   1.594  0.00  0.00           C+0\n"
+"ATOM     27  C           0      -4.363   1.580   1.857  0.00  0.00           C+0\n"
+"ATOM     28  C           0      -1.768  -3.894  -2.073  0.00  0.00           C+0\n"
+"ATOM     29  C           0       5.353  -2.949   1.401  0.00  0.00           C+0\n"
+"ATOM     30  C           0      -5.577   3.309   2.365  0.00  0.00           C+0\n"
+"ATOM     31  C           0      -2.903  -3.782  -1.178  0.00  0.00           C+0\n"
+"ATOM     32  H           0      -0.032  -0.494   0.566  0.00  0.00           H+0\n"
+"ATOM     33  H           0       0.021   1.488   1.831  0.00  0.00           H+0\n"
+"ATOM     34  H           0       2.176   0.125   1.788  0.00  0.00           H+0\n"
+"ATOM     35  H           0       3.509   0.668   0.818  0.00  0.00           H+0\n"
+"ATOM     36  H           0       1.806  -2.023   0.910  0.00  0.00           H+0\n"
+"ATOM     37  H           0       2.250   2.682   0.154  0.00  0.00           H+0\n"
+"ATOM     38  H           0       2.226   2.485   1.891  0.00  0.00           H+0\n"
+"ATOM     39  H           0      -2.454   1.020  -0.933  0.00  0.00           H+0\n"
+"ATOM     40  H           0      -2.074   0.590   0.706  0.00  0.00           H+0\n"
+"ATOM     41  H           0       1.574  -3.811  -0.660  0.00  0.00           H+0\n"
+"ATOM     42  H           0       1.827  -2.744  -2.026  0.00  0.00           H+0\n"
+"ATOM     43  H           0       2.260  -0.386  -2.545  0.00  0.00           H+0\n"
+"ATOM     44  H           0       2.509   1.228  -1.923  0.00  0.00           H+0\n"
+"ATOM     45  H           0       3.681   0.081  -1.611  0.00  0.00           H+0\n"
+"ATOM     46  H           0      -0.558   1.749  -2.507  0.00  0.00           H+0\n"
+"ATOM     47  H           0      -0.638   3.215  -1.562  0.00  0.00           H+0\n"
+"ATOM     48  H           0       0.868   2.520  -1.836  0.00  0.00           H+0\n"
+"ATOM     49  H           0      -0.497  -2.735  -0.061  0.00  0.00           H+0\n"
+"ATOM     50  H           0      -2.764   3.279  -0.460  0.00  0.00           H+0\n"
+"ATOM     51  H           0      -4.357   4.736   1.321  0.00  0.00           H+0\n"
+"ATOM     52  H           0      -4.064   0.605   1.821  0.00  0.00           H+0\n"
+"ATOM     53  H           0       5.360  -3.151   2.472  0.00  0.00           H+0\n"
+"ATOM     54  H           0       6.112  -2.193   1.186  0.00  0.00           H+0\n"
+"ATOM     55  H           0       5.605  -3.873   0.875  0.00  0.00           H+0\n"
+"ATOM     56  H           0      -6.323   3.886   2.756  0.00  0.00           H+0\n"
+"ATOM     57  H           0      -3.222  -2.742  -1.105  0.00  0.00           H+0\n"
+"ATOM     58  H           0      -2.636  -4.143  -0.184  0.00  0.00           H+0\n"
+"ATOM     59  H           0      -3.759  -4.370  -1.521  0.00  0.00           H+0\n"
+"CONECT    1   22   23    0    0                                         NONE  65\n"
+"CONECT    2   21   28    0    0                                         NONE  66\n"
+"CONECT    3   17    0    0    0                                         NONE  67\n"
+"CONECT    4   23    0    0    0                                         NONE  68\n"
+"CONECT    5   24   29    0    0                                         NONE  69\n"
+"CONECT    6   24    0    0    0                                         NONE  70\n"
+"CONECT    7   27   30    0    0                                         NONE  71\n"
+"CONECT    8   28    0    0    0                                         NONE  72\n"
+"CONECT    9   11   13   14   19                                         NONE  73\n"
+"CONECT   10   11   12   16   20                                         NONE  74\n"
+"CONECT   11    9   10   17   32                                         NONE  75\n"
+"CONECT   12   10   15   23   33                                         NONE  76\n"
+"CONECT   13    9   15   34   35                                         NONE  77\n"
+"CONECT   14    9   18   24   36                                         NONE  78\n"
+"CONECT   15   12   13   37   38                                         NONE  79\n"
+"CONECT   16   10   22   39   40                                         NONE  80\n"
+"CONECT   17    3   11   21    0                                         NONE  81\n"
+"CONECT   18   14   21   41   42                                         NONE  82\n"
+"CONECT   19    9   43   44   45                                         NONE  83\n"
+"CONECT   20   10   46   47   48                                         NONE  84\n"
+"CONECT   21    2   17   18   49                                         NONE  85\n"
+"CONECT   22    1   16   25   50                                         NONE  86\n"
+"CONECT   23    1    4   12    0                                         NONE  87\n"
+"CONECT   24    5    6   14    0                                         NONE  88\n"
+"CONECT   25   22   26   27    0                                         NONE  89\n"
+"CONECT   26   25   30   51    0                                         NONE  90\n"
+"CONECT   27    7   25   52    0                                         NONE  91\n"
+"CONECT   28    2    8   31    0                                         NONE  92\n"
+"CONECT   29    5   53   54   55                                         NONE  93\n"
+"CONECT   30    7   26   56    0                                         NONE  94\n"
+"CONECT   31   28   57   58   59                                         NONE  95\n"
+"END                                                                     NONE  96\n"
+,
+"HEADER    Sarin: S Enantiomer, a chemical warfare agent\n"
+"COMPND    al3023\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  P           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  F           1       1.779   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1      -0.611   1.725   0.000  1.00  0.00 \n"
+"HETATM    4  O           1      -0.599  -0.840   1.463  1.00  0.00 \n"
+"HETATM    5  O           1      -0.599  -0.841  -1.466  1.00  0.00 \n"
+"HETATM    6  C           1      -1.898  -1.369  -1.304  1.00  0.00 \n"
+"HETATM    7  C           1      -1.817  -2.772  -0.672  1.00  0.00 \n"
+"HETATM    8  C           1      -2.555  -1.476  -2.694  1.00  0.00 \n"
+"HETATM    9  H           1      -0.248   2.240  -0.890  1.00  0.00 \n"
+"HETATM   10  H           1      -0.248   2.239   0.891  1.00  0.00 \n"
+"HETATM   11  H           1      -1.701   1.724   0.000  1.00  0.00 \n"
+"HETATM   12  H           1      -2.510  -0.718  -0.679  1.00  0.00 \n"
+"HETATM   13  H           1      -1.372  -2.712   0.320  1.00  0.00 \n"
+"HETATM   14  H           1      -1.203  -3.414  -1.303  1.00  0.00 \n"
+"HETATM   15  H           1      -2.818  -3.194  -0.591  1.00  0.00 \n"
+"HETATM   16  H           1      -1.961  -2.124  -3.339  1.00  0.00 \n"
+"HETATM   17  H           1      -3.561  -1.885  -2.595  1.00  0.00 \n"
+"HETATM   18  H           1      -2.613  -0.482  -3.136  1.00  0.00 \n"
+"CONECT    1    2    3    4    4    5\n"
+"CONECT    2    1\n"
+"CONECT    3    1    9   10   11\n"
+"CONECT    4    1    1\n"
+"CONECT    5    1    6\n"
+"CONECT    6    5    7    8   12\n"
+"CONECT    7    6   13   14   15\n"
+"CONECT    8    6   16   17   18\n"
+"CONECT    9    3\n"
+"CONECT   10    3\n"
+"CONECT   11    3\n"
+"CONECT   12    6\n"
+"CONECT   13    7\n"
+"CONECT   14    7\n"
+"CONECT   15    7\n"
+"CONECT   16    8\n"
+"CONECT   17    8\n"
+"CONECT   18    8\n"
+"MASTER        0    0    0    0    0    0    0    0   18    0   18    0\n"
+"END\n"
+,
+"HEADER    Strychnine: Nux Vomica\n"
+"COMPND    al3061\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Wed Aug 30 12:33:12 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.395   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.124   1.193   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.414   2.398  -0.067  1.00  0.00 \n"
+"HETATM    5  C           1       0.014   2.401  -0.115  1.00  0.00 \n"
+"HETATM    6  C           1      -0.709   1.203  -0.087  1.00  0.00 \n"
+"HETATM    7  C           1       1.911  -1.410   0.160  1.00  0.00 \n"
+"HETATM    8  N           1      -0.471  -1.291  -0.057  1.00  0.00 \n"
+"HETATM    9  C           1      -1.720  -1.604  -0.472  1.00  0.00 \n"
+"HETATM   10  O           1      -2.589  -0.778  -0.359  1.00  0.00 \n"
+"HETATM   11  C           1       0.645  -2.239  -0.189  1.00  0.00 \n"
+"HETATM   12  C           1      -1.941  -2.698  -1.483  1.00  0.00 \n"
+"HETATM   13  C           1      -0.687  -3.549  -1.797  1.00  0.00 \n"
+"HETATM   14  H           1       0.525  -3.093   0.477  1.00  0.00 \n"
+"HETATM   15  C           1       0.573  -2.674  -1.656  1.00  0.00 \n"
+"HETATM   16  H           1      -0.775  -3.908  -2.822  1.00  0.00 \n"
+"HETATM   17  O           1      -0.654  -4.641  -0.904  1.00  0.00 \n"
+"HETATM   18  C           1       0.221  -5.671  -1.313  1.00  0.00 \n"
+"HETATM   19  C           1       1.595  -5.446  -0.726  1.00  0.00 \n"
+"HETATM   20  C           1       2.356  -4.403  -1.088  1.00  0.00 \n"
+"HETATM   21  C           1       3.723  -4.222  -0.464  1.00  0.00 \n"
+"HETATM   22  C           1       1.893  -3.351  -2.072  1.00  0.00 \n"
+"HETATM   23  H           1       0.431  -1.791  -2.279  1.00  0.00 \n"
+"HETATM   24  H           1       1.803  -3.769  -3.074  1.00  0.00 \n"
+"HETATM   25  C           1       2.942  -2.222  -2.062  1.00  0.00 \n"
+"HETATM   26  C           1       3.199  -1.816  -0.595  1.00  0.00 \n"
+"HETATM   27  C           1       2.322  -1.641   1.618  1.00  0.00 \n"
+"HETATM   28  C           1       3.109  -2.956   1.512  1.00  0.00 \n"
+"HETATM   29  N           1       3.783  -2.911   0.202  1.00  0.00 \n"
+"HETATM   30  H           1       3.212   1.188   0.059  1.00  0.00 \n"
+"HETATM   31  H           1       1.957   3.343  -0.078  1.00  0.00 \n"
+"HETATM   32  H           1      -0.520   3.349  -0.172  1.00  0.00 \n"
+"HETATM   33  H           1      -1.798   1.219  -0.127  1.00  0.00 \n"
+"HETATM   34  H           1      -2.263  -2.218  -2.408  1.00  0.00 \n"
+"HETATM   35  H           1      -2.740  -3.355  -1.139  1.00  0.00 \n"
+"HETATM   36  H           1       0.290  -5.733  -2.400  1.00  0.00 \n"
+"HETATM   37  H           1      -0.163  -6.618  -0.935  1.00  0.00 \n"
+"HETATM   38  H           1       1.974  -6.159   0.006  1.00  0.00 \n"
+"HETATM   39  H           1       4.483  -4.272  -1.243  1.00  0.00 \n"
+"HETATM   40  H           1       3.923  -5.012   0.260  1.00  0.00 \n"
+"HETATM   41  H           1       2.578  -1.363  -2.625  1.00  0.00 \n"
+"HETATM   42  H           1       3.871  -2.566  -2.519  1.00  0.00 \n"
+"HETATM   43  H           1       3.898  -0.980  -0.573  1.00  0.00 \n"
+"HETATM   44  H           1       1.464  -1.724   2.285  1.00  0.00 \n"
+"HETATM   45  H           1       2.987  -0.840   1.943  1.00  0.00 \n"
+"HETATM   46  H           1       2.413  -3.794   1.551  1.00  0.00 \n"
+"HETATM   47  H           1       3.833  -3.042   2.322  1.00  0.00 \n"
+"CONECT    1    2    2    6    8\n"
+"CONECT    2    1    1    3    7\n"
+"CONECT    3    2    4    4   30\n"
+"CONECT    4    3    3    5   31\n"
+"CONECT    5    4    6    6   32\n"
+"CONECT    6    1    5    5   33\n"
+"CONECT    7    2   11   26   27\n"
+"CONECT    8    1    9   11\n"
+"CONECT    9    8   10   10   12\n"
+"CONECT   10    9    9\n"
+"CONECT   11    7    8   14   15\n"
+"CONECT   12    9   13   34   35\n"
+"CONECT   13   12   15   16   17\n"
+"CONECT   14   11\n"
+"CONECT   15   11   13   22   23\n"
+"CONECT   16   13\n"
+"CONECT   17   13   18\n"
+"CONECT   18   17   19   36   37\n"
+"CONECT   19   18   20   20   38\n"
+"CONECT   20   19   19   21   22\n"
+"CONECT   21   20   29   39   40\n"
+"CONECT   22   15   20   24   25\n"
+"CONECT   23   15\n"
+"CONECT   24   22\n"
+"CONECT   25   22   26   41   42\n"
+"CONECT   26    7   25   29   43\n"
+"CONECT   27    7   28   44   45\n"
+"CONECT   28   27   29   46   47\n"
+"CONECT   29   21   26   28\n"
+"CONECT   30    3\n"
+"CONECT   31    4\n"
+"CONECT   32    5\n"
+"CONECT   33    6\n"
+"CONECT   34   12\n"
+"CONECT   35   12\n"
+"CONECT   36   18\n"
+"CONECT   37   18\n"
+"CONECT   38   19\n"
+"CONECT   39   21\n"
+"CONECT   40   21\n"
+"CONECT   41   25\n"
+"CONECT   42   25\n"
+"CONECT   43   26\n"
+"CONECT   44   27\n"
+"CONECT   45   27\n"
+"CONECT   46   28\n"
+"CONECT   47   28\n"
+"MASTER        0    0    0    0    0    0    0    0   47    0   47    0\n"
+"END\n"
+,
+"HEADER    Sucrose: Sugar\n"
+"COMPND    nat0013\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.542   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.041   1.457   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.414   2.181   1.207  1.00  0.00 \n"
+"HETATM    5  C           1      -0.117   2.034   1.128  1.00  0.00 \n"
+"HETATM    6  O           1      -0.472   0.668   1.149  1.00  0.00 \n"
+"HETATM    7  H           1      -0.566   2.548   1.978  1.00  0.00 \n"
+"HETATM    8  O           1      -0.572   2.607  -0.076  1.00  0.00 \n"
+"HETATM    9  C           1      -1.867   3.149  -0.193  1.00  0.00 \n"
+"HETATM   10  C           1      -1.993   3.815  -1.579  1.00  0.00 \n"
+"HETATM   11  C           1      -2.960   2.084  -0.002  1.00  0.00 \n"
+"HETATM   12  O           1      -2.117   4.104   0.816  1.00  0.00 \n"
+"HETATM   13  C           1      -3.516   4.220   0.978  1.00  0.00 \n"
+"HETATM   14  C           1      -4.167   2.959   0.369  1.00  0.00 \n"
+"HETATM   15  H           1      -0.368   0.500  -0.896  1.00  0.00 \n"
+"HETATM   16  H           1       1.901  -0.501   0.899  1.00  0.00 \n"
+"HETATM   17  H           1       1.728   1.949  -0.923  1.00  0.00 \n"
+"HETATM   18  H           1       1.774   1.726   2.130  1.00  0.00 \n"
+"HETATM   19  H           1      -1.836   3.065  -2.355  1.00  0.00 \n"
+"HETATM   20  H           1      -2.981   4.259  -1.698  1.00  0.00 \n"
+"HETATM   21  H           1      -3.133   1.511  -0.914  1.00  0.00 \n"
+"HETATM   22  H           1      -3.871   5.100   0.441  1.00  0.00 \n"
+"HETATM   23  H           1      -4.821   2.452   1.081  1.00  0.00 \n"
+"HETATM   24  C           1      -3.859   4.364   2.474  1.00  0.00 \n"
+"HETATM   25  O           1      -5.279   4.442   2.639  1.00  0.00 \n"
+"HETATM   26  O           1      -4.897   3.325  -0.807  1.00  0.00 \n"
+"HETATM   27  O           1      -2.638   1.202   1.079  1.00  0.00 \n"
+"HETATM   28  O           1      -0.995   4.834  -1.694  1.00  0.00 \n"
+"HETATM   29  C           1      -0.513  -1.453   0.003  1.00  0.00 \n"
+"HETATM   30  O           1      -1.944  -1.459  -0.055  1.00  0.00 \n"
+"HETATM   31  O           1       2.039  -0.690  -1.152  1.00  0.00 \n"
+"HETATM   32  O           1       3.468   1.480   0.101  1.00  0.00 \n"
+"HETATM   33  O           1       1.772   3.567   1.189  1.00  0.00 \n"
+"HETATM   34  H           1      -3.396   5.270   2.866  1.00  0.00 \n"
+"HETATM   35  H           1      -3.480   3.504   3.024  1.00  0.00 \n"
+"HETATM   36  H           1      -5.622   5.216   2.180  1.00  0.00 \n"
+"HETATM   37  H           1      -5.302   2.544  -1.199  1.00  0.00 \n"
+"HETATM   38  H           1      -2.661   1.671   1.919  1.00  0.00 \n"
+"HETATM   39  H           1      -1.056   5.255  -2.558  1.00  0.00 \n"
+"HETATM   40  H           1      -0.180  -1.958   0.910  1.00  0.00 \n"
+"HETATM   41  H           1      -0.118  -1.977  -0.868  1.00  0.00 \n"
+"HETATM   42  H           1      -2.305  -1.058   0.741  1.00  0.00 \n"
+"HETATM   43  H           1       1.728  -0.261  -1.956  1.00  0.00 \n"
+"HETATM   44  H           1       3.781   2.391   0.099  1.00  0.00 \n"
+"HETATM   45  H           1       1.428   3.987   0.394  1.00  0.00 \n"
+"CONECT    1    2    6   15   29\n"
+"CONECT    2    1    3   16   31\n"
+"CONECT    3    2    4   17   32\n"
+"CONECT    4    3    5   18   33\n"
+"CONECT    5    4    6    7    8\n"
+"CONECT    6    1    5\n"
+"CONECT    7    5\n"
+"CONECT    8    5    9\n"
+"CONECT    9    8   10   11   12\n"
+"CONECT   10    9   19   20   28\n"
+"CONECT   11    9   14   21   27\n"
+"CONECT   12    9   13\n"
+"CONECT   13   12   14   22   24\n"
+"CONECT   14   11   13   23   26\n"
+"CONECT   15    1\n"
+"CONECT   16    2\n"
+"CONECT   17    3\n"
+"CONECT   18    4\n"
+"CONECT   19   10\n"
+"CONECT   20   10\n"
+"CONECT   21   11\n"
+"CONECT   22   13\n"
+"CONECT   23   14\n"
+"CONECT   24   13   25   34   35\n"
+"CONECT   25   24   36\n"
+"CONECT   26   14   37\n"
+"CONECT   27   11   38\n"
+"CONECT   28   10   39\n"
+"CONECT   29    1   30   40   41\n"
+"CONECT   30   29   42\n"
+"CONECT   31    2   43\n"
+"CONECT   32    3   44\n"
+"CONECT   33    4   45\n"
+"CONECT   34   24\n"
+"CONECT   35   24\n"
+"CONECT   36   25\n"
+"CONECT   37   26\n"
+"CONECT   38   27\n"
+"CONECT   39   28\n"
+"CONECT   40   29\n"
+"CONECT   41   29\n"
+"CONECT   42   30\n"
+"CONECT   43   31\n"
+"CONECT   44   32\n"
+"CONECT   45   33\n"
+"MASTER        0    0    0    0    0    0    0    0   45    0   45    0\n"
+"END\n"
+,
+"HEADER    (S)-Thalidomide, the teratogenic enantiomer\n"
+"COMPND    jb03stha\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Mon Sep 18 15:35:27 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.402   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.128   1.197   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.396   2.389  -0.011  1.00  0.00 \n"
+"HETATM    5  C           1       0.003   2.388  -0.010  1.00  0.00 \n"
+"HETATM    6  C           1      -0.728   1.196   0.001  1.00  0.00 \n"
+"HETATM    7  C           1      -0.415   3.783   0.056  1.00  0.00 \n"
+"HETATM    8  O           1      -1.550   4.177   0.150  1.00  0.00 \n"
+"HETATM    9  N           1       0.698   4.553   0.096  1.00  0.00 \n"
+"HETATM   10  C           1       1.812   3.785   0.053  1.00  0.00 \n"
+"HETATM   11  O           1       2.946   4.181   0.146  1.00  0.00 \n"
+"HETATM   12  C           1       0.702   6.005   0.319  1.00  0.00 \n"
+"HETATM   13  C           1       1.020   6.278   1.801  1.00  0.00 \n"
+"HETATM   14  C           1       1.130   7.799   2.000  1.00  0.00 \n"
+"HETATM   15  C           1       2.180   8.336   1.068  1.00  0.00 \n"
+"HETATM   16  O           1       2.814   9.307   1.391  1.00  0.00 \n"
+"HETATM   17  N           1       2.428   7.747  -0.124  1.00  0.00 \n"
+"HETATM   18  C           1       1.757   6.647  -0.538  1.00  0.00 \n"
+"HETATM   19  O           1       2.022   6.158  -1.607  1.00  0.00 \n"
+"HETATM   20  H           1      -0.535  -0.949   0.010  1.00  0.00 \n"
+"HETATM   21  H           1       1.938  -0.949   0.010  1.00  0.00 \n"
+"HETATM   22  H           1       3.217   1.203   0.020  1.00  0.00 \n"
+"HETATM   23  H           1      -1.817   1.201   0.022  1.00  0.00 \n"
+"HETATM   24  H           1      -0.272   6.423   0.067  1.00  0.00 \n"
+"HETATM   25  H           1       1.968   5.808   2.060  1.00  0.00 \n"
+"HETATM   26  H           1       0.228   5.873   2.432  1.00  0.00 \n"
+"HETATM   27  H           1       1.408   8.016   3.031  1.00  0.00 \n"
+"HETATM   28  H           1       0.173   8.268   1.775  1.00  0.00 \n"
+"HETATM   29  H           1       3.142   8.141  -0.727  1.00  0.00 \n"
+"CONECT    1    2    2    6   20\n"
+"CONECT    2    1    1    3   21\n"
+"CONECT    3    2    4    4   22\n"
+"CONECT    4    3    3    5   10\n"
+"CONECT    5    4    6    6    7\n"
+"CONECT    6    1    5    5   23\n"
+"CONECT    7    5    8    8    9\n"
+"CONECT    8    7    7\n"
+"CONECT    9    7   10   12\n"
+"CONECT   10    4    9   11   11\n"
+"CONECT   11   10   10\n"
+"CONECT   12    9   13   18   24\n"
+"CONECT   13   12   14   25   26\n"
+"CONECT   14   13   15   27   28\n"
+"CONECT   15   14   16   16   17\n"
+"CONECT   16   15   15\n"
+"CONECT   17   15   18   29\n"
+"CONECT   18   12   17   19   19\n"
+"CONECT   19   18   18\n"
+"CONECT   20    1\n"
+"CONECT   21    2\n"
+"CONECT   22    3\n"
+"CONECT   23    6\n"
+"CONECT   24   12\n"
+"CONECT   25   13\n"
+"CONECT   26   13\n"
+"CONECT   27   14\n"
+"CONECT   28   14\n"
+"CONECT   29   17\n"
+"MASTER        0    0    0    0    0    0    0    0   29    0   29    0\n"
+"END\n"
+,
+"HEADER    Thymine: Pyrimidine base nucleotide\n"
+"COMPND    jb09thye\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Tue Sep 19 21:46:02 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.399   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.068   1.228   0.000  1.00  0.00 \n"
+"HETATM    4  N           1       1.356   2.377  -0.004  1.00  0.00 \n"
+"HETATM    5  C           1       0.004   2.350  -0.006  1.00  0.00 \n"
+"HETATM    6  N           1      -0.667   1.176  -0.004  1.00  0.00 \n"
+"HETATM    7  O           1      -0.611   3.385  -0.006  1.00  0.00 \n"
+"HETATM    8  O           1       3.272   1.261   0.006  1.00  0.00 \n"
+"HETATM    9  C           1       2.173  -1.300   0.014  1.00  0.00 \n"
+"HETATM   10  H           1      -0.549  -0.941   0.006  1.00  0.00 \n"
+"HETATM   11  H           1       1.840   3.268  -0.003  1.00  0.00 \n"
+"HETATM   12  H           1      -1.681   1.178  -0.004  1.00  0.00 \n"
+"HETATM   13  H           1       1.632  -2.055  -0.555  1.00  0.00 \n"
+"HETATM   14  H           1       2.293  -1.638   1.044  1.00  0.00 \n"
+"HETATM   15  H           1       3.155  -1.146  -0.433  1.00  0.00 \n"
+"CONECT    1    2    2    6   10\n"
+"CONECT    2    1    1    3    9\n"
+"CONECT    3    2    4    8    8\n"
+"CONECT    4    3    5   11\n"
+"CONECT    5    4    6    7    7\n"
+"CONECT    6    1    5   12\n"
+"CONECT    7    5    5\n"
+"CONECT    8    3    3\n"
+"CONECT    9    2   13   14   15\n"
+"CONECT   10    1\n"
+"CONECT   11    4\n"
+"CONECT   12    6\n"
+"CONECT   13    9\n"
+"CONECT   14    9\n"
+"CONECT   15    9\n"
+"MASTER        0    0    0    0    0    0    0    0   15    0   15    0\n"
+"END\n"
+,
+"COMPND    Viagra\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"REMARK    from a model provided by Dr Eric Walters\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Mon Oct 16 12:17:54 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.398   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.105   1.207   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.417   2.427  -0.037  1.00  0.00 \n"
+"HETATM    5  C           1       0.017   2.422  -0.014  1.00  0.00 \n"
+"HETATM    6  C           1      -0.692   1.216  -0.005  1.00  0.00 \n"
+"HETATM    7  H           1      -0.545  -0.944   0.023  1.00  0.00 \n"
+"HETATM    8  H           1       1.939  -0.946   0.029  1.00  0.00 \n"
+"HETATM    9  H           1      -0.531   3.364  -0.022  1.00  0.00 \n"
+"HETATM   10  C           1       2.100   3.733  -0.053  1.00  0.00 \n"
+"HETATM   11  N           1       3.453   3.848  -0.302  1.00  0.00 \n"
+"HETATM   12  C           1       4.091   5.067  -0.302  1.00  0.00 \n"
+"HETATM   13  C           1       3.259   6.246  -0.033  1.00  0.00 \n"
+"HETATM   14  C           1       1.897   6.080   0.190  1.00  0.00 \n"
+"HETATM   15  N           1       1.310   4.840   0.169  1.00  0.00 \n"
+"HETATM   16  O           1       5.271   5.168  -0.544  1.00  0.00 \n"
+"HETATM   17  H           1       4.029   2.992  -0.569  1.00  0.00 \n"
+"HETATM   18  N           1       3.538   7.572   0.006  1.00  0.00 \n"
+"HETATM   19  N           1       2.406   8.264   0.248  1.00  0.00 \n"
+"HETATM   20  C           1       1.373   7.363   0.369  1.00  0.00 \n"
+"HETATM   21  C           1       4.863   8.163  -0.230  1.00  0.00 \n"
+"HETATM   22  H           1       4.799   9.247  -0.133  1.00  0.00 \n"
+"HETATM   23  H           1       5.200   7.907  -1.235  1.00  0.00 \n"
+"HETATM   24  H           1       5.570   7.774   0.501  1.00  0.00 \n"
+"HETATM   25  C           1      -0.079   7.701   0.624  1.00  0.00 \n"
+"HETATM   26  C           1      -0.226   9.225   0.805  1.00  0.00 \n"
+"HETATM   27  H           1      -0.415   7.190   1.526  1.00  0.00 \n"
+"HETATM   28  H           1      -0.680   7.372  -0.224  1.00  0.00 \n"
+"HETATM   29  C           1      -1.702   9.584   1.072  1.00  0.00 \n"
+"HETATM   30  H           1       0.112   9.732  -0.099  1.00  0.00 \n"
+"HETATM   31  H           1       0.383   9.550   1.649  1.00  0.00 \n"
+"HETATM   32  H           1      -1.796  10.663   1.198  1.00  0.00 \n"
+"HETATM   33  H           1      -2.043   9.083   1.978  1.00  0.00 \n"
+"HETATM   34  H           1      -2.315   9.264   0.229  1.00  0.00 \n"
+"HETATM   35  O           1       3.461   1.164   0.124  1.00  0.00 \n"
+"HETATM   36  C           1       3.859   0.886   1.450  1.00  0.00 \n"
+"HETATM   37  C           1       3.396   1.998   2.414  1.00  0.00 \n"
+"HETATM   38  H           1       4.947   0.824   1.480  1.00  0.00 \n"
+"HETATM   39  H           1       3.443  -0.069   1.771  1.00  0.00 \n"
+"HETATM   40  H           1       3.774   1.788   3.414  1.00  0.00 \n"
+"HETATM   41  H           1       2.307   2.037   2.446  1.00  0.00 \n"
+"HETATM   42  H           1       3.786   2.959   2.077  1.00  0.00 \n"
+"HETATM   43  S           1      -2.443   1.230   0.022  1.00  0.00 \n"
+"HETATM   44  N           1      -3.045  -0.296  -0.555  1.00  0.00 \n"
+"HETATM   45  C           1      -4.498  -0.382  -0.345  1.00  0.00 \n"
+"HETATM   46  C           1      -4.996  -1.765  -0.804  1.00  0.00 \n"
+"HETATM   47  N           1      -4.674  -1.957  -2.227  1.00  0.00 \n"
+"HETATM   48  C           1      -3.222  -1.855  -2.442  1.00  0.00 \n"
+"HETATM   49  C           1      -2.728  -0.471  -1.980  1.00  0.00 \n"
+"HETATM   50  H           1      -5.005   0.395  -0.919  1.00  0.00 \n"
+"HETATM   51  H           1      -4.725  -0.254   0.715  1.00  0.00 \n"
+"HETATM   52  H           1      -6.076  -1.822  -0.662  1.00  0.00 \n"
+"HETATM   53  H           1      -4.513  -2.539  -0.208  1.00  0.00 \n"
+"HETATM   54  H           1      -2.998  -1.979  -3.502  1.00  0.00 \n"
+"HETATM   55  H           1      -2.707  -2.629  -1.872  1.00  0.00 \n"
+"HETATM   56  H           1      -3.222   0.303  -2.569  1.00  0.00 \n"
+"HETATM   57  H           1      -1.651  -0.407  -2.135  1.00  0.00 \n"
+"HETATM   58  O           1      -2.929   2.282  -0.818  1.00  0.00 \n"
+"HETATM   59  O           1      -2.893   1.442   1.364  1.00  0.00 \n"
+"HETATM   60  C           1      -5.177  -3.257  -2.700  1.00  0.00 \n"
+"HETATM   61  H           1      -4.954  -3.372  -3.760  1.00  0.00 \n"
+"HETATM   62  H           1      -6.257  -3.305  -2.557  1.00  0.00 \n"
+"HETATM   63  H           1      -4.703  -4.065  -2.142  1.00  0.00 \n"
+"CONECT    1    2    2    6    7\n"
+"CONECT    2    1    1    3    8\n"
+"CONECT    3    2    4    4   35\n"
+"CONECT    4    3    3    5   10\n"
+"CONECT    5    4    6    6    9\n"
+"CONECT    6    1    5    5   43\n"
+"CONECT    7    1\n"
+"CONECT    8    2\n"
+"CONECT    9    5\n"
+"CONECT   10    4   11   15   15\n"
+"CONECT   11   10   12   17\n"
+"CONECT   12   11   13   16   16\n"
+"CONECT   13   12   14   14   18\n"
+"CONECT   14   13   13   15   20\n"
+"CONECT   15   10   14   14\n"
+"CONECT   16   12   12\n"
+"CONECT   17   11\n"
+"CONECT   18   13   19   21\n"
+"CONECT   19   18   20   20\n"
+"CONECT   20   14   19   19   25\n"
+"CONECT   21   18   22   23   24\n"
+"CONECT   22   21\n"
+"CONECT   23   21\n"
+"CONECT   24   21\n"
+"CONECT   25   20   26   27   28\n"
+"CONECT   26   25   29   30   31\n"
+"CONECT   27   25\n"
+"CONECT   28   25\n"
+"CONECT   29   26   32   33   34\n"
+"CONECT   30   26\n"
+"CONECT   31   26\n"
+"CONECT   32   29\n"
+"CONECT   33   29\n"
+"CONECT   34   29\n"
+"CONECT   35    3   36\n"
+"CONECT   36   35   37   38   39\n"
+"CONECT   37   36   40   41   42\n"
+"CONECT   38   36\n"
+"CONECT   39   36\n"
+"CONECT   40   37\n"
+"CONECT   41   37\n"
+"CONECT   42   37\n"
+"CONECT   43    6   44   58   59\n"
+"CONECT   44   43   45   49\n"
+"CONECT   45   44   46   50   51\n"
+"CONECT   46   45   47   52   53\n"
+"CONECT   47   46   48   60\n"
+"CONECT   48   47   49   54   55\n"
+"CONECT   49   44   48   56   57\n"
+"CONECT   50   45\n"
+"CONECT   51   45\n"
+"CONECT   52   46\n"
+"CONECT   53   46\n"
+"CONECT   54   48\n"
+"CONECT   55   48\n"
+"CONECT   56   49\n"
+"CONECT   57   49\n"
+"CONECT   58   43\n"
+"CONECT   59   43\n"
+"CONECT   60   47   61   62   63\n"
+"CONECT   61   60\n"
+"CONECT   62   60\n"
+"CONECT   63   60\n"
+"MASTER        0    0    0    0    0    0    0    0   63    0   63    0\n"
+"END\n"
+,
+"HEADER    Pyridoxine: Vitamin B6\n"
+"COMPND    c8h11no3\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.399   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       2.095   1.214   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       1.381   2.418   0.018  1.00  0.00 \n"
+"HETATM    5  C           1      -0.018   2.390   0.005  1.00  0.00 \n"
+"HETATM    6  N           1      -0.688   1.189  -0.006  1.00  0.00 \n"
+"HETATM    7  C           1      -0.754  -1.311   0.010  1.00  0.00 \n"
+"HETATM    8  O           1       2.079  -1.180   0.011  1.00  0.00 \n"
+"HETATM    9  C           1       3.608   1.210   0.001  1.00  0.00 \n"
+"HETATM   10  O           1       4.077   1.576   1.303  1.00  0.00 \n"
+"HETATM   11  C           1       2.102   3.747   0.058  1.00  0.00 \n"
+"HETATM   12  O           1       1.197   4.767   0.493  1.00  0.00 \n"
+"HETATM   13  H           1      -0.583   3.322   0.008  1.00  0.00 \n"
+"HETATM   14  H           1      -0.438  -1.905   0.867  1.00  0.00 \n"
+"HETATM   15  H           1      -0.543  -1.858  -0.909  1.00  0.00 \n"
+"HETATM   16  H           1      -1.824  -1.114   0.078  1.00  0.00 \n"
+"HETATM   17  H           1       2.145  -1.522  -0.886  1.00  0.00 \n"
+"HETATM   18  H           1       3.977   1.922  -0.737  1.00  0.00 \n"
+"HETATM   19  H           1       3.973   0.214  -0.250  1.00  0.00 \n"
+"HETATM   20  H           1       5.040   1.579   1.315  1.00  0.00 \n"
+"HETATM   21  H           1       2.472   3.988  -0.939  1.00  0.00 \n"
+"HETATM   22  H           1       2.940   3.690   0.753  1.00  0.00 \n"
+"HETATM   23  H           1       1.650   5.617   0.520  1.00  0.00 \n"
+"CONECT    1    2    6    7\n"
+"CONECT    1    2\n"
+"CONECT    2    1    3    8\n"
+"CONECT    3    2    4    9\n"
+"CONECT    3    4\n"
+"CONECT    4    3    5   11\n"
+"CONECT    5    4    6   13\n"
+"CONECT    5    6\n"
+"CONECT    6    1    5\n"
+"CONECT    7    1   14   15   16\n"
+"CONECT    8    2   17\n"
+"CONECT    9    3   10   18   19\n"
+"CONECT   10    9   20\n"
+"CONECT   11    4   12   21   22\n"
+"CONECT   12   11   23\n"
+"CONECT   13    5\n"
+"CONECT   14    7\n"
+"CONECT   15    7\n"
+"CONECT   16    7\n"
+"CONECT   17    8\n"
+"CONECT   18    9\n"
+"CONECT   19    9\n"
+"CONECT   20   10\n"
+"CONECT   21   11\n"
+"CONECT   22   11\n"
+"CONECT   23   12\n"
+"MASTER        0    0    0    0    0    0    0    0   23    0   23    0\n"
+"END\n"
+,
+"HEADER    Ascorbic Acid: Vitamin C\n"
+"COMPND    vit-c\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.512   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  C           1       1.927   1.264   0.000  1.00  0.00 \n"
+"HETATM    4  C           1       0.730   2.091   0.015  1.00  0.00 \n"
+"HETATM    5  O           1      -0.382   1.359   0.113  1.00  0.00 \n"
+"HETATM    6  O           1       0.759   3.270   0.261  1.00  0.00 \n"
+"HETATM    7  O           1       3.197   1.690   0.245  1.00  0.00 \n"
+"HETATM    8  O           1       2.283  -1.055   0.386  1.00  0.00 \n"
+"HETATM    9  H           1      -0.390  -0.463  -0.907  1.00  0.00 \n"
+"HETATM   10  C           1      -0.565  -0.653   1.264  1.00  0.00 \n"
+"HETATM   11  H           1       0.050  -1.475   1.629  1.00  0.00 \n"
+"HETATM   12  O           1      -0.674   0.397   2.229  1.00  0.00 \n"
+"HETATM   13  C           1      -2.028  -1.077   1.106  1.00  0.00 \n"
+"HETATM   14  O           1      -2.543  -0.906   2.429  1.00  0.00 \n"
+"HETATM   15  H           1       3.383   1.620   1.187  1.00  0.00 \n"
+"HETATM   16  H           1       2.156  -1.784  -0.228  1.00  0.00 \n"
+"HETATM   17  H           1      -0.774   1.222   1.738  1.00  0.00 \n"
+"HETATM   18  H           1      -2.112  -2.110   0.766  1.00  0.00 \n"
+"HETATM   19  H           1      -2.545  -0.402   0.425  1.00  0.00 \n"
+"HETATM   20  H           1      -2.081  -0.175   2.830  1.00  0.00 \n"
+"CONECT    1    2    5    9   10\n"
+"CONECT    2    1    3    8\n"
+"CONECT    3    2    4    7\n"
+"CONECT    4    3    5    6    6\n"
+"CONECT    5    1    4\n"
+"CONECT    6    4    4\n"
+"CONECT    7    3   15\n"
+"CONECT    8    2   16\n"
+"CONECT    9    1\n"
+"CONECT   10    1   11   12   13\n"
+"CONECT   11   10\n"
+"CONECT   12   10   17\n"
+"CONECT   13   10   14   18   19\n"
+"CONECT   14   13   20\n"
+"CONECT   15    7\n"
+"CONECT   16    8\n"
+"CONECT   17   12\n"
+"CONECT   18   13\n"
+"CONECT   19   13\n"
+"CONECT   20   14\n"
+"MASTER        0    0    0    0    0    0    0    0   20    0   20    0\n"
+"END\n"
+,
+"HEADER    VX: a chemical warfare agent, cholinesterase inhibitor\n"
+"COMPND    VX\n"
+"AUTHOR    Created by Dave Woodcock at Okanagan University College\n"
+"AUTHOR    email:woodcock@okanagan.bc.ca\n"
+"AUTHOR    Date revised: Fri Sep  1 09:41:05 2000  GENERATED BY BABEL 1.6 \n"
+"HETATM    1  C           1       0.000   0.000   0.000  1.00  0.00 \n"
+"HETATM    2  C           1       1.541   0.000   0.000  1.00  0.00 \n"
+"HETATM    3  O           1       2.000   1.333   0.000  1.00  0.00 \n"
+"HETATM    4  P           1       3.580   1.768  -0.723  1.00  0.00 \n"
+"HETATM    5  O           1       3.908   3.507  -0.453  1.00  0.00 \n"
+"HETATM    6  C           1       3.536   1.434  -2.522  1.00  0.00 \n"
+"HETATM    7  S           1       5.089   0.633   0.149  1.00  0.00 \n"
+"HETATM    8  C           1       6.652   1.113  -0.581  1.00  0.00 \n"
+"HETATM    9  C           1       7.173   2.394   0.105  1.00  0.00 \n"
+"HETATM   10  N           1       8.475   2.827  -0.436  1.00  0.00 \n"
+"HETATM   11  C           1       9.247   3.677   0.492  1.00  0.00 \n"
+"HETATM   12  C           1       9.948   2.776   1.531  1.00  0.00 \n"
+"HETATM   13  C           1       8.388   4.729   1.230  1.00  0.00 \n"
+"HETATM   14  C           1       8.465   3.210  -1.863  1.00  0.00 \n"
+"HETATM   15  C           1       9.881   3.493  -2.414  1.00  0.00 \n"
+"HETATM   16  C           1       7.562   4.422  -2.181  1.00  0.00 \n"
+"HETATM   17  H           1      -0.362   0.520   0.887  1.00  0.00 \n"
+"HETATM   18  H           1      -0.367  -1.026   0.006  1.00  0.00 \n"
+"HETATM   19  H           1      -0.363   0.510  -0.892  1.00  0.00 \n"
+"HETATM   20  H           1       1.902  -0.524  -0.885  1.00  0.00 \n"
+"HETATM   21  H           1       1.904  -0.507   0.894  1.00  0.00 \n"
+"HETATM   22  H           1       2.728   2.007  -2.976  1.00  0.00 \n"
+"HETATM   23  H           1       3.367   0.370  -2.691  1.00  0.00 \n"
+"HETATM   24  H           1       4.485   1.727  -2.970  1.00  0.00 \n"
+"HETATM   25  H           1       6.489   1.278  -1.644  1.00  0.00 \n"
+"HETATM   26  H           1       7.377   0.311  -0.444  1.00  0.00 \n"
+"HETATM   27  H           1       7.282   2.161   1.162  1.00  0.00 \n"
+"HETATM   28  H           1       6.438   3.191   0.006  1.00  0.00 \n"
+"HETATM   29  H           1      10.030   4.205  -0.044  1.00  0.00 \n"
+"HETATM   30  H           1      10.539   2.021   1.012  1.00  0.00 \n"
+"HETATM   31  H           1       9.216   2.282   2.169  1.00  0.00 \n"
+"HETATM   32  H           1      10.608   3.383   2.151  1.00  0.00 \n"
+"HETATM   33  H           1       9.041   5.368   1.825  1.00  0.00 \n"
+"HETATM   34  H           1       7.675   4.243   1.895  1.00  0.00 \n"
+"HETATM   35  H           1       7.847   5.345   0.515  1.00  0.00 \n"
+"HETATM   36  H           1       8.094   2.362  -2.434  1.00  0.00 \n"
+"HETATM   37  H           1      10.574   2.735  -2.048  1.00  0.00 \n"
+"HETATM   38  H           1      10.223   4.483  -2.116  1.00  0.00 \n"
+"HETATM   39  H           1       9.853   3.454  -3.503  1.00  0.00 \n"
+"HETATM   40  H           1       7.928   5.308  -1.665  1.00  0.00 \n"
+"HETATM   41  H           1       6.533   4.222  -1.886  1.00  0.00 \n"
+"HETATM   42  H           1       7.584   4.609  -3.255  1.00  0.00 \n"
+"CONECT    1    2   17   18   19\n"
+"CONECT    2    1    3   20   21\n"
+"CONECT    3    2    4\n"
+"CONECT    4    3    5    6    7\n"
+"CONECT    4    5\n"
+"CONECT    5    4\n"
+"CONECT    6    4   22   23   24\n"
+"CONECT    7    4    8\n"
+"CONECT    8    7    9   25   26\n"
+"CONECT    9    8   10   27   28\n"
+"CONECT   10    9   11   14\n"
+"CONECT   11   10   12   13   29\n"
+"CONECT   12   11   30   31   32\n"
+"CONECT   13   11   33   34   35\n"
+"CONECT   14   10   15   16   36\n"
+"CONECT   15   14   37   38   39\n"
+"CONECT   16   14   40   41   42\n"
+"CONECT   17    1\n"
+"CONECT   18    1\n"
+"CONECT   19    1\n"
+"CONECT   20    2\n"
+"CONECT   21    2\n"
+"CONECT   22    6\n"
+"CONECT   23    6\n"
+"CONECT   24    6\n"
+"CONECT   25    8\n"
+"CONECT   26    8\n"
+"CONECT   27    9\n"
+"CONECT   28    9\n"
+"CONECT   29   11\n"
+"CONECT   30   12\n"
+"CONECT   31   12\n"
+"CONECT   32   12\n"
+"CONECT   33   13\n"
+"CONECT   34   13\n"
+"CONECT   35   13\n"
+"CONECT   36   14\n"
+"CONECT   37   15\n"
+"CONECT   38   15\n"
+"CONECT   39   15\n"
+"CONECT   40   16\n"
+"CONECT   41   16\n"
+"CONECT   42   16\n"
+"MASTER        0    0    0    0    0    0    0    0   42    0   42    0\n"
+"END\n"
+,
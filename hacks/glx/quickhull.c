@@ -36,6 +36,10 @@
   #include "quickhull.h"
 
  HISTORY:
+  - 19-Oct-2026: contexts can be reused from one hull to the next, and
+            their memory grows as needed instead of being n^2 up front;
+            duplicates are found by hashing; the initial point assignment
+            can run on several threads
   - 25-Feb-2018: jwz: adapted for xscreensaver
   - 1.0.1 (2016-11-01): Various improvements over epsilon issues and
             degenerate faces
@@ -45,7 +49,6 @@
 
  TODO:
   - use float* from public interface
-  - reduce memory usage
 */
 
 #include "screenhackI.h"
@@ -53,10 +56,12 @@
 extern const char *progname;
 
 #include "quickhull.h"
+#include "thread_util.h"
 
 #include <math.h>   /* sqrt & fabs */
 #include <stdio.h>  /* FILE */
 #include <string.h> /* memcpy */
+#include <errno.h>
 
 #if (__GNUC__ >= 4)
 # pragma GCC diagnostic ignored "-Wvariadic-macros"
@@ -88,7 +93,13 @@ extern const char *progname;
 #endif
 
 #ifndef QH_VERTEX_SET_SIZE
-#define QH_VERTEX_SET_SIZE 128
+#define QH_VERTEX_SET_SIZE 16
+#endif
+
+/* Below this many points, handing the initial assignment to other threads
+   costs more than it saves. */
+#ifndef QH_THREAD_MIN_VERTICES
+#define QH_THREAD_MIN_VERTICES 4096
 #endif
 
 typedef long qh_index_t;
@@ -123,7 +134,18 @@ typedef struct qh_index_stack {
   unsigned int size;
 } qh_index_stack_t;
 
-typedef struct qh_context {
+struct qh_thread {
+  qh_context_t* context;
+  unsigned int id;
+};
+
+/* Everything in here is allocated on demand and kept until the context is
+   freed, so once a reused context has grown to fit the point sets it is
+   given, building a hull does not call malloc at all.  There is room for
+   `maxfaces' faces, three times that many edges, and `maxvertices'
+   vertices.
+ */
+struct qh_context {
   qh_face_t* faces;
   qh_half_edge_t* edges;
   qh_vertex_t* vertices;
@@ -132,16 +154,27 @@ typedef struct qh_context {
   qh_index_stack_t scratch;
   qh_index_stack_t horizonedges;
   qh_index_stack_t newhorizonedges;
+  qh_index_stack_t visited;	/* faces seen while finding the horizon */
   char* valid;
   unsigned int nedges;
   unsigned int nvertices;
   unsigned int nfaces;
 
-  #ifdef QUICKHULL_DEBUG
   unsigned int maxfaces;
-  unsigned int maxedges;
-  #endif
-} qh_context_t;
+  unsigned int maxvertices;
+
+  /* For finding duplicate vertices: chains of vertex indexes, by cell. */
+  long* hashheads;
+  long* hashnext;
+  unsigned int nhash;		/* a power of 2 */
+
+  /* For the initial assignment of points to the tetrahedron's faces. */
+  signed char* assigned;	/* face index per vertex, or -1 */
+  qh_index_t basis[3];
+  double epsilon;
+  struct threadpool threadpool;
+  Bool threads_p;
+};
 
 static void
 qh__find_6eps(qh_vertex_t* vertices, unsigned int nvertices, qh_index_t* eps)
@@ -358,7 +391,7 @@ qh__next_edge(qh_context_t* context)
   edge->he = context->nedges;
   context->nedges++;
 
-  QH_ASSERT(context->nedges < context->maxedges);
+  QH_ASSERT(context->nedges <= context->maxfaces * 3);
 
   return edge;
 }
@@ -369,11 +402,10 @@ qh__next_face(qh_context_t* context)
   qh_face_t* face = context->faces + context->nfaces;
 
   face->face = context->nfaces;
-  face->iset.indices = NULL;
   context->valid[context->nfaces] = 1;
   context->nfaces++;
 
-  QH_ASSERT(context->nfaces < context->maxfaces);
+  QH_ASSERT(context->nfaces <= context->maxfaces);
 
   return face;
 }
@@ -433,12 +465,98 @@ qh__face_init(qh_face_t* face, qh_index_t vertices[3],
   face->centroid = centroid;
   face->sdist = qh__vec3_dot(&normal, &centroid);
   face->normal = normal;
-  face->iset.indices = QH_MALLOC(qh_index_t, QH_VERTEX_SET_SIZE);
-  face->iset.capacity = QH_VERTEX_SET_SIZE;
-  face->iset.size = 0;
+  face->iset.size = 0;  /* keep whatever memory this face slot had */
   face->visitededges = 0;
 }
 
+/* The point set is allocated when the first point is added to it.
+   Returns False if out of memory. */
+static Bool
+qh__iset_add(qh_index_set_t* iset, qh_index_t index)
+{
+  if (iset->size + 1 >= iset->capacity) {
+    unsigned int n = (iset->capacity ? iset->capacity * 2
+                      : QH_VERTEX_SET_SIZE);
+    qh_index_t* indices = QH_REALLOC(qh_index_t, iset->indices, n);
+    if (!indices) return False;
+    iset->indices = indices;
+    iset->capacity = n;
+  }
+
+  iset->indices[iset->size++] = index;
+  return True;
+}
+
+static int
+qh__index_cmp(const void* a, const void* b)
+{
+  qh_index_t ia = *(const qh_index_t*) a;
+  qh_index_t ib = *(const qh_index_t*) b;
+  return (ia < ib ? -1 : ia > ib ? 1 : 0);
+}
+
+/* Makes room for at least `nfaces' faces and their edges, doubling as
+   needed.  The stacks of edges are bounded by three per face: that many
+   can be pushed in the course of one horizon search.
+   Returns False if out of memory. */
+static Bool
+qh__reserve_faces(qh_context_t* context, unsigned int nfaces)
+{
+  unsigned int n = context->maxfaces;
+  unsigned int i;
+  void* p;
+
+  if (nfaces <= n) return True;
+  if (n < 64) n = 64;
+  while (n < nfaces) n *= 2;
+
+# define GROW(FIELD,T,N) \
+  if (!(p = QH_REALLOC(T, context->FIELD, (N)))) return False; \
+  context->FIELD = (T*) p
+
+  GROW(faces, qh_face_t, n);
+  for (i = context->maxfaces; i < n; ++i) {
+    memset(&context->faces[i].iset, 0, sizeof(context->faces[i].iset));
+  }
+
+  GROW(edges, qh_half_edge_t, n * 3);
+  GROW(valid, char, n);
+  GROW(facestack.begin, qh_index_t, n);
+  GROW(visited.begin, qh_index_t, n);
+  GROW(scratch.begin, qh_index_t, n * 3);
+  GROW(horizonedges.begin, qh_index_t, n * 3);
+  GROW(newhorizonedges.begin, qh_index_t, n * 3);
+
+  context->maxfaces = n;
+  return True;
+}
+
+/* Makes room for at least `nvertices' vertices, and the tables that are
+   kept per vertex.  Returns False if out of memory. */
+static Bool
+qh__reserve_vertices(qh_context_t* context, unsigned int nvertices)
+{
+  unsigned int n = context->maxvertices;
+  unsigned int nhash = context->nhash;
+  void* p;
+
+  if (nvertices <= n) return True;
+  if (n < 64) n = 64;
+  while (n < nvertices) n *= 2;
+  if (nhash < 128) nhash = 128;
+  while (nhash < n * 2) nhash *= 2;
+
+  GROW(vertices, qh_vertex_t, n);
+  GROW(assigned, signed char, n);
+  GROW(hashnext, long, n);
+  GROW(hashheads, long, nhash);
+# undef GROW
+
+  context->maxvertices = n;
+  context->nhash = nhash;
+  return True;
+}
+
 static void
 qh__tetrahedron_basis(qh_context_t* context, qh_index_t vertices[3])
 {
@@ -659,7 +777,8 @@ qh__test_hull(qh_context_t* context, double epsilon, int testiset)
 #endif /* QUICKHULL_DEBUG */
 
 
-static void
+/* Returns False when out of memory. */
+static Bool
 #ifdef QUICKHULL_DEBUG
 qh__build_hull(qh_context_t* context, double epsilon, unsigned int step,
                unsigned int* failurestep)
@@ -668,7 +787,7 @@ qh__build_hull(qh_context_t* context, double epsilon)
 #endif
 {
   qh_index_t topface = qh__pop_stack(&context->facestack);
-  int i, j, k;
+  int i, j, k, l;
 
   #ifdef QUICKHULL_DEBUG
   unsigned int iteration = 0;
@@ -707,11 +826,13 @@ qh__build_hull(qh_context_t* context, double epsilon)
 
     qh__assert_face(face, context);
 
-    /* Reset visited flag for faces */
+    /* Reset visited flag for faces.  Only the ones visited last time
+       around can be set: new faces start out at 0. */
     {
-      for (i = 0; i < context->nfaces; ++i) {
-        context->faces[i].visitededges = 0;
+      for (i = 0; i < context->visited.size; ++i) {
+        context->faces[context->visited.begin[i]].visitededges = 0;
       }
+      context->visited.size = 0;
     }
 
     /* Find horizon edge */
@@ -733,6 +854,9 @@ qh__build_hull(qh_context_t* context, double epsilon)
           qh_half_edge_t* oppedge;
           qh_face_t* adjface;
 
+          if (facetovisit->visitededges == 0) {
+            qh__push_stack(&context->visited, tovisit);
+          }
           facetovisit->visitededges++;
 
           edge = context->edges + edgeindex;
@@ -808,6 +932,13 @@ qh__build_hull(qh_context_t* context, double epsilon)
       }
     }
 
+    /* Make room for one new face per horizon edge.  This may move the
+       faces and edges, so no pointers to them are held across it. */
+    if (!qh__reserve_faces(context,
+                           context->nfaces + context->horizonedges.size)) {
+      return False;
+    }
+
     /* Create new faces */
     {
       qh_index_t top = qh__pop_stack(&context->horizonedges);
@@ -863,10 +994,19 @@ qh__build_hull(qh_context_t* context, double epsilon)
       }
     }
 
-    /* Attach point sets to newly created faces */
+    /* Attach point sets to newly created faces.  The only faces that can
+       have been invalidated with points still attached are the ones
+       visited while finding the horizon: go through those in the order
+       they were created, rather than scanning every face there is. */
     {
-      for (k = 0; k < context->nfaces; ++k) {
-        qh_face_t* f = context->faces + k;
+      qsort(context->visited.begin, context->visited.size,
+            sizeof(*context->visited.begin), qh__index_cmp);
+
+      for (l = 0; l < context->visited.size; ++l) {
+        qh_face_t* f;
+
+        k = context->visited.begin[l];
+        f = context->faces + k;
 
         if (context->valid[k] || f->iset.size == 0) {
           continue;
@@ -902,14 +1042,8 @@ qh__build_hull(qh_context_t* context, double epsilon)
             }
           }
 
-          if (dface) {
-            if (dface->iset.size + 1 >= dface->iset.capacity) {
-              dface->iset.capacity *= 2;
-              dface->iset.indices = QH_REALLOC(qh_index_t,
-                dface->iset.indices, dface->iset.capacity);
-            }
-
-            dface->iset.indices[dface->iset.size++] = vertex;
+          if (dface && !qh__iset_add(&dface->iset, vertex)) {
+            return False;
           }
         }
 
@@ -966,6 +1100,8 @@ qh__build_hull(qh_context_t* context, double epsilon)
 
     /* TODO: push all non-valid faces for reuse in face stack memory pool */
   }
+
+  return True;
 }
 
 #ifdef QUICKHULL_FILES
@@ -996,6 +1132,79 @@ qh_mesh_export(qh_mesh_t const* mesh, char const* filename)
 }
 #endif /* QUICKHULL_FILES */
 
+/* Finds the first face of the initial tetrahedron that can see each of
+   the vertices in [start, end).  This is the only pass over every point
+   in the set, so it is the part that is divided among threads.  Each
+   call touches only its own vertices and its own slots in `assigned'.
+   (It does write to the vertices: qh__face_can_see_vertex_epsilon nudges
+   points that are almost on a face.)
+ */
+static void
+qh__assign_points(qh_context_t* context, qh_index_t start, qh_index_t end)
+{
+  qh_index_t* vertices = context->basis;
+  qh_index_t i;
+  int j, k;
+
+  for (i = start; i < end; ++i) {
+    qh_face_t* dface = NULL;
+
+    context->assigned[i] = -1;
+
+    if (vertices[0] == i || vertices[1] == i || vertices[2] == i) {
+      continue;
+    }
+
+    for (j = 0; j < 4; ++j) {
+      if (qh__face_can_see_vertex_epsilon(context, context->faces + j,
+                                          context->vertices + i,
+                                          context->epsilon)) {
+        dface = context->faces + j;
+        break;
+      }
+    }
+
+    if (!dface) { continue; }
+
+    for (k = 0; k < 3; ++k) {
+      qh_half_edge_t* e = context->edges + dface->edges[k];
+      if (i == e->to_vertex) {
+        break;
+      }
+    }
+
+    if (k == 3) {
+      context->assigned[i] = j;
+    }
+  }
+}
+
+static int
+qh__thread_create(void* self, struct threadpool* pool, unsigned id)
+{
+  struct qh_thread* t = (struct qh_thread*) self;
+  t->context = GET_PARENT_OBJ(qh_context_t, threadpool, pool);
+  t->id = id;
+  return 0;
+}
+
+static void
+qh__thread_destroy(void* self)
+{
+}
+
+static void
+qh__thread_run(void* self)
+{
+  struct qh_thread* t = (struct qh_thread*) self;
+  qh_context_t* context = t->context;
+  size_t n = context->nvertices;
+  size_t count = context->threadpool.count;
+
+  qh__assign_points(context, n * t->id / count, n * (t->id + 1) / count);
+}
+
+/* Returns NULL when out of memory. */
 static qh_face_t* 
 qh__build_tetrahedron(qh_context_t* context, double epsilon)
 {
@@ -1092,43 +1301,24 @@ qh__build_tetrahedron(qh_context_t* context, double epsilon)
   /* Create initial point set; every point is */
   /* attached to the first face it can see */
   {
-    for (i = 0; i < context->nvertices; ++i) {
-      /* qh_vertex_t* v; */
-      qh_face_t* dface = NULL;
-
-      if (vertices[0] == i || vertices[1] == i || vertices[2] == i) {
-        continue;
-      }
-
-      for (j = 0; j < 4; ++j) {
-        if (qh__face_can_see_vertex_epsilon(context, context->faces + j,
-                                            context->vertices + i, epsilon)) {
-          dface = context->faces + j;
-          break;
-        }
-      }
-
-      if (dface) {
-        int valid = 1;
-        int j;
-
-        for (j = 0; j < 3; ++j) {
-          qh_half_edge_t* e = context->edges + dface->edges[j];
-          if (i == e->to_vertex) {
-            valid = 0;
-            break;
-          }
-        }
-
-        if (!valid) { continue; }
-
-        if (dface->iset.size + 1 >= dface->iset.capacity) {
-          dface->iset.capacity *= 2;
-          dface->iset.indices = QH_REALLOC(qh_index_t,
-            dface->iset.indices, dface->iset.capacity);
-        }
+    context->basis[0] = vertices[0];
+    context->basis[1] = vertices[1];
+    context->basis[2] = vertices[2];
+    context->epsilon = epsilon;
+
+    if (context->threads_p &&
+        context->nvertices >= QH_THREAD_MIN_VERTICES) {
+      threadpool_run(&context->threadpool, qh__thread_run);
+      threadpool_wait(&context->threadpool);
+    } else {
+      qh__assign_points(context, 0, context->nvertices);
+    }
 
-        dface->iset.indices[dface->iset.size++] = i;
+    /* Add them in order, so the result is the same either way. */
+    for (i = 0; i < context->nvertices; ++i) {
+      j = context->assigned[i];
+      if (j >= 0 && !qh__iset_add(&context->faces[j].iset, i)) {
+        return NULL;
       }
     }
   }
@@ -1153,41 +1343,122 @@ qh__build_tetrahedron(qh_context_t* context, double epsilon)
   return faces;
 }
 
+static long
+qh__grid_cell(double v, double size)
+{
+  double c = floor(v / size);
+  if (c >  1e9) c =  1e9;  /* far-flung points just share a cell */
+  if (c < -1e9) c = -1e9;
+  return (long) c;
+}
+
+static unsigned long
+qh__grid_hash(long x, long y, long z)
+{
+  return (((unsigned long) x * 73856093UL) ^
+          ((unsigned long) y * 19349663UL) ^
+          ((unsigned long) z * 83492791UL));
+}
+
+/* Removes each vertex that is within epsilon of an earlier one.  The
+   vertices that are kept are chained into a hash table of cells twice
+   epsilon wide, so a duplicate of a vertex can only be in its own cell or
+   one of the 26 around it, and this is linear rather than quadratic.
+ */
 static void
 qh__remove_vertex_duplicates(qh_context_t* context, double epsilon)
 {
-  int i, j, k;
+  double size = (epsilon > 0 ? epsilon * 2 : 1);
+  unsigned long mask = context->nhash - 1;
+  long* heads = context->hashheads;
+  long* next = context->hashnext;
+  unsigned int i, n = 0;
+
+  for (i = 0; i < context->nhash; ++i) {
+    heads[i] = -1;
+  }
+
   for (i = 0; i < context->nvertices; ++i) {
-    qh_vertex_t* v = context->vertices + i;
-    if (v->x == 0) v->x = 0;
-    if (v->y == 0) v->y = 0;
-    if (v->z == 0) v->z = 0;
-    for (j = i + 1; j < context->nvertices; ++j) {
-      if (qh__vertex_equals_epsilon(context->vertices + i,
-            context->vertices + j, epsilon))
-      {
-        for (k = j; k < context->nvertices - 1; ++k) {
-          context->vertices[k] = context->vertices[k+1];
+    qh_vertex_t v = context->vertices[i];
+    long x, y, z, k;
+    int dx, dy, dz, dup = 0;
+    unsigned long h;
+
+    if (v.x == 0) v.x = 0;  /* no negative zeroes */
+    if (v.y == 0) v.y = 0;
+    if (v.z == 0) v.z = 0;
+
+    x = qh__grid_cell(v.x, size);
+    y = qh__grid_cell(v.y, size);
+    z = qh__grid_cell(v.z, size);
+
+    for (dx = -1; dx <= 1 && !dup; ++dx) {
+      for (dy = -1; dy <= 1 && !dup; ++dy) {
+        for (dz = -1; dz <= 1 && !dup; ++dz) {
+          h = qh__grid_hash(x + dx, y + dy, z + dz) & mask;
+          for (k = heads[h]; k >= 0; k = next[k]) {
+            if (qh__vertex_equals_epsilon(context->vertices + k, &v,
+                                          epsilon)) {
+              dup = 1;
+              break;
+            }
+          }
         }
-        context->nvertices--;
       }
     }
+
+    if (dup) { continue; }
+
+    h = qh__grid_hash(x, y, z) & mask;
+    context->vertices[n] = v;
+    next[n] = heads[h];
+    heads[h] = n;
+    n++;
   }
+
+  context->nvertices = n;
 }
 
 
-static void
-qh__free_context(qh_context_t* context)
+qh_context_t*
+qh_create_context(Display* dpy)
 {
-  int i;
+  static const struct threadpool_class cls = {
+    sizeof(struct qh_thread),
+    qh__thread_create,
+    qh__thread_destroy
+  };
+  qh_context_t* context = (qh_context_t*) calloc(1, sizeof(*context));
+  unsigned int nthreads = (dpy ? hardware_concurrency(dpy) : 1);
+
+  if (!context) return NULL;
+
+  if (nthreads > 1) {
+    int err = threadpool_create(&context->threadpool, &cls, dpy, nthreads);
+    if (err) {
+      fprintf(stderr, "%s: threadpool: %s\n", progname, strerror(err));
+      exit(1);
+    }
+    context->threads_p = True;
+  }
 
-  for (i = 0; i < context->nfaces; ++i) {
-    QH_FREE(context->faces[i].iset.indices);
-    context->faces[i].iset.size = 0;
+  return context;
+}
+
+void
+qh_free_context(qh_context_t* context)
+{
+  unsigned int i;
+
+  if (!context) return;
+
+  if (context->threads_p) {
+    threadpool_destroy(&context->threadpool);
   }
 
-  context->nvertices = 0;
-  context->nfaces = 0;
+  for (i = 0; i < context->maxfaces; ++i) {
+    QH_FREE(context->faces[i].iset.indices);
+  }
 
   QH_FREE(context->edges);
 
@@ -1196,8 +1467,13 @@ qh__free_context(qh_context_t* context)
   QH_FREE(context->scratch.begin);
   QH_FREE(context->horizonedges.begin);
   QH_FREE(context->newhorizonedges.begin);
+  QH_FREE(context->visited.begin);
   QH_FREE(context->vertices);
   QH_FREE(context->valid);
+  QH_FREE(context->assigned);
+  QH_FREE(context->hashheads);
+  QH_FREE(context->hashnext);
+  free(context);
 }
 
 /* jwz: return 0 when out of memory */
@@ -1205,45 +1481,24 @@ static Bool
 qh__init_context(qh_context_t* context, qh_vertex_t const* vertices,
                  unsigned int nvertices)
 {
-  /* TODO: */
-  /* size_t nedges = 3 * nvertices - 6; */
-  /* size_t nfaces = 2 * nvertices - 4; */
-  unsigned int nfaces = nvertices * (nvertices - 1);
-  unsigned int nedges = nfaces * 3;
-
-  memset (context, 0, sizeof(*context));
-
-  context->edges = QH_MALLOC(qh_half_edge_t, nedges);
-  if (!context->edges) goto FAIL;
-  context->faces = QH_MALLOC(qh_face_t, nfaces);
-  if (!context->faces) goto FAIL;
-  context->facestack.begin = QH_MALLOC(qh_index_t, nfaces);
-  if (!context->facestack.begin) goto FAIL;
-  context->scratch.begin = QH_MALLOC(qh_index_t, nfaces);
-  if (!context->scratch.begin) goto FAIL;
-  context->horizonedges.begin = QH_MALLOC(qh_index_t, nedges);
-  if (!context->horizonedges.begin) goto FAIL;
-  context->newhorizonedges.begin = QH_MALLOC(qh_index_t, nedges);
-  if (!context->newhorizonedges.begin) goto FAIL;
-  context->valid = QH_MALLOC(char, nfaces);
-  if (!context->valid) goto FAIL;
-
-  context->vertices = QH_MALLOC(qh_vertex_t, nvertices);
-  if (!context->vertices) goto FAIL;
-  context->nvertices = nvertices;
+  /* A hull of n points has at most 2n-4 faces, but more than that are
+     created and discarded on the way there.  The arrays grow if this
+     turns out to be too few. */
+  if (!qh__reserve_faces(context, nvertices * 2 + 4)) return False;
+  if (!qh__reserve_vertices(context, nvertices)) return False;
 
-  memcpy(context->vertices, vertices, sizeof(qh_vertex_t) * nvertices);
+  context->nedges = 0;
+  context->nfaces = 0;
+  context->facestack.size = 0;
+  context->scratch.size = 0;
+  context->horizonedges.size = 0;
+  context->newhorizonedges.size = 0;
+  context->visited.size = 0;
 
-  #ifdef QUICKHULL_DEBUG
-  context->maxfaces = nfaces;
-  context->maxedges = nedges;
-  #endif
+  context->nvertices = nvertices;
+  memcpy(context->vertices, vertices, sizeof(qh_vertex_t) * nvertices);
 
   return True;
-
- FAIL:
-  qh__free_context (context);
-  return False;
 }
 
 void
@@ -1282,36 +1537,40 @@ qh__compute_epsilon(qh_vertex_t const* vertices, unsigned int nvertices)
 }
 
 qh_mesh_t
-qh_quickhull3d(qh_vertex_t const* vertices, unsigned int nvertices)
+qh_quickhull3d_context(qh_context_t* context,
+                       qh_vertex_t const* vertices, unsigned int nvertices)
 {
   qh_mesh_t m;
-  qh_context_t context;
   /* unsigned int* indices; */
   unsigned int nfaces = 0, i, index, nindices;
   double epsilon;
+  Bool ok;
 
   memset (&m, 0, sizeof(m));
   epsilon = qh__compute_epsilon(vertices, nvertices);
 
-  if (! qh__init_context(&context, vertices, nvertices))
+  if (! qh__init_context(context, vertices, nvertices))
     return m;
 
-  qh__remove_vertex_duplicates(&context, epsilon);
+  qh__remove_vertex_duplicates(context, epsilon);
 
   /* Build the initial tetrahedron */
-  qh__build_tetrahedron(&context, epsilon);
+  if (! qh__build_tetrahedron(context, epsilon))
+    return m;
 
   /* Build the convex hull */
   #ifdef QUICKHULL_DEBUG
-  qh__build_hull(&context, epsilon, -1, NULL);
+  ok = qh__build_hull(context, epsilon, -1, NULL);
   #else
-  qh__build_hull(&context, epsilon);
+  ok = qh__build_hull(context, epsilon);
   #endif
+  if (! ok)
+    return m;
 
-  /* QH_ASSERT(qh__test_hull(&context, epsilon)); */
+  /* QH_ASSERT(qh__test_hull(context, epsilon)); */
 
-  for (i = 0; i < context.nfaces; ++i) {
-    if (context.valid[i]) { nfaces++; }
+  for (i = 0; i < context->nfaces; ++i) {
+    if (context->valid[i]) { nfaces++; }
   }
 
   nindices = nfaces * 3;
@@ -1326,42 +1585,56 @@ qh_quickhull3d(qh_vertex_t const* vertices, unsigned int nvertices)
 
   {
     index = 0;
-    for (i = 0; i < context.nfaces; ++i) {
-      if (!context.valid[i]) { continue; }
-      m.normals[index] = context.faces[i].normal;
+    for (i = 0; i < context->nfaces; ++i) {
+      if (!context->valid[i]) { continue; }
+      m.normals[index] = context->faces[i].normal;
       index++;
     }
 
     index = 0;
-    for (i = 0; i < context.nfaces; ++i) {
-      if (!context.valid[i]) { continue; }
+    for (i = 0; i < context->nfaces; ++i) {
+      if (!context->valid[i]) { continue; }
       m.normalindices[index] = index;
       index++;
     }
 
     index = 0;
-    for (i = 0; i < context.nfaces; ++i) {
-      if (!context.valid[i]) { continue; }
+    for (i = 0; i < context->nfaces; ++i) {
+      if (!context->valid[i]) { continue; }
       m.indices[index+0] = index+0;
       m.indices[index+1] = index+1;
       m.indices[index+2] = index+2;
       index += 3;
     }
 
-    for (i = 0; i < context.nfaces; ++i) {
+    for (i = 0; i < context->nfaces; ++i) {
       qh_half_edge_t e0, e1, e2;
-      if (!context.valid[i]) { continue; }
-      e0 = context.edges[context.faces[i].edges[0]];
-      e1 = context.edges[context.faces[i].edges[1]];
-      e2 = context.edges[context.faces[i].edges[2]];
-
-      m.vertices[m.nvertices++] = context.vertices[e0.to_vertex];
-      m.vertices[m.nvertices++] = context.vertices[e1.to_vertex];
-      m.vertices[m.nvertices++] = context.vertices[e2.to_vertex];
+      if (!context->valid[i]) { continue; }
+      e0 = context->edges[context->faces[i].edges[0]];
+      e1 = context->edges[context->faces[i].edges[1]];
+      e2 = context->edges[context->faces[i].edges[2]];
+
+      m.vertices[m.nvertices++] = context->vertices[e0.to_vertex];
+      m.vertices[m.nvertices++] = context->vertices[e1.to_vertex];
+      m.vertices[m.nvertices++] = context->vertices[e2.to_vertex];
     }
   }
 
-  qh__free_context(&context);
+  return m;
+}
+
+qh_mesh_t
+qh_quickhull3d(qh_vertex_t const* vertices, unsigned int nvertices)
+{
+  qh_context_t* context = qh_create_context(NULL);
+  qh_mesh_t m;
+
+  if (!context) {
+    memset (&m, 0, sizeof(m));
+    return m;
+  }
 
+  m = qh_quickhull3d_context(context, vertices, nvertices);
+  qh_free_context(context);
   return m;
 }
@@ -39,7 +39,24 @@ typedef struct qh_mesh {
   unsigned int nnormals;
 } qh_mesh_t;
 
+/* A context holds the working memory for building hulls.  It grows to fit
+   the largest point set it has been given, and keeps that memory, so a
+   hack that builds a new hull every frame should make one context and
+   reuse it.  If dpy is non-NULL, large point sets are divided among
+   threads, according to the "useThreads" resource.  A context must only
+   be used by one thread at a time.  Returns NULL if out of memory.
+ */
+typedef struct qh_context qh_context_t;
+
+extern qh_context_t* qh_create_context(Display* dpy);
+extern void qh_free_context(qh_context_t* context);
+
 /* If out of memory, returns a mesh with no vertices */
+extern qh_mesh_t qh_quickhull3d_context(qh_context_t* context,
+                                        qh_vertex_t const* vertices,
+                                        unsigned int nvertices);
+
+/* The same, using a temporary context. */
 extern qh_mesh_t qh_quickhull3d(qh_vertex_t const* vertices,
                                 unsigned int nvertices);
 
@@ -0,0 +1,235 @@
+/* xscreensaver, Copyright (c) 2002-2026 Jamie Zawinski <jwz@jwz.org>
+ * Evaluating scalar fields on a regular grid, in parallel.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ *
+ * The grid is divided into slabs of whole rows, one slab per thread.
+ * Each thread owns the coordinate arrays that it passes to the kernel,
+ * so the only memory shared between threads is the output grid, and
+ * every thread writes to a different part of that.
+ */
+
+#include "screenhackI.h"
+#include "scalarfield.h"
+#include "thread_util.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+struct field_thread {
+  scalar_field *sf;
+  unsigned id;
+  double *x, *y, *z;		/* one row of coordinates */
+};
+
+struct scalar_field {
+  int nx, ny, nz;
+  double x0, dx, y0, dy, z0, dz;
+  double *grid;
+  Bool valid_p;			/* grid holds the result for `params' */
+
+  double *params;		/* what the grid was last computed from */
+  int nparams;
+
+  struct threadpool threadpool;
+
+  /* Set for the duration of one scalar_field_compute(). */
+  scalar_field_fn fn;
+  void *closure;
+};
+
+
+static int
+field_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct field_thread *t = (struct field_thread *) self;
+  scalar_field *sf = GET_PARENT_OBJ (scalar_field, threadpool, pool);
+  t->sf = sf;
+  t->id = id;
+  t->x = (double *) malloc (sf->nx * 3 * sizeof(*t->x));
+  if (!t->x) return ENOMEM;
+  t->y = t->x + sf->nx;
+  t->z = t->y + sf->nx;
+  return 0;
+}
+
+
+static void
+field_thread_destroy (void *self)
+{
+  struct field_thread *t = (struct field_thread *) self;
+  free (t->x);
+}
+
+
+static void
+field_thread_run (void *self)
+{
+  struct field_thread *t = (struct field_thread *) self;
+  scalar_field *sf = t->sf;
+  int nrows = sf->ny * sf->nz;
+  int row0 = nrows * t->id       / sf->threadpool.count;
+  int row1 = nrows * (t->id + 1) / sf->threadpool.count;
+  int row, i;
+
+  for (i = 0; i < sf->nx; i++)
+    t->x[i] = sf->x0 + i * sf->dx;
+
+  for (row = row0; row < row1; row++)
+    {
+      double y = sf->y0 + (row % sf->ny) * sf->dy;
+      double z = sf->z0 + (row / sf->ny) * sf->dz;
+      for (i = 0; i < sf->nx; i++)
+        {
+          t->y[i] = y;
+          t->z[i] = z;
+        }
+      sf->fn (sf->nx, t->x, t->y, t->z,
+              sf->grid + (size_t) row * sf->nx,
+              sf->closure);
+    }
+}
+
+
+scalar_field *
+scalar_field_create (Display *dpy, int nx, int ny, int nz)
+{
+  static const struct threadpool_class cls = {
+    sizeof(struct field_thread),
+    field_thread_create,
+    field_thread_destroy
+  };
+  scalar_field *sf = (scalar_field *) calloc (1, sizeof(*sf));
+  unsigned nthreads;
+  int err;
+
+  if (!sf) goto FAIL;
+  if (nx < 1) nx = 1;
+  if (ny < 1) ny = 1;
+  if (nz < 1) nz = 1;
+  sf->nx = nx;
+  sf->ny = ny;
+  sf->nz = nz;
+  sf->dx = sf->dy = sf->dz = 1;
+
+  sf->grid = (double *) malloc ((size_t) nx * ny * nz * sizeof(*sf->grid));
+  if (!sf->grid) goto FAIL;
+
+  /* No point in more threads than there are rows, and the per-thread
+     overhead isn't worth it for tiny grids. */
+  nthreads = hardware_concurrency (dpy);
+  if (nthreads > ny * nz) nthreads = ny * nz;
+  if (nthreads > 1 && (size_t) nx * ny * nz < 4096) nthreads = 1;
+
+  err = threadpool_create (&sf->threadpool, &cls, dpy, nthreads);
+  if (err)
+    {
+      fprintf (stderr, "%s: threadpool: %s\n", progname, strerror (err));
+      exit (1);
+    }
+
+  return sf;
+
+ FAIL:
+  fprintf (stderr, "%s: out of memory for %dx%dx%d grid\n",
+           progname, nx, ny, nz);
+  exit (1);
+}
+
+
+void
+scalar_field_free (scalar_field *sf)
+{
+  if (!sf) return;
+  if (sf->threadpool.count)
+    threadpool_destroy (&sf->threadpool);
+  free (sf->grid);
+  free (sf->params);
+  free (sf);
+}
+
+
+void
+scalar_field_set_grid (scalar_field *sf,
+                       double x0, double dx,
+                       double y0, double dy,
+                       double z0, double dz)
+{
+  if (sf->x0 != x0 || sf->dx != dx ||
+      sf->y0 != y0 || sf->dy != dy ||
+      sf->z0 != z0 || sf->dz != dz)
+    sf->valid_p = False;
+  sf->x0 = x0; sf->dx = dx;
+  sf->y0 = y0; sf->dy = dy;
+  sf->z0 = z0; sf->dz = dz;
+}
+
+
+/* Whether the parameters are close enough to the ones that the grid was
+   computed from that we can keep using it.  Compares against the last
+   *computed* parameters rather than the last requested ones, so that slow
+   drift still accumulates into a recompute.
+ */
+static Bool
+params_match_p (scalar_field *sf, const double *params, int nparams,
+                double tolerance)
+{
+  int i;
+  if (!sf->valid_p || !params || nparams != sf->nparams)
+    return False;
+  for (i = 0; i < nparams; i++)
+    if (fabs (params[i] - sf->params[i]) > tolerance)
+      return False;
+  return True;
+}
+
+
+const double *
+scalar_field_compute (scalar_field *sf, scalar_field_fn fn, void *closure,
+                      const double *params, int nparams, double tolerance,
+                      int *changed_p)
+{
+  if (params_match_p (sf, params, nparams, tolerance))
+    {
+      if (changed_p) *changed_p = 0;
+      return sf->grid;
+    }
+
+  sf->fn = fn;
+  sf->closure = closure;
+  threadpool_run (&sf->threadpool, field_thread_run);
+  threadpool_wait (&sf->threadpool);
+  sf->fn = 0;
+  sf->closure = 0;
+
+  if (params && nparams > 0)
+    {
+      if (nparams != sf->nparams)
+        {
+          sf->params = (double *)
+            realloc (sf->params, nparams * sizeof(*sf->params));
+          if (!sf->params)
+            {
+              fprintf (stderr, "%s: out of memory\n", progname);
+              exit (1);
+            }
+          sf->nparams = nparams;
+        }
+      memcpy (sf->params, params, nparams * sizeof(*sf->params));
+      sf->valid_p = True;
+    }
+  else
+    sf->valid_p = False;
+
+  if (changed_p) *changed_p = 1;
+  return sf->grid;
+}
@@ -0,0 +1,64 @@
+/* xscreensaver, Copyright (c) 2002-2026 Jamie Zawinski <jwz@jwz.org>
+ * Evaluating scalar fields on a regular grid, in parallel.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+#ifndef __SCALARFIELD_H__
+#define __SCALARFIELD_H__
+
+/* The field kernel.  Computes the value of the field at `count' points,
+   whose coordinates are in the parallel arrays x, y and z, and stores the
+   results in `out'.  The evaluator hands it a whole row of the grid at a
+   time, so keep the inner loop free of function calls and branches that
+   depend on the previous point, and the compiler can vectorize it.
+
+   The kernel is called from several threads at once, on disjoint rows:
+   it must not write to anything but `out'.
+ */
+typedef void (*scalar_field_fn) (int count,
+                                 const double *x,
+                                 const double *y,
+                                 const double *z,
+                                 double *out,
+                                 void *closure);
+
+typedef struct scalar_field scalar_field;
+
+/* Creates an evaluator for a grid of nx * ny * nz points.  Grid point
+   (i, j, k) is at (x0 + i*dx, y0 + j*dy, z0 + k*dz); by default the
+   origin is 0 and the step is 1, so the coordinates are the grid indexes.
+   The rows of the grid are divided among a threadpool, which honors the
+   "useThreads" resource.
+ */
+extern scalar_field *scalar_field_create (Display *, int nx, int ny, int nz);
+extern void scalar_field_free (scalar_field *);
+
+extern void scalar_field_set_grid (scalar_field *,
+                                   double x0, double dx,
+                                   double y0, double dy,
+                                   double z0, double dz);
+
+/* Fills in the grid, and returns it: the value at (i, j, k) is at
+   index ((k * ny) + j) * nx + i.
+
+   `params' describes whatever the kernel's output depends on (e.g., the
+   positions and radii of the metaballs.)  If none of them have moved by
+   more than `tolerance' since the last time the grid was actually
+   computed, the kernel is not run at all, and the old grid is returned.
+   `*changed_p' says which happened, so the caller can also skip
+   re-tesselating the surface.  Pass params = 0 to always recompute.
+ */
+extern const double *scalar_field_compute (scalar_field *,
+                                           scalar_field_fn, void *closure,
+                                           const double *params, int nparams,
+                                           double tolerance,
+                                           int *changed_p);
+
+#endif /* __SCALARFIELD_H__ */
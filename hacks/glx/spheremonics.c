@@ -65,6 +65,7 @@
 		 "*wireframe:	False	    \n" \
 	         "*labelfont:   sans-serif 18\n" \
 		 "*suppressRotationAnimation: True\n" \
+		 THREAD_DEFAULTS_XLOCK
 
 # define release_spheremonics 0
 
@@ -74,6 +75,8 @@
 #include "colors.h"
 #include "rotator.h"
 #include "gltrackball.h"
+#include "scalarfield.h"
+#include "thread_util.h"
 #include <ctype.h>
 
 #ifdef USE_GL /* whole file */
@@ -98,6 +101,8 @@ typedef struct {
   XYZ bbox[2];
 
   int resolution;
+  scalar_field *field, *field2;  /* radius at each (theta, phi) */
+  XYZ *points;
   int ncolors;
   XColor *colors;
 
@@ -142,6 +147,7 @@ static XrmOptionDescRec opts[] = {
   {"-smooth",  ".smooth", XrmoptionNoArg, "True" },
   {"+smooth",  ".smooth", XrmoptionNoArg, "False" },
   { "-parameters", ".parameters", XrmoptionSepArg, 0 },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
@@ -248,22 +254,33 @@ gl_init (ModeInfo *mi)
 
 /* generate the object */
 
-static XYZ
-sphere_eval (double theta, double phi, int *m)
+/* Raises to an integer power.  Same as pow() (including 0^0 = 1) but
+   without the libm call for the non-negative exponents that the animation
+   uses; negative ones can only come from -parameters. */
+static double
+ipow (double x, int n)
 {
-  double r = 0;
-  XYZ p;
-
-  r += pow (sin(m[0] * phi),  (double)m[1]);
-  r += pow (cos(m[2] * phi),  (double)m[3]);
-  r += pow (sin(m[4] * theta),(double)m[5]);
-  r += pow (cos(m[6] * theta),(double)m[7]);
+  double r = 1;
+  if (n < 0) return pow (x, n);
+  while (n-- > 0) r *= x;
+  return r;
+}
 
-  p.x = r * sin(phi) * cos(theta);
-  p.y = r * cos(phi);
-  p.z = r * sin(phi) * sin(theta);
 
-  return (p);
+/* Field kernel for scalar_field_compute(): the radius of the surface at
+   each (theta, phi) in x and y.  z is unused.
+ */
+static void
+sphere_field (int count, const double *theta, const double *phi,
+              const double *unused, double *out, void *closure)
+{
+  const int *m = (const int *) closure;
+  int i;
+  for (i = 0; i < count; i++)
+    out[i] = (ipow (sin (m[0] * phi[i]),   m[1]) +
+              ipow (cos (m[2] * phi[i]),   m[3]) +
+              ipow (sin (m[4] * theta[i]), m[5]) +
+              ipow (cos (m[6] * theta[i]), m[7]));
 }
 
 
@@ -433,7 +450,7 @@ do_tracer (ModeInfo *mi)
 
 
 static int
-unit_spheremonics (ModeInfo *mi,
+unit_spheremonics (ModeInfo *mi, scalar_field *field,
                    int resolution, Bool wire, int *m, XColor *colors)
 {
   spheremonics_configuration *cc = &ccs[MI_SCREEN(mi)];
@@ -445,6 +462,9 @@ unit_spheremonics (ModeInfo *mi,
   int res = (wire == 2
              ? resolution / 2
              : resolution);
+  int stride = res + 3;
+  const double *grid;
+  double params[8];
 
   cc->bbox[0].x = cc->bbox[0].y = cc->bbox[0].z = 0;
   cc->bbox[1].x = cc->bbox[1].y = cc->bbox[1].z = 0;
@@ -452,46 +472,62 @@ unit_spheremonics (ModeInfo *mi,
   du = (M_PI+M_PI) / (double)res; /* Theta */
   dv = M_PI        / (double)res; /* Phi   */
 
+  /* Evaluate the radius once at every point of the mesh, plus a border of
+     one on each side for the normals, instead of evaluating it fifteen
+     times per quad.  Grid point (i, j) is at theta = (i-1) du,
+     phi = (j-1) dv.  If the parameters haven't changed, this is free.
+   */
+  for (i = 0; i < countof(params); i++)
+    params[i] = m[i];
+  scalar_field_set_grid (field, -du, du, -dv, dv, 0, 1);
+  grid = scalar_field_compute (field, sphere_field, m,
+                               params, countof(params), 0, 0);
+
+  for (j = 0; j < stride; j++)
+    for (i = 0; i < stride; i++)
+      {
+        double u = (i-1) * du;
+        double v = (j-1) * dv;
+        double r = grid[j * stride + i];
+        XYZ *p = &cc->points[j * stride + i];
+        p->x = r * sin(v) * cos(u);
+        p->y = r * cos(v);
+        p->z = r * sin(v) * sin(u);
+      }
+
   if (wire)
     glColor3f (1, 1, 1);
 
   glBegin (wire ? GL_LINE_LOOP : GL_QUADS);
 
   for (i = 0; i < res; i++) {
-    double u = i * du;
     for (j = 0; j < res; j++) {
-      double v = j * dv;
-      q[0] = sphere_eval (u, v, m);
-      n[0] = calc_normal(q[0],
-                         sphere_eval (u+du/10, v, m),
-                         sphere_eval (u, v+dv/10, m));
-      glNormal3f(n[0].x,n[0].y,n[0].z);
-      if (!wire) do_color (i, colors);
-      glVertex3f(q[0].x,q[0].y,q[0].z);
-
-      q[1] = sphere_eval (u+du, v, m);
-      n[1] = calc_normal(q[1],
-                         sphere_eval (u+du+du/10, v, m),
-                         sphere_eval (u+du, v+dv/10, m));
-      glNormal3f(n[1].x,n[1].y,n[1].z);
-      if (!wire) do_color ((i+1)%res, colors);
-      glVertex3f(q[1].x,q[1].y,q[1].z);
-
-      q[2] = sphere_eval (u+du, v+dv, m);
-      n[2] = calc_normal(q[2],
-                         sphere_eval (u+du+du/10, v+dv, m),
-                         sphere_eval (u+du, v+dv+dv/10, m));
-      glNormal3f(n[2].x,n[2].y,n[2].z);
-      if (!wire) do_color ((i+1)%res, colors);
-      glVertex3f(q[2].x,q[2].y,q[2].z);
-
-      q[3] = sphere_eval (u,v+dv, m);
-      n[3] = calc_normal(q[3],
-                         sphere_eval (u+du/10, v+dv, m),
-                         sphere_eval (u, v+dv+dv/10, m));
-      glNormal3f(n[3].x,n[3].y,n[3].z);
-      if (!wire) do_color (i, colors);
-      glVertex3f(q[3].x,q[3].y,q[3].z);
+
+      /* The normal at a mesh point is the cross product of the tangents
+         along theta and phi, by central differences on the mesh. */
+# define P(I,J) cc->points[((J)+1) * stride + ((I)+1)]
+# define VERT(N,I,J,C) do {                                     \
+        XYZ o, a, b;                                            \
+        o.x = o.y = o.z = 0;                                    \
+        a.x = P((I)+1,(J)).x - P((I)-1,(J)).x;                  \
+        a.y = P((I)+1,(J)).y - P((I)-1,(J)).y;                  \
+        a.z = P((I)+1,(J)).z - P((I)-1,(J)).z;                  \
+        b.x = P((I),(J)+1).x - P((I),(J)-1).x;                  \
+        b.y = P((I),(J)+1).y - P((I),(J)-1).y;                  \
+        b.z = P((I),(J)+1).z - P((I),(J)-1).z;                  \
+        q[N] = P((I),(J));                                      \
+        n[N] = calc_normal (o, a, b);                           \
+        glNormal3f (n[N].x, n[N].y, n[N].z);                    \
+        if (!wire) do_color ((C), colors);                      \
+        glVertex3f (q[N].x, q[N].y, q[N].z);                    \
+      } while (0)
+
+      VERT (0, i,   j,   i);
+      VERT (1, i+1, j,   (i+1)%res);
+      VERT (2, i+1, j+1, (i+1)%res);
+      VERT (3, i,   j+1, i);
+# undef VERT
+# undef P
 
       polys++;
 
@@ -644,13 +680,15 @@ generate_spheremonics (ModeInfo *mi)
     init_colors (mi);
 
   glNewList(cc->dlist, GL_COMPILE);
-  cc->polys1 = unit_spheremonics (mi, cc->resolution, wire,cc->m,cc->colors);
+  cc->polys1 = unit_spheremonics (mi, cc->field, cc->resolution, wire,
+                                  cc->m, cc->colors);
   glEndList();
 
   glNewList(cc->dlist2, GL_COMPILE);
   glPushMatrix();
   glScalef (1.05, 1.05, 1.05);
-  cc->polys2 = unit_spheremonics (mi, cc->resolution, 2, cc->m, cc->colors);
+  cc->polys2 = unit_spheremonics (mi, cc->field2, cc->resolution, 2,
+                                  cc->m, cc->colors);
   glPopMatrix();
   glEndList();
 
@@ -731,6 +769,14 @@ init_spheremonics (ModeInfo *mi)
   cc->mesher = -1;
 
   cc->resolution = res;
+  if (cc->resolution < 2) cc->resolution = 2;
+  cc->field  = scalar_field_create (MI_DISPLAY(mi), cc->resolution + 3,
+                                    cc->resolution + 3, 1);
+  cc->field2 = scalar_field_create (MI_DISPLAY(mi), cc->resolution/2 + 3,
+                                    cc->resolution/2 + 3, 1);
+  cc->points = (XYZ *) malloc ((cc->resolution + 3) * (cc->resolution + 3) *
+                               sizeof(*cc->points));
+  if (!cc->points) abort();
 
   cc->font_data = load_texture_font (mi->dpy, "labelfont");
 
@@ -912,6 +958,9 @@ free_spheremonics (ModeInfo *mi)
   if (!cc->glx_context) return;
   glXMakeCurrent(MI_DISPLAY(mi), MI_WINDOW(mi), *cc->glx_context);
   if (cc->colors) free (cc->colors);
+  if (cc->field) scalar_field_free (cc->field);
+  if (cc->field2) scalar_field_free (cc->field2);
+  if (cc->points) free (cc->points);
   if (cc->trackball) gltrackball_free (cc->trackball);
   if (cc->rot) free_rotator (cc->rot);
   if (cc->font_data) free_texture_font (cc->font_data);
@@ -21,6 +21,7 @@
  *		--program4 FILE4.glsl		\
  *		--speed 2.0			\
  *		--scale 0.5			\
+ *		--interlace 4			\
  *		--automouse			\
  *
  *   It is not possible to have this program load the code directly from
@@ -36,6 +37,16 @@
  *   iChannel2 to a different pass instead.  Likewise, self-access to
  *   previously-generated frames is not supported.
  *
+ *   A pass is only re-run when something it reads has changed: one of
+ *   the clock uniforms, the mouse, or the output of another pass.  So a
+ *   pass that, e.g., builds a lookup table from gl_FragCoord alone runs
+ *   once and is then just a texture.
+ *
+ *   For slow (e.g. software) GL, "--scale" renders at lower resolution
+ *   and bilinear-scales the final image up to the window; and
+ *   "--interlace N" re-renders only every Nth horizontal band of each
+ *   buffer per frame, keeping the other bands from previous frames.
+ *
  *   It can also randomly choose a program at startup:
  *
  *   xshadertoy --program0-0 FIRST-PROGRAM-0.glsl	\
@@ -122,11 +133,13 @@
 #define DEF_AUTOMOUSE "False"
 #define DEF_AUTOMOUSE_SPEED "1.0"
 #define DEF_SCALE "1.0"
+#define DEF_INTERLACE "1"
 #define DEF_SHADER_FILE "(none)"
 #define DEF_DURATION "120"
 
 static GLfloat speed;
 static GLfloat scale;
+static int interlace;
 static Bool automouse_p;
 static GLfloat automouse_speed;
 static int duration;
@@ -134,6 +147,9 @@ static int duration;
 #define BUFFERS  6	/* BufferA, B, C, D, Image, Common */
 #define VARIANTS 10	/* N different sets of buffers */
 
+#define BAND_HEIGHT   8	/* rows per band, for --interlace */
+#define MAX_INTERLACE 16
+
 static char *shader_files[VARIANTS][BUFFERS];
 
 typedef struct {
@@ -148,6 +164,16 @@ typedef struct {
   GLuint vertex_pos_buffer;
   GLuint win_draw_fbo, win_read_fbo;
   GLuint vao;
+
+  int fb_width, fb_height;	/* size of the channel FBOs, after --scale */
+
+  /* For --interlace: triangles covering every Nth band of the frame,
+     grouped by phase, in one buffer. */
+  GLuint band_pos_buffer;
+  GLint band_first[MAX_INTERLACE];
+  GLsizei band_count[MAX_INTERLACE];
+  int interlace_phase;
+
   struct {
     GLuint poly_shader_program;
     GLuint fbo, tex, draw_fbo, read_fbo;
@@ -160,6 +186,15 @@ typedef struct {
     GLint frag_idate;
     GLint frag_imouse;
     GLint frag_ichan[4];
+
+    /* Dirty tracking: a pass is re-run only if it uses a clock uniform,
+       or the mouse moved and it uses that, or one of the channels that it
+       reads has been re-run since it last ran. */
+    Bool clock_p;		/* uses iTime, iFrame, etc. */
+    Bool valid_p;		/* FBO holds a complete render */
+    unsigned long generation;	/* bumped each time this pass runs */
+    unsigned long input_gen[BUFFERS-1];
+    GLfloat last_mouse[4];
   } channels[BUFFERS-1];	/* BufferA, B, C, D, Image; omit Common */
 
   double start_time, last_time, last_tm, midnight;
@@ -178,6 +213,7 @@ static xshadertoy_configuration *bps = NULL;
 static XrmOptionDescRec opts[] = {
   {"-speed",          ".speed",          XrmoptionSepArg, 0 },
   {"-scale",          ".scale",          XrmoptionSepArg, 0 },
+  {"-interlace",      ".interlace",      XrmoptionSepArg, 0 },
   {"-automouse",      ".automouse",      XrmoptionNoArg, "True"  },
   {"+automouse",      ".automouse",      XrmoptionNoArg, "False" },
   {"-automouse-speed",".automouseSpeed", XrmoptionSepArg, 0 },
@@ -214,6 +250,7 @@ static XrmOptionDescRec opts[] = {
 static argtype vars[] = {
   { &speed, "speed",  "Speed", DEF_SPEED, t_Float },
   { &scale, "scale",  "Scale", DEF_SCALE, t_Float },
+  { &interlace, "interlace", "Interlace", DEF_INTERLACE, t_Int },
   { &automouse_p,     "automouse", "Automouse", DEF_AUTOMOUSE, t_Bool },
   { &automouse_speed, "automouseSpeed", "Speed", DEF_AUTOMOUSE_SPEED, t_Float },
   { &duration,        "duration", "Duration", DEF_DURATION, t_Int },
@@ -656,6 +693,57 @@ parse_program_args (ModeInfo *mi)
 }
 
 
+/* For --interlace N, divide the frame into bands of BAND_HEIGHT rows,
+   and make a set of triangles for each of the N phases: phase P covers
+   bands P, P+N, P+2N...  Drawing those instead of the full-screen quad
+   runs the fragment shader on only 1/N of the pixels, and the rest of
+   the FBO keeps what was drawn there on previous frames.
+ */
+static void
+gen_bands (ModeInfo *mi)
+{
+  xshadertoy_configuration *bp = &bps[MI_SCREEN(mi)];
+  int nbands = (bp->fb_height + BAND_HEIGHT - 1) / BAND_HEIGHT;
+  GLfloat *verts, *v;
+  int phase, band;
+
+  if (interlace <= 1)
+    return;
+
+  verts = (GLfloat *) malloc ((nbands + 1) * 6 * 2 * sizeof(*verts));
+  if (!verts) abort();
+  v = verts;
+
+  for (phase = 0; phase < interlace; phase++)
+    {
+      bp->band_first[phase] = (v - verts) / 2;
+      for (band = phase; band < nbands; band += interlace)
+        {
+          GLfloat y0 = band * BAND_HEIGHT;
+          GLfloat y1 = y0 + BAND_HEIGHT;
+          if (y1 > bp->fb_height) y1 = bp->fb_height;
+          y0 = -1 + 2 * y0 / bp->fb_height;
+          y1 = -1 + 2 * y1 / bp->fb_height;
+          *v++ = -1; *v++ = y0;
+          *v++ =  1; *v++ = y0;
+          *v++ = -1; *v++ = y1;
+          *v++ = -1; *v++ = y1;
+          *v++ =  1; *v++ = y0;
+          *v++ =  1; *v++ = y1;
+        }
+      bp->band_count[phase] = (v - verts) / 2 - bp->band_first[phase];
+    }
+
+  if (! bp->band_pos_buffer)
+    glGenBuffers (1, &bp->band_pos_buffer);
+  glBindBuffer (GL_ARRAY_BUFFER, bp->band_pos_buffer);
+  glBufferData (GL_ARRAY_BUFFER, (v - verts) * sizeof(*verts), verts,
+                GL_STATIC_DRAW);
+  glBindBuffer (GL_ARRAY_BUFFER, 0);
+  free (verts);
+}
+
+
 static void
 gen_framebuffers (ModeInfo *mi)
 {
@@ -685,8 +773,15 @@ gen_framebuffers (ModeInfo *mi)
         }
     }
 
+  bp->fb_width  = MI_WIDTH(mi)  * scale;
+  bp->fb_height = MI_HEIGHT(mi) * scale;
+  if (bp->fb_width  < 1) bp->fb_width  = 1;
+  if (bp->fb_height < 1) bp->fb_height = 1;
+
   for (i = 0; i < countof(bp->channels); i++)
     {
+      bp->channels[i].valid_p = False;
+
       if (! bp->shader_program[bp->variant][i] ||
           !*bp->shader_program[bp->variant][i])
         continue;
@@ -699,7 +794,7 @@ gen_framebuffers (ModeInfo *mi)
       glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
       glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
       glTexImage2D (GL_TEXTURE_2D, 0, internal_format,
-                    MI_WIDTH(mi) * scale, MI_HEIGHT(mi) * scale,
+                    bp->fb_width, bp->fb_height,
                     0, format, type, 0);
     
       glBindFramebuffer (GL_FRAMEBUFFER, bp->channels[i].fbo);
@@ -717,6 +812,8 @@ gen_framebuffers (ModeInfo *mi)
       bp->channels[i].draw_fbo = bp->channels[i].fbo;
       bp->channels[i].read_fbo = bp->channels[i].fbo;
     }
+
+  gen_bands (mi);
 }
 
 
@@ -732,6 +829,8 @@ delete_framebuffers (ModeInfo *mi)
         glDeleteFramebuffers (1, &bp->channels[i].fbo);
       if (bp->channels[i].tex)
         glDeleteTextures (1, &bp->channels[i].tex);
+      bp->channels[i].fbo = bp->channels[i].tex = 0;
+      bp->channels[i].valid_p = False;
     }
 }
 
@@ -775,6 +874,8 @@ init_glsl (ModeInfo *mi)
 
   if (scale > 1 || scale <= 0)  /* Scale down only */
     scale = 1;
+  if (interlace < 1) interlace = 1;
+  if (interlace > MAX_INTERLACE) interlace = MAX_INTERLACE;
 
   for (i = 0; i < countof(bp->channels); i++)
     {
@@ -856,6 +957,13 @@ init_glsl (ModeInfo *mi)
       bp->channels[i].frag_ichan[1] = glGetUniformLocation (p, "iChannel1");
       bp->channels[i].frag_ichan[2] = glGetUniformLocation (p, "iChannel2");
       bp->channels[i].frag_ichan[3] = glGetUniformLocation (p, "iChannel3");
+
+      bp->channels[i].clock_p = (bp->channels[i].frag_itime  >= 0 ||
+                                 bp->channels[i].frag_idelta >= 0 ||
+                                 bp->channels[i].frag_ifps   >= 0 ||
+                                 bp->channels[i].frag_iframe >= 0 ||
+                                 bp->channels[i].frag_idate  >= 0);
+      bp->channels[i].valid_p = False;
     }
 
   {
@@ -1080,22 +1188,45 @@ draw_xshadertoy (ModeInfo *mi)
 
 # ifdef HAVE_GLSL
 
+  glViewport (0, 0, bp->fb_width, bp->fb_height);
+
   for (i = 0; i < countof(bp->channels); i++)
     {
       Bool last_p = (i == countof(bp->channels) - 1 ||
                      !bp->shader_program[bp->variant][i + 1]);
+      Bool dirty_p;
+      GLfloat mouse[4];
       int j;
 
       if (!bp->channels[i].poly_shader_program)
         continue;
 
+      /* Decide whether this pass's output would be any different from
+         what is already in its FBO. */
+      mouse[0] = mx; mouse[1] = my; mouse[2] = mz; mouse[3] = mw;
+      dirty_p = (!bp->channels[i].valid_p ||
+                 bp->channels[i].clock_p ||
+                 (bp->channels[i].frag_imouse >= 0 &&
+                  memcmp (mouse, bp->channels[i].last_mouse, sizeof(mouse))));
+      for (j = 0; j < countof(bp->channels[i].frag_ichan) && !dirty_p; j++)
+        if (bp->channels[j].tex &&
+            bp->channels[i].frag_ichan[j] >= 0 &&
+            bp->channels[i].input_gen[j] != bp->channels[j].generation)
+          dirty_p = True;
+
+      if (!dirty_p)
+        {
+          if (last_p) break;
+          continue;
+        }
+
       glUseProgram (bp->channels[i].poly_shader_program);
 
       /* Bind to this layer's output buffer */
       glBindFramebuffer (GL_DRAW_FRAMEBUFFER, bp->channels[i].draw_fbo);
       glBindFramebuffer (GL_READ_FRAMEBUFFER, bp->channels[i].read_fbo);
 
-      for (j = 0; j < countof(bp->channels); j++)
+      for (j = 0; j < countof(bp->channels[i].frag_ichan); j++)
         {
           if (!bp->channels[j].tex ||
               bp->channels[i].frag_ichan[j] < 0)
@@ -1106,9 +1237,7 @@ draw_xshadertoy (ModeInfo *mi)
         }
 
       glUniform3f (bp->channels[i].frag_irez,
-                   MI_WIDTH(mi) * scale,
-                   MI_HEIGHT(mi) * scale,
-                   1);
+                   bp->fb_width, bp->fb_height, 1);
       glUniform1f (bp->channels[i].frag_itime,  now - bp->start_time);
       glUniform1f (bp->channels[i].frag_idelta, now - bp->last_time);
       glUniform1f (bp->channels[i].frag_ifps,
@@ -1124,29 +1253,57 @@ draw_xshadertoy (ModeInfo *mi)
       if (bp->channels[i].poly_pos < 0) abort();
       if (bp->vao)
         glBindVertexArray (bp->vao);
-      glBindBuffer (GL_ARRAY_BUFFER, bp->vertex_pos_buffer);
-      glVertexAttribPointer (bp->channels[i].poly_pos, 2,
-                             GL_FLOAT, GL_FALSE, 0, 0);
-      glEnableVertexAttribArray (bp->channels[i].poly_pos);
-      glDrawArrays (GL_TRIANGLES, 0, 6);
+
+      /* The first render into an FBO is always a full one. */
+      if (interlace > 1 && bp->channels[i].valid_p)
+        {
+          int phase = bp->interlace_phase;
+          glBindBuffer (GL_ARRAY_BUFFER, bp->band_pos_buffer);
+          glVertexAttribPointer (bp->channels[i].poly_pos, 2,
+                                 GL_FLOAT, GL_FALSE, 0, 0);
+          glEnableVertexAttribArray (bp->channels[i].poly_pos);
+          if (bp->band_count[phase] > 0)
+            glDrawArrays (GL_TRIANGLES, bp->band_first[phase],
+                          bp->band_count[phase]);
+        }
+      else
+        {
+          glBindBuffer (GL_ARRAY_BUFFER, bp->vertex_pos_buffer);
+          glVertexAttribPointer (bp->channels[i].poly_pos, 2,
+                                 GL_FLOAT, GL_FALSE, 0, 0);
+          glEnableVertexAttribArray (bp->channels[i].poly_pos);
+          glDrawArrays (GL_TRIANGLES, 0, 6);
+        }
+
       glBindBuffer (GL_ARRAY_BUFFER, 0);
       if (bp->vao)
         glBindVertexArray (0);
 
       glUseProgram (0);
 
+      bp->channels[i].valid_p = True;
+      bp->channels[i].generation++;
+      for (j = 0; j < countof(bp->channels); j++)
+        bp->channels[i].input_gen[j] = bp->channels[j].generation;
+      memcpy (bp->channels[i].last_mouse, mouse, sizeof(mouse));
+
       if (last_p)
         break;
     }
 
+  if (interlace > 1)
+    bp->interlace_phase = (bp->interlace_phase + 1) % interlace;
+
+  /* Scale the final pass up to the window, with bilinear filtering. */
   glBindFramebuffer (GL_READ_FRAMEBUFFER, bp->channels[i].draw_fbo);
   glBindFramebuffer (GL_DRAW_FRAMEBUFFER, bp->win_draw_fbo);
 
-  glBlitFramebuffer (0, 0, MI_WIDTH(mi) * scale, MI_HEIGHT(mi) * scale,
+  glBlitFramebuffer (0, 0, bp->fb_width, bp->fb_height,
                      0, 0, MI_WIDTH(mi), MI_HEIGHT(mi),
                      GL_COLOR_BUFFER_BIT, GL_LINEAR);
 
   glBindFramebuffer (GL_READ_FRAMEBUFFER, bp->win_read_fbo);
+  glViewport (0, 0, MI_WIDTH(mi), MI_HEIGHT(mi));
 
 # endif /* HAVE_GLSL */
 
@@ -1180,6 +1337,8 @@ free_xshadertoy (ModeInfo *mi)
     }
   delete_framebuffers (mi);
   glDeleteBuffers (1, &bp->vertex_pos_buffer);
+  if (bp->band_pos_buffer)
+    glDeleteBuffers (1, &bp->band_pos_buffer);
   if (bp->vao)
     glDeleteVertexArrays (1, &bp->vao);
 
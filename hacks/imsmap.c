@@ -18,6 +18,7 @@
 #include <math.h>
 
 #include "screenhack.h"
+#include "xbatch.h"
 
 #define NSTEPS 7
 #define COUNT (1 << NSTEPS)
@@ -42,7 +43,7 @@ struct state {
 
   int cx, xstep, ystep, xnextStep, ynextStep;
 
-  unsigned int last_pixel, last_valid;
+  xbatch *batch;		/* neighbouring cells rarely share a color */
   int flip_x;
   int flip_xy;
 
@@ -138,13 +139,11 @@ draw (struct state *st,
       y = swap;
     }
 
-  if (! (st->last_valid && pixel == st->last_pixel))
-    XSetForeground (st->dpy, st->gc, pixel);
-  st->last_valid = 1, st->last_pixel = pixel;
+  xbatch_set_foreground (st->batch, st->gc, pixel);
   if (grid_size == 1)
-    XDrawPoint (st->dpy, st->window, st->gc, x, y);
+    xbatch_point (st->batch, st->gc, x, y);
   else
-    XFillRectangle (st->dpy, st->window, st->gc, x, y, grid_size, grid_size);
+    xbatch_fill_rectangle (st->batch, st->gc, x, y, grid_size, grid_size);
 }
 
 
@@ -251,6 +250,7 @@ imsmap_init (Display *dpy, Window window)
   struct state *st = (struct state *) calloc (1, sizeof(*st));
   st->dpy = dpy;
   st->window = window;
+  st->batch = xbatch_create (dpy);
   init_map (st);
   return st;
 }
@@ -344,6 +344,10 @@ imsmap_draw (Display *dpy, Window window, void *closure)
         break;
     }
 
+  /* The cells drawn in one call are all from the same iteration, so none
+     of them overlap, and they can be drawn in any order. */
+  xbatch_flush (st->batch, st->window);
+
   if (st->cx >= st->xmax)
     {
       st->cx = 0;
@@ -392,6 +396,7 @@ imsmap_free (Display *dpy, Window window, void *closure)
   struct state *st = (struct state *) closure;
   XFreeGC (dpy, st->gc);
   XFreeGC (dpy, st->gc2);
+  xbatch_free (st->batch);
   if (st->colors) free (st->colors);
   if (st->cell) free (st->cell);
   free (st);
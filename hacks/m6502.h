@@ -0,0 +1,3565 @@
+"start:\n"
+"  lda #$b\n"
+"  jsr setcol\n"
+"  jsr delay\n"
+"  lda #$f\n"
+"  jsr setcol\n"
+"  jsr delay\n"
+"  lda #$1\n"
+"  jsr setcol\n"
+"  jsr delay\n"
+"  ldx #0\n"
+"cp:\n"
+"  lda pic,x\n"
+"  sta $200,x\n"
+"  lda pic2,x\n"
+"  sta $300,x\n"
+"  lda pic3,x\n"
+"  sta $400,x\n"
+"  lda pic4,x\n"
+"  sta $500,x\n"
+"  dex\n"
+"  bne cp\n"
+"  rts\n"
+"setcol:\n"
+"  ldx #0\n"
+"s:sta $200,x\n"
+"  sta $300,x\n"
+"  sta $400,x\n"
+"  sta $500,x\n"
+"  dex\n"
+"  bne s\n"
+"  rts\n"
+"delay:\n"
+"  ldy #29\n"
+"d1:\n"
+"  ldx #0\n"
+"d2:\n"
+"  dex\n"
+"  bne d2\n"
+"  dey\n"
+"  bne d1\n"
+"  rts\n"
+"pic:\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0\n"
+"        dcb 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,0,$f,$f,$f\n"
+"        dcb $f,$f,$f,$f,0,0,0,$f,0,$e,$e,0,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,0,$f,$f,$f\n"
+"        dcb $f,$f,$f,$f,0,$e,0,$f,0,$e,$e,$e,0,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,0,$f,$f,$f\n"
+"        dcb $f,$f,$f,$f,0,$e,0,$f,0,$e,$e,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,0,$f,$f,$f\n"
+"        dcb $f,$f,$f,$f,0,0,0,$f,0,$e,$e,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,0,0,0,0\n"
+"        dcb 0,0,0,0,0,0,0,0,0,$e,$e,$e,$e,0,1,1\n"
+" \n"
+"pic2:\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,$e,$e,$e,$e\n"
+"        dcb $e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,$e,$e,$e,$e\n"
+"        dcb $e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,$e,$e,$e,$e\n"
+"        dcb $e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,$e,$e,$e,$e,$e,$e,$e\n"
+"        dcb $e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,1,1,0,$e,0,0,0,0,0,0,0\n"
+"        dcb 0,0,0,0,0,0,0,0,0,0,0,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,1,0,0,$e,0,0,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,0,$e,$e,0,1,1\n"
+"        dcb 1,1,1,1,1,0,1,0,$e,0,0,0,0,1,1,$e\n"
+"        dcb $e,$e,1,$e,1,$e,1,$e,1,1,0,$e,$e,0,1,1\n"
+"        dcb 1,1,1,0,0,1,1,0,0,1,0,1,1,0,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,0,$e,$e,0,1,1\n"
+"pic3:\n"
+"        dcb 1,1,0,1,1,1,0,1,1,1,1,0,0,1,1,1\n"
+"        dcb $e,1,$e,1,$e,1,$e,1,1,1,0,$e,$e,0,1,1\n"
+"        dcb 1,0,1,1,0,1,1,1,1,1,1,1,0,1,1,0\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,0,$e,$e,0,1,1\n"
+"        dcb 1,0,1,0,1,1,1,1,1,1,0,0,1,1,0,$f\n"
+"        dcb 0,1,0,1,1,1,0,0,0,1,0,$e,$e,0,1,1\n"
+"        dcb 1,0,1,1,1,1,1,1,1,1,0,1,1,1,1,0\n"
+"        dcb 0,$f,1,0,1,$f,1,0,1,1,0,$e,$e,0,1,1\n"
+"        dcb 1,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0\n"
+"        dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1\n"
+"        dcb 1,0,1,1,1,1,1,1,1,1,1,0,1,1,0,0\n"
+"        dcb 0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,0,1,1,1,1,1,1,1,1,1,0,1,0,0,1\n"
+"        dcb 0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,0,1,1,1,1,1,1,1,1,1,0,1,0,1,1\n"
+"        dcb 0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"pic4:\n"
+"        dcb 1,0,1,1,1,1,1,1,1,1,1,0,1,0,0,0\n"
+"        dcb 0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,0,1,1,1,1,1,1,0,0,0,0,0,1,1,0\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,0,1,1,1,1,1,1,0,1,1,1,0,0,0,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,0,1,1,1,1,1,0,1,1,1,0,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,0,1,1,1,1,1,0,1,1,1,0,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,0,1,1,1,1,1,0,1,1,1,0,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"        dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"	\n",
+"init:\n"
+" lda #$fe\n"
+" sta $2\n"
+" lda #$ee\n"
+" sta $3\n"
+"drawbox:\n"
+" lda #0\n"
+" sta $0\n"
+" lda #2\n"
+" sta $1\n"
+" ldx #$20\n"
+"boxloop:\n"
+" lda #2\n"
+" sta $1ff,x\n"
+" sta $5df,x\n"
+" ldy #0\n"
+" sta ($0),y\n"
+" ldy #$1f\n"
+" sta ($0),y\n"
+" cpx #$1\n"
+" beq noblocks\n"
+" lda #3\n"
+" ldy #$17\n"
+" sta ($0),y\n"
+" lda #4\n"
+" iny\n"
+" sta ($0),y\n"
+" lda #5\n"
+" iny\n"
+" sta ($0),y\n"
+" lda #6\n"
+" iny\n"
+" sta ($0),y\n"
+"noblocks:\n"
+" clc\n"
+" lda $0\n"
+" adc #$20\n"
+" sta $0\n"
+" lda $1\n"
+" adc #0\n"
+" sta $1\n"
+" dex\n"
+" bne boxloop\n"
+" ldx $2\n"
+" ldy $3\n"
+" lda #$44\n"
+" sta $0\n"
+" lda #$02\n"
+" sta $1\n"
+"drawball:\n"
+" txa\n"
+" pha\n"
+" lda #1\n"
+" ldx #0\n"
+" sta ($0,x)\n"
+" pla\n"
+" tax\n"
+"decloop:\n"
+" dex\n"
+" beq updatexpos\n"
+" dey\n"
+" bne decloop\n"
+"updateypos:\n"
+" txa\n"
+" pha\n"
+" jsr clearball\n"
+"updateyposnoclear:\n"
+" lda $3\n"
+" and #1\n"
+" bne moveup\n"
+"movedown:\n"
+" clc\n"
+" lda $0\n"
+" adc #$20\n"
+" sta $0\n"
+" bcc ycollision\n"
+" inc $1\n"
+" bne ycollision\n"
+"moveup:\n"
+" sec\n"
+" lda $0\n"
+" sbc #$20\n"
+" sta $0\n"
+" lda $1\n"
+" sbc #$0\n"
+" sta $1\n"
+"ycollision:\n"
+" ldx #0\n"
+" lda ($0,x)\n"
+" bne ycollided\n"
+" ldy $3\n"
+" pla\n"
+" tax\n"
+" jmp drawball\n"
+"ycollided:\n"
+" cmp #$2\n"
+" beq ycollided2\n"
+" lda #0\n"
+" sta ($0,x)\n"
+"ycollided2:\n"
+" lda #1\n"
+" eor $3\n"
+" sta $3\n"
+" jmp updateyposnoclear\n"
+"updatexpos:\n"
+" jsr clearball\n"
+"updatexposnoclear:\n"
+" lda $2\n"
+" and #1\n"
+" bne moveleft\n"
+"moveright:\n"
+" inc $0\n"
+" bne xcollision\n"
+"moveleft:\n"
+" dec $0\n"
+"xcollision:\n"
+" ldx #0\n"
+" lda ($0,x)\n"
+" bne xcollided\n"
+" ldx $2\n"
+" jmp drawball\n"
+"xcollided:\n"
+" cmp #$2\n"
+" beq xcollided2\n"
+" lda #0\n"
+" sta ($0,x)\n"
+"xcollided2:\n"
+" lda #1\n"
+" eor $2\n"
+" sta $2\n"
+" jmp updatexposnoclear\n"
+"clearball:\n"
+" lda #0\n"
+" tax\n"
+" sta ($0,x)\n"
+" rts\n"
+,
+" \n"
+"start:\n"
+"  lda #<logo\n"
+"  sta $0\n"
+"  lda #>logo\n"
+"  sta $1\n"
+"  lda #$00\n"
+"  sta $2\n"
+"  lda #$02\n"
+"  sta $3\n"
+"decrunchLoop:\n"
+"  lda $3\n"
+"  cmp #$6\n"
+"  bne moreWork \n"
+"  rts\n"
+"moreWork:\n"
+"  ldy #0\n"
+"  lda ($0),y\n"
+"  cmp #$ff\n"
+"  bne notCrunched\n"
+"  iny\n"
+"  lda ($0),y\n"
+"  sta $4\n"
+"  iny\n"
+"  lda ($0),y\n"
+"  ldy $4\n"
+"drawLoop:\n"
+"  ldx #0\n"
+"  sta ($2,x)\n"
+"  jsr nextPixel\n"
+"  dey\n"
+"  bne drawLoop\n"
+"  jsr getNextByte\n"
+"  jsr getNextByte\n"
+"  jmp decrunchLoop\n"
+"notCrunched:\n"
+"  ldx #0\n"
+"  sta ($2,x)\n"
+"  jsr nextPixel\n"
+"  jsr getNextByte\n"
+"  jmp decrunchLoop\n"
+"getNextByte:\n"
+"  inc $0\n"
+"  lda $0\n"
+"  cmp #$00\n"
+"  bne notHi\n"
+"  inc $1\n"
+"notHi:\n"
+"  rts\n"
+"nextPixel:\n"
+"  inc $2\n"
+"  ldx $2\n"
+"  cpx #$00\n"
+"  bne notNextLine\n"
+"  inc $3\n"
+"notNextLine:\n"
+"  rts\n"
+"logo:\n"
+" dcb $ff,43,1,$f,$f,$f,$c,$f,$f,$f,$ff,24,1,$c,$f,$c,0\n"
+" dcb $c,$f,$c,$ff,24,1,0,$f,$c,0,$c,$f,$c,$ff,24,1\n"
+" dcb $c,$f,$c,0,$c,$f,$c,$ff,24,1,0,$f,$c,0,$c,$f,$c\n"
+" dcb $ff,24,1,$c,$f,0,0,$c,$f,$c,$ff,24,1,0,$f,$c,0\n"
+" dcb $c,$f,$c,$ff,24,1,0,$f,$c,0,$c,$f,0,$ff,24,1\n"
+" dcb 0,$f,$c,0,$c,$f,0,$ff,23,1,$f,0,$f,$c,0,$c,$f,0,$f\n"
+" dcb $ff,22,1,$c,0,1,$c,0,$c,$f,0,$c,$ff,21,1\n"
+" dcb $f,0,0,1,0,0,$c,1,0,0,$ff,21,1,$c,0,$c,1,$c,0\n"
+" dcb $c,1,$c,0,$c,$ff,19,1,$f,0,0,$f,1,$c,0\n"
+" dcb $c,1,$f,0,0,$f,$ff,17,1,$f,0,0,0,1,1,$c,0\n"
+" dcb $c,1,1,0,0,0,$ff,16,1,$f,0,0,0,$f,1,1,0,0\n"
+" dcb $c,1,1,$f,0,0,0,$f,$ff,13,1\n"
+" dcb $c,0,0,0,$c,1,1,1,$c,0,$c,1,1,1,$c,0,0,0,$c\n"
+" dcb $ff,10,1,$c,0,0,0,0,$c,1,1,1,1,0,0\n"
+" dcb $c,1,1,1,1,0,0,0,0,0,$c,$ff,8,1\n"
+" dcb 0,0,0,0,$c,1,1,1,1,1,0,0\n"
+" dcb $c,1,1,1,1,1,$c,0,0,0,0,1,1,1,1,1\n"
+" dcb 1,1,1,1,0,0,$c,1,1,1,1,1,1,1,$c,0\n"
+" dcb $c,1,1,1,1,1,1,$f,$c,0,0,$ff,18,1,$f\n"
+" dcb $ff,53,1,0,$f,1,0,0,0,0,0,$f,1,$c\n"
+" dcb $c,1,1,1,$c,0,0,0,1,1,0,$f,$f,1,1,1\n"
+" dcb 1,1,1,1,$c,0,0,1,1,1,0,$f,1,1,$f,0\n"
+" dcb 0,$f,1,1,0,$f,1,$c,$c,1,0,$f,1,1,1,1\n"
+" dcb 1,1,1,1,0,$f,0,$f,1,1,0,$f,1,1,$f,$c\n"
+" dcb $c,$c,1,1,0,1,1,$f,0,1,0,$f,1,1,1,1\n"
+" dcb 1,1,1,1,0,1,$c,$f,1,1,$c,$f,1,1,0,$f\n"
+" dcb $f,0,1,1,0,$f,$f,0,$f,1,0,$f,1,1,1,1\n"
+" dcb 1,1,1,$c,0,$c,0,0,1,1,0,$f,1,1,0,$c\n"
+" dcb $c,0,$f,1,0,$f,0,$f,1,1,0,$f,1,1,1,1\n"
+" dcb 1,1,1,0,$c,$f,$f,0,$f,1,$c,$f,1,$c,$c,$f\n"
+" dcb $f,$c,$c,1,0,1,$f,$c,1,1,0,$f,1,1,1,1\n"
+" dcb 1,1,$f,0,1,1,1,$c,$c,1,0,$f,1,0,$f,1\n"
+" dcb 1,$f,0,1,0,$f,1,0,$f,1,0,$f,$ff,16,1\n"
+" dcb $f,$ff,5,1,$f,1,1,1,$f,$ff,38,1\n"
+,
+" lda #1\n"
+" sta $20f\n"
+"l3:\n"
+" lda #2\n"
+" sta 3\n"
+" sta 5\n"
+" sta 7\n"
+" lda #1\n"
+" sta 9\n"
+" sta 6\n"
+" lda #255\n"
+" sta 8\n"
+" lda #0\n"
+" sta 2\n"
+" lda #32\n"
+" sta 4\n"
+" ldx #30\n"
+"l1:\n"
+" ldy #31\n"
+"l2:\n"
+" lda ($2),y\n"
+" ora ($6),y\n"
+" eor ($8),y\n"
+" sta ($4),y\n"
+" dey\n"
+" bpl l2\n"
+" lda $2\n"
+" adc #32\n"
+" sta $2\n"
+" lda $3\n"
+" adc #0\n"
+" sta $3\n"
+" lda $4\n"
+" adc #32\n"
+" sta $4\n"
+" lda $5\n"
+" adc #0\n"
+" sta $5\n"
+" lda $6\n"
+" adc #32\n"
+" sta $6\n"
+" lda $7\n"
+" adc #0\n"
+" sta $7\n"
+" lda $8\n"
+" adc #32\n"
+" sta $8\n"
+" lda $9\n"
+" adc #0\n"
+" sta $9\n"
+" dex\n"
+" bpl l1\n"
+" ldy #31\n"
+"l4:\n"
+" lda ($2),y\n"
+" sta $200,y\n"
+" dey\n"
+" bpl l4\n"
+" jmp l3\n"
+,
+" lda #1\n"
+" sta $22f\n"
+"l3:\n"
+" ldy #29\n"
+"l2:\n"
+" lda  $220,y\n"
+" adc $221,y\n"
+" adc $222,y\n"
+" tax\n"
+" lda rule,x\n"
+" sta  $201,y\n"
+" dey\n"
+" bpl l2\n"
+" ldy #$c0\n"
+" sec\n"
+"ll2:\n"
+" lda $503,y\n"
+" sta $523,y\n"
+" sta $53b,y\n"
+" lda $504,y\n"
+" sta $524,y\n"
+" sta $53a,y\n"
+" lda $505,y\n"
+" sta $525,y\n"
+" sta $539,y\n"
+" lda $506,y\n"
+" sta $526,y\n"
+" sta $538,y\n"
+" lda $507,y\n"
+" sta $527,y\n"
+" sta $537,y\n"
+" lda $508,y\n"
+" sta $528,y\n"
+" sta $536,y\n"
+" lda $509,y\n"
+" sta $529,y\n"
+" sta $535,y\n"
+" lda $50a,y\n"
+" sta $52a,y\n"
+" sta $534,y\n"
+" lda $50b,y\n"
+" sta $52b,y\n"
+" sta $533,y\n"
+" lda $50c,y\n"
+" sta $52c,y\n"
+" sta $532,y\n"
+" lda $50d,y\n"
+" sta $52d,y\n"
+" sta $531,y\n"
+" lda $50e,y\n"
+" sta $52e,y\n"
+" sta $530,y\n"
+" lda $50f,y\n"
+" sta $52f,y\n"
+" tya\n"
+" adc #$df\n"
+" tay\n"
+" bcs ll2\n"
+" ldy #$e0\n"
+" sec\n"
+"ll3:\n"
+" lda $403,y\n"
+" sta $423,y\n"
+" sta $43b,y\n"
+" lda $404,y\n"
+" sta $424,y\n"
+" sta $43a,y\n"
+" lda $405,y\n"
+" sta $425,y\n"
+" sta $439,y\n"
+" lda $406,y\n"
+" sta $426,y\n"
+" sta $438,y\n"
+" lda $407,y\n"
+" sta $427,y\n"
+" sta $437,y\n"
+" lda $408,y\n"
+" sta $428,y\n"
+" sta $436,y\n"
+" lda $409,y\n"
+" sta $429,y\n"
+" sta $435,y\n"
+" lda $40a,y\n"
+" sta $42a,y\n"
+" sta $434,y\n"
+" lda $40b,y\n"
+" sta $42b,y\n"
+" sta $433,y\n"
+" lda $40c,y\n"
+" sta $42c,y\n"
+" sta $432,y\n"
+" lda $40d,y\n"
+" sta $42d,y\n"
+" sta $431,y\n"
+" lda $40e,y\n"
+" sta $42e,y\n"
+" sta $430,y\n"
+" lda $40f,y\n"
+" sta $42f,y\n"
+" tya\n"
+" adc #$df\n"
+" tay\n"
+" bcs ll3\n"
+" ldy #$e0\n"
+" sec\n"
+"ll4:\n"
+" lda $303,y\n"
+" sta $323,y\n"
+" sta $33b,y\n"
+" lda $304,y\n"
+" sta $324,y\n"
+" sta $33a,y\n"
+" lda $305,y\n"
+" sta $325,y\n"
+" sta $339,y\n"
+" lda $306,y\n"
+" sta $326,y\n"
+" sta $338,y\n"
+" lda $307,y\n"
+" sta $327,y\n"
+" sta $337,y\n"
+" lda $308,y\n"
+" sta $328,y\n"
+" sta $336,y\n"
+" lda $309,y\n"
+" sta $329,y\n"
+" sta $335,y\n"
+" lda $30a,y\n"
+" sta $32a,y\n"
+" sta $334,y\n"
+" lda $30b,y\n"
+" sta $32b,y\n"
+" sta $333,y\n"
+" lda $30c,y\n"
+" sta $32c,y\n"
+" sta $332,y\n"
+" lda $30d,y\n"
+" sta $32d,y\n"
+" sta $331,y\n"
+" lda $30e,y\n"
+" sta $32e,y\n"
+" sta $330,y\n"
+" lda $30f,y\n"
+" sta $32f,y\n"
+" tya\n"
+" adc #$df\n"
+" tay\n"
+" bcs ll4\n"
+" ldy #$e0\n"
+" sec\n"
+"ll1:\n"
+" lda $203,y\n"
+" sta $223,y\n"
+" sta $23b,y\n"
+" lda $204,y\n"
+" sta $224,y\n"
+" sta $23a,y\n"
+" lda $205,y\n"
+" sta $225,y\n"
+" sta $239,y\n"
+" lda $206,y\n"
+" sta $226,y\n"
+" sta $238,y\n"
+" lda $207,y\n"
+" sta $227,y\n"
+" sta $237,y\n"
+" lda $208,y\n"
+" sta $228,y\n"
+" sta $236,y\n"
+" lda $209,y\n"
+" sta $229,y\n"
+" sta $235,y\n"
+" lda $20a,y\n"
+" sta $22a,y\n"
+" sta $234,y\n"
+" lda $20b,y\n"
+" sta $22b,y\n"
+" sta $233,y\n"
+" lda $20c,y\n"
+" sta $22c,y\n"
+" sta $232,y\n"
+" lda $20d,y\n"
+" sta $22d,y\n"
+" sta $231,y\n"
+" lda $20e,y\n"
+" sta $22e,y\n"
+" sta $230,y\n"
+" lda $20f,y\n"
+" sta $22f,y\n"
+" tya\n"
+" adc #$df\n"
+" tay\n"
+" bcs ll1\n"
+" jmp l3\n"
+"rule:\n"
+" dcb 0,2,0,1,1,2,0\n"
+,
+" jmp $700\n"
+" *=$700\n"
+" ldx #0		\n"
+" ldy #0\n"
+" lda #0\n"
+" sta $0\n"
+" sta $3\n"
+" lda #2\n"
+" sta $1\n"
+"loop:\n"
+" lda colors,x\n"
+" bpl ok\n"
+" inc $0\n"
+" ldx #0\n"
+" lda colors,x\n"
+"ok:\n"
+" inx\n"
+" sta ($0),y\n"
+" iny\n"
+" bne ok2\n"
+" inc $1\n"
+" lda $1\n"
+" cmp #6\n"
+" beq end\n"
+"ok2:\n"
+" jmp loop\n"
+"end:\n"
+" inc $3\n"
+" lda $3\n"
+" and #$3f\n"
+" tax\n"
+" ldy #0\n"
+" lda #2\n"
+" sta $1\n"
+" sty $0\n"
+" jmp loop\n"
+"colors:\n"
+"dcb 0,2,0,2,2,8,2,8,8,7,8,7,7,1,7,1,1,7,1,7,7,8,7,8\n"
+"dcb 8,2,8,2,2,0,2,0,2,2,8,2,8,8,7,8,7,7,1,7,1,1,1,1\n"
+"dcb 1,1,1,1,7,1,7,7,8,7,8,8,2,8,2,2,255\n"
+,
+"jmp init_font_table\n"
+"start:\n"
+"lda #<y_start_pos1\n"
+"sta $b\n"
+"lda #>y_start_pos1\n"
+"sta $c\n"
+"lda #<y_start_pos2\n"
+"sta $d\n"
+"lda #>y_start_pos2\n"
+"sta $e\n"
+"lda #<y_start_pos3\n"
+"sta $f\n"
+"lda #>y_start_pos3\n"
+"sta $10\n"
+"lda #<y_start_pos4\n"
+"sta $11\n"
+"lda #>y_start_pos4\n"
+"sta $12\n"
+"lda #<y_start_pos5\n"
+"sta $13\n"
+"lda #>y_start_pos5\n"
+"sta $14\n"
+"lda #<y_start_pos4\n"
+"sta $15\n"
+"lda #>y_start_pos4\n"
+"sta $16\n"
+"lda #<y_start_pos3\n"
+"sta $17\n"
+"lda #>y_start_pos3\n"
+"sta $18\n"
+"lda #<y_start_pos2\n"
+"sta $19\n"
+"lda #>y_start_pos2\n"
+"sta $1a\n"
+"lda #0\n"
+"sta $8\n"
+"main_loop:\n"
+"inc $1c\n"
+"inc $1d\n"
+"ldy $8\n"
+"ldx $b,y\n"
+"txa\n"
+"sta $9\n"
+"iny\n"
+"ldx $b,y\n"
+"txa\n"
+"sta $a\n"
+"iny\n"
+"tya\n"
+"cmp #$10\n"
+"bne store_idx\n"
+"lda #0\n"
+"store_idx:\n"
+"sta $8\n"
+"ldy #0\n"
+"lda #$ff\n"
+"sta $4\n"
+"display_loop:\n"
+"  inc $4\n"
+"  ldx $d0,y\n"
+"  stx $2\n"
+"  iny\n"
+"  ldx $d0,y\n"
+"  stx $3\n"
+"  sty $7\n"
+"  jsr dis_pat\n"
+"  inc $4\n"
+"  jsr dis_pat\n"
+"  ldy $7\n"
+"  iny\n"
+"  tya\n"
+"  cmp #$20\n"
+"  bne display_loop\n"
+"jmp main_loop\n"
+"rts\n"
+"init_font_table:\n"
+"  lda #<pattern_a\n"
+"  sta $d0\n"
+"  lda #>pattern_a\n"
+"  sta $d1\n"
+"  lda #<pattern_b\n"
+"  sta $d2\n"
+"  lda #>pattern_b\n"
+"  sta $d3\n"
+"  lda #<pattern_c\n"
+"  sta $d4\n"
+"  lda #>pattern_c\n"
+"  sta $d5\n"
+"  lda #<pattern_null\n"
+"  sta $d6\n"
+"  lda #>pattern_null\n"
+"  sta $d7\n"
+"  lda #<pattern_d\n"
+"  sta $d8\n"
+"  lda #>pattern_d\n"
+"  sta $d9\n"
+"  lda #<pattern_b\n"
+"  sta $da\n"
+"  lda #>pattern_b\n"
+"  sta $db\n"
+"  lda #<pattern_c\n"
+"  sta $dc\n"
+"  lda #>pattern_c\n"
+"  sta $dd\n"
+"  lda #<pattern_null\n"
+"  sta $de\n"
+"  lda #>pattern_null\n"
+"  sta $df\n"
+"  lda #<pattern_a\n"
+"  sta $e0\n"
+"  lda #>pattern_a\n"
+"  sta $e1\n"
+"  lda #<pattern_e\n"
+"  sta $e2\n"
+"  lda #>pattern_e\n"
+"  sta $e3\n"
+"  lda #<pattern_a\n"
+"  sta $e4\n"
+"  lda #>pattern_a\n"
+"  sta $e5\n"
+"  lda #<pattern_null\n"
+"  sta $e6\n"
+"  lda #>pattern_null\n"
+"  sta $e7\n"
+"  lda #<pattern_c\n"
+"  sta $e8\n"
+"  lda #>pattern_c\n"
+"  sta $e9\n"
+"  lda #<pattern_b\n"
+"  sta $ea\n"
+"  lda #>pattern_b\n"
+"  sta $eb\n"
+"  lda #<pattern_d\n"
+"  sta $ec\n"
+"  lda #>pattern_d\n"
+"  sta $ed\n"
+"  lda #<pattern_null\n"
+"  sta $ee\n"
+"  lda #>pattern_null\n"
+"  sta $ef\n"
+"  jmp start\n"
+"dis_pat:\n"
+"  ldy $4\n"
+"  lda ($9),y\n"
+"  tay\n"
+"  sty $5\n"
+"  ldy #0\n"
+"dis_pat_loop:\n"
+"  lda ($2),y\n"
+"  pha\n"
+"  tya\n"
+"  clc\n"
+"  adc $5\n"
+"  sty $6\n"
+"  tay\n"
+"  ldx $4\n"
+"  pla\n"
+"  beq go_paint\n"
+"  clc\n"
+"  sty $1b\n"
+"  tya\n"
+"  clc\n"
+"  adc $1c\n"
+"  and #$7\n"
+"  tay\n"
+"  lda color_row,y\n"
+"  ldy $1b\n"
+"go_paint:\n"
+"  jsr paint\n"
+"  ldy $6\n"
+"  iny\n"
+"  tya\n"
+"  cmp #12\n"
+"  bne dis_pat_loop\n"
+"  rts\n"
+"paint:\n"
+"   pha\n"
+"   lda yl,y\n"
+"   sta $0\n"
+"   lda yh,y\n"
+"   sta $1\n"
+"   txa\n"
+"   tay\n"
+"   pla\n"
+"   sta ($0),y\n"
+"   rts\n"
+"yh:\n"
+"       dcb $02, $02, $02, $02, $02, $02, $02, $02\n"
+"       dcb $03, $03, $03, $03, $03, $03, $03, $03\n"
+"       dcb $04, $04, $04, $04, $04, $04, $04, $04\n"
+"       dcb $05, $05, $05, $05, $05, $05, $05, $05\n"
+"yl:\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0 \n"
+"pattern_a:\n"
+"  dcb 0,1,1,1,1,1,1,1,1,1,1,0\n"
+"pattern_b:\n"
+"  dcb 0,1,1,0,0,1,1,0,0,1,1,0\n"
+"pattern_c:\n"
+"  dcb 0,1,1,0,0,1,1,1,1,1,1,0\n"
+"pattern_d:\n"
+"  dcb 0,1,1,1,1,1,1,0,0,1,1,0\n"
+"pattern_e:\n"
+"  dcb 0,1,1,0,0,0,0,0,0,1,1,0\n"
+"pattern_null:\n"
+"  dcb 0,0,0,0,0,0,0,0,0,0,0,0\n"
+"y_start_pos1:\n"
+"  dcb 10,10,9,9,8,8,7,7,6,6,7,7,8,8,9,9,10,10,9,9,8,8,7,7\n"
+"  dcb 6,6,7,7,8,8\n"
+"y_start_pos2:\n"
+"  dcb 9,9,8,8,8,8,8,8,7,7,8,8,8,8,8,8,9,9,8,8,8,8,8,8\n"
+"  dcb 7,7,8,8,8,8\n"
+"y_start_pos3:\n"
+"  dcb 8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8\n"
+"  dcb 8,8,8,8,8,8\n"
+"y_start_pos4:\n"
+"  dcb 7,7,8,8,8,8,8,8,9,9,8,8,8,8,8,8,7,7,8,8,8,8,8,8\n"
+"  dcb 9,9,8,8,8,8\n"
+"y_start_pos5:\n"
+"  dcb  6, 6,7,7,8,8,9,9,10,10,9,9,8,8,7,7, 6, 6,7,7,8,8,9,9\n"
+"  dcb 10,10,9,9,8,8\n"
+"color_row:\n"
+"  dcb $7,$8,$9,$2,$4,$6,$e,$3,$d,$5\n"
+,
+"start:\n"
+"  ldx #0\n"
+"c:lda bottombar,x\n"
+"  cmp #$ff\n"
+"  beq init\n"
+"  sta $4e0,x\n"
+"  sta $5e0,x\n"
+"  inx\n"
+"  jmp c\n"
+"init:\n"
+"  jsr initDraw\n"
+"  lda #0\n"
+"  sta $10\n"
+"  sta $11\n"
+"loop:\n"
+"  jsr drawMain\n"
+"  jsr putfont\n"
+"  jsr scrollarea\n"
+"  jmp loop\n"
+"scrollarea:\n"
+"  ldx #0\n"
+"g:lda $521,x\n"
+"  sta $520,x\n"
+"  lda $541,x\n"
+"  sta $540,x\n"
+"  lda $561,x\n"
+"  sta $560,x\n"
+"  lda $581,x\n"
+"  sta $580,x\n"
+"  lda $5a1,x\n"
+"  sta $5a0,x\n"
+"  inx\n"
+"  cpx #31\n"
+"  bne g\n"
+"  rts\n"
+"putfont:\n"
+"  lda $10\n"
+"  cmp #0\n"
+"  bne noNext\n"
+"  inc $11\n"
+"  ldx $11\n"
+"  lda scrolltext,x\n"
+"  tax\n"
+"  lda fontSize,x\n"
+"  sta $10\n"
+"noNext:\n"
+"  dec $10\n"
+"  ldx $11\n"
+"  lda scrolltext,x\n"
+"  cmp #$ff\n"
+"  bne notResetText\n"
+"  lda #0\n"
+"  sta $10\n"
+"  sta $11\n"
+"  rts\n"
+"notResetText:\n"
+"  asl\n"
+"  tax\n"
+"  lda fontlookup,x\n"
+"  sta $2\n"
+"  inx\n"
+"  lda fontlookup,x\n"
+"  sta $3\n"
+"  lda #<fonts\n"
+"  clc\n"
+"  adc $2\n"
+"  sta $0\n"
+"  lda #>fonts\n"
+"  adc $3\n"
+"  sta $1\n"
+"  ldy $10\n"
+"  lda ($00),y\n"
+"  sta $53f\n"
+"  tya\n"
+"  clc\n"
+"  adc #6\n"
+"  tay\n"
+"  lda ($00),y\n"
+"  sta $55f\n"
+"  tya\n"
+"  clc\n"
+"  adc #6\n"
+"  tay\n"
+"  lda ($00),y\n"
+"  sta $57f\n"
+"  tya\n"
+"  clc\n"
+"  adc #6\n"
+"  tay\n"
+"  lda ($00),y\n"
+"  sta $59f\n"
+"  tya\n"
+"  clc\n"
+"  adc #6\n"
+"  tay\n"
+"  lda ($00),y\n"
+"  sta $5bf\n"
+"  rts\n"
+"initDraw:\n"
+"  lda #<picture\n"
+"  sta $20\n"
+"  lda #>picture\n"
+"  sta $21\n"
+"  lda #$00\n"
+"  sta $22\n"
+"  lda #$02\n"
+"  sta $23\n"
+"  ldx #$0\n"
+"  rts\n"
+"drawMain:\n"
+"  ldx #0\n"
+"  lda ($20,x)\n"
+"  cmp #$ff\n"
+"  beq done\n"
+"  sta ($22,x)\n"
+"  inc $20\n"
+"  lda $20\n"
+"  cmp #$00\n"
+"  bne n1\n"
+"  inc $21\n"
+"n1:\n"
+"  inc $22\n"
+"  lda $22 \n"
+"  cmp #$00\n"
+"  bne done\n"
+"  lda $23\n"
+"  cmp #$05\n"
+"  beq done\n"
+"  inc $23\n"
+"done:\n"
+"  rts\n"
+"picture:\n"
+"  dcb 0,0,0,0,0,0,0,0,0,$b,$b,$c,$f,$f,$f,$f\n"
+"  dcb $f,$b,0,0,0,$b,$b,$c,$c,$f,$f,$b,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0,0,0,0,$b,$c,$c,$f,$c,$f,$f\n"
+"  dcb $b,$b,$b,$b,$b,0,$b,$b,$c,$f,$f,$c,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0,0,$b,0,$c,$b,$f,$c,$f,$f,$c\n"
+"  dcb $c,$b,0,$b,$c,$c,$c,$f,$f,1,$f,$c,$b,0,0,0\n"
+"  dcb 0,0,0,0,0,0,0,0,$b,$b,$c,$c,$c,$f,$f,$f\n"
+"  dcb $c,$c,$c,$c,$c,$c,$f,$c,$f,$f,$f,$f,$b,0,0,0\n"
+"  dcb 0,0,0,0,0,0,0,$b,0,0,$b,$c,$c,$f,$f,$f\n"
+"  dcb $f,$c,$f,$f,$f,$f,$f,$f,$f,1,$f,$f,$c,0,0,0\n"
+"  dcb 0,0,0,0,0,0,0,0,0,$b,$b,$b,$c,$f,$f,1\n"
+"  dcb $f,$f,$c,$f,$f,$f,1,$f,$f,$f,$f,$f,$f,0,0,0\n"
+"  dcb 0,0,0,0,0,0,0,0,0,$b,$b,$b,$b,$c,$f,1\n"
+"  dcb $f,$f,$f,$f,$f,$f,$f,$f,1,$f,$f,$f,$f,$b,0,0\n"
+"  dcb 0,0,0,0,0,0,0,0,$b,0,$b,$c,$b,$c,$c,1\n"
+"  dcb 1,$f,1,$f,1,$f,1,$f,$f,1,$f,$f,1,$b,0,0\n"
+"  dcb 0,0,0,0,0,0,0,$b,$b,$b,$c,$c,$b,$c,$f,1\n"
+"  dcb 1,1,$f,$f,1,$f,$f,1,$f,$f,$f,$f,1,$c,0,0\n"
+"  dcb 0,0,0,0,0,0,0,$b,$b,$c,$c,$c,$b,$c,$c,$f\n"
+"  dcb 1,1,1,$f,$f,1,$f,1,$f,1,$f,$f,1,$c,0,0\n"
+"  dcb 0,0,0,0,0,$b,$b,$b,$c,$c,$c,$f,$c,$c,$f,$f\n"
+"  dcb 1,1,1,1,$f,$f,$f,1,$f,1,$f,$f,$f,$f,0,0\n"
+"  dcb 0,0,0,0,0,0,$b,$c,$c,$c,$f,$c,$f,$c,$f,$f\n"
+"  dcb 1,1,1,1,1,$f,$f,1,$f,$f,$f,$f,1,$f,$b,0\n"
+"  dcb 0,0,0,0,$b,$b,$b,$c,$c,$f,$c,$f,$f,$c,$f,$f\n"
+"  dcb 1,1,1,1,1,$f,$f,$f,1,$f,$f,$f,1,$c,$b,$b\n"
+"  dcb 0,0,0,0,$b,$b,$c,$f,$c,$f,$f,$f,$f,$f,$c,$f\n"
+"  dcb 1,1,1,1,1,$f,$f,$f,1,$f,$f,$f,$f,$f,$b,$b\n"
+"  dcb 0,0,0,0,$b,$c,$c,$c,$f,$f,$f,$f,$f,$f,$f,$f\n"
+"  dcb $f,1,1,1,$f,$b,$f,$f,$f,1,$f,$f,$f,$f,$b,$b\n"
+"  dcb 0,0,0,0,$b,$c,$c,$f,$c,$f,$f,$f,$f,$f,$f,$f\n"
+"  dcb $f,$f,$f,$c,$b,$f,$f,1,$f,$f,$f,$f,$f,$f,$c,$b\n"
+"  dcb 0,0,0,0,$b,$b,$c,$c,$f,$c,$f,$f,$f,$f,$f,$f\n"
+"  dcb $c,$c,$b,$c,$c,$f,$f,1,$c,$c,$f,$f,$f,$f,$c,$b\n"
+"  dcb 0,0,0,0,$b,$b,$c,$c,$c,$f,$f,$f,$f,$f,$f,$f\n"
+"  dcb $f,$f,$f,$f,$f,1,$f,$c,$b,$f,$c,$f,$c,$f,$c,$b\n"
+"  dcb 0,0,0,0,0,$b,$c,$c,$c,$c,$f,$f,$f,$f,$f,$f\n"
+"  dcb $f,$f,$f,$f,$f,$c,$b,$c,$c,$c,$f,$f,$c,$f,$c,$c\n"
+"  dcb 0,0,0,0,0,$b,$b,$c,$c,$c,$c,$c,$f,$f,$f,$f\n"
+"  dcb $f,$f,$f,$c,$b,$b,$c,$c,$c,$f,$c,$f,$f,$f,$c,$b\n"
+"  dcb 0,0,0,0,0,$b,$b,$b,$b,$c,$c,$f,$c,$f,$f,$f\n"
+"  dcb $c,$c,$b,$b,$b,$c,$b,$b,$c,$c,$f,$c,$c,$f,$c,$c\n"
+"  dcb 0,0,0,0,0,0,$b,$b,$c,$b,$c,$c,$c,$c,$c,$c\n"
+"  dcb $b,$b,$b,$b,$c,$b,$b,$c,$c,$f,$f,$f,$c,$c,$c,$b\n"
+"  dcb 0,0,0,0,0,0,0,0,$b,$b,$b,$c,$c,$c,$c,$c\n"
+"  dcb $c,$c,$b,$b,$b,$b,$c,$c,$f,$f,$f,$c,$c,$c,$c,$c\n"
+"  dcb $ff\n"
+"fontSize:\n"
+"  dcb 5,5,5,5,5,5,5,5\n"
+"  dcb 2,5,5,5,6,6,5,5\n"
+"  dcb 6,5,5,4,5,6,6,6\n"
+"  dcb 6,5,2,3\n"
+"scrolltext:\n"
+"  dcb 0\n"
+"  dcb 14,13,11,24,27\n"
+"  dcb 03,04,15,19,07,27\n"
+"  dcb 12,0,10,4,18,27\n"
+"  dcb 8,19,27\n"
+"  dcb 15,14,18,18,8,1,11,4\n"
+"  dcb 26,26,26\n"
+"  dcb 19,7,8,18,27\n"
+"  dcb 8,18,27\n"
+"  dcb 19,7,4,27\n"
+"  dcb 5,8,17,18,19,27\n"
+"  dcb 3,4,12,14,27\n"
+"  dcb 12,0,3,4,27\n"
+"  dcb 8,13,27\n"
+"  dcb 19,7,8,18,27\n"
+"  dcb 4,13,21,26,26,26,26,27\n"
+"  dcb 7,14,15,4,27\n"
+"  dcb 24,14,20,27\n"
+"  dcb 11,8,10,4,27\n"
+"  dcb 8,19,26,26,26,27,27\n"
+"  dcb 22,22,22,26\n"
+"  dcb 3,4,15,19,7,26\n"
+"  dcb 14,17,6,27,27,27,27,27\n"
+"  dcb $ff\n"
+"fontlookup:\n"
+"  dcb $00,$00\n"
+"  dcb $20,$00\n"
+"  dcb $40,$00\n"
+"  dcb $60,$00\n"
+"  dcb $80,$00\n"
+"  dcb $a0,$00\n"
+"  dcb $c0,$00\n"
+"  dcb $e0,$00\n"
+"  dcb $00,$01\n"
+"  dcb $20,$01\n"
+"  dcb $40,$01\n"
+"  dcb $60,$01\n"
+"  dcb $80,$01\n"
+"  dcb $a0,$01\n"
+"  dcb $c0,$01\n"
+"  dcb $e0,$01\n"
+"  dcb $00,$02\n"
+"  dcb $20,$02\n"
+"  dcb $40,$02\n"
+"  dcb $60,$02\n"
+"  dcb $80,$02\n"
+"  dcb $a0,$02\n"
+"  dcb $c0,$02\n"
+"  dcb $e0,$02\n"
+"  dcb $00,$03\n"
+"  dcb $20,$03\n"
+"  dcb $40,$03\n"
+"  dcb $60,$03\n"
+"fonts:\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,1,1,0,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 1,1,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,1,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 0,0,1,1,0,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 1,1,0,1,1,0\n"
+"  dcb 1,0,1,0,1,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 1,0,0,1,1,0\n"
+"  dcb 1,0,1,0,1,0\n"
+"  dcb 1,1,0,0,1,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 1,0,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,1,1,0,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 0,1,1,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,1,1,0,0,0\n"
+"  dcb 0,1,0,0,0,0\n"
+"  dcb 0,1,0,0,0,0\n"
+"  dcb 0,1,0,0,0,0\n"
+"  dcb 0,1,0,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,0,0,1,0,0\n"
+"  dcb 1,1,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 0,0,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 1,0,1,0,1,0\n"
+"  dcb 1,1,0,1,1,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 0,0,1,0,0,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 0,0\n"
+"  dcb 1,0,0,0,1,0\n"
+"  dcb 0,1,0,1,0,0\n"
+"  dcb 0,0,1,0,0,0\n"
+"  dcb 0,0,1,0,0,0\n"
+"  dcb 0,0,1,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 0,1,1,0,0,0\n"
+"  dcb 0,0,0,1,0,0\n"
+"  dcb 1,1,1,1,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 1,0,0,0,0,0\n"
+"  dcb 0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0,0,0,0,0\n"
+"  dcb 0,0\n"
+"bottombar:\n"
+"  dcb $b,$9,$b,9,8,9,8,$a,8,$a,7,$a,7,1,7,1,1\n"
+"  dcb 7,1,7,$a,7,$a,8,$a,8,9,8,9,$b,9,$b\n"
+"  dcb $ff\n"
+,
+" \n"
+"start:\n"
+" inx\n"
+" txa\n"
+" sta $200, y\n"
+" sta $300, y\n"
+" sta $400, y\n"
+" sta $500, y\n"
+" iny\n"
+" tya\n"
+" cmp 16\n"
+" bne do\n"
+" iny\n"
+" jmp start\n"
+"do:\n"
+" iny\n"
+" iny\n"
+" iny\n"
+" iny\n"
+"jmp start\n"
+,
+" dcb  76, 94, 11,133, 32,162,  8,160,  8,145, 16,136,208,251,165, 16\n"
+" dcb  24,105, 32,133, 16,165, 17,105,  0,133, 17,165, 32,202,208,231\n"
+" dcb  96,230, 48,165, 48, 41, 63,133, 48,170,189,106,  6,170,189,  8\n"
+" dcb   3,105,  1, 41,  3,157,  8,  3,138, 73,231,170,189,  0,  2,105\n"
+" dcb   1, 41,  3,157,  0,  2,165, 48, 73, 63,170,189,106,  6, 73,224\n"
+" dcb 170,189,  8,  2,105,  1, 41,  3,157,  8,  2,138, 73,231,170,189\n"
+" dcb   0,  3,105,  1, 41,  3,157,  0,  3, 96,224,192,160,128, 96,225\n"
+" dcb  64,193,161,226,129, 32,194, 97,162,227,195,130,228, 65,163,196\n"
+" dcb  98,229,131,164,197,230,231,132,165,198, 99, 66, 33,  0,199,166\n"
+" dcb 133,100,167, 67,134,101,135, 34, 68,102,103, 69, 35, 70, 71, 36\n"
+" dcb   1, 37, 38, 39,  2,  3,  4,  5,  6,  7,166, 48,189,198,  6,170\n"
+" dcb 254, 24,  3, 73,  7,170,254, 16,  3, 73,231,170,254, 24,  2, 73\n"
+" dcb   7,170,254, 16,  2, 96,  0, 32,  1, 33, 64,  2, 65, 34, 96, 66\n"
+" dcb   3, 97, 35, 98, 67,128,  4,129, 36, 99,130, 68,160,  5,161,131\n"
+" dcb 100, 37,162, 69,132,192,163,101,  6,193, 38,194, 70,164,133,195\n"
+" dcb 102,224,  7,225, 39,165,226,196,134, 71,227,103,197,166,228,135\n"
+" dcb 198,229,167,230,199,231,166, 49,189, 21,  7,170,189,  0,160,157\n"
+" dcb   0,  5,230, 49, 96,195,227,194,162,228, 97,226,128,129,130,225\n"
+" dcb  64,161,163,224, 96,160,193,196, 32, 98,192, 65,  0,131,229,164\n"
+" dcb  33, 99,197, 66,132,  1,230, 34,165, 67,100,198,  2,  3, 68,  6\n"
+" dcb  35,133,166,  5,101,  4,199,  7, 36,231, 69,134,167, 37, 38,102\n"
+" dcb 135, 70,232, 71, 39,103,136,200,168,  8, 11, 10,169,233,104,  9\n"
+" dcb  12,137,201, 13, 40, 44, 72, 43,170, 42, 45, 41,105, 73,202, 14\n"
+" dcb 138,234, 74, 75,106,203, 76,171, 46, 77,235,107,139, 15,108,172\n"
+" dcb 174,140,173,141,142,204,109,206,207,205, 78,175, 47,236,239,143\n"
+" dcb 237,238,110,240,241,111,208, 16, 79,176,209,242, 48,144,243, 80\n"
+" dcb 177,244,112,210, 17, 49,178,179, 52, 53,147, 18, 81,211,145, 19\n"
+" dcb 146, 51, 85,180, 20, 54,113,148, 22, 50, 84,212, 21, 55,115,245\n"
+" dcb  83,114,116, 23, 82, 86, 88, 89, 87,118,117,119,149,213, 56, 57\n"
+" dcb 181,214, 90,121,122,150,151,182,183,215,246, 58,120,247, 24,153\n"
+" dcb 184,152,216, 25, 26, 59, 91,248,123,185, 27, 60,217,154, 28, 92\n"
+" dcb 249, 29,155,186, 61,218, 93,124,250,187, 30,251, 62,156, 94,125\n"
+" dcb 219,188, 31,252,254,220,253, 63,126,255,157,221, 95,159,191,222\n"
+" dcb 127,189,223,158,190,165, 66, 41,224,208, 72,165, 66, 24,105,  1\n"
+" dcb  41, 31,133, 66,165, 67,240,  7,198, 67,169,  0, 76, 97,  8,198\n"
+" dcb  69,240,247, 16, 37,166, 64,230, 64,189,177,  9, 16, 15, 41,127\n"
+" dcb 133, 67, 73,127,208,228,169,  1,133, 70, 76, 42,  8,170,189,117\n"
+" dcb   8,133, 69,234,234,189,181,  8,133, 65,166, 65,230, 65,189,245\n"
+" dcb   8,133, 68,165, 66, 24,105,224,133, 66,166, 66,169,  1,102, 68\n"
+" dcb  42,157,  0,160, 96,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  2\n"
+" dcb   3,  2,  3,  3,  3,  3,  3,  1,  2,  3,  1,  5,  3,  3,  3,  3\n"
+" dcb   3,  2,  2,  3,  3,  5,  4,  3,  3,  5,  4,  4,  4,  3,  3,  4\n"
+" dcb   4,  1,  3,  4,  3,  5,  5,  5,  4,  5,  4,  4,  3,  4,  4,  7\n"
+" dcb   4,  4,  4,  2,  1,  0,  3,  6,  9, 12, 15, 18, 21, 24, 27, 30\n"
+" dcb  32, 35, 35, 38, 40, 43, 46, 49, 50, 52,  4, 55, 55, 60, 63, 65\n"
+" dcb  68, 71, 73, 75, 78, 78, 33, 83, 86, 89, 94, 98,102,106,109,112\n"
+" dcb 116, 94,120,123,127,130,134,139,144,148,153,157,161,164,167,171\n"
+" dcb 178,171,182,186,  5, 56, 68, 56, 36,124,  4, 76, 84, 36, 68, 84\n"
+" dcb  40, 24, 40,124,100, 84, 88, 56, 84, 72, 76, 80, 96, 40, 84, 40\n"
+" dcb  36, 84, 56, 44, 28,124, 36, 24, 24, 36,124, 24, 52, 16, 60, 80\n"
+" dcb  24, 37, 30,124, 32, 28,188,  1,190,124, 24, 36, 60, 32, 28, 32\n"
+" dcb  28, 24, 36, 24, 63, 36, 24, 36, 63, 60, 16, 32, 52, 44,120, 36\n"
+" dcb  56,  4, 60, 56,  4, 56,  4, 56, 57,  6, 56, 44, 52, 36, 12, 48\n"
+" dcb 208, 48, 12,252,164,164, 88,120,132,132, 72,252,132,132,120,252\n"
+" dcb 164,132,252,160,128,120,132,164, 56,252, 32, 32,252,  8,  4,248\n"
+" dcb 252, 48, 80,140,252,  4,  4,252, 64, 60, 64,252, 64, 48,  8,252\n"
+" dcb 120,132,132,132,120,252,144,144, 96,120,132,134,133,120,252,144\n"
+" dcb 144,108, 68,164,164,152,128,252,128,248,  4,  4,248,  4,  8,240\n"
+" dcb 224, 28, 16,224, 28, 16,224,204, 48, 48,204,140,148,164,196,  0\n"
+" dcb   0,133, 41, 10, 28, 29, 63, 63, 63,136, 15, 10, 28, 29, 14, 27\n"
+" dcb  63, 63, 63,132, 55, 17, 18, 28, 62, 18, 28, 62, 10,136, 27, 14\n"
+" dcb  10, 21, 21, 34,143, 15, 10, 28, 29,142, 39, 40, 48, 50,149,145\n"
+" dcb  10, 23, 13, 62, 23, 24, 32,136, 28, 24, 22, 14,136, 11, 14, 10\n"
+" dcb  30, 29, 18, 15, 30, 21,128, 14, 15, 15, 14, 12, 29, 28, 63, 63\n"
+" dcb  63,144,159,255, 55, 17, 18, 28, 62, 18, 28, 62, 10, 21, 21,129\n"
+" dcb  15, 24, 27, 62, 23, 24, 32,136, 11, 34, 14, 63, 63, 63,141, 63\n"
+" dcb  63, 63, 11, 34, 14,150,159,143, 11, 34, 62, 39, 48, 54, 38,  2\n"
+" dcb   0,  0,  7, 63,  5, 63,  2,  9, 11, 34, 62, 39, 48, 54, 38,  2\n"
+" dcb   0,  0,  7, 63,  5, 63,  2,  9, 11, 34, 62, 39, 48, 54, 38,  2\n"
+" dcb   0,  0,  7, 63,  5, 63,  2,  9,143,159,255,169,  0,133, 42,169\n"
+" dcb   1,133, 44,133, 45,169,  0,133, 32,169,160,133, 33,165, 42,133\n"
+" dcb  43,162, 15,160, 15,145, 32, 24,101, 44,230, 44,136, 16,246,165\n"
+" dcb  32, 24,105, 32,133, 32,165, 33,105,  0,133, 33,169,  1,133, 44\n"
+" dcb 165, 43, 24,101, 45,133, 43,230, 45,202, 16,215,169,  0,133, 32\n"
+" dcb 169,160,133, 33,169,224,133, 34,169,  3,133, 35,169,  0,133, 36\n"
+" dcb 169,  4,133, 37,169,240,133, 38,169,  3,133, 39,169, 16,133, 40\n"
+" dcb 169,  4,133, 41,169, 15,133, 46,160, 15,177, 32, 74, 74, 74, 74\n"
+" dcb 170,189, 62, 11,209, 34,240, 18,145, 34,145, 36,170,152, 73, 15\n"
+" dcb 168,138,145, 38,145, 40,152, 73, 15,168,136, 16,221,165, 32, 24\n"
+" dcb 105, 32,133, 32,165, 33,105,  0,133, 33,165, 34, 24,105,224,133\n"
+" dcb  34,165, 35,105,255,133, 35,165, 36, 24,105, 32,133, 36,165, 37\n"
+" dcb 105,  0,133, 37,165, 38, 24,105,224,133, 38,165, 39,105,255,133\n"
+" dcb  39,165, 40, 24,105, 32,133, 40,165, 41,105,  0,133, 41,198, 46\n"
+" dcb  16,150,230, 42,165, 42, 41, 63,240,  3, 76, 95, 10, 96,  0, 11\n"
+" dcb  12, 15,  1, 15, 12, 11,  0, 11, 12, 15,  1, 15, 12, 11,  0, 11\n"
+" dcb  12, 15,  1, 15, 12, 11,  0, 11, 12, 15,  1, 15, 12, 11,169,  1\n"
+" dcb 162,255,134, 16,162,  1,134, 17, 32,  3,  6,169,  2,162,  7,134\n"
+" dcb  16,162,  2,134, 17, 32,  3,  6,169,  3,162,  7,134, 16,162,  3\n"
+" dcb 134, 17, 32,  3,  6,169, 31,133, 66,169,  0,133, 70,133, 67,133\n"
+" dcb  64,169,  1,141,109,  8,169,  0,141,114,  8,169,160,141,115,  8\n"
+" dcb 169, 63,133, 48,169,128,133, 49,169,  3,141,109,  8,169,  0,170\n"
+" dcb 157,  0,160,232,208,250, 32, 33,  6, 32,170,  6, 32,  6,  7, 32\n"
+" dcb  21,  8,165, 66, 73, 31,208, 13,173,109,  8, 24,105,  2, 41,  3\n"
+" dcb 105,  3,141,109,  8,165, 49,208,221,173, 17,  7, 73,  1,141, 17\n"
+" dcb   7,165, 70,240,209, 32, 29, 12, 32, 91, 10,169, 31,133, 66,169\n"
+" dcb   0,133, 70,133, 67,141,109,  8,169,  0,141,114,  8,169,  3,141\n"
+" dcb 115,  8, 32, 29, 12, 32, 21,  8,165, 66, 73, 31,208,247,173,115\n"
+" dcb   8, 73,  7,141,115,  8,165, 70,240,235, 76, 94, 11,169,  0,170\n"
+" dcb 157,  0,  2,157,  0,  3,157,  0,  4,157,  0,  5,232,208,241, 96\n"
+" \n"
+,
+"lda #0\n"
+" sta $0\n"
+"lop:\n"
+" lda $0\n"
+" sta $1\n"
+" lda #3\n"
+" sta $6\n"
+" lda #232\n"
+" sta $5\n"
+" ldx #0\n"
+"lpN:\n"
+" lsr $1\n"
+" bcc nos\n"
+" lda $5\n"
+" clc\n"
+" adc tL,x\n"
+" sta $5\n"
+" lda $6\n"
+" adc tH,x\n"
+" sta $6\n"
+"nos:\n"
+" inx\n"
+" lda $1\n"
+" bne lpN\n"
+" inx\n"
+" txa\n"
+" ldy #0\n"
+" sta ($5),y\n"
+" inc $0\n"
+" bne lop\n"
+" rts\n"
+"tL:\n"
+" dcb 32, 31, 254, 190, 128, 132, 8, 8\n"
+"tH:\n"
+" dcb 0, 0, 255, 255, 255, 255, 0, 1 \n"
+,
+"start:\n"
+"  lda #<logo\n"
+"  sta $0\n"
+"  lda #>logo\n"
+"  sta $1\n"
+"  lda #$00\n"
+"  sta $2\n"
+"  lda #$02\n"
+"  sta $3\n"
+"  ldx #$0\n"
+"l:\n"
+"  lda ($0,x)\n"
+"  sta ($2,x)\n"
+"  inc $00\n"
+"  lda $00\n"
+"  cmp #$00\n"
+"  bne notReset1\n"
+"  inc $01\n"
+"notReset1:\n"
+"  inc $02\n"
+"  lda $02 \n"
+"  cmp #$00\n"
+"  bne notReset2\n"
+"  lda $03\n"
+"  cmp #$05\n"
+"  beq done\n"
+"  inc $03\n"
+"notReset2:\n"
+"  jmp l\n"
+"done:\n"
+"  rts\n"
+"logo:\n"
+" dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,6,6,6\n"
+" dcb 6,6,6,6,1,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,1,1,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,6,6,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,6,6,6,6,6,6,6,6,6,6,6,6,1\n"
+" dcb 1,1,1,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,6,6,6,6,6,6,6,6,6,6,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 1,1,6,6,6,6,6,6,6,6,6,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,6,6,6,6,1\n"
+" dcb 1,1,6,6,6,6,6,6,6,6,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,6,6,6,1,1\n"
+" dcb 1,1,6,6,6,6,6,6,6,6,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,6,6,1,1,1\n"
+" dcb 1,6,6,6,6,6,6,6,6,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,6,1,1,1,1\n"
+" dcb 1,6,6,6,6,6,6,6,6,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,1,1,1,1,1\n"
+" dcb 1,6,6,6,6,6,6,6,6,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,1,1,1,1,1,1\n"
+" dcb 1,6,6,6,6,6,6,6,6,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1\n"
+" dcb 1,6,6,6,6,6,6,6,6,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1\n"
+" dcb 1,6,6,6,6,6,6,6,6,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1\n"
+" dcb 1,6,6,6,6,6,6,6,6,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,2,2,2,2,2,2,2,2,1,1,1\n"
+" dcb 1,1,6,6,6,6,6,6,6,6,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,2,2,2,2,2,2,2,2,2,1,1\n"
+" dcb 1,1,6,6,6,6,6,6,6,6,6,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,1\n"
+" dcb 1,1,1,6,6,6,6,6,6,6,6,6,1,1,1,1\n"
+" dcb 1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2\n"
+" dcb 1,1,1,6,6,6,6,6,6,6,6,6,6,1,1,1\n"
+" dcb 1,1,1,1,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,6,6,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,6,6,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,6,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,6,6,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,6,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,1,6,6,6,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,1,1,1,1,6,6,6,6\n"
+" dcb 6,6,6,6,6,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+" dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+,
+"lda #$0\n"
+"sta $0\n"
+"lda #$2\n"
+"sta $1\n"
+"start:\n"
+"lda $1\n"
+"cmp #$6\n"
+"bne randOffset\n"
+"lda #$2\n"
+"sta $1\n"
+"randOffset:\n"
+"clc\n"
+"lda $fe\n"
+"adc $0\n"
+"sta $0\n"
+"lda $1\n"
+"adc #$0\n"
+"sta $1\n"
+"cmp #$06\n"
+"bne setRect\n"
+"lda #$02\n"
+"sta $1\n"
+"setRect:\n"
+"lda $fe\n"
+"and #$f\n"
+"tax\n"
+"inx\n"
+"stx $2\n"
+"stx $3\n"
+"lda $fe\n"
+"and #$f\n"
+"tax\n"
+"inx\n"
+"stx $4\n"
+"lda $fe\n"
+"sta $5\n"
+"ldy #0\n"
+"draw:\n"
+"lda $5\n"
+"sta ($0), y\n"
+"dec $3\n"
+"beq down\n"
+"lda $0\n"
+"clc\n"
+"adc #$1\n"
+"sta $0\n"
+"lda $1\n"
+"adc #$0\n"
+"sta $1\n"
+"cmp #$06\n"
+"beq done\n"
+"jmp draw\n"
+"down:\n"
+"ldx $2\n"
+"dex\n"
+"lda $0\n"
+"stx $0\n"
+"sec\n"
+"sbc $0\n"
+"sta $0\n"
+"lda $1\n"
+"sbc #$0\n"
+"sta $1\n"
+"dec $4\n"
+"beq done\n"
+"lda $2\n"
+"sta $3\n"
+"lda $0\n"
+"clc\n"
+"adc #$20\n"
+"sta $0\n"
+"lda $1\n"
+"adc #$0\n"
+"sta $1\n"
+"cmp #$06\n"
+"beq done\n"
+"jmp draw\n"
+"done:\n"
+"jmp start\n"
+,
+"init:\n"
+"  ldx #0\n"
+"  stx $0\n"
+"  inx\n"
+"  stx $2\n"
+"  stx $3\n"
+"  inx\n"
+"  stx $1\n"
+"loop:\n"
+"  lda $2\n"
+"  cmp #$20\n"
+"  bne notIncF2\n"
+"  inc $3\n"
+"  lda #0\n"
+"  sta $2\n"
+"notIncF2:\n"
+"  inc $2\n"
+"  lda $2\n"
+"  sta $f1\n"
+"  lda $2\n"
+"  sta $f2\n"
+"  jsr multiply\n"
+"  lda $f4\n"
+"  sta $f8\n"
+"  lda $3\n"
+"  sta $f1\n"
+"  lda $3\n"
+"  sta $f2\n"
+"  jsr multiply\n"
+"  lda $f4\n"
+"  clc\n"
+"  adc $f8\n"
+"  lsr\n"
+"  lsr\n"
+"  lsr\n"
+"  lsr\n"
+"  lsr\n"
+"  ldx #0\n"
+"  sta ($0,x)\n"
+"  inc $0\n"
+"  lda $0\n"
+"  cmp #$00\n"
+"  bne notNextY\n"
+"  inc $1\n"
+"  lda $1\n"
+"  cmp #6\n"
+"  beq exit\n"
+"notNextY:\n"
+"  jmp loop\n"
+"exit:\n"
+"  rts\n"
+"multiply:\n"
+"  lda #0\n"
+"  sta $f4\n"
+"  sta $f5\n"
+"  ldx #8\n"
+"a:asl $f4\n"
+"  rol $f5\n"
+"  asl $f2\n"
+"  bcc b\n"
+"  clc\n"
+"  lda $f4\n"
+"  adc $f1\n"
+"  sta $f4\n"
+"  bcc b\n"
+"  inc $f5\n"
+"b:dex\n"
+"  bne a\n"
+"  rts \n",
+"randfill:   stx $01\n"
+"            ldx #$02\n"
+"            stx $02\n"
+"randloop:   lda $fe\n"
+"            and #$01\n"
+"            sta ($01),Y\n"
+"            jsr inc0103\n"
+"            cmp #$00\n"
+"            bne randloop\n"
+"            lda $02\n"
+"            cmp #$06\n"
+"            bne randloop\n"
+" \n"
+" \n"
+"clearmem:   lda #$df\n"
+"            sta $01\n"
+"            lda #$07\n"
+"            sta $02\n"
+"clearbyte:  lda #$00\n"
+"            sta ($01),Y\n"
+"            jsr inc0103\n"
+"            cmp #$20\n"
+"            bne clearbyte\n"
+"            lda $02\n"
+"            cmp #$0a\n"
+"            bne clearbyte\n"
+" \n"
+" \n"
+"starttick:\n"
+"copyscreen: lda #$00\n"
+"            sta $01\n"
+"            sta $03\n"
+"            lda #$02\n"
+"            sta $02\n"
+"            lda #$08\n"
+"            sta $04\n"
+"            ldy #$00\n"
+"copybyte:   lda ($01),Y\n"
+"            sta ($03),Y\n"
+"            jsr inc0103\n"
+"            cmp #$00\n"
+"            bne copybyte\n"
+"            lda $02\n"
+"            cmp #$06\n"
+"            bne copybyte\n"
+" \n"
+" \n"
+"conway:     lda #$df\n"
+"            sta $01\n"
+"            sta $03\n"
+"            lda #$01\n"
+"            sta $02\n"
+"            lda #$07\n"
+"            sta $04\n"
+"onecell:    lda #$00\n"
+"            ldy #$01\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"            ldy #$41\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"chkleft:    tax\n"
+"            lda $01\n"
+"            and #$1f\n"
+"            tay\n"
+"            txa\n"
+"            cpy #$1f\n"
+"            beq rightcells\n"
+"leftcells:  ldy #$00\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"            ldy #$20\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"            ldy #$40\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"chkright:   tax\n"
+"            lda $01\n"
+"            and #$1f\n"
+"            tay\n"
+"            txa\n"
+"            cpy #$1e\n"
+"            beq evaluate\n"
+"rightcells: ldy #$02\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"            ldy #$22\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"            ldy #$42\n"
+"            clc\n"
+"            adc ($03),Y\n"
+"evaluate:   ldx #$01\n"
+"            ldy #$21\n"
+"            cmp #$03\n"
+"            beq storex\n"
+"            ldx #$00\n"
+"            cmp #$02\n"
+"            bne storex\n"
+"            lda ($03),Y\n"
+"            and #$01\n"
+"            tax\n"
+"storex:     txa\n"
+"            sta ($01),Y\n"
+"            jsr inc0103\n"
+"conwayloop: cmp #$e0\n"
+"            bne onecell\n"
+"            lda $02\n"
+"            cmp #$05\n"
+"            bne onecell\n"
+"            jmp starttick\n"
+" \n"
+" \n"
+"inc0103:    lda $01\n"
+"            cmp #$ff\n"
+"            bne onlyinc01\n"
+"            inc $02\n"
+"            inc $04\n"
+"onlyinc01:  inc $01\n"
+"            lda $01\n"
+"            sta $03\n"
+"            rts\n"
+,
+"main_loop:\n"
+"	lda #$00\n"
+"	sta $0\n"
+"y_loop:\n"
+"	ldx $0\n"
+"	lda #1\n"
+"	bit $1\n"
+"	beq left_right\n"
+"	lda x_px0,x\n"
+"	and #1\n"
+"	bne fill\n"
+"	jmp next_y\n"
+"clear:\n"
+"	ldx #1\n"
+"	lda $0\n"
+"	clc\n"
+"	adc #$20\n"
+"	tay\n"
+"	sec\n"
+"clear_loop:\n"
+"	lda #0\n"
+"	sta $0200,y\n"
+"	sta $0240,y\n"
+"	sta $0280,y\n"
+"	sta $02c0,y\n"
+"	sta $0300,y\n"
+"	sta $0340,y\n"
+"	sta $0380,y\n"
+"	sta $03c0,y\n"
+"	sta $0400,y\n"
+"	sta $0440,y\n"
+"	sta $0480,y\n"
+"	sta $04c0,y\n"
+"	sta $0500,y\n"
+"	sta $0540,y\n"
+"	sta $0580,y\n"
+"	sta $05c0,y\n"
+"	tya\n"
+"	sbc #$20\n"
+"	tay\n"
+"	dex\n"
+"	bpl clear_loop\n"
+"	jmp next_y\n"
+"left_right:\n"
+"	lda x_px0,x\n"
+"	bit const_two\n"
+"	beq next_y\n"
+"	lda x_px0,x\n"
+"	and #1\n"
+"	beq clear\n"
+"fill:\n"
+"	ldx #1\n"
+"	lda $0\n"
+"	clc\n"
+"	adc #$20\n"
+"	tay\n"
+"	sec\n"
+"fill_loop:\n"
+"	lda y_px0,x\n"
+"	sta $0200,y\n"
+"	lda y_px1,x\n"
+"	sta $0240,y\n"
+"	lda y_px2,x\n"
+"	sta $0280,y\n"
+"	lda y_px3,x\n"
+"	sta $02c0,y\n"
+"	lda y_px4,x\n"
+"	sta $0300,y\n"
+"	lda y_px5,x\n"
+"	sta $0340,y\n"
+"	lda y_px6,x\n"
+"	sta $0380,y\n"
+"	lda y_px7,x\n"
+"	sta $03c0,y\n"
+"	lda y_px8,x\n"
+"	sta $0400,y\n"
+"	lda y_px9,x\n"
+"	sta $0440,y\n"
+"	lda y_pxa,x\n"
+"	sta $0480,y\n"
+"	lda y_pxb,x\n"
+"	sta $04c0,y\n"
+"	lda y_pxc,x\n"
+"	sta $0500,y\n"
+"	lda y_pxd,x\n"
+"	sta $0540,y\n"
+"	lda y_pxe,x\n"
+"	sta $0580,y\n"
+"	lda y_pxf,x\n"
+"	sta $05c0,y\n"
+"	tya\n"
+"	sbc #$20\n"
+"	tay\n"
+"	dex\n"
+"	bpl fill_loop\n"
+"next_y:\n"
+"	inc $0\n"
+"	lda #32\n"
+"	cmp $0\n"
+"	beq shift\n"
+"	jmp y_loop\n"
+"shift:\n"
+"	lda $fe\n"
+"	and #$3\n"
+"	sta $1\n"
+"	beq shift_x1\n"
+"	cmp #2\n"
+"	bmi shift_y1\n"
+"	beq shift_x0\n"
+"shift_y0:\n"
+"	ldx #0\n"
+"shift_y0_loop:\n"
+"	lda y_px0,x\n"
+"	eor y_px00,x\n"
+"	sta y_px0,x\n"
+"	inx\n"
+"	cpx #31\n"
+"	bne shift_y0_loop\n"
+"	jmp main_loop\n"
+"shift_y1:\n"
+"	ldx #30\n"
+"shift_y1_loop:\n"
+"	lda y_px00,x\n"
+"	eor y_px0,x\n"
+"	sta y_px00,x\n"
+"	dex\n"
+"	bpl shift_y1_loop\n"
+"	jmp main_loop\n"
+"shift_x0:\n"
+"	ldx #0\n"
+"shift_x0_loop:\n"
+"	lda x_px0,x\n"
+"	eor x_px00,x\n"
+"	lsr\n"
+"	lda x_px00,x\n"
+"	rol\n"
+"	sta x_px0,x\n"
+"	inx\n"
+"	cpx #31\n"
+"	bne shift_x0_loop\n"
+"	jmp main_loop\n"
+"shift_x1:\n"
+"	ldx #30\n"
+"shift_x1_loop:\n"
+"	lda x_px00,x\n"
+"	eor x_px0,x\n"
+"	lsr\n"
+"	lda x_px0,x\n"
+"	rol\n"
+"	sta x_px00,x\n"
+"	dex\n"
+"	bpl shift_x1_loop\n"
+"	jmp main_loop\n"
+"y_px0:\n"
+"	dcb 0\n"
+"y_px00:\n"
+"	dcb 0\n"
+"y_px1:\n"
+"	dcb 0, 0\n"
+"y_px2:\n"
+"	dcb 0, 0\n"
+"y_px3:\n"
+"	dcb 0, 0\n"
+"y_px4:\n"
+"	dcb 0, 0\n"
+"y_px5:\n"
+"	dcb 0, 0\n"
+"y_px6:\n"
+"	dcb 0, 0\n"
+"y_px7:\n"
+"	dcb 0, 0\n"
+"y_px8:\n"
+"	dcb 1, 0\n"
+"y_px9:\n"
+"	dcb 0, 0\n"
+"y_pxa:\n"
+"	dcb 0, 0\n"
+"y_pxb:\n"
+"	dcb 0, 0\n"
+"y_pxc:\n"
+"	dcb 0, 0\n"
+"y_pxd:\n"
+"	dcb 0, 0\n"
+"y_pxe:\n"
+"	dcb 0, 0\n"
+"y_pxf:\n"
+"	dcb 0, 0\n"
+"x_px0:\n"
+"	dcb 0\n"
+"x_px00:\n"
+"	dcb    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0\n"
+"	dcb 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0\n"
+"const_two:\n"
+"	dcb 2\n"
+,
+"	\n"
+"loop:   \n"
+"   	lda $fe\n"
+"	and #$1f\n"
+"	tay\n"
+"	tax\n"
+"	lda matrix,y\n"
+"	sta $1\n"
+"	tay\n"
+"	lda #0\n"
+"	jsr paint\n"
+"   inc $1\n"
+"   lda $1\n"
+"   and #$1f\n"
+"   sta matrix,y\n"
+"   tay\n"
+"   lda #5 \n"
+"   jsr paint\n"
+"   	lda $fe\n"
+"	and #$1f\n"
+"	tay\n"
+"	tax\n"
+"	lda matrix,y\n"
+"	sta $1\n"
+"	tay\n"
+"	lda #$d\n"
+"	jsr paint\n"
+"   	lda $fe\n"
+"	and #$1f\n"
+"	tay\n"
+"	tax\n"
+"	lda matrix,y\n"
+"	sta $1\n"
+"	tay\n"
+"	lda #$5\n"
+"	jsr paint\n"
+"   jmp loop\n"
+"	\n"
+"paint:\n"
+"   pha\n"
+"   lda yl,y\n"
+"   sta $2\n"
+"   lda yh,y\n"
+"   sta $3\n"
+"   txa\n"
+"   tay\n"
+"   pla\n"
+"   sta ($2),y\n"
+"   rts\n"
+"yh:\n"
+"       dcb $02, $02, $02, $02, $02, $02, $02, $02\n"
+"       dcb $03, $03, $03, $03, $03, $03, $03, $03\n"
+"       dcb $04, $04, $04, $04, $04, $04, $04, $04\n"
+"       dcb $05, $05, $05, $05, $05, $05, $05, $05\n"
+"       \n"
+"yl:\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"   \n"
+"matrix:\n"
+"	dcb 5,16,19,19,17,26,10,14,11,4,1,2,20,1,8,30\n"
+"	dcb 17,26,19,19,31,21,11,19,3,24,4,24,13,8,8,26\n"
+,
+"start: ldy #$ff\n"
+"       ldx #$0\n"
+"loop:  lda $fe\n"
+"       sta $200,x\n"
+"       and #$7\n"
+"       sta $300,x\n"
+"       and #$3\n"
+"       sta $400,x\n"
+"       and #$1\n"
+"       sta $500,x\n"
+"       inx\n"
+"       dey\n"
+"       bne loop\n"
+"       rts\n"
+,
+"   lda #16\n"
+"   sta $0\n"
+"   sta $1\n"
+"   lda $fe\n"
+"   sta $5\n"
+"   lda $fe\n"
+"   sta $6\n"
+"loop:\n"
+"   ldx $0\n"
+"   ldy $1\n"
+"   lda $5\n"
+"   jsr paint\n"
+"   jsr walk\n"
+"   dec $6\n"
+"   bne loop\n"
+"   lda $fe\n"
+"   sta $5\n"
+"   lda $fe\n"
+"   sta $6\n"
+"   jmp loop\n"
+"walk:\n"
+"   lda $fe\n"
+"   and #3\n"
+"   cmp #0\n"
+"   beq right\n"
+"   cmp #1\n"
+"   beq left\n"
+"   cmp #2\n"
+"   beq up\n"
+"   jmp down\n"
+"right:\n"
+"   inc $0\n"
+"   jmp done\n"
+"left:\n"
+"   dec $0\n"
+"   jmp done\n"
+"up:\n"
+"   dec $1\n"
+"   jmp done\n"
+"down:\n"
+"   inc $1\n"
+"   jmp done\n"
+"done:\n"
+"   lda $0\n"
+"   and #31\n"
+"   sta $0\n"
+"   lda $1\n"
+"   and #31\n"
+"   sta $1\n"
+"   rts\n"
+"paint:\n"
+"   pha\n"
+"   lda yl,y\n"
+"   sta $2\n"
+"   lda yh,y\n"
+"   sta $3\n"
+"   txa\n"
+"   tay\n"
+"   pla\n"
+"   sta ($2),y\n"
+"   rts\n"
+"yh:\n"
+"       dcb $02, $02, $02, $02, $02, $02, $02, $02\n"
+"       dcb $03, $03, $03, $03, $03, $03, $03, $03\n"
+"       dcb $04, $04, $04, $04, $04, $04, $04, $04\n"
+"       dcb $05, $05, $05, $05, $05, $05, $05, $05\n"
+"yl:\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0 \n"
+,
+"loop: lda $fe\n"
+"      sta $00\n"
+"      lda $fe\n"
+"      and #$3\n"
+"      clc\n"
+"      adc #$2\n"
+"      sta $01\n"
+"      lda $fe\n"
+"      ldy #$0\n"
+"      sta ($00),y\n"
+"      jmp loop\n"
+,
+"      lda $fe\n"
+"      sta $00\n"
+"      lda $fe\n"
+"      and #$3\n"
+"      clc\n"
+"      adc #$2\n"
+"      sta $01\n"
+"      lda $fe\n"
+"      ldy #$0\n"
+"      sta ($00),y\n"
+"      jmp $600\n"
+,
+"  lda #8\n"
+"  tax\n"
+"dr:\n"
+"  sta $3cb,x\n"
+"  sta $40b,x\n"
+"  dex\n"
+"  bpl dr\n"
+"  sta $3f3\n"
+"  sta $3eb\n"
+"  lda #1\n"
+"  sta $3ec\n"
+"  ldx #255\n"
+"mk:\n"
+"  lda $fe\n"
+"  sta $1200,x\n"
+"  lda $fe\n"
+"  sta $1300,x\n"
+"  lda $fe\n"
+"  sta $1400,x\n"
+"  lda $fe\n"
+"  sta $1500,x\n"
+"  dex\n"
+"  cpx #$ff\n"
+"  bne mk\n"
+"  ldy #0\n"
+"re:\n"
+"  lda #1\n"
+"  sta $3ec,y\n"
+"  ldx #255\n"
+"sm:\n"
+"  lda $1201,x\n"
+"  adc $11ff,x\n"
+"  adc $1220,x\n"
+"  adc $11e0,x\n"
+"  lsr\n"
+"  lsr\n"
+"  sta $1200,x\n"
+"  lda $1301,x\n"
+"  adc $12ff,x\n"
+"  adc $1320,x\n"
+"  adc $12e0,x\n"
+"  lsr\n"
+"  lsr\n"
+"  sta $1300,x\n"
+"  lda $1401,x\n"
+"  adc $13ff,x\n"
+"  adc $1420,x\n"
+"  adc $13e0,x\n"
+"  lsr\n"
+"  lsr\n"
+"  sta $1400,x\n"
+"  lda $1501,x\n"
+"  adc $14ff,x\n"
+"  adc $1520,x\n"
+"  adc $14e0,x\n"
+"  lsr\n"
+"  lsr\n"
+"  sta $1500,x\n"
+"  dex\n"
+"  cpx #$ff\n"
+"  bne sm\n"
+"  iny\n"
+"  cpy #7\n"
+"  bne re\n"
+"  lda #1\n"
+"  sta $3f0\n"
+"  clc\n"
+"  ldx #255\n"
+"cp:\n"
+"  lda $1200,x\n"
+"  lsr\n"
+"  lsr\n"
+"  tay\n"
+"  lda colors,y\n"
+"  sta $200,x\n"
+"  lda $1300,x\n"
+"  lsr\n"
+"  lsr\n"
+"  tay\n"
+"  lda colors,y\n"
+"  sta $300,x\n"
+"  lda $1400,x\n"
+"  lsr\n"
+"  lsr\n"
+"  tay\n"
+"  lda colors,y\n"
+"  sta $400,x\n"
+"  lda $1500,x\n"
+"  lsr\n"
+"  lsr\n"
+"  tay\n"
+"  lda colors,y\n"
+"  sta $500,x\n"
+"  dex\n"
+"  cpx #$ff\n"
+"  bne cp\n"
+"  rts\n"
+"colors:\n"
+"  dcb 0,0,0,0,0,$9,$9,1,1,0,0,0,0,0\n"
+,
+"start:\n"
+"ldx #0\n"
+"cs:\n"
+"lda $2000,x\n"
+"sta $500,x\n"
+"dex\n"
+"bne cs\n"
+"stx $20\n"
+"loop:\n"
+"inc $20\n"
+"lda $20\n"
+"and #$7f\n"
+"tay\n"
+"and #$1f\n"
+"tax\n"
+"lda sinus,x\n"
+"tax\n"
+"d:\n"
+"lda #0\n"
+"sta $1e0,x\n"
+"sta $2e0,x\n"
+"lda $1000,y\n"
+"sta $200,x\n"
+"lda $1080,y\n"
+"sta $220,x\n"
+"lda $1100,y\n"
+"sta $240,x\n"
+"lda $1180,y\n"
+"sta $260,x\n"
+"lda $1200,y\n"
+"sta $280,x\n"
+"lda $1280,y\n"
+"sta $2a0,x\n"
+"lda $1300,y\n"
+"sta $2c0,x\n"
+"lda $1380,y\n"
+"sta $2c0,x\n"
+"inx\n"
+"iny\n"
+"txa\n"
+"and #$1f\n"
+"bne d\n"
+"jmp loop\n"
+"sinus:\n"
+"dcb 0,0,0,0,$20,$20,$20\n"
+"dcb $40,$40,$60,$80,$a0,$a0,$c0,$c0,$c0\n"
+"dcb $e0,$e0,$e0,$e0,$c0,$c0,$c0\n"
+"dcb $a0,$a0,$80,$60,$40,$40,$20,$20,$20\n"
+"*=$1000\n"
+"santa:\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,$a,$a,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,$a,$a,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,2,2,2,1,0,0,0,0,$9,$9,$9,$9,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,$a,$a,$a,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,$a,$a,$a,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,$9,$9,0,0,0,0,0,0,0,0\n"
+"dcb 0,1,1,2,2,0,$9,$9,$9,$9,$9,$9,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,$a,$a,$a,$a,$a,$a,0,0,0,0\n"
+"dcb 0,0,0,$a,$a,$a,$a,$a,$a,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,$9,$9,$9,0,0,0,0,0,0\n"
+"dcb 0,1,2,2,$9,$9,$9,$9,$9,$9,$9,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,$a,$a,$a,$a,$a,$a,$b\n"
+"dcb $b,$b,$b,$b,$b,$b,$a,$a,$a,$a,$a,$a,$b,$b,$b,$b\n"
+"dcb $b,$b,$b,$b,$b,$9,$9,$9,$9,$9,$9,$9,$9,$9,$9,$9\n"
+"dcb $9,2,2,$9,$9,$9,$9,$9,$9,$9,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,$a,$a,$a,$a,$a,$a,$a\n"
+"dcb $a,0,0,0,0,0,$a,$a,$a,$a,$a,$a,$a,$a,0,0\n"
+"dcb 0,0,0,0,0,0,0,$9,$9,$9,$9,$9,$9,$9,$9,$9\n"
+"dcb 2,2,$9,$9,$9,$9,$9,$9,$9,$9,$9,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,$a,$a,$a,$a,$a,$a,0\n"
+"dcb $a,$a,0,0,0,0,$a,$a,$a,$a,$a,$a,0,$a,$a,0\n"
+"dcb 0,0,0,0,0,$a,$a,0,0,$9,$a,$9,$9,$9,$9,$9\n"
+"dcb $9,$9,$a,$9,$9,$9,$9,$9,$9,$9,$9,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,$a,0,$a,0,0,$a,0\n"
+"dcb 0,$a,0,0,0,0,$a,0,$a,0,0,$a,0,0,$a,0\n"
+"dcb 0,0,0,0,0,$a,0,0,0,$a,0,0,0,0,0,0\n"
+"dcb 0,$a,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,$a,$a,0,$a,0,0,$a,$a\n"
+"dcb 0,$a,$a,0,0,$a,$a,0,$a,0,0,$a,$a,0,$a,$a\n"
+"dcb 0,0,0,0,0,0,$a,$a,$a,$a,$a,$a,$a,$a,$a,$a\n"
+"dcb $a,$a,$a,$a,$a,$a,$a,$a,$a,$a,$a,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"*=$2000\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,$c,1,1,1\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,1,1,1,$a,$a\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,$c,1,1,1,1,1\n"
+"dcb 1,1,$c,0,0,0,0,0,0,0,0,0,1,1,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,$c,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,$c,0,0,0,0,0,1,1,1,1,0\n"
+"dcb 0,0,0,0,0,0,$c,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,$c,0,0,0,0,1,1,1,1,0\n"
+"dcb 0,0,0,0,0,$c,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,$c,0,0,1,1,0,0\n"
+"dcb 0,0,$c,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"	\n",
+"  lda $fe\n"
+"  sta $1001\n"
+"  jmp $1000\n"
+"  *=$1000\n"
+"  lda #$00\n"
+"  sta $3ef\n"
+"  jmp $600\n"
+,
+"lda #7\n"
+"sta $f\n"
+"lda #0\n"
+"sta $10\n"
+"lda #$00\n"
+"sta $4\n"
+"lda #$10\n"
+"sta $5\n"
+"lda #$00\n"
+"sta $6\n"
+"lda #$11\n"
+"sta $7\n"
+"ldy #$ff\n"
+"initCells:\n"
+"lda #0\n"
+"sta ($4),y\n"
+"sta ($6),y\n"
+"dey\n"
+"bne initCells\n"
+"ldy #115\n"
+"lda #1\n"
+"sta ($4),y\n"
+"   \n"
+"lda #15\n"
+"sta $d\n"
+"lda #16\n"
+"sta $e\n"
+"mainloop:\n"
+"lda #0\n"
+"sta $a\n"
+"lda #0\n"
+"sta $9\n"
+"ldy #248\n"
+"display:\n"
+"lda #0\n"
+"sta $8\n"
+"lda $a\n"
+"beq stop16\n"
+"lda #15\n"
+"sta $b\n"
+"lda #1\n"
+"sta $8\n"
+"jmp toggle\n"
+"stop16:\n"
+"lda #16\n"
+"sta $b\n"
+"toggle:\n"
+"lda $a\n"
+"eor #1\n"
+"sta $a\n"
+"ldx $b\n"
+"inner_display:\n"
+"dex\n"
+"txa\n"
+"pha\n"
+"dey\n"
+"tya\n"
+"pha\n"
+"lda ($4),y\n"
+"beq display_continue\n"
+"ldx $8\n"
+"ldy $9\n"
+"lda #1\n"
+"jsr paint\n"
+"ldx $8\n"
+"ldy $9\n"
+"inx\n"
+"jsr paint\n"
+"ldx $8\n"
+"ldy $9\n"
+"iny\n"
+"jsr paint\n"
+"ldx $8\n"
+"ldy $9\n"
+"inx\n"
+"iny\n"
+"jsr paint\n"
+"display_continue:\n"
+"inc $8\n"
+"inc $8\n"
+"pla\n"
+"tay\n"
+"pha\n"
+"tax\n"
+"dey\n"
+"lda ($4),y\n"
+"iny\n"
+"iny\n"
+"clc\n"
+"adc ($4),y\n"
+"sta $c\n"
+"txa\n"
+"sec\n"
+"sbc $d\n"
+"tay\n"
+"lda $c\n"
+"clc\n"
+"adc ($4),y\n"
+"sta $c\n"
+"txa\n"
+"sec\n"
+"sbc $e\n"
+"tay\n"
+"lda $c\n"
+"clc\n"
+"adc ($4),y\n"
+"sta $c\n"
+"txa\n"
+"clc\n"
+"adc $d\n"
+"tay\n"
+"lda $c\n"
+"clc\n"
+"adc ($4),y\n"
+"sta $c\n"
+"txa\n"
+"clc\n"
+"adc $e\n"
+"tay\n"
+"lda $c\n"
+"clc\n"
+"adc ($4),y\n"
+"sta $c\n"
+"pla\n"
+"tay\n"
+"lda $c\n"
+"and #1\n"
+"beq dontset\n"
+"sta ($6),y\n"
+"dontset:\n"
+"   \n"
+"pla\n"
+"tax\n"
+"beq exit_inner_display\n"
+"jmp inner_display\n"
+"exit_inner_display:\n"
+"inc $9\n"
+"inc $9\n"
+"tya\n"
+"beq display_exit\n"
+"jmp display\n"
+"display_exit:\n"
+"ldy #248\n"
+"copybuf:\n"
+"dey\n"
+"lda ($6),y\n"
+"sta ($4),y\n"
+"tya\n"
+"bne copybuf\n"
+"dec $f\n"
+"lda $f\n"
+"beq reset_main\n"
+"jmp mainloop\n"
+"reset_main:\n"
+"lda #7\n"
+"sta $f\n"
+"lda #$ff\n"
+"sta $11\n"
+"delay:\n"
+"ldy #$a0\n"
+"inner_delay:\n"
+"nop\n"
+"dey\n"
+"bne inner_delay\n"
+"dec $11\n"
+"lda $11\n"
+"bne delay\n"
+"clrscr:\n"
+"lda $fe\n"
+"and $f\n"
+"cmp #1\n"
+"beq clrscr\n"
+"ldy #$00\n"
+"ldx #$0\n"
+"cs_loop: \n"
+"sta $200,x\n"
+"sta $300,x\n"
+"sta $400,x\n"
+"sta $500,x\n"
+"pha\n"
+"lda #0\n"
+"sta ($6),y\n"
+"sta ($4),y\n"
+"pla\n"
+"inx\n"
+"dey\n"
+"bne cs_loop\n"
+"inc $10\n"
+"lda $10\n"
+"and #3\n"
+"sta $10\n"
+"cmp #0\n"
+"beq pattern1\n"
+"cmp #1\n"
+"beq pattern2\n"
+"cmp #2\n"
+"beq pattern3\n"
+"cmp #3\n"
+"beq pattern4\n"
+"pattern1:\n"
+"ldy #114\n"
+"lda #1\n"
+"sta ($4),y\n"
+"ldy #115\n"
+"lda #1\n"
+"sta ($4),y\n"
+"ldy #116\n"
+"lda #1\n"
+"sta ($4),y\n"
+"jmp mainloop\n"
+"pattern2:\n"
+"ldy #113\n"
+"lda #1\n"
+"sta ($4),y\n"
+"ldy #118\n"
+"lda #1\n"
+"sta ($4),y\n"
+"jmp mainloop\n"
+"pattern3:\n"
+"ldy #115\n"
+"lda #1\n"
+"sta ($4),y\n"
+"jmp mainloop\n"
+"pattern4:\n"
+"ldy #102\n"
+"lda #1\n"
+"sta ($4),y\n"
+"ldy #128\n"
+"lda #1\n"
+"sta ($4),y\n"
+"jmp mainloop\n"
+"paint:\n"
+"   pha\n"
+"   lda yl,y\n"
+"   sta $2\n"
+"   lda yh,y\n"
+"   sta $3\n"
+"   txa\n"
+"   tay\n"
+"   pla\n"
+"   sta ($2),y\n"
+"   rts\n"
+"yh:\n"
+"       dcb $02, $02, $02, $02, $02, $02, $02, $02\n"
+"       dcb $03, $03, $03, $03, $03, $03, $03, $03\n"
+"       dcb $04, $04, $04, $04, $04, $04, $04, $04\n"
+"       dcb $05, $05, $05, $05, $05, $05, $05, $05\n"
+"yl:\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0\n"
+"       dcb $00, $20, $40, $60, $80, $a0, $c0, $e0 \n"
+,
+"start:\n"
+"  lda #$e1\n"
+"  sta $0\n"
+"  lda #$01\n"
+"  sta $1\n"
+"  ldy #$20\n"
+"write:\n"
+"  ldx #$00\n"
+"  eor ($0, x)\n"
+"  sta ($0),y\n"
+"  inc $0\n"
+"  bne write\n"
+"  inc $1\n"
+"  ldx $1\n"
+"  cpx #$06\n"
+"  bne write\n"
+"  rts\n"
+,
+"	\n"
+"	LDX #0\n"
+"	LDY #0\n"
+"new_rnd:\n"
+"	LDA $FE\n"
+"	AND #3\n"
+"	CMP #3\n"
+"	BNE good_rnd\n"
+"	JMP new_rnd\n"
+"good_rnd:     \n"
+"	PHA\n"
+"	ASL\n"
+"	ASL\n"
+"	ASL\n"
+"	STA $F3\n"
+"	PLA\n"
+"	AND #1\n"
+"	ASL\n"
+"	ASL\n"
+"	ASL\n"
+"	ASL\n"
+"	STA $F4\n"
+"	TXA\n"
+"	LSR\n"
+"	ADC $F3\n"
+"	TAX\n"
+"	TYA\n"
+"	LSR\n"
+"	ADC $F4\n"
+"	TAY\n"
+"	JSR set_point\n"
+"	JMP new_rnd\n"
+"set_point:\n"
+"	PHA\n"
+"	TXA\n"
+"	PHA\n"
+"	TYA\n"
+"	PHA \n"
+"	PHA \n"
+"	PHA\n"
+"	STX $F2\n"
+"	LDY $F2\n"
+"	LDA #0\n"
+"	STA $F0\n"
+"	LDA #$2\n"
+"	STA $F1\n"
+"	LDA #0\n"
+"	PLA\n"
+"	AND #$07\n"
+"	ASL\n"
+"	ASL\n"
+"	ASL\n"
+"	ASL\n"
+"	ASL\n"
+"	CLC\n"
+"	ADC $F0\n"
+"	STA $F0\n"
+"	BCC no_carry\n"
+"	INC $F1\n"
+"no_carry:\n"
+"	CLC\n"
+"	PLA\n"
+"	AND #$18\n"
+"	LSR\n"
+"	LSR\n"
+"	LSR\n"
+"	ADC $F1\n"
+"	STA $F1		\n"
+"	CLC\n"
+"	TYA\n"
+"	ADC $F0\n"
+"	ADC $F1\n"
+"	LDA #1\n"
+"   	JSR set_toning_point\n"
+"	STA ($F0),Y\n"
+"	PLA\n"
+"	TAY\n"
+"	PLA\n"
+"	TAX\n"
+"	PLA\n"
+"	RTS\n"
+"set_toning_point:\n"
+"        LDA ($F0),Y\n"
+"        CMP #$00\n"
+"        BNE not_black\n"
+"        LDA #$0B\n"
+"        RTS\n"
+"not_black:\n"
+"        CMP #$0B\n"
+"        BNE not_dgrey\n"
+"        LDA #$0C\n"
+"        RTS\n"
+"not_dgrey:\n"
+"        CMP #$0C\n"
+"        BNE not_grey\n"
+"        LDA #$0F\n"
+"        RTS\n"
+"not_grey:\n"
+"        CMP #$0F\n"
+"        BNE not_lgrey\n"
+"        LDA #$01\n"
+"        RTS\n"
+"not_lgrey:\n"
+"        RTS\n"
+,
+"loop:\n"
+" ldx $90\n"
+" inx\n"
+" stx $90\n"
+" lda #4\n"
+" sta $3\n"
+" lda #0\n"
+" sta $4\n"
+"multiple:\n"
+" lda $90\n"
+" clc\n"
+" adc $4\n"
+" tax\n"
+" lda sinus,x\n"
+" ldy cosinus,x\n"
+" asl\n"
+" tax\n"
+" lda ypos,x\n"
+" sta $00\n"
+" inx\n"
+" lda ypos,x\n"
+" sta $01\n"
+" ldx #0\n"
+" lda #5\n"
+" sta $2\n"
+"draw:\n"
+" lda image,x\n"
+" sta ($0),y\n"
+" inx\n"
+" iny\n"
+" lda image,x\n"
+" sta ($0),y\n"
+" inx\n"
+" iny\n"
+" lda image,x\n"
+" sta ($0),y\n"
+" inx\n"
+" iny\n"
+" lda image,x\n"
+" sta ($0),y\n"
+" inx\n"
+" iny\n"
+" lda image,x\n"
+" sta ($0),y\n"
+" tya\n"
+" clc\n"
+" adc #28\n"
+" tay\n"
+" inx\n"
+" dec $2\n"
+" bne draw\n"
+" lda $4 \n"
+" clc\n"
+" adc #18\n"
+" sta $4\n"
+" dec $3\n"
+" bne multiple\n"
+" jmp loop\n"
+"sinus:\n"
+" dcb $0e, $0e, $0e, $0f, $0f, $0f, $10, $10, $10, $11\n"
+" dcb $11, $11, $12, $12, $12, $13, $13, $13, $14, $14\n"
+" dcb $14, $14, $15, $15, $15, $16, $16, $16, $16, $17\n"
+" dcb $17, $17, $17, $18, $18, $18, $18, $19, $19, $19\n"
+" dcb $19, $19, $1a, $1a, $1a, $1a, $1a, $1a, $1a, $1b\n"
+" dcb $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b\n"
+" dcb $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b\n"
+"cosinus:\n"
+" dcb $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b\n"
+" dcb $1a, $1a, $1a, $1a, $1a, $1a, $19, $19, $19, $19\n"
+" dcb $19, $18, $18, $18, $18, $18, $17, $17, $17, $17\n"
+" dcb $16, $16, $16, $15, $15, $15, $15, $14, $14, $14\n"
+" dcb $13, $13, $13, $12, $12, $12, $11, $11, $11, $10\n"
+" dcb $10, $10, $0f, $0f, $0f, $0e, $0e, $0e, $0d, $0d\n"
+" dcb $0d, $0c, $0c, $0c, $0b, $0b, $0b, $0a, $0a, $0a\n"
+" dcb $09, $09, $09, $08, $08, $08, $07, $07, $07, $06\n"
+" dcb $06, $06, $06, $05, $05, $05, $04, $04, $04, $04\n"
+" dcb $03, $03, $03, $03, $03, $02, $02, $02, $02, $02\n"
+" dcb $01, $01, $01, $01, $01, $01, $00, $00, $00, $00\n"
+" dcb $00, $00, $00, $00, $00, $00, $00, $00, $00, $00\n"
+" dcb $00, $00, $00, $00, $00, $00, $00, $00, $00, $00\n"
+" dcb $00, $00, $00, $00, $00, $00, $00, $01, $01, $01\n"
+" dcb $01, $01, $01, $01, $02, $02, $02, $02, $02, $03\n"
+" dcb $03, $03, $03, $04, $04, $04, $04, $05, $05, $05\n"
+" dcb $05, $06, $06, $06, $07, $07, $07, $07, $08, $08\n"
+" dcb $08, $09, $09, $09, $0a, $0a, $0a, $0b, $0b, $0b\n"
+" dcb $0c, $0c, $0c, $0d, $0d\n"
+" dcb $0e, $0e, $0e, $0f, $0f, $0f, $10, $10, $10, $11\n"
+" dcb $11, $11, $12, $12, $12, $13, $13, $13, $14, $14\n"
+" dcb $14, $14, $15, $15, $15, $16, $16, $16, $16, $17\n"
+" dcb $17, $17, $17, $18, $18, $18, $18, $19, $19, $19\n"
+" dcb $19, $19, $1a, $1a, $1a, $1a, $1a, $1a, $1a, $1b\n"
+" dcb $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b\n"
+" dcb $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b\n"
+" dcb $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b, $1b\n"
+" dcb $1a, $1a, $1a, $1a, $1a, $1a, $19, $19, $19, $19\n"
+"image:\n"
+" dcb $0,$0,$0,$0,$0\n"
+" dcb $0,$c,$c,$c,$0\n"
+" dcb $0,$c,$1,$c,$0\n"
+" dcb $0,$c,$c,$c,$0\n"
+" dcb $0,$0,$0,$0,$0\n"
+"ypos:\n"
+" dcb $00,$02,$20,$02,$40,$02,$60,$02\n"
+" dcb $80,$02,$a0,$02,$c0,$02,$e0,$02\n"
+" dcb $00,$03,$20,$03,$40,$03,$60,$03\n"
+" dcb $80,$03,$a0,$03,$c0,$03,$e0,$03\n"
+" dcb $00,$04,$20,$04,$40,$04,$60,$04\n"
+" dcb $80,$04,$a0,$04,$c0,$04,$e0,$04\n"
+" dcb $00,$05,$20,$05,$40,$05,$60,$05\n"
+" dcb $80,$05,$a0,$05,$c0,$05,$e0,$05\n"
+,
+"start:\n"
+"  jsr init\n"
+"loop:\n"
+"  jsr drawMap\n"
+"  jsr genMap\n"
+"  jsr readKeys\n"
+"  jmp loop\n"
+"drawShip:\n"
+"  lda $82\n"
+"  tay\n"
+"  lda ypos,y\n"
+"  sta $00\n"
+"  iny\n"
+"  lda ypos,y\n"
+"  sta $01\n"
+"  ldx #42\n"
+"  lda ($00,x)\n"
+"  cmp #0\n"
+"  beq noCrash\n"
+"  cmp #5\n"
+"noCrash:\n"
+"  lda #5\n"
+"  sta ($00,x)\n"
+"  lda $60\n"
+"  cmp $61\n"
+"  beq ret\n"
+"  lda $61\n"
+"  asl\n"
+"  tay\n"
+"  lda ypos,y\n"
+"  sta $00\n"
+"  iny\n"
+"  lda ypos,y\n"
+"  sta $01\n"
+"  lda #0\n"
+"  ldx #42\n"
+"  sta ($00,x)\n"
+"  lda $60\n"
+"  sta $61\n"
+"ret:\n"
+"  rts\n"
+"crashed:\n"
+"  lda $fe\n"
+"  sta ($00,x)\n"
+"  jmp crashed\n"
+"readKeys:\n"
+"  lda $ff\n"
+"  cmp #119\n"
+"  bne notUp\n"
+"  dec $60\n"
+"  rts\n"
+"notUp:\n"
+"  cmp #120\n"
+"  bne noMove\n"
+"  inc $60\n"
+"noMove:\n"
+"  rts\n"
+"init:\n"
+"  ldx #0\n"
+"drawLogo:\n"
+"  lda bottomLogo,x\n"
+"  sta $500,x\n"
+"  inx\n"
+"  cpx #0\n"
+"  bne drawLogo\n"
+"  lda #10\n"
+"  sta $60\n"
+"  sta $61\n"
+"  ldx #0\n"
+"  lda #$c\n"
+"c:sta $200,x\n"
+"  sta $400,x\n"
+"  dex\n"
+"  cpx #0\n"
+"  bne c\n"
+"  lda #16\n"
+"  sta $80\n"
+"  ldx #15\n"
+"set:\n"
+"  sta $81,x\n"
+"  dex\n"
+"  bpl set\n"
+"  rts\n"
+"drawMap:\n"
+"  lda #0\n"
+"  sta $78\n"
+"  lda #32\n"
+"  sta $79\n"
+"  lda #192\n"
+"  sta $7a\n"
+"  lda #224\n"
+"  sta $7b\n"
+"  ldx #15\n"
+"drawLoop:\n"
+"  lda $81,x\n"
+"  sta $82,x\n"
+"  tay\n"
+"  lda ypos,y\n"
+"  sta $00\n"
+"  iny\n"
+"  lda ypos,y\n"
+"  sta $01\n"
+"  lda #$c\n"
+"  ldy $78\n"
+"  sta ($00),y\n"
+"  iny\n"
+"  sta ($00),y\n"
+"  ldy $7b\n"
+"  sta ($00),y\n"
+"  iny\n"
+"  sta ($00),y\n"
+"  ldy $79\n"
+"  lda #0\n"
+"  sta ($00),y\n"
+"  iny\n"
+"  sta ($00),y\n"
+"  ldy $7a\n"
+"  sta ($00),y\n"
+"  iny\n"
+"  sta ($00),y\n"
+"  inc $78\n"
+"  inc $79\n"
+"  inc $7a\n"
+"  inc $7b\n"
+"  inc $78\n"
+"  inc $79\n"
+"  inc $7a\n"
+"  inc $7b\n"
+"  dex\n"
+"  bpl drawLoop\n"
+"  rts\n"
+"genMap:\n"
+"  lda $80\n"
+"  cmp $81\n"
+"  beq done\n"
+"  lda $80\n"
+"  clc\n"
+"  sbc $81\n"
+"  bpl plus\n"
+"  bmi minus\n"
+"done:\n"
+"  lda $fe\n"
+"  and #$f\n"
+"  asl\n"
+"  sta $80\n"
+"  rts\n"
+"minus:\n"
+"  dec $81\n"
+"  dec $81\n"
+"  rts\n"
+"plus:\n"
+"  inc $81\n"
+"  inc $81\n"
+"  rts\n"
+"ypos:\n"
+"  dcb $00,$02,$20,$02,$40,$02,$60,$02\n"
+"  dcb $80,$02,$a0,$02,$c0,$02,$e0,$02\n"
+"  dcb $00,$03,$20,$03,$40,$03,$60,$03\n"
+"  dcb $80,$03,$a0,$03,$c0,$03,$e0,$03\n"
+"  dcb $00,$04,$20,$04,$40,$04,$60,$04\n"
+"  dcb $80,$04,$a0,$04,$c0,$04,$e0,$04\n"
+"  dcb $00,$05,$20,$05,$40,$05,$60,$05\n"
+"  dcb $80,$05,$a0,$05,$c0,$05,$e0,$05\n"
+"bottomLogo:\n"
+"  dcb $0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0\n"
+"  dcb $0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0,$0\n"
+"  dcb $0,$0,$0,$0,$0,$0,$1,$1,$1,$6,$1,$1,$1,$0\n"
+"  dcb $0,$6,$1,$1,$6,$0,$0,$1,$1,$1,$6,$0,$1,$1\n"
+"  dcb $1,$0,$1,$1,$1,$6,$0,$0,$6,$1,$6,$0,$6,$0\n"
+"  dcb $1,$0,$6,$1,$6,$1,$6,$0,$1,$0,$1,$0,$6,$0\n"
+"  dcb $6,$1,$6,$0,$6,$0,$1,$0,$6,$1,$6,$0,$0,$6\n"
+"  dcb $1,$1,$6,$6,$1,$1,$1,$0,$6,$1,$0,$0,$1,$0\n"
+"  dcb $1,$6,$0,$6,$6,$1,$1,$1,$0,$6,$1,$0,$6,$1\n"
+"  dcb $0,$6,$6,$6,$6,$6,$1,$6,$1,$1,$6,$6,$6,$1\n"
+"  dcb $1,$1,$1,$6,$1,$6,$6,$6,$6,$1,$6,$6,$6,$6\n"
+"  dcb $1,$1,$1,$6,$6,$6,$6,$1,$1,$1,$1,$e,$1,$1\n"
+"  dcb $e,$6,$6,$1,$1,$6,$1,$6,$1,$1,$1,$1,$e,$1\n"
+"  dcb $1,$1,$1,$6,$1,$1,$6,$1,$6,$6,$6,$1,$1,$1\n"
+"  dcb $6,$e,$1,$1,$6,$e,$6,$1,$1,$e,$1,$e,$6,$1\n"
+"  dcb $1,$1,$6,$e,$1,$1,$1,$e,$1,$1,$6,$1,$6,$e\n"
+"  dcb $e,$e,$6,$e,$e,$6,$e,$e,$6,$e,$e,$6,$e,$e\n"
+"  dcb $6,$e,$e,$6,$e,$e,$6,$e,$e,$6,$e,$e,$6,$e\n"
+"  dcb $e,$6,$e,$e\n"
+,
+"i:ldx #$7\n"
+"g:lda $fe\n"
+"  and #3\n"
+"  adc #1\n"
+"  sta $0,x\n"
+"  lda $fe\n"
+"  and #$1f\n"
+"  sta $20,x\n"
+"  dex\n"
+"  bpl g\n"
+"f:\n"
+"  lda #$ff\n"
+"  sta $10\n"
+"  delay:\n"
+"  nop\n"
+"  dec $10\n"
+"  bne delay\n"
+"  lda #$00\n"
+"  sta $80\n"
+"  lda #$02\n"
+"  sta $81\n"
+"  ldx #$7\n"
+"l:lda $20,x\n"
+"  pha\n"
+"  clc\n"
+"  sbc $00,x\n"
+"  and #$1f\n"
+"  sta $20,x\n"
+"  lda $20,x\n"
+"  tay\n"
+"  lda #1\n"
+"  sta ($80),y\n"
+"  pla\n"
+"  tay\n"
+"  lda #0\n"
+"  sta ($80),y\n"
+"  lda $80\n"
+"  clc\n"
+"  adc #$80\n"
+"  bne n\n"
+"  inc $81\n"
+"n:sta $80\n"
+"  dex\n"
+"  bpl l\n"
+"  jmp f\n"
+,
+"	lda $fe\n"
+"	sta src_row\n"
+"	ldy #0\n"
+"top_loop:\n"
+"	lda $fe\n"
+"	and #$f\n"
+"	sbc #$8\n"
+"	adc src_row,y\n"
+"	iny\n"
+"	sta src_row,y\n"
+"	cpy #31\n"
+"	bne top_loop\n"
+"lda #$00\n"
+"sta $0\n"
+"lda #$02\n"
+"sta $1\n"
+"init_loop:\n"
+"	jsr tex\n"
+"	clc\n"
+"	lda $0\n"
+"	adc #$20\n"
+"	sta $0\n"
+"	lda $1\n"
+"	adc #0\n"
+"	sta $1\n"
+"	cmp #$06\n"
+"	bne init_loop\n"
+"lda #$e0\n"
+"sta $0\n"
+"lda #$05\n"
+"sta $1\n"
+"loop:\n"
+"	clc\n"
+"	lda #0\n"
+"	blit_loop2:\n"
+"		tay\n"
+"		lda $0220,y\n"
+"		sta $0200,y\n"
+"		lda $0221,y\n"
+"		sta $0201,y\n"
+"		lda $0222,y\n"
+"		sta $0202,y\n"
+"		lda $0223,y\n"
+"		sta $0203,y\n"
+"		lda $0224,y\n"
+"		sta $0204,y\n"
+"		lda $0225,y\n"
+"		sta $0205,y\n"
+"		lda $0226,y\n"
+"		sta $0206,y\n"
+"		lda $0227,y\n"
+"		sta $0207,y\n"
+"		tya\n"
+"		adc #8\n"
+"	bne blit_loop2\n"
+"	clc\n"
+"	lda #0\n"
+"	blit_loop3:\n"
+"		tay\n"
+"		lda $0320,y\n"
+"		sta $0300,y\n"
+"		lda $0321,y\n"
+"		sta $0301,y\n"
+"		lda $0322,y\n"
+"		sta $0302,y\n"
+"		lda $0323,y\n"
+"		sta $0303,y\n"
+"		lda $0324,y\n"
+"		sta $0304,y\n"
+"		lda $0325,y\n"
+"		sta $0305,y\n"
+"		lda $0326,y\n"
+"		sta $0306,y\n"
+"		lda $0327,y\n"
+"		sta $0307,y\n"
+"		tya\n"
+"		adc #8\n"
+"	bne blit_loop3\n"
+"	clc\n"
+"	lda #0\n"
+"	blit_loop4:\n"
+"		tay\n"
+"		lda $0420,y\n"
+"		sta $0400,y\n"
+"		lda $0421,y\n"
+"		sta $0401,y\n"
+"		lda $0422,y\n"
+"		sta $0402,y\n"
+"		lda $0423,y\n"
+"		sta $0403,y\n"
+"		lda $0424,y\n"
+"		sta $0404,y\n"
+"		lda $0425,y\n"
+"		sta $0405,y\n"
+"		lda $0426,y\n"
+"		sta $0406,y\n"
+"		lda $0427,y\n"
+"		sta $0407,y\n"
+"		tya\n"
+"		adc #8\n"
+"	bne blit_loop4\n"
+"	lda #0\n"
+"	blit_loop5:\n"
+"		tay\n"
+"		lda $0520,y\n"
+"		sta $0500,y\n"
+"		lda $0521,y\n"
+"		sta $0501,y\n"
+"		lda $0522,y\n"
+"		sta $0502,y\n"
+"		lda $0523,y\n"
+"		sta $0503,y\n"
+"		lda $0524,y\n"
+"		sta $0504,y\n"
+"		lda $0525,y\n"
+"		sta $0505,y\n"
+"		lda $0526,y\n"
+"		sta $0506,y\n"
+"		lda $0527,y\n"
+"		sta $0507,y\n"
+"		tya\n"
+"		clc\n"
+"		adc #8\n"
+"		cmp #$e0\n"
+"	bne blit_loop5\n"
+"	skip_blit:\n"
+"	jsr tex\n"
+"jmp loop\n"
+"tex:\n"
+"	lda $fe\n"
+"	and #$f\n"
+"	sbc #$8\n"
+"	adc src_row\n"
+"	sta src_row\n"
+"	ldy #0\n"
+"	tax\n"
+"	lda pal0,x\n"
+"	sta ($0),y\n"
+"	tex_loop0:\n"
+"		lda $fe\n"
+"		and #$f\n"
+"		sbc #$8\n"
+"		adc src_row,y\n"
+"		iny\n"
+"		adc src_row,y\n"
+"		ror\n"
+"		sta src_row,y\n"
+"		tax\n"
+"		lda pal0,x\n"
+"		sta ($0),y\n"
+"		cpy #31\n"
+"	bne tex_loop0\n"
+"	rts\n"
+"pal0:\n"
+"	dcb $00, $00, $00, $00, $00, $00, $00, $00\n"
+"	dcb $00, $00, $0b, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0b, $0b, $0b, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0c, $0c, $0c, $0c, $0c, $0c, $0c, $0c\n"
+"	dcb $0c, $0c, $0c, $0c, $0c, $0c, $0c, $0c\n"
+"	dcb $0f, $0f, $0f, $0f, $0f, $0f, $0f, $0f\n"
+"	dcb $0f, $0f, $0f, $0f, $0f, $0f, $0f, $0f\n"
+"	dcb $0f, $01, $01, $01, $01, $01, $01, $01\n"
+"	dcb $01, $01, $01, $01, $01, $01, $01, $01\n"
+"	dcb $0f, $0f, $0f, $0f, $0f, $0f, $0f, $0f\n"
+"	dcb $0f, $0f, $0f, $0f, $0f, $0f, $0f, $0f\n"
+"	dcb $0f, $0c, $0c, $0c, $0c, $0c, $0c, $0c\n"
+"	dcb $0c, $0c, $0c, $0c, $0c, $0c, $0c, $0c\n"
+"	dcb $0c, $0b, $0b, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0b, $0b, $0b, $0b, $0b, $0b, $0b, $00\n"
+"	dcb $00, $00, $00, $00, $00, $00, $00, $00\n"
+"	dcb $00, $00, $00, $00, $00, $00, $00, $00\n"
+"	dcb $00, $00, $00, $00, $00, $00, $00, $00\n"
+"	dcb $0b, $0b, $0b, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0b, $0b, $0b, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0b, $0b, $0b, $0b, $0b, $0b, $05, $05\n"
+"	dcb $05, $05, $05, $05, $05, $05, $05, $05\n"
+"	dcb $05, $05, $05, $05, $05, $05, $05, $05\n"
+"	dcb $0d, $0d, $0d, $0d, $0d, $0d, $0d, $0d\n"
+"	dcb $0d, $0d, $0d, $0d, $0d, $0d, $0d, $0d\n"
+"	dcb $0d, $05, $05, $05, $05, $05, $05, $05\n"
+"	dcb $05, $05, $05, $05, $05, $05, $05, $05\n"
+"	dcb $05, $05, $05, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0b, $0b, $0b, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0b, $0b, $0b, $0b, $0b, $0b, $0b, $0b\n"
+"	dcb $0b, $00, $00, $00, $00, $00, $00, $00\n"
+"	dcb $00, $00, $00, $00, $00, $00, $00, $00\n"
+"src_row:\n"
+,
+"start:\n"
+"ldx #0\n"
+"stx $20\n"
+"lda #5\n"
+"sta $21\n"
+"lda $fe\n"
+"sta $22\n"
+"loop:\n"
+"dec $21\n"
+"lda $21\n"
+"beq randcolor\n"
+"jmp pastrandcolor\n"
+"randcolor:\n"
+"lda #5\n"
+"sta $21\n"
+"ldx #33\n"
+"inc $22\n"
+"lda $22\n"
+"and #7\n"
+"tay\n"
+"rl:\n"
+"lda $1000,x\n"
+"beq pastcolor1\n"
+"lda color_row,y\n"
+"sta $1000,x\n"
+"pastcolor1:\n"
+"lda $1040,x\n"
+"beq pastcolor2\n"
+"lda color_row,y\n"
+"sta $1040,x\n"
+"pastcolor2:\n"
+"lda $1080,x\n"
+"beq pastcolor3\n"
+"lda color_row,y\n"
+"sta $1080,x\n"
+"pastcolor3:\n"
+"lda $10c0,x\n"
+"beq pastcolor4\n"
+"lda color_row,y\n"
+"sta $10c0,x\n"
+"pastcolor4:\n"
+"lda $1100,x\n"
+"beq pastcolor5\n"
+"lda color_row,y\n"
+"sta $1100,x\n"
+"pastcolor5:\n"
+"lda $1140,x\n"
+"beq pastcolor6\n"
+"lda color_row,y\n"
+"sta $1140,x\n"
+"pastcolor6:\n"
+"lda $1180,x\n"
+"beq pastcolor7\n"
+"lda color_row,y\n"
+"sta $1180,x\n"
+"pastcolor7:\n"
+"lda $11C0,x\n"
+"beq pastcolor8\n"
+"lda color_row,y\n"
+"sta $11C0,x\n"
+"pastcolor8:\n"
+"lda $1200,x\n"
+"beq pastcolor9\n"
+"lda color_row,y\n"
+"sta $1200,x\n"
+"pastcolor9:\n"
+"inx\n"
+"txa\n"
+"and #$3f\n"
+"bne rl\n"
+"pastrandcolor:\n"
+"inc $20\n"
+"lda $20\n"
+"and #$3f\n"
+"tay\n"
+"and #$1f\n"
+"tax\n"
+"lda sinus,x\n"
+"tax\n"
+"d:\n"
+"lda #0\n"
+"sta $2e0,x\n"
+"sta $3e0,x\n"
+"lda $1000,y\n"
+"sta $300,x\n"
+"lda $1080,y\n"
+"sta $320,x\n"
+"lda $1100,y\n"
+"sta $340,x\n"
+"lda $1180,y\n"
+"sta $360,x\n"
+"lda $1200,y\n"
+"sta $380,x\n"
+"lda $1280,y\n"
+"sta $3a0,x\n"
+"lda $1300,y\n"
+"sta $3c0,x\n"
+"lda $1380,y\n"
+"sta $3c0,x\n"
+"inx\n"
+"iny\n"
+"txa\n"
+"and #$1f\n"
+"bne d\n"
+"jmp loop\n"
+"sinus:\n"
+"dcb 0,0,0,0,$20,$20,$20\n"
+"dcb $40,$40,$60,$80,$a0,$a0,$c0,$c0,$c0\n"
+"dcb $e0,$e0,$e0,$e0,$c0,$c0,$c0\n"
+"dcb $a0,$a0,$80,$60,$40,$40,$20,$20,$20\n"
+"color_row:\n"
+"dcb $7,$8,$9,$2,$4,$6,$e,$3\n"
+"*=$1000\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0\n"
+"dcb 0,0,1,1,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,1,1\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0\n"
+"dcb 0,0,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,0,0,1,1\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,1,1,1,1\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,1,1\n"
+"dcb 0,0,1,1,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,1,1,0,0,1,1\n"
+"dcb 0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1\n"
+"dcb 0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1\n"
+,
+"ldx #0\n"
+"lda #0\n"
+"hupsu:\n"
+"sta $200,x\n"
+"sta $300,x\n"
+"sta $400,x\n"
+"sta $500,x\n"
+"bne hupsu\n"
+"lda #1\n"
+"ldx #0\n"
+"fill:\n"
+"txa\n"
+"tay\n"
+"lda seko,x\n"
+"tax\n"
+"lda kuva,x\n"
+"sta $200,x\n"
+"lda kuva_0,x\n"
+"sta $300,x\n"
+"lda kuva_1,x\n"
+"sta $400,x\n"
+"lda kuva_2,x\n"
+"sta $500,x\n"
+"tya\n"
+"tax\n"
+"inx\n"
+"bne fill\n"
+"rts\n"
+"seko:\n"
+"dcb 46,93,219,97,168,170,196,63,204,201,206\n"
+"dcb 56,238,25,2,186,209,191,138,226,80,128\n"
+"dcb 58,171,81,115,42,44,102,193,69,231,107\n"
+"dcb 78,5,218,103,11,13,221,130,149,16,227\n"
+"dcb 105,213,232,182,17,255,27,190,205,137,192\n"
+"dcb 222,233,94,52,229,96,18,220,202,122,166\n"
+"dcb 43,153,131,246,177,4,70,22,7,86,173\n"
+"dcb 141,151,164,32,143,40,156,185,121,132,165\n"
+"dcb 62,249,252,139,154,251,85,236,12,134,245\n"
+"dcb 184,39,195,119,242,244,162,74,1,77,51\n"
+"dcb 33,75,35,76,34,10,89,47,189,237,71\n"
+"dcb 159,9,38,101,180,116,147,140,183,157,123\n"
+"dcb 14,19,126,199,100,45,241,28,125,210,155\n"
+"dcb 41,254,31,144,55,247,111,95,57,53,223\n"
+"dcb 152,108,203,36,214,37,113,200,66,67,197\n"
+"dcb 29,250,20,212,68,87,207,163,145,211,48\n"
+"dcb 136,24,98,215,169,83,124,224,181,187,142\n"
+"dcb 84,240,54,110,234,59,243,79,50,30,114\n"
+"dcb 6,178,0,172,148,146,179,120,60,225,65\n"
+"dcb 230,208,15,72,117,248,198,106,129,92,127\n"
+"dcb 175,160,49,216,176,133,64,109,112,82,90\n"
+"dcb 235,104,158,194,8,161,167,88,91,174,23\n"
+"dcb 73,118,150,3,99,61,217,26,239,21,253\n"
+"dcb 135,188,228\n"
+"kuva:\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0\n"
+"dcb 0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,11,11\n"
+"dcb 11,0,0,0,0,0,0,1,0,0,0,11,11,11,0,0,0,0,0,1,1,1,1,1\n"
+"dcb 1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1\n"
+"kuva_0:\n"
+"dcb 1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1\n"
+"dcb 1,0,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0\n"
+"dcb 0,1,15,0,0,0,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,15,0,0,0,1,1,1,0,0,0,1,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,15,0,0,0,1,1\n"
+"dcb 1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0\n"
+"dcb 0,0,15,0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,1\n"
+"dcb 0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,1\n"
+"kuva_1:\n"
+"dcb 1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,15,0,0,0,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,15,0,0,0,1,1,1,0,0,0,1,1,0,0\n"
+"dcb 0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,1,0,0,0,1,1\n"
+"dcb 1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,0,0,0,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,0,1,1,1,1\n"
+"dcb 1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,1,1\n"
+"dcb 1,0,0,0,1,1,1,1,1,1,1,1,1,15,15,15,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,15,0,0,0,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,15,15,15\n"
+"dcb 1,1,1,1,1,1,1,1,1,1,15,0,0,0,1,1\n"
+"kuva_2:\n"
+"dcb 1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,0,0,0,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,15,15,0\n"
+"dcb 15,15,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,0,1,1,1,1\n"
+"dcb 1,1,1,1,1,15,15,0,15,15,1,1,1,1,1,1,1,1,1,0,0,0,1,1\n"
+"dcb 1,0,0,0,15,1,1,1,1,1,1,1,1,15,15,0,1,1,1,1,1,1,1,1\n"
+"dcb 1,1,1,0,0,0,1,1,1,0,0,0,0,15,15,15,15,15,15,1,15,1,1,1\n"
+"dcb 1,1,15,1,15,15,15,1,1,15,0,0,0,0,1,1,1,0,0,0,0,15,15,15\n"
+"dcb 15,15,15,1,15,1,1,1,1,1,15,1,15,15,15,1,1,15,0,0,0,0,1,1\n"
+"dcb 1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0\n"
+"dcb 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1\n"
+,
@@ -0,0 +1,280 @@
+#!/usr/bin/perl -w
+# Copyright © 2026 Jamie Zawinski <jwz@jwz.org>
+#
+# Permission to use, copy, modify, distribute, and sell this software and its
+# documentation for any purpose is hereby granted without fee, provided that
+# the above copyright notice appear in all copies and that both that
+# copyright notice and this permission notice appear in supporting
+# documentation.  No representations are made about the suitability of this
+# software for any purpose.  It is provided "as is" without express or
+# implied warranty.
+#
+# Runs every hack with --record-animation, several at a time, to make a
+# short low-resolution MP4 and a PPM poster frame of each, for the
+# thumbnails in xscreensaver-settings.  The hacks must have been built
+# with "configure --with-record-animation".
+#
+# It also writes "timings.txt" into the output directory: how long each
+# hack took to render its frames, wall-clock, including startup.  Since
+# every hack renders the same number of frames at the same size, that is
+# a reasonable benchmark to compare from one build to the next.
+#
+# With --xvfb, it starts its own virtual X server, so this can run on a
+# machine with no display.
+#
+# Created: 19-Oct-2026.
+
+require 5;
+use diagnostics;
+use strict;
+
+use Cwd;
+use POSIX qw(:sys_wait_h);
+use Time::HiRes qw(time);
+
+my $progname = $0; $progname =~ s@.*/@@g;
+my ($version) = ('$Revision: 1.1 $' =~ m/\s(\d[.\d]+)\s/s);
+
+my $verbose = 0;
+
+
+sub ncpus() {
+  my $n = 0;
+  if (open (my $in, '<', '/proc/cpuinfo')) {
+    while (<$in>) { $n++ if m/^processor\s*:/s; }
+    close $in;
+  }
+  $n = `sysctl -n hw.ncpu 2>/dev/null` unless $n;
+  chomp ($n);
+  return ($n && $n > 0 ? $n : 1);
+}
+
+
+# Returns extra args for the hack, from its XML file.
+#
+sub hack_args($) {
+  my ($xml) = @_;
+  my @args = ();
+  return @args unless open (my $in, '<', $xml);
+  local $/ = undef;  # read entire file
+  my $body = <$in>;
+  close $in;
+
+  # Don't waste time sleeping between frames: the recorded video runs at
+  # 30 fps regardless.
+  push @args, '--delay', '0' if ($body =~ m/\barg="--delay %"/s);
+  return @args;
+}
+
+
+sub find_exe($@) {
+  my ($hack, @bindirs) = @_;
+  foreach my $d (@bindirs) {
+    my $f = "$d/$hack";
+    return $f if (-x $f && ! -d $f);
+  }
+  return undef;
+}
+
+
+sub start_xvfb() {
+  my $dpy;
+  for (my $n = 90; $n < 200; $n++) {
+    next if (-e "/tmp/.X$n-lock" || -e "/tmp/.X11-unix/X$n");
+    $dpy = ":$n";
+    last;
+  }
+  error ("no free display number") unless $dpy;
+
+  my $pid = fork();
+  error ("fork: $!") unless defined ($pid);
+  if ($pid == 0) {
+    open (STDOUT, '>', '/dev/null');
+    open (STDERR, '>', '/dev/null') unless ($verbose > 1);
+    exec ('Xvfb', $dpy, '-screen', '0', '1280x1024x24', '-nolisten', 'tcp');
+    exit (1);
+  }
+
+  # Wait for it to start listening.
+  my $n = $dpy; $n =~ s/^://s;
+  for (my $i = 0; $i < 50 && ! -e "/tmp/.X11-unix/X$n"; $i++) {
+    select (undef, undef, undef, 0.1);
+  }
+  error ("Xvfb $dpy didn't start") unless (-e "/tmp/.X11-unix/X$n");
+
+  print STDERR "$progname: started Xvfb on $dpy\n" if ($verbose);
+  $ENV{DISPLAY} = $dpy;
+  return $pid;
+}
+
+
+sub make_previews($$$$$$@) {
+  my ($outdir, $jobs, $frames, $size, $timeout, $bindirs, @hacks) = @_;
+
+  my $confdir = $0;
+  $confdir =~ s@[^/]*$@@s;
+  $confdir .= 'config';
+
+  if (! -d $outdir) {
+    mkdir ($outdir) || error ("mkdir $outdir: $!");
+  }
+
+  my @queue = ();
+  foreach my $hack (@hacks) {
+    my $exe = find_exe ($hack, @$bindirs);
+    if (! $exe) {
+      print STDERR "$progname: $hack: not found\n" if ($verbose);
+      next;
+    }
+    $exe = getcwd() . "/$exe" unless ($exe =~ m@^/@s);
+    push @queue, [ $hack, $exe, hack_args ("$confdir/$hack.xml") ];
+  }
+
+  error ("no hacks found in " . join(' ', @$bindirs)) unless @queue;
+
+  print STDERR "$progname: rendering " . scalar(@queue) .
+               " hacks, $jobs at a time\n" if ($verbose);
+
+  my %running = ();   # pid => [ hack, start time ]
+  my %results = ();   # hack => [ secs, status ]
+
+  while (@queue || %running) {
+
+    while (@queue && scalar(keys %running) < $jobs) {
+      my ($hack, $exe, @args) = @{shift @queue};
+      my @cmd = ($exe, '--record-animation', $frames, '--geometry', $size,
+                 @args);
+      print STDERR "$progname: " . join(' ', @cmd) . "\n" if ($verbose > 1);
+
+      my $pid = fork();
+      error ("fork: $!") unless defined ($pid);
+      if ($pid == 0) {
+        chdir ($outdir) || die;
+        unlink ("$hack.mp4", "$hack.ppm");
+        open (STDOUT, '>', "$hack.log");
+        open (STDERR, '>&', \*STDOUT);
+        exec (@cmd);
+        exit (1);
+      }
+      $running{$pid} = [ $hack, time() ];
+    }
+
+    my $pid = waitpid (-1, WNOHANG);
+    if ($pid > 0 && $running{$pid}) {
+      my ($hack, $start) = @{$running{$pid}};
+      my $secs = time() - $start;
+      delete $running{$pid};
+      my $status = ($? == 0 &&
+                    -s "$outdir/$hack.mp4" &&
+                    -s "$outdir/$hack.ppm"
+                    ? 'ok' : 'failed');
+      $status = 'timeout' if ($results{$hack});
+      $results{$hack} = [ $secs, $status ];
+      printf STDERR "$progname: %-20s %6.1f sec  %s\n", $hack, $secs, $status
+        if ($verbose);
+      next;
+    }
+
+    # Kill any that have been running too long.  Note the timeout in
+    # %results; the status is filled in when the pid is reaped.
+    foreach my $pid (keys %running) {
+      my ($hack, $start) = @{$running{$pid}};
+      next unless (time() - $start > $timeout && !$results{$hack});
+      $results{$hack} = [ 0, 'timeout' ];
+      kill ('KILL', $pid);
+    }
+
+    select (undef, undef, undef, 0.1);
+  }
+
+  my $file = "$outdir/timings.txt";
+  open (my $out, '>', $file) || error ("$file: $!");
+  print $out "# hack\tseconds\tstatus\t($frames frames at $size)\n";
+  my $total = 0;
+  my $failed = 0;
+  foreach my $hack (sort { $results{$b}->[0] <=> $results{$a}->[0] }
+                    keys %results) {
+    my ($secs, $status) = @{$results{$hack}};
+    printf $out "%s\t%.2f\t%s\n", $hack, $secs, $status;
+    $total += $secs;
+    $failed++ unless ($status eq 'ok');
+  }
+  close $out;
+
+  printf STDERR "$progname: %d hacks, %d failed, %.0f seconds in all; " .
+                "wrote %s\n",
+                scalar(keys %results), $failed, $total, $file;
+  return $failed;
+}
+
+
+sub error($) {
+  my ($err) = @_;
+  print STDERR "$progname: $err\n";
+  exit 1;
+}
+
+sub usage() {
+  print STDERR "usage: $progname [--verbose] [--jobs N] [--frames N]\n" .
+    "\t\t[--size WxH] [--timeout SECS] [--outdir DIR] [--xvfb]\n" .
+    "\t\t[--bindir DIR ...] [hacks ...]\n";
+  exit 1;
+}
+
+sub main() {
+  my $outdir  = 'previews';
+  my $jobs    = ncpus();
+  my $frames  = 30 * 5;
+  my $size    = '320x180';
+  my $timeout = 300;
+  my $xvfb_p  = 0;
+  my @bindirs = ();
+  my @hacks   = ();
+
+  while ($#ARGV >= 0) {
+    $_ = shift @ARGV;
+    if    (m/^--?verbose$/s)  { $verbose++; }
+    elsif (m/^-v+$/s)         { $verbose += length($_)-1; }
+    elsif (m/^--?jobs$/s)     { $jobs    = shift @ARGV; }
+    elsif (m/^-j(\d+)$/s)     { $jobs    = $1; }
+    elsif (m/^--?frames$/s)   { $frames  = shift @ARGV; }
+    elsif (m/^--?size$/s)     { $size    = shift @ARGV; }
+    elsif (m/^--?timeout$/s)  { $timeout = shift @ARGV; }
+    elsif (m/^--?outdir$/s)   { $outdir  = shift @ARGV; }
+    elsif (m/^--?bindir$/s)   { push @bindirs, shift @ARGV; }
+    elsif (m/^--?xvfb$/s)     { $xvfb_p  = 1; }
+    elsif (m/^-./s)           { usage; }
+    else                      { push @hacks, $_; }
+  }
+
+  usage unless ($jobs   && $jobs   =~ m/^\d+$/s && $jobs > 0);
+  usage unless ($frames && $frames =~ m/^\d+$/s && $frames > 0);
+  usage unless ($size   && $size   =~ m/^\d+x\d+$/s);
+
+  @bindirs = ('.') unless @bindirs;
+
+  if (! @hacks) {
+    my $confdir = $0;
+    $confdir =~ s@[^/]*$@@s;
+    $confdir .= 'config';
+    opendir (my $dir, $confdir) || error ("$confdir: $!");
+    @hacks = sort map { m/^(.*)\.xml$/s ? $1 : () } readdir ($dir);
+    closedir $dir;
+  }
+
+  my $xvfb_pid = ($xvfb_p ? start_xvfb() : undef);
+  error ("\$DISPLAY is not set: try --xvfb") unless ($ENV{DISPLAY});
+
+  my $failed = make_previews ($outdir, $jobs, $frames, $size, $timeout,
+                              \@bindirs, @hacks);
+
+  if ($xvfb_pid) {
+    kill ('TERM', $xvfb_pid);
+    waitpid ($xvfb_pid, 0);
+  }
+
+  exit ($failed ? 1 : 0);
+}
+
+main();
+exit 0;
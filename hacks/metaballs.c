@@ -17,6 +17,8 @@
 
 #include <math.h>
 #include "screenhack.h"
+#include "xshm.h"
+#include "pixwrite.h"
 
 /*#define VERBOSE*/ 
 
@@ -38,14 +40,17 @@ struct state {
   unsigned char delta;
   unsigned char dradius;
   unsigned short sradius;
-  unsigned char **blob;
+  unsigned char *blob;		/* dradius x dradius */
   BLOB *blobs;
-  unsigned char **blub;
+  unsigned char *blub;		/* iWinWidth x iWinHeight color indexes */
+  int dirty_x0, dirty_y0, dirty_x1, dirty_y1;  /* what blub has drawn in */
 
   int delay, cycles;
   signed short iColorCount;
   unsigned long *aiColorVals;
   XImage *pImage;
+  XShmSegmentInfo shm_info;
+  pixel_lut lut;
   GC gc;
   int draw_i;
 };
@@ -63,10 +68,13 @@ static void init_blob(struct state *st, BLOB *blob)
 static void Execute( struct state *st )
 {
 	int i, j, k;
+	int cmax = st->iColorCount - 1;
+	int x0 = st->iWinWidth, y0 = st->iWinHeight, x1 = 0, y1 = 0;
 
-	/* clear st->blub array */
-	for (i = 0; i < st->iWinHeight; ++i)
-	  memset(st->blub[i], 0, st->iWinWidth * sizeof(unsigned char));
+	/* clear the part of st->blub that the last frame drew in */
+	for (i = st->dirty_y0; i < st->dirty_y1; ++i)
+	  memset(st->blub + i * st->iWinWidth + st->dirty_x0, 0,
+		 st->dirty_x1 - st->dirty_x0);
 
 	/* move st->blobs */
 	for (i = 0; i < st->nBlobCount; i++)
@@ -75,49 +83,72 @@ static void Execute( struct state *st )
 	  st->blobs[i].ypos += -st->delta + (int)((st->delta + .5f) * frand(2.0));
 	}
 
-	/* draw st->blobs to st->blub array */
+	/* draw st->blobs to st->blub array, clipped to the window */
 	for (k = 0; k < st->nBlobCount; ++k)
 	  { 
-	    if (st->blobs[k].ypos > -st->dradius && st->blobs[k].xpos > -st->dradius && st->blobs[k].ypos < st->iWinHeight && st->blobs[k].xpos < st->iWinWidth)
+	    BLOB *b = st->blobs + k;
+	    if (b->ypos > -st->dradius && b->xpos > -st->dradius && b->ypos < st->iWinHeight && b->xpos < st->iWinWidth)
 	      {
-		for (i = 0; i < st->dradius; ++i)
+		int i0 = (b->ypos < 0 ? -b->ypos : 0);
+		int j0 = (b->xpos < 0 ? -b->xpos : 0);
+		int i1 = st->iWinHeight - b->ypos;
+		int j1 = st->iWinWidth  - b->xpos;
+		if (i1 > st->dradius) i1 = st->dradius;
+		if (j1 > st->dradius) j1 = st->dradius;
+
+		for (i = i0; i < i1; ++i)
 		  {
-		    if (st->blobs[k].ypos + i >= 0 && st->blobs[k].ypos + i < st->iWinHeight)
+		    unsigned char *out = st->blub + (b->ypos + i) * st->iWinWidth + b->xpos;
+		    const unsigned char *in = st->blob + i * st->dradius;
+		    for (j = j0; j < j1; ++j)
 		      {
-			for (j = 0; j < st->dradius; ++j)
-			  {
-			    if (st->blobs[k].xpos + j >= 0 && st->blobs[k].xpos + j < st->iWinWidth)
-			      {
-				if (st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] < st->iColorCount-1)
-				  {
-				    if (st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] + st->blob[i][j] > st->iColorCount-1)
-				      st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] = st->iColorCount-1;
-				    else 
-				      st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] += st->blob[i][j];     
-				  }
-			      }
-			  }
+			int v = out[j] + in[j];
+			out[j] = (v > cmax ? cmax : v);
 		      }
 		  }
+
+		if (b->xpos + j0 < x0) x0 = b->xpos + j0;
+		if (b->ypos + i0 < y0) y0 = b->ypos + i0;
+		if (b->xpos + j1 > x1) x1 = b->xpos + j1;
+		if (b->ypos + i1 > y1) y1 = b->ypos + i1;
 	      }
 	    else
 	      init_blob(st, st->blobs + k);
 	  }
 
-	memset( st->pImage->data, 0, st->pImage->bytes_per_line * st->pImage->height);
+	/* draw the union of this frame's and the last frame's st->blub to
+	   the screen: outside of that, it is still background. */
+	{
+	  int ux0 = x0, uy0 = y0, ux1 = x1, uy1 = y1;
+	  if (st->dirty_x1 > st->dirty_x0)
+	    {
+	      if (st->dirty_x0 < ux0) ux0 = st->dirty_x0;
+	      if (st->dirty_y0 < uy0) uy0 = st->dirty_y0;
+	      if (st->dirty_x1 > ux1) ux1 = st->dirty_x1;
+	      if (st->dirty_y1 > uy1) uy1 = st->dirty_y1;
+	    }
+
+	  if (ux1 > ux0 && uy1 > uy0)
+	    {
+	      pixel_lut_expand (&st->lut,
+				st->blub + uy0 * st->iWinWidth + ux0,
+				st->iWinWidth,
+				ux0, uy0, ux1 - ux0, uy1 - uy0);
+	      put_xshm_image (st->dpy, st->window, st->gc, st->pImage,
+			      ux0, uy0, ux0, uy0, ux1 - ux0, uy1 - uy0,
+			      &st->shm_info);
+	    }
+	}
 
-	/* draw st->blub array to screen */
-	for (i = 0; i < st->iWinHeight; ++i)
+	if (x1 > x0 && y1 > y0)
 	  {
-	    for (j = 0; j < st->iWinWidth; ++j)
-	      {
-		if (st->aiColorVals[st->blub[i][j]] > 0)
-		  XPutPixel( st->pImage, j, i, st->aiColorVals[st->blub[i][j]] );
-	      }
+	    st->dirty_x0 = x0;
+	    st->dirty_y0 = y0;
+	    st->dirty_x1 = x1;
+	    st->dirty_y1 = y1;
 	  }
-
-	XPutImage( st->dpy, st->window, st->gc, st->pImage,
-		   0, 0, 0, 0, st->iWinWidth, st->iWinHeight );
+	else
+	  st->dirty_x0 = st->dirty_y0 = st->dirty_x1 = st->dirty_y1 = 0;
 }
 
 static unsigned long * SetPalette(struct state *st )
@@ -226,9 +257,8 @@ static void Initialize( struct state *st )
 	/*  Create the GC. */
 	st->gc = XCreateGC( st->dpy, st->window, 0, &gcValues );
 
-	st->pImage = XCreateImage( st->dpy, XWinAttribs.visual, XWinAttribs.depth, ZPixmap, 0, NULL,
-							  XWinAttribs.width, XWinAttribs.height, BitmapPad( st->dpy ), 0 );
-	(st->pImage)->data = calloc((st->pImage)->bytes_per_line, (st->pImage)->height);
+	st->pImage = create_xshm_image( st->dpy, XWinAttribs.visual, XWinAttribs.depth, ZPixmap,
+					&st->shm_info, XWinAttribs.width, XWinAttribs.height );
 
 	st->iWinWidth = XWinAttribs.width;
 	st->iWinHeight = XWinAttribs.height;
@@ -262,14 +292,10 @@ static void Initialize( struct state *st )
 	st->sradius = st->radius * st->radius;
 
 	/* create st->blob */
-	st->blob = malloc ( st->dradius * sizeof(unsigned char*));
-	for (i = 0; i < st->dradius; ++i)
-	  st->blob[i] = malloc( st->dradius * sizeof(unsigned char));
+	st->blob = malloc( st->dradius * st->dradius * sizeof(unsigned char));
 
 	/* create st->blub array */
-	st->blub = malloc( st->iWinHeight * sizeof(unsigned char*));
-	for (i = 0; i < st->iWinHeight; ++i)
-	  st->blub[i] = malloc( st->iWinWidth * sizeof(unsigned char));
+	st->blub = calloc( st->iWinHeight * st->iWinWidth, sizeof(unsigned char));
 
 	/* create st->blob */
 	for (i = -st->radius; i < st->radius; ++i)
@@ -281,11 +307,11 @@ static void Initialize( struct state *st )
 		  {
 		    /* compute density */     
 		    fraction = (float)distance_squared / (float)st->sradius;
-		    st->blob[i + st->radius][j + st->radius] = pow((1.0 - (fraction * fraction)),4.0) * 255.0;
+		    st->blob[(i + st->radius) * st->dradius + j + st->radius] = pow((1.0 - (fraction * fraction)),4.0) * 255.0;
 		  }
 		else
 		  {
-		    st->blob[i + st->radius][j + st->radius] = 0;
+		    st->blob[(i + st->radius) * st->dradius + j + st->radius] = 0;
 		  }
 	      }    
 	  }
@@ -343,10 +369,10 @@ metaballs_draw (Display *dpy, Window window, void *closure)
       XWindowAttributes XWinAttribs;
       XGetWindowAttributes( st->dpy, st->window, &XWinAttribs );
 
-      memset( st->pImage->data, 0, st->pImage->bytes_per_line * st->pImage->height );
       XFreeColors( st->dpy, XWinAttribs.colormap, st->aiColorVals, st->iColorCount, 0 );
       free( st->aiColorVals );
       st->aiColorVals = SetPalette( st );
+      pixel_lut_init( &st->lut, st->pImage, st->aiColorVals, st->iColorCount );
       XClearWindow( st->dpy, st->window );
       for (i = 0; i < st->nBlobCount; i++)
         {
@@ -387,15 +413,10 @@ static void
 metaballs_free (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
-  int i;
-  if (st->pImage) XDestroyImage (st->pImage);
+  if (st->pImage) destroy_xshm_image (dpy, st->pImage, &st->shm_info);
   free (st->aiColorVals);
   free (st->blobs);
-  for (i = 0; i < st->iWinHeight; ++i)
-    free (st->blub[i]);
   free (st->blub);
-  for (i = 0; i < st->dradius; ++i)
-    free (st->blob[i]);
   if (st->sColor) free (st->sColor);
   free (st->blob);
   XFreeGC (dpy, st->gc);
@@ -406,6 +427,7 @@ metaballs_free (Display *dpy, Window window, void *closure)
 static const char *metaballs_defaults [] = {
   ".background: black",
   ".foreground: white",
+  "*fpsSolid:	true",
   "*color:    random",
   "*count:    10",
   "*cycles:   1000",
@@ -413,6 +435,9 @@ static const char *metaballs_defaults [] = {
   "*delay:    10000",
   "*radius:   100",
   "*delta:   3",
+#ifdef HAVE_XSHM_EXTENSION
+  "*useSHM:   True",
+#endif
 #ifdef HAVE_MOBILE
   "*ignoreRotation: True",
 #endif
@@ -17,6 +17,7 @@
 #include "ansi-tty.h"
 #include "ximage-loader.h"
 #include "utf8wc.h"
+#include "xshm.h"
 
 #ifndef HAVE_JWXYZ
 # include <X11/Intrinsic.h>
@@ -44,14 +45,20 @@
 #endif /* BUILTIN_FONT */
 
 
+/* Glyphs are rendered on the client side, into one image the size of the
+   window, and only the rows that changed are sent to the server.  Each
+   glyph is stored as a map of which pixels are the background, the fuzzy
+   halo around a stroke, or the stroke itself; each fade state has a
+   3-entry table mapping those to pixel values.
+ */
+#define BITS_BG   0
+#define BITS_HALO 1
+#define BITS_CORE 2
+
 typedef struct {
   unsigned long name;	/* Unicode character */
   int width, height;
-  Pixmap pixmap;
-#ifdef FUZZY_BORDER
-  Pixmap pixmap2;
-  Pixmap cache;
-#endif /* FUZZY_BORDER */
+  unsigned char *bits;	/* width * height of BITS_BG/HALO/CORE */
   Bool blank_p;
 } p_char;
 
@@ -85,14 +92,19 @@ typedef struct {
 
   p_cell *cells;
   XGCValues gcv;
-  GC gc0;
-  GC gc1;
-#ifdef FUZZY_BORDER
-  GC gc2;
-#endif /* FUZZY_BORDER */
-  GC *gcs;
+  GC gc;
+  unsigned long *pixels;	/* one per state: bg, flare, fg, fades... */
+  unsigned long (*luts)[3];	/* per state, indexed by BITS_BG/HALO/CORE */
+  int line_width;		/* of the strokes, in real pixels */
+# ifdef FUZZY_BORDER
+  int line_width2;		/* of the inside of the strokes */
+# endif /* FUZZY_BORDER */
   XImage *font_bits, *sym_font_bits;
 
+  XImage *image;		/* the whole window */
+  XShmSegmentInfo shm_info;
+  Bool fast32;			/* image is 32bpp, in our byte order */
+
   int cursor_x, cursor_y;
   Bool cursor_on;
   XtIntervalId cursor_timer;
@@ -106,8 +118,9 @@ typedef struct {
 
 
 static void capture_font_bits (p_state *state, Bool symbol_p);
-static void char_to_pixmap (p_state *state, p_char *pc, unsigned long c,
-                            Bool invert_p, Bool symbol_p);
+static void char_to_bits (p_state *state, p_char *pc, unsigned long c,
+                          Bool invert_p, Bool symbol_p);
+static Bool make_image (p_state *state);
 
 
 /* About font metrics:
@@ -156,7 +169,6 @@ static void *
 phosphor_init (Display *dpy, Window window)
 {
   int i;
-  unsigned long flags;
   p_state *state = (p_state *) calloc (sizeof(*state), 1);
   char *fontname = get_string_resource (dpy, "font", "Font");
   XftFont *font;
@@ -245,7 +257,8 @@ phosphor_init (Display *dpy, Window window)
   state->cells = (p_cell *) calloc (sizeof(p_cell),
                                     state->grid_width * state->grid_height);
 
-  state->gcs = (GC *) calloc (sizeof(GC), state->ticks + 1);
+  state->pixels = (unsigned long *)
+    calloc (sizeof(*state->pixels), state->ticks + 1);
 
   {
     int ncolors = MAX (1, state->ticks - 3);
@@ -305,48 +318,59 @@ phosphor_init (Display *dpy, Window window)
           flare = white.pixel;
       }
 
-    /* Now, GCs all around.
-     */
-    state->gcv.cap_style = CapRound;
+    state->pixels[BLANK]  = bg;
+    state->pixels[FLARE]  = flare;
+    state->pixels[NORMAL] = fg;
+    for (i = 0; i < ncolors; i++)
+      state->pixels[STATE_MAX + i] = colors[i].pixel;
+
+    /* The halo is two states further along in the fade than the stroke
+       inside it; near the end of the fade, they are the same color. */
+    state->luts = (unsigned long (*)[3])
+      calloc (sizeof(*state->luts), state->ticks);
+    for (i = 0; i < state->ticks; i++)
+      {
+        unsigned long core = state->pixels[i];
 # ifdef FUZZY_BORDER
-    state->gcv.line_width = (int) (((long) state->scale) * 1.3);
-    if (state->gcv.line_width == state->scale)
-      state->gcv.line_width++;
+        unsigned long halo = ((i + 2) < state->ticks
+                              ? state->pixels[i + 2]
+                              : core);
 # else /* !FUZZY_BORDER */
-    state->gcv.line_width = (int) (((long) state->scale) * 0.9);
-    if (state->gcv.line_width >= state->scale)
-      state->gcv.line_width = state->scale - 1;
-    if (state->gcv.line_width < 1)
-      state->gcv.line_width = 1;
+        unsigned long halo = core;
 # endif /* !FUZZY_BORDER */
+        state->luts[i][BITS_BG]   = bg;
+        state->luts[i][BITS_HALO] = halo;
+        state->luts[i][BITS_CORE] = core;
+      }
 
-    flags = (GCForeground | GCBackground | GCCapStyle | GCLineWidth);
+# ifdef FUZZY_BORDER
+    state->line_width = (int) (((long) state->scale) * 1.3);
+    if (state->line_width == state->scale)
+      state->line_width++;
+    state->line_width2 = (int) (((long) state->scale) * 0.8);
+    if (state->line_width2 >= state->scale)
+      state->line_width2 = state->scale - 1;
+    if (state->line_width2 < 1)
+      state->line_width2 = 1;
+# else /* !FUZZY_BORDER */
+    state->line_width = (int) (((long) state->scale) * 0.9);
+    if (state->line_width >= state->scale)
+      state->line_width = state->scale - 1;
+    if (state->line_width < 1)
+      state->line_width = 1;
+# endif /* !FUZZY_BORDER */
 
-    state->gcv.background = bg;
     state->gcv.foreground = bg;
-    state->gcs[BLANK] = XCreateGC (state->dpy, state->window, flags,
-                                   &state->gcv);
-
-    state->gcv.foreground = flare;
-    state->gcs[FLARE] = XCreateGC (state->dpy, state->window, flags,
-                                   &state->gcv);
-
-    state->gcv.foreground = fg;
-    state->gcs[NORMAL] = XCreateGC (state->dpy, state->window, flags,
-                                    &state->gcv);
-
-    for (i = 0; i < ncolors; i++)
-      {
-        state->gcv.foreground = colors[i].pixel;
-        state->gcs[STATE_MAX + i] = XCreateGC (state->dpy, state->window,
-                                               flags, &state->gcv);
-      }
+    state->gcv.background = bg;
+    state->gc = XCreateGC (state->dpy, state->window,
+                           GCForeground | GCBackground, &state->gcv);
 
     free (colors);
   }
 
   capture_font_bits (state, False);
   capture_font_bits (state, True);
+  make_image (state);
 
   state->tty = ansi_tty_init (state->grid_width, state->grid_height);
   state->tty->closure  = state;
@@ -374,9 +398,11 @@ resize_grid (p_state *state)
   int ow = state->grid_width;
   int oh = state->grid_height;
   p_cell *ocells = state->cells;
+  Bool new_image_p;
   int x, y;
 
   XGetWindowAttributes (state->dpy, state->window, &state->xgwa);
+  new_image_p = make_image (state);
 
   /* Would like to ensure here that
      state->char_height * state->scale <= state->xgwa.height
@@ -392,7 +418,13 @@ resize_grid (p_state *state)
 
   if (ow == state->grid_width &&
       oh == state->grid_height)
-    return False;
+    {
+      /* Same grid, but the old image is gone: redraw all of it. */
+      if (new_image_p)
+        for (x = 0; x < ow * oh; x++)
+          state->cells[x].changed = True;
+      return False;
+    }
 
   state->cells = (p_cell *) calloc (sizeof(p_cell),
                                     state->grid_width * state->grid_height);
@@ -425,7 +457,7 @@ make_character (p_state *state, unsigned char c, Bool invert_p, Bool symbol_p)
   pc->name = (c + (symbol_p ? 256 : 0)) * (invert_p ? -1 : 1);
   pc->width =  state->scale * state->char_width;
   pc->height = state->scale * state->char_height;
-  char_to_pixmap (state, pc, c, invert_p, symbol_p);
+  char_to_bits (state, pc, c, invert_p, symbol_p);
   return pc;
 }
 
@@ -438,6 +470,7 @@ capture_font_bits (p_state *state, Bool symbol_p)
   unsigned char string[257];
   int i;
   Pixmap p;
+  GC gc0, gc1;
 
 # ifdef BUILTIN_FONT
   Pixmap p2 = 0;
@@ -529,41 +562,22 @@ capture_font_bits (p_state *state, Bool symbol_p)
 
   state->gcv.foreground = 0;
   state->gcv.background = 0;
-  state->gc0 = XCreateGC (state->dpy, p,
-                          (GCForeground | GCBackground),
-                          &state->gcv);
+  gc0 = XCreateGC (state->dpy, p, (GCForeground | GCBackground), &state->gcv);
 
   state->gcv.foreground = 1;
-  state->gc1 = XCreateGC (state->dpy, p,
-                          (GCForeground | GCBackground |
-                           GCCapStyle | GCLineWidth),
-                          &state->gcv);
+  gc1 = XCreateGC (state->dpy, p, (GCForeground | GCBackground), &state->gcv);
 
 # ifdef HAVE_JWXYZ
-  jwxyz_XSetAntiAliasing (state->dpy, state->gc0, False);
-  jwxyz_XSetAntiAliasing (state->dpy, state->gc1, False);
+  jwxyz_XSetAntiAliasing (state->dpy, gc0, False);
+  jwxyz_XSetAntiAliasing (state->dpy, gc1, False);
 # endif
 
-# ifdef FUZZY_BORDER
-  {
-    state->gcv.line_width = (int) (((long) state->scale) * 0.8);
-    if (state->gcv.line_width >= state->scale)
-      state->gcv.line_width = state->scale - 1;
-    if (state->gcv.line_width < 1)
-      state->gcv.line_width = 1;
-    state->gc2 = XCreateGC (state->dpy, p,
-                            (GCForeground | GCBackground |
-                             GCCapStyle | GCLineWidth),
-                            &state->gcv);
-  }
-# endif /* FUZZY_BORDER */
-
-  XFillRectangle (state->dpy, p, state->gc0, 0, 0, (safe_width * 256), height);
+  XFillRectangle (state->dpy, p, gc0, 0, 0, (safe_width * 256), height);
 
 # ifdef BUILTIN_FONT
   if (p2)
     {
-      XCopyPlane (state->dpy, p2, p, state->gc1,
+      XCopyPlane (state->dpy, p2, p, gc1,
                   0, 0, FONT6x10_WIDTH, FONT6x10_HEIGHT, 
                   0, 0, 1);
       XFreePixmap (state->dpy, p2);
@@ -701,6 +715,8 @@ capture_font_bits (p_state *state, Bool symbol_p)
   }
 
   XFreePixmap (state->dpy, p);
+  XFreeGC (state->dpy, gc0);
+  XFreeGC (state->dpy, gc1);
 
   for (i = 0; i < countof(state->chars); i++)
     {
@@ -720,33 +736,50 @@ capture_font_bits (p_state *state, Bool symbol_p)
 }
 
 
+/* Draws a horizontal line with round end caps, the way XDrawLine would
+   with CapRound.  X puts pixel centers on the integer coordinates, and
+   includes a pixel on the edge of the shape only if the inside of the
+   shape is below or to the right of it.
+ */
 static void
-char_to_pixmap (p_state *state, p_char *pc, unsigned long c,
-                Bool invert_p, Bool symbol_p)
+draw_span (p_char *pc, int x1, int x2, int y, int line_width,
+           unsigned char level)
+{
+  int lw2 = line_width * line_width;
+  int r = line_width / 2 + 1;
+  int xa = MAX (0, x1 - r), xb = MIN (pc->width  - 1, x2 + r);
+  int ya = MAX (0, y  - r), yb = MIN (pc->height - 1, y  + r);
+  int px, py;
+
+  for (py = ya; py <= yb; py++)
+    {
+      unsigned char *row = pc->bits + py * pc->width;
+      int dy = py - y;
+      for (px = xa; px <= xb; px++)
+        {
+          int dx = (px < x1 ? x1 - px : px > x2 ? px - x2 : 0);
+          int d4 = 4 * (dx*dx + dy*dy);
+          if ((d4 < lw2 ||
+               (d4 == lw2 && (dy < 0 || (dy == 0 && px < x1)))) &&
+              row[px] < level)
+            row[px] = level;
+        }
+    }
+}
+
+
+static void
+char_to_bits (p_state *state, p_char *pc, unsigned long c,
+              Bool invert_p, Bool symbol_p)
 {
-  Pixmap p = 0;
-  GC gc;
-# ifdef FUZZY_BORDER
-  Pixmap p2 = 0;
-  GC gc2;
-# endif /* FUZZY_BORDER */
   int from, to;
   int x1, y;
   XImage *font_bits = (symbol_p ? state->sym_font_bits : state->font_bits);
-
   int safe_width = state->char_width + 1;
+  int xoff = state->scale / 2;
 
-  int width  = state->scale * state->char_width;
-  int height = state->scale * state->char_height;
-
-  gc = state->gc1;
-  p = XCreatePixmap (state->dpy, state->window, width, height, 1);
-  XFillRectangle (state->dpy, p, state->gc0, 0, 0, width, height);
-# ifdef FUZZY_BORDER
-  gc2 = state->gc2;
-  p2 = XCreatePixmap (state->dpy, state->window, width, height, 1);
-  XFillRectangle (state->dpy, p2, state->gc0, 0, 0, width, height);
-# endif /* FUZZY_BORDER */
+  pc->bits = (unsigned char *) calloc (pc->width, pc->height);
+  if (! pc->bits) abort();
 
   from = safe_width * c;
   to =   safe_width * (c + 1);
@@ -772,7 +805,6 @@ char_to_pixmap (p_state *state, p_char *pc, unsigned long c,
         if (invert_p) pix = !pix;
         if (pix)
           {
-            int xoff = state->scale / 2;
             int x2;
             for (x2 = x1; x2 < to; x2++)
               {
@@ -782,59 +814,107 @@ char_to_pixmap (p_state *state, p_char *pc, unsigned long c,
                   break;
               }
             x2--;
-            XDrawLine (state->dpy, p, gc,
-                       (x1 - from) * state->scale + xoff, y * state->scale,
-                       (x2 - from) * state->scale + xoff, y * state->scale);
+            draw_span (pc,
+                       (x1 - from) * state->scale + xoff,
+                       (x2 - from) * state->scale + xoff,
+                       y * state->scale,
+                       state->line_width, BITS_HALO);
 # ifdef FUZZY_BORDER
-            XDrawLine (state->dpy, p2, gc2,
-                       (x1 - from) * state->scale + xoff, y * state->scale,
-                       (x2 - from) * state->scale + xoff, y * state->scale);
+            draw_span (pc,
+                       (x1 - from) * state->scale + xoff,
+                       (x2 - from) * state->scale + xoff,
+                       y * state->scale,
+                       state->line_width2, BITS_CORE);
 # endif /* FUZZY_BORDER */
             x1 = x2;
             pc->blank_p = False;
           }
       }
+}
 
-  pc->pixmap = p;
-# ifdef FUZZY_BORDER
-  pc->pixmap2 = p2;
-# endif /* FUZZY_BORDER */
 
-# ifdef FUZZY_BORDER
-  pc->cache = 0;
-  if (get_boolean_resource (state->dpy, "cache", "Cache"))
+/* (Re)creates the window-sized image, if the window size has changed.
+   Returns True if the contents of the window need to be redrawn.
+ */
+static Bool
+make_image (p_state *state)
+{
+  XImage *image = state->image;
+  int x, y;
+
+  if (image &&
+      image->width  == state->xgwa.width &&
+      image->height == state->xgwa.height)
+    return False;
+
+  if (image)
+    destroy_xshm_image (state->dpy, image, &state->shm_info);
+
+  image = state->image =
+    create_xshm_image (state->dpy, state->xgwa.visual, state->xgwa.depth,
+                       ZPixmap, &state->shm_info,
+                       state->xgwa.width, state->xgwa.height);
+  if (! image)
+    {
+      fprintf (stderr, "%s: out of memory (%dx%d)\n", progname,
+               state->xgwa.width, state->xgwa.height);
+      exit (1);
+    }
+
+  {
+    unsigned int local_order = (MSBFirst << 24) | (LSBFirst << 0);
+    state->fast32 = (image->bits_per_pixel == 32 &&
+                     image->byte_order == *(char *) &local_order);
+  }
+
+  for (y = 0; y < image->height; y++)
+    for (x = 0; x < image->width; x++)
+      XPutPixel (image, x, y, state->pixels[BLANK]);
+
+  return True;
+}
+
+
+/* Copies one character cell into the image.  pc = 0 means blank.
+ */
+static void
+draw_cell (p_state *state, const p_char *pc, const unsigned long *lut,
+           int tx, int ty, int width, int height)
+{
+  XImage *image = state->image;
+  const unsigned char *bits = (pc ? pc->bits : 0);
+  int stride = width;
+  int x, y;
+
+  /* The grid is never smaller than 2x2, even if the window is. */
+  if (tx + width  > image->width)  width  = image->width  - tx;
+  if (ty + height > image->height) height = image->height - ty;
+  if (width <= 0 || height <= 0) return;
+
+  if (state->fast32)
     {
-      /* Cache every possible frame of this character's fade in a pixmap,
-         because XSetClipMask has become *incredibly* fucking slow on
-         "modern" X11 systems (e.g. Raspbian 11.)  I blame compositors. */
-
-      int st;
-      pc->cache = XCreatePixmap (state->dpy, state->window,
-                                 width * state->ticks, height,
-                                 state->xgwa.depth);
-      for (st = 0; st < state->ticks; st++)
+      for (y = 0; y < height; y++)
         {
-          int tx = st * width;
-          int ty = 0;
-          GC gc1 = state->gcs[st];
-          GC gc2 = ((st + 2) < state->ticks
-                    ? state->gcs[st + 2]
-                    : 0);
-          GC gc3 = (gc2 ? gc2 : gc1);
-          if (gc3)
-            XCopyPlane (state->dpy, pc->pixmap, pc->cache, gc3,
-                        0, 0, width, height, tx, ty, 1L);
-          if (gc2)
+          uint32_t *out = (uint32_t *)
+            (image->data + (ty + y) * image->bytes_per_line) + tx;
+          if (bits)
             {
-              XSetClipMask (state->dpy, gc1, pc->pixmap2);
-              XSetClipOrigin (state->dpy, gc1, tx, ty);
-              XFillRectangle (state->dpy, pc->cache, gc1,
-                              tx, ty, width, height);
-              XSetClipMask (state->dpy, gc1, None);
+              const unsigned char *in = bits + y * stride;
+              for (x = 0; x < width; x++)
+                out[x] = (uint32_t) lut[in[x]];
             }
+          else
+            for (x = 0; x < width; x++)
+              out[x] = (uint32_t) lut[BITS_BG];
         }
     }
-# endif /* FUZZY_BORDER */
+  else
+    {
+      for (y = 0; y < height; y++)
+        for (x = 0; x < width; x++)
+          XPutPixel (image, tx + x, ty + y,
+                     lut[bits ? bits[y * stride + x] : BITS_BG]);
+    }
 }
 
 
@@ -1013,6 +1093,9 @@ print_char (p_state *state, int c)
 static void
 update_display (p_state *state, Bool changed_only)
 {
+  int width  = state->char_width  * state->scale;
+  int height = state->char_height * state->scale;
+  int y0 = state->grid_height, y1 = -1;
   int x, y;
 
   for (y = 0; y < state->grid_height; y++)
@@ -1025,7 +1108,7 @@ update_display (p_state *state, Bool changed_only)
         Bool cursor_p = (x == state->cursor_x && y == state->cursor_y);
         unsigned char c = cell->c;
         p_char *pc;
-        int width, height, tx, ty;
+        int tx, ty;
 
         if (changed_only && !cell->changed)
           continue;
@@ -1045,54 +1128,35 @@ update_display (p_state *state, Bool changed_only)
               ? (inv_p ? state->sichars[c] : state->schars[c])
               : (inv_p ?  state->ichars[c] :  state->chars[c]));
 
-        width  = state->char_width  * state->scale;
-        height = state->char_height * state->scale;
         tx = x * width  + state->xmargin;
         ty = y * height + state->ymargin;
 
         if (pc->blank_p || (cell->state == BLANK && !cursor_p))
-          {
-            XFillRectangle (state->dpy, state->window, state->gcs[BLANK],
-                            tx, ty, width, height);
-          }
-# ifdef FUZZY_BORDER
-        else if (pc->cache)
-          {
-            int src_x = st * width;
-            int src_y = 0;
-            XCopyArea (state->dpy, pc->cache, state->window, state->gcs[BLANK],
-                       src_x, src_y, width, height, tx, ty);
-          }
-# endif /* FUZZY_BORDER */
+          draw_cell (state, 0, state->luts[BLANK], tx, ty, width, height);
         else
-          {
-# ifdef FUZZY_BORDER
-            GC gc1 = state->gcs[st];
-            GC gc2 = ((st + 2) < state->ticks
-                      ? state->gcs[st + 2]
-                      : 0);
-            GC gc3 = (gc2 ? gc2 : gc1);
-            if (gc3)
-              XCopyPlane (state->dpy, pc->pixmap, state->window, gc3,
-                          0, 0, width, height, tx, ty, 1L);
-            if (gc2)
-              {
-                XSetClipMask (state->dpy, gc1, pc->pixmap2);
-                XSetClipOrigin (state->dpy, gc1, tx, ty);
-                XFillRectangle (state->dpy, state->window, gc1,
-                                tx, ty, width, height);
-                XSetClipMask (state->dpy, gc1, None);
-              }
-# else /* !FUZZY_BORDER */
-            XCopyPlane (state->dpy,
-                        pc->pixmap, state->window,
-                        state->gcs[st],
-                        0, 0, width, height, tx, ty, 1L);
-# endif /* !FUZZY_BORDER */
-          }
+          draw_cell (state, pc, state->luts[st], tx, ty, width, height);
 
         cell->changed = False;
+        if (y < y0) y0 = y;
+        y1 = y;
       }
+
+  /* One request for all of the rows that changed. */
+  if (! changed_only)
+    put_xshm_image (state->dpy, state->window, state->gc, state->image,
+                    0, 0, 0, 0, state->image->width, state->image->height,
+                    &state->shm_info);
+  else if (y1 >= y0)
+    {
+      int ty = y0 * height + state->ymargin;
+      int th = (y1 - y0 + 1) * height;
+      if (ty + th > state->image->height)
+        th = state->image->height - ty;
+      if (th > 0)
+        put_xshm_image (state->dpy, state->window, state->gc, state->image,
+                        0, ty, 0, ty, state->image->width, th,
+                        &state->shm_info);
+    }
 }
 
 
@@ -1104,9 +1168,22 @@ phosphor_draw (Display *dpy, Window window, void *closure)
   update_display (state, True);
   decay (state);
 
-  c = textclient_getc (state->tc);
-  if (c > 0) 
-    print_char (state, c);
+  if (state->delay > 0)
+    {
+      c = textclient_getc (state->tc);
+      if (c > 0)
+        print_char (state, c);
+    }
+  else
+    {
+      /* With no delay, we're being used to tail something busy: take
+         everything that's waiting, rather than one byte per frame. */
+      char buf[4096];
+      int i, n = textclient_read (state->tc, buf, sizeof(buf));
+      for (i = 0; i < n; i++)
+        if (buf[i])
+          print_char (state, (unsigned char) buf[i]);
+    }
 
   return state->delay;
 }
@@ -1164,27 +1241,23 @@ phosphor_free (Display *dpy, Window window, void *closure)
 
   ansi_tty_free (state->tty);
 
-  if (state->gc0) XFreeGC (dpy, state->gc0);
-  if (state->gc1) XFreeGC (dpy, state->gc1);
-# ifdef FUZZY_BORDER
-  if (state->gc2) XFreeGC (dpy, state->gc2);
-# endif /* FUZZY_BORDER */
-  for (i = 0; i < state->ticks; i++)
-    if (state->gcs[i]) XFreeGC (dpy, state->gcs[i]);
-  free (state->gcs);
+  if (state->gc) XFreeGC (dpy, state->gc);
+  free (state->pixels);
+  free (state->luts);
   for (i = 0; i < countof(state->chars); i++) {
-    XFreePixmap (dpy, state->chars[i]->pixmap);
-    XFreePixmap (dpy, state->ichars[i]->pixmap);
-# ifdef FUZZY_BORDER
-    XFreePixmap (dpy, state->chars[i]->pixmap2);
-    XFreePixmap (dpy, state->ichars[i]->pixmap2);
-    if (state->chars[i]->cache)
-      XFreePixmap (dpy, state->chars[i]->cache);
-    if (state->ichars[i]->cache)
-      XFreePixmap (dpy, state->ichars[i]->cache);
-# endif /* FUZZY_BORDER */
-    free (state->chars[i]);
+    p_char *pcs[4];
+    int j;
+    pcs[0] = state->chars[i];
+    pcs[1] = state->ichars[i];
+    pcs[2] = state->schars[i];
+    pcs[3] = state->sichars[i];
+    for (j = 0; j < countof(pcs); j++) {
+      free (pcs[j]->bits);
+      free (pcs[j]);
+    }
   }
+  if (state->image)
+    destroy_xshm_image (dpy, state->image, &state->shm_info);
   XDestroyImage (state->font_bits);
   XDestroyImage (state->sym_font_bits);
   free (state->cells);
@@ -1215,12 +1288,6 @@ static const char *phosphor_defaults [] = {
   "*font:		   fixed",
 # endif
 
-# ifdef HAVE_JWXYZ
-  "*cache:		   False",
-# else
-  "*cache:		   True",
-# endif
-
 # ifdef HAVE_FORKPTY
   "*usePty:                True",
 # else
@@ -1250,8 +1317,8 @@ static XrmOptionDescRec phosphor_options [] = {
   { "-esc",		".metaSendsESC",	XrmoptionNoArg, "True"  },
   { "-bs",		".swapBSDEL",		XrmoptionNoArg, "False" },
   { "-del",		".swapBSDEL",		XrmoptionNoArg, "True"  },
-  { "-cache",		".cache",		XrmoptionNoArg, "True"  },
-  { "-no-cache",	".cache",		XrmoptionNoArg, "False" },
+  { "-cache",		".cache",		XrmoptionNoArg, "True"  }, /* ignored */
+  { "-no-cache",	".cache",		XrmoptionNoArg, "False" }, /* ignored */
   { 0, 0, 0, 0 }
 };
 
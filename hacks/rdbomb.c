@@ -21,6 +21,7 @@
 
 #include "screenhack.h"
 #include "xshm.h"
+#include "thread_util.h"
 
 /* costs ~6% speed */
 #define dither_when_mapped 1
@@ -32,9 +33,8 @@ struct state {
   int ncolors;
   XColor *colors;
   Visual *visual;
-#if dither_when_mapped
-  unsigned char *mc;
-#endif
+  unsigned char *mc;		/* r1 to color index, maybe dithered */
+  unsigned long pixels[256];	/* color index to pixel */
   Colormap cmap;
   int mapped;
   int pdepth;
@@ -46,7 +46,6 @@ struct state {
   int reaction;
   int diffusion;
 
-  char *pd;
   int array_width, array_height;
 
   XShmSegmentInfo shm_info;
@@ -57,6 +56,15 @@ struct state {
   double array_dx, array_dy;
   XWindowAttributes xgwa;
   int delay;
+  int steps;
+
+  struct threadpool pool;
+  Bool draw_p;
+};
+
+struct rd_thread {
+  struct state *st;
+  unsigned id;
 };
 
 static void random_colors(struct state *st);
@@ -65,7 +73,7 @@ static void random_colors(struct state *st);
    pixel hack, 8-bit pixel grid, first/next frame interface
 
    pixack_init(int *size_h, int *size_v)
-   pixack_frame(char *pix_buf)
+   pixack_frame(Bool draw_p)
    */
 
 
@@ -122,20 +130,164 @@ pixack_init(struct state *st, int *size_h, int *size_v)
   *size_v = st->height;
 }
 
-#define test_pattern_hyper 0
+/* The grids have a one-cell border of ghost cells around them, which are
+   copied from the opposite edge before each step, so that the stencil can
+   read its neighbors without any wraparound arithmetic.  Each row is then
+   stepped in three passes -- diffusion, reaction, and color lookup -- each
+   of which is a straight loop with the choice of constants hoisted out of
+   it, so that the compiler can vectorize the first two.  The rows are
+   divided into bands, one per thread.
+ */
+
+static void
+fill_ghost_cells (struct state *st)
+{
+  int i;
+  int w2 = st->width + 2;
+  int h = st->height;
+
+  memcpy (st->r1, st->r1 + w2 * h, w2 * sizeof(*st->r1));
+  memcpy (st->r2, st->r2 + w2 * h, w2 * sizeof(*st->r2));
+  memcpy (st->r1 + w2 * (h + 1), st->r1 + w2, w2 * sizeof(*st->r1));
+  memcpy (st->r2 + w2 * (h + 1), st->r2 + w2, w2 * sizeof(*st->r2));
+
+  for (i = 0; i <= h+1; i++) {
+    st->r1[w2 * i] = st->r1[st->width + w2 * i];
+    st->r2[w2 * i] = st->r2[st->width + w2 * i];
+    st->r1[w2 * i + st->width + 1] = st->r1[w2 * i + 1];
+    st->r2[w2 * i + st->width + 1] = st->r2[w2 * i + 1];
+  }
+}
+
+
+/* Steps one row of the grid from r1/r2 into r1b/r2b, and if draw_p,
+   renders it into the image. */
+static void
+step_row (struct state *st, int y)
+{
+  int j;
+  int w = st->width;
+  int w2 = w + 2;
+  const unsigned short *i1 = st->r1 + 1 + w2 * (y + 1);
+  const unsigned short *i2 = st->r2 + 1 + w2 * (y + 1);
+  unsigned short *o1 = st->r1b + 1 + w2 * (y + 1);
+  unsigned short *o2 = st->r2b + 1 + w2 * (y + 1);
+  int ka, kf, kb;
+
+  /* The two grids are done in separate loops so that each loop has only
+     one input and one output, which keeps the compiler's aliasing checks
+     simple enough for it to vectorize them. */
+  switch (st->diffusion) {
+  case 0:
+    for (j = 0; j < w; j++)
+      o1[j] = (i1[j] + i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2]) / 5;
+    for (j = 0; j < w; j++)
+      o2[j] = ((i2[j]<<3) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2]) / 12;
+    break;
+  case 1:
+    for (j = 0; j < w; j++)
+      o1[j] = (i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2]) >> 2;
+    for (j = 0; j < w; j++)
+      o2[j] = ((i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2]) >> 3;
+    break;
+  default:
+    for (j = 0; j < w; j++)
+      o1[j] = ((i1[j]<<1) + (i1[j+1]<<1) + (i1[j-1]<<1) +
+               i1[j+w2] + i1[j-w2]) >> 3;
+    for (j = 0; j < w; j++)
+      o2[j] = ((i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2]) >> 3;
+    break;
+  }
+
+  /* John E. Pearson "Complex Patterns in a Simple System"
+     Science, July 1993 */
+  switch (st->reaction) {
+  case 0:  ka = 4; kf = 28; kb = 4; break;
+  case 1:  ka = 3; kf = 27; kb = 3; break;
+  default: ka = 2; kf = 28; kb = 3; break;
+  }
+
+  for (j = 0; j < w; j++) {
+    int r1 = o1[j];
+    int r2 = o2[j];
+    /* uvv = (((r1 * r2) >> bps) * r2) >> bps; */
+    /* avoid signed integer overflow */
+    int uvv = ((((r1 >> 1)* r2) >> bps) * r2) >> (bps - 1);
+    r1 += ka * (((kf * (mx-r1)) >> 10) - uvv);
+    r2 += kb * (uvv - ((80 * r2) >> 10));
+    o1[j] = (r1 < 0 ? 0 : r1 > mx ? mx : r1);
+    o2[j] = (r2 < 0 ? 0 : r2 > mx ? mx : r2);
+  }
+
+  if (st->draw_p) {
+    char *row = st->image->data + st->image->bytes_per_line * y;
+    const unsigned char *mc = st->mc;
+    const unsigned long *pixels = st->pixels;
+    switch (st->pdepth) {
+    case 8:
+      {
+        unsigned char *q = (unsigned char *) row;
+        for (j = 0; j < w; j++)
+          q[j] = pixels[mc[o1[j]]];
+      }
+      break;
+    case 16:
+      {
+        unsigned short *q = (unsigned short *) row;
+        for (j = 0; j < w; j++)
+          q[j] = pixels[mc[o1[j]]];
+      }
+      break;
+    case 32:
+      {
+        /* long -- crashes on Alpha */
+        unsigned int *q = (unsigned int *) row;
+        for (j = 0; j < w; j++)
+          q[j] = pixels[mc[o1[j]]];
+      }
+      break;
+    default:
+      abort();
+    }
+  }
+}
+
+
+static int
+rd_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct rd_thread *t = (struct rd_thread *) self;
+  t->st = GET_PARENT_OBJ (struct state, pool, pool);
+  t->id = id;
+  return 0;
+}
+
+static void
+rd_thread_destroy (void *self)
+{
+}
+
+static void
+rd_thread_run (void *self)
+{
+  struct rd_thread *t = (struct rd_thread *) self;
+  struct state *st = t->st;
+  int y0 = st->height * t->id       / st->pool.count;
+  int y1 = st->height * (t->id + 1) / st->pool.count;
+  int y;
+  for (y = y0; y < y1; y++)
+    step_row (st, y);
+}
 
 
-/* returns the pixels.  called many times. */
+/* advances the grid one step, and if draw_p, renders it into the image.
+   called many times. */
 static void
-pixack_frame(struct state *st, char *pix_buf) 
+pixack_frame(struct state *st, Bool draw_p)
 {
   int i, j;
   int w2 = st->width + 2;
   unsigned short *t;
-#if test_pattern_hyper
-  if (st->frame&0x100)
-    sleep(1);
-#endif
 
   if (!(st->frame%st->epoch_time)) {
     int s;
@@ -173,109 +325,13 @@ pixack_frame(struct state *st, char *pix_buf)
     if (2 == st->reaction && 2 == st->diffusion)
       st->reaction = st->diffusion = 0;
   }
-  for (i = 0; i <= st->width+1; i++) {
-    st->r1[i] = st->r1[i + w2 * st->height];
-    st->r2[i] = st->r2[i + w2 * st->height];
-    st->r1[i + w2 * (st->height + 1)] = st->r1[i + w2];
-    st->r2[i + w2 * (st->height + 1)] = st->r2[i + w2];
-  }
-  for (i = 0; i <= st->height+1; i++) {
-    st->r1[w2 * i] = st->r1[st->width + w2 * i];
-    st->r2[w2 * i] = st->r2[st->width + w2 * i];
-    st->r1[w2 * i + st->width + 1] = st->r1[w2 * i + 1];
-    st->r2[w2 * i + st->width + 1] = st->r2[w2 * i + 1];
-  }
-  for (i = 0; i < st->height; i++) {
-    int ii = i + 1;
-    char *q = pix_buf + st->width * i;
-    short *qq = ((short *) pix_buf) + st->width * i;
-/*  long  *qqq = ((long *) pix_buf) + st->width * i;  -- crashes on Alpha */
-    int   *qqq = ((int  *) pix_buf) + st->width * i;
-    unsigned short *i1 = st->r1 + 1 + w2 * ii;
-    unsigned short *i2 = st->r2 + 1 + w2 * ii;
-    unsigned short *o1 = st->r1b + 1 + w2 * ii;
-    unsigned short *o2 = st->r2b + 1 + w2 * ii;
-    for (j = 0; j < st->width; j++) {
-#if test_pattern_hyper
-      int r1 = (i * j + (st->frame&127)*frame)&65535;
-#else
-      int uvv, r1 = 0, r2 = 0;
-      switch (st->diffusion) {
-      case 0:
-	r1 = i1[j] + i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2];
-	r1 = r1 / 5;
-	r2 = (i2[j]<<3) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2];
-	r2 = r2 / 12;
-	break;
-      case 1:
-	r1 = i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2];
-	r1 = r1 >> 2;
-	r2 = (i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2];
-	r2 = r2 >> 3;
-	break;
-      case 2:
-	r1 = (i1[j]<<1) + (i1[j+1]<<1) + (i1[j-1]<<1) + i1[j+w2] + i1[j-w2];
-	r1 = r1 >> 3;
-	r2 = (i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2];
-	r2 = r2 >> 3;
-	break;
-      }
 
-      /* John E. Pearson "Complex Patterns in a Simple System"
-	 Science, July 1993 */
-
-      /* uvv = (((r1 * r2) >> bps) * r2) >> bps; */
-      /* avoid signed integer overflow */
-      uvv = ((((r1 >> 1)* r2) >> bps) * r2) >> (bps - 1);
-      switch (st->reaction) {  /* costs 4% */
-      case 0:
-	r1 += 4 * (((28 * (mx-r1)) >> 10) - uvv);
-	r2 += 4 * (uvv - ((80 * r2) >> 10));
-	break;
-      case 1:
-	r1 += 3 * (((27 * (mx-r1)) >> 10) - uvv);
-	r2 += 3 * (uvv - ((80 * r2) >> 10));
-	break;
-      case 2:
-	r1 += 2 * (((28 * (mx-r1)) >> 10) - uvv);
-	r2 += 3 * (uvv - ((80 * r2) >> 10));
-	break;
-      }
-      if (r1 > mx) r1 = mx;
-      if (r2 > mx) r2 = mx;
-      if (r1 < 0) r1 = 0;
-      if (r2 < 0) r2 = 0;
-      o1[j] = r1;
-      o2[j] = r2;
-#endif
+  fill_ghost_cells (st);
 
-      /* this is terrible.  here i want to assume ncolors = 256.
-	 should lose double indirection */
+  st->draw_p = draw_p;
+  threadpool_run (&st->pool, rd_thread_run);
+  threadpool_wait (&st->pool);
 
-      if (st->mapped)
-#if dither_when_mapped
-	q[j] = st->colors[st->mc[r1]  % st->ncolors].pixel;
-#else
-      q[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-#endif
-      else if (st->pdepth == 8)
-	q[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-      else if (st->pdepth == 16)
-#if dither_when_mapped
-	qq[j] = st->colors[st->mc[r1] % st->ncolors].pixel;
-#else
-	qq[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-#endif
-      else if (st->pdepth == 32)
-#if dither_when_mapped
-	qqq[j] = st->colors[st->mc[r1] % st->ncolors].pixel;
-#else
-	qqq[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-#endif
-      else
-	abort();
-    }
-  }
   t = st->r1; st->r1 = st->r1b; st->r1b = t;
   t = st->r2; st->r2 = st->r2b; st->r2b = t;  
 }
@@ -297,6 +353,7 @@ static const char *rd_defaults [] = {
   "*size:	1.0",
   "*delay:	30000",
   "*colors:	255",
+  "*steps:	3",
 #ifdef HAVE_XSHM_EXTENSION
   "*useSHM:	True",
 #else
@@ -305,6 +362,7 @@ static const char *rd_defaults [] = {
 #ifdef HAVE_MOBILE
   "*ignoreRotation: True",
 #endif
+  THREAD_DEFAULTS
   0
 };
 
@@ -319,8 +377,10 @@ static XrmOptionDescRec rd_options [] = {
   { "-size",		".size",	XrmoptionSepArg, 0 },
   { "-delay",		".delay",	XrmoptionSepArg, 0 },
   { "-ncolors",		".colors",	XrmoptionSepArg, 0 },
+  { "-steps",		".steps",	XrmoptionSepArg, 0 },
   { "-shm",		".useSHM",	XrmoptionNoArg, "True" },
   { "-no-shm",		".useSHM",	XrmoptionNoArg, "False" },
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
@@ -357,6 +417,11 @@ random_colors(struct state *st)
     st->ncolors = n;
   }
 
+  {
+    int i;
+    for (i = 0; i < countof(st->pixels); i++)
+      st->pixels[i] = st->colors[i % st->ncolors].pixel;
+  }
 }
 
 
@@ -468,9 +533,11 @@ rd_init (Display *dpy, Window win)
 
   {
     int i, di;
+    Bool dither_p = (dither_when_mapped &&
+                     (st->mapped || st->pdepth != 8));
     st->mc = (unsigned char *) malloc(1<<16);
     for (i = 0; i < (1<<16); i++) {
-      di = (i + (random()&255))>>8;
+      di = (dither_p ? (i + (random()&255))>>8 : i>>8);
       if (di > 255) di = 255;
       st->mc[i] = di;
     }
@@ -478,7 +545,24 @@ rd_init (Display *dpy, Window win)
 
   st->image = create_xshm_image(st->dpy, st->xgwa.visual, vdepth,
                                 ZPixmap, &st->shm_info, st->width, st->height);
-  st->pd = st->image->data;
+  st->steps = get_integer_resource (st->dpy, "steps", "Integer");
+  if (st->steps < 1) st->steps = 1;
+
+  {
+    static const struct threadpool_class cls = {
+      sizeof(struct rd_thread),
+      rd_thread_create,
+      rd_thread_destroy
+    };
+    unsigned count = hardware_concurrency (st->dpy);
+    int err;
+    if (count > st->height) count = st->height;
+    err = threadpool_create (&st->pool, &cls, st->dpy, count);
+    if (err) {
+      fprintf (stderr, "%s: threadpool: %s\n", progname, strerror (err));
+      exit (1);
+    }
+  }
 
   return st;
 }
@@ -493,11 +577,11 @@ rd_draw (Display *dpy, Window win, void *closure)
      the animation and the seething, but doesn't appreciably affect the
      frame rate or CPU utilization. */
   int ii;
-  int chunk = 3;
+  int chunk = st->steps;
   for (ii = 0; ii < chunk; ii++) {
 
   int i, j;
-  pixack_frame(st, st->pd);
+  pixack_frame(st, ii == chunk-1);
   if (ii == chunk-1) {  /* Only need to putimage on the final frame */
   for (i = 0; i < st->array_width; i += st->width)
     for (j = 0; j < st->array_height; j += st->height)
@@ -556,6 +640,7 @@ static void
 rd_free (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
+  threadpool_destroy (&st->pool);
   free (st->r1);
   free (st->r2);
   free (st->r1b);
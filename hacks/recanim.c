@@ -12,6 +12,8 @@
  * When configured --with-record-animation, each screenhack takes a
  * "-record-animation DUR" arg that will cause it to run for exactly that
  * many frames, and write a "progname.mp4" file into the current directory.
+ * It also writes "progname.ppm", a still image of the frame half way
+ * through, for use as a thumbnail: see make-previews.pl.
  * "DUR" may be a number of frames, or a time specified as H:MM:SS, "N sec",
  * etc. at 30 FPS.
  *
@@ -82,6 +84,7 @@ struct record_anim_state {
   char *title;
   int secs_elapsed;
   int fade_frames;
+  int poster_frame;
   double start_time;
   XImage *img;
 # ifdef USE_GL
@@ -176,6 +179,8 @@ screenhack_record_anim_init (Screen *screen, Window window, int target_frames)
   if (st->fade_frames >= (st->target_frames / 2) - st->fps)
     st->fade_frames = 0;
 
+  st->poster_frame = st->target_frames / 2;
+
   XGetWindowAttributes (dpy, st->window, &st->xgwa);
 
 # ifdef USE_GL
@@ -231,6 +236,49 @@ screenhack_record_anim_init (Screen *screen, Window window, int target_frames)
 }
 
 
+/* Writes the frame as a binary PPM file.  Assumes data is 3-byte packed
+   BGR, which is what we hand to ffmpeg.
+ */
+static void
+write_poster (record_anim_state *st, const unsigned char *data)
+{
+  int w = st->xgwa.width;
+  int h = st->xgwa.height;
+  unsigned char *row = (unsigned char *) malloc (w * 3);
+  char fn[1024];
+  FILE *out;
+  int x, y;
+
+  sprintf (fn, "%.1000s.ppm", progname);
+  out = fopen (fn, "wb");
+  if (!out || !row)
+    {
+      perror (fn);
+      exit (1);
+    }
+
+  fprintf (out, "P6\n%d %d\n255\n", w, h);
+  for (y = 0; y < h; y++)
+    {
+      const unsigned char *in = data + y * w * 3;
+      for (x = 0; x < w; x++)
+        {
+          row[x*3]   = in[x*3+2];
+          row[x*3+1] = in[x*3+1];
+          row[x*3+2] = in[x*3];
+        }
+      fwrite (row, 3, w, out);
+    }
+
+  if (fclose (out))
+    {
+      perror (fn);
+      exit (1);
+    }
+  free (row);
+}
+
+
 /* Fade to black. Assumes data is 3-byte packed.
  */
 static void
@@ -321,6 +369,9 @@ screenhack_record_anim (record_anim_state *st)
 
 # endif /* USE_GL */
 
+  if (st->frame_count == st->poster_frame)
+    write_poster (st, (unsigned char *) st->img->data);
+
   if (st->frame_count < st->fade_frames)
     fade_frame (st, (unsigned char *) st->img->data,
                 (double) st->frame_count / st->fade_frames);
@@ -40,6 +40,8 @@
  * 13 Nov 1999: Speed up tweaks
  *              Adjust "light" for different bits per colour (-water only)
  * 09 Oct 2016: Updated for new xshm.c
+ * 2026:        The wave equation and the drawing are done in bands of rows
+ *              on a threadpool; colours come from lookup tables.
  *
  */
 
@@ -49,9 +51,15 @@
 typedef enum {ripple_drop, ripple_blob, ripple_box, ripple_stir} ripple_mode;
 
 #include "xshm.h"
+#include "thread_util.h"
 
 #define TABLE 256
 
+/* How hard to hit the water */
+#define SPLASH 512
+
+enum { PHASE_TEMP, PHASE_SMOOTH, PHASE_WAVE, PHASE_DRAW };
+
 struct state {
   Display *dpy;
   Window window;
@@ -59,7 +67,9 @@ struct state {
   Visual *visual;
 
   XImage *orig_map, *buffer_map;
+  Bool fast32;
   int ctab[256];
+  unsigned long ripple_lut[SPLASH/4 + 1];	/* map_color, by abs(height) */
   Colormap colormap;
   Screen *screen;
   int ncolors;
@@ -84,6 +94,15 @@ struct state {
   int gshift;
   int bshift;
 
+  /* bright_lut[c][v + dx + bright_range] is channel c of a pixel whose
+     value in that channel is v, brightened by dx. */
+  unsigned long *bright_lut[3];
+  int bright_range;
+
+  /* gray_lut[r + g + b] is the gray pixel, when the masks are all the
+     same size. */
+  unsigned long *gray_lut;
+
   double stir_ang;
 
   int draw_toggle;
@@ -93,11 +112,20 @@ struct state {
   int duration;
   time_t start_time;
 
-  void (*draw_transparent) (struct state *st, short *src);
+  void (*draw_transparent) (struct state *st, short *src, int down);
 
   async_load_state *img_loader;
 
   XShmSegmentInfo shm_info;
+
+  struct threadpool threadpool;
+  int phase;
+  short *src, *dest;
+};
+
+struct ripples_thread {
+  struct state *st;
+  unsigned id;
 };
 
 
@@ -106,8 +134,6 @@ static const double drop_dist[] =
   {0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.2, 0.6};
 
 
-/* How hard to hit the water */
-#define SPLASH 512
 #undef  MIN
 #define MIN(x, y) ((x) < (y) ? (x) : (y))
 #undef  MAX
@@ -132,23 +158,47 @@ static int
 map_color(struct state *st, int grey)
 {
   /* Clip it */
-  grey = st->ncolors * abs(grey) / (SPLASH/4);
-  if (grey > st->ncolors)
-    grey = st->ncolors;
+  grey = abs(grey);
+  if (grey > SPLASH/4)
+    grey = SPLASH/4;
 
   /* Display it */
-  return st->ctab[grey];
+  return st->ripple_lut[grey];
 }
 
 
+/* The ripples are computed at half resolution, and each cell of the height
+   field becomes 2x2 pixels.  When both images are 32 bits per pixel in our
+   own byte order, read and write the pixels directly.
+ */
+static unsigned long
+get_pixel(struct state *st, int x, int y)
+{
+  if (st->fast32)
+    return ((unsigned int *) (st->orig_map->data +
+                        y * st->orig_map->bytes_per_line))[x];
+  return XGetPixel(st->orig_map, x, y);
+}
+
 static void
-draw_ripple(struct state *st, short *src)
+put_pixel(struct state *st, int x, int y, unsigned long p)
 {
-  int across, down;
-  char *dirty = st->dirty_buffer;
+  if (st->fast32)
+    ((unsigned int *) (st->buffer_map->data +
+                 y * st->buffer_map->bytes_per_line))[x] = p;
+  else
+    XPutPixel(st->buffer_map, x, y, p);
+}
+
 
-  for (down = 0; down < st->height - 1; down++, src += 1, dirty += 1)
-    for (across = 0; across < st->width - 1; across++, src++, dirty++) {
+static void
+draw_ripple(struct state *st, short *src, int down)
+{
+  int across;
+  char *dirty = st->dirty_buffer + down * st->width;
+
+  src += down * st->width;
+  for (across = 0; across < st->width - 1; across++, src++, dirty++) {
       int v1, v2, v3, v4;
       v1 = (int)*src;
       v2 = (int)*(src + 1);
@@ -166,10 +216,10 @@ draw_ripple(struct state *st, short *src)
           dx = ((v3 - v1) + (v4 - v2)) << st->light; /* light from top */
         } else
           dx = 0;
-        XPutPixel(st->buffer_map,(across<<1),  (down<<1),  map_color(st, dx + v1));
-        XPutPixel(st->buffer_map,(across<<1)+1,(down<<1),  map_color(st, dx + ((v1 + v2) >> 1)));
-        XPutPixel(st->buffer_map,(across<<1),  (down<<1)+1,map_color(st, dx + ((v1 + v3) >> 1)));
-        XPutPixel(st->buffer_map,(across<<1)+1,(down<<1)+1,map_color(st, dx + ((v1 + v4) >> 1)));
+        put_pixel(st,(across<<1),  (down<<1),  map_color(st, dx + v1));
+        put_pixel(st,(across<<1)+1,(down<<1),  map_color(st, dx + ((v1 + v2) >> 1)));
+        put_pixel(st,(across<<1),  (down<<1)+1,map_color(st, dx + ((v1 + v3) >> 1)));
+        put_pixel(st,(across<<1)+1,(down<<1)+1,map_color(st, dx + ((v1 + v4) >> 1)));
       }
     }
 }
@@ -180,58 +230,57 @@ draw_ripple(struct state *st, short *src)
 
 /* Uses the horizontal gradient as an offset to create a warp effect  */
 static void
-draw_transparent_vanilla(struct state *st, short *src)
+draw_transparent_vanilla(struct state *st, short *src, int down)
 {
-  int across, down, pixel;
+  int across, pixel;
   char *dirty = st->dirty_buffer;
 
-  pixel = 0;
-  for (down = 0; down < st->height - 2; down++, pixel += 2)
-    for (across = 0; across < st->width-2; across++, pixel++) {
-      int gradx, grady, gradx1, grady1;
-      int x0, x1, x2, y1, y2;
-
-      x0 = src[pixel];
-      x1 = src[pixel + 1];
-      x2 = src[pixel + 2];
-      y1 = src[pixel + st->width];
-      y2 = src[pixel + 2*st->width];
-
-      gradx = (x1 - x0);
-      grady = (y1 - x0);
-      gradx1= (x2 - x1);
-      grady1= (y2 - y1);
-      gradx1 = 1 + (gradx + gradx1) / 2;
-      grady1 = 1 + (grady + grady1) / 2;
-
-      if ((2*across+MIN(gradx,gradx1) < 0) ||
-          (2*across+MAX(gradx,gradx1) >= st->bigwidth)) {
-        gradx = 0;
-        gradx1= 1;
-      }
-      if ((2*down+MIN(grady,grady1) < 0) ||
-          (2*down+MAX(grady,grady1) >= st->bigheight)) {
-        grady = 0;
-        grady1 = 1;
-      }
-
-      if ((gradx == 0 && gradx1 == 1 && grady == 0 && grady1 == 1)) {
-        if (dirty[pixel] > 0)
-          dirty[pixel]--;
-      } else
-        dirty[pixel] = DIRTY;
+  pixel = down * st->width;
+  for (across = 0; across < st->width-2; across++, pixel++) {
+    int gradx, grady, gradx1, grady1;
+    int x0, x1, x2, y1, y2;
+
+    x0 = src[pixel];
+    x1 = src[pixel + 1];
+    x2 = src[pixel + 2];
+    y1 = src[pixel + st->width];
+    y2 = src[pixel + 2*st->width];
+
+    gradx = (x1 - x0);
+    grady = (y1 - x0);
+    gradx1= (x2 - x1);
+    grady1= (y2 - y1);
+    gradx1 = 1 + (gradx + gradx1) / 2;
+    grady1 = 1 + (grady + grady1) / 2;
+
+    if ((2*across+MIN(gradx,gradx1) < 0) ||
+        (2*across+MAX(gradx,gradx1) >= st->bigwidth)) {
+      gradx = 0;
+      gradx1= 1;
+    }
+    if ((2*down+MIN(grady,grady1) < 0) ||
+        (2*down+MAX(grady,grady1) >= st->bigheight)) {
+      grady = 0;
+      grady1 = 1;
+    }
 
-      if (dirty[pixel] > 0) {
-        XPutPixel(st->buffer_map, (across<<1),  (down<<1),
-                  grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx, (down<<1) + grady)));
-        XPutPixel(st->buffer_map, (across<<1)+1,(down<<1),
-                  grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx1,(down<<1) + grady)));
-        XPutPixel(st->buffer_map, (across<<1),  (down<<1)+1,
-                  grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx, (down<<1) + grady1)));
-        XPutPixel(st->buffer_map, (across<<1)+1,(down<<1)+1,
-                  grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx1,(down<<1) + grady1)));
-      }
+    if ((gradx == 0 && gradx1 == 1 && grady == 0 && grady1 == 1)) {
+      if (dirty[pixel] > 0)
+        dirty[pixel]--;
+    } else
+      dirty[pixel] = DIRTY;
+
+    if (dirty[pixel] > 0) {
+      put_pixel(st, (across<<1),  (down<<1),
+                grayscale(st, get_pixel(st, (across<<1) + gradx, (down<<1) + grady)));
+      put_pixel(st, (across<<1)+1,(down<<1),
+                grayscale(st, get_pixel(st, (across<<1) + gradx1,(down<<1) + grady)));
+      put_pixel(st, (across<<1),  (down<<1)+1,
+                grayscale(st, get_pixel(st, (across<<1) + gradx, (down<<1) + grady1)));
+      put_pixel(st, (across<<1)+1,(down<<1)+1,
+                grayscale(st, get_pixel(st, (across<<1) + gradx1,(down<<1) + grady1)));
     }
+  }
 }
 
 
@@ -268,9 +317,40 @@ cadd(unsigned long color, int dx, unsigned long mask, int shift)
 static unsigned long
 bright(struct state *st, int dx, unsigned long color)
 {
-  return (cadd(color, dx, st->rmask, st->rshift) |
-          cadd(color, dx, st->gmask, st->gshift) |
-          cadd(color, dx, st->bmask, st->bshift));
+  int r = st->bright_range;
+  if (dx >  r) dx =  r;
+  if (dx < -r) dx = -r;
+  dx += r;
+  return (st->bright_lut[0][((color >> st->rshift) & st->rmask) + dx] |
+          st->bright_lut[1][((color >> st->gshift) & st->gmask) + dx] |
+          st->bright_lut[2][((color >> st->bshift) & st->bmask) + dx]);
+}
+
+
+/* One table per channel, of that channel brightened by every amount that
+   can make a difference. */
+static void
+init_bright_lut(struct state *st)
+{
+  unsigned long masks[3];
+  int shifts[3];
+  int c, i, r;
+
+  masks[0] = st->rmask; shifts[0] = st->rshift;
+  masks[1] = st->gmask; shifts[1] = st->gshift;
+  masks[2] = st->bmask; shifts[2] = st->bshift;
+  r = st->bright_range = MAX(MAX(masks[0], masks[1]), masks[2]) + 1;
+
+  for (c = 0; c < 3; c++) {
+    st->bright_lut[c] = (unsigned long *)
+      malloc(3 * r * sizeof(*st->bright_lut[c]));
+    if (!st->bright_lut[c]) {
+      fprintf(stderr, "%s: out of memory\n", progname);
+      exit(1);
+    }
+    for (i = 0; i < 3 * r; i++)
+      st->bright_lut[c][i] = cadd(0, i - r, masks[c], shifts[c]);
+  }
 }
 
 
@@ -292,6 +372,11 @@ grayscale(struct state *st, unsigned long color)
   if ((st->rmask == 0) || (st->gmask == 0) || (st->bmask == 0))
     return color;
 
+  if (st->gray_lut)
+    return st->gray_lut[((color >> st->rshift) & st->rmask) +
+                        ((color >> st->gshift) & st->gmask) +
+                        ((color >> st->bshift) & st->bmask)];
+
   red = ((color >> st->rshift) & st->rmask);
   green =  ((color >> st->gshift) & st->gmask);
   blue =  ((color >> st->bshift) & st->bmask);
@@ -320,79 +405,98 @@ grayscale(struct state *st, unsigned long color)
 }
 
 
+/* With the same number of bits in each channel, the gray level is just
+   the average of the three. */
 static void
-draw_transparent_light(struct state *st, short *src)
+init_gray_lut(struct state *st)
 {
-  int across, down, pixel;
-  char *dirty = st->dirty_buffer;
-
-  pixel = 0;
-  for (down = 0; down < st->height - 2; down++, pixel += 2)
-    for (across = 0; across < st->width-2; across++, pixel++) {
-      int gradx, grady, gradx1, grady1;
-      int x0, x1, x2, y1, y2;
-
-      x0 = src[pixel];
-      x1 = src[pixel + 1];
-      x2 = src[pixel + 2];
-      y1 = src[pixel + st->width];
-      y2 = src[pixel + 2*st->width];
-
-      gradx = (x1 - x0);
-      grady = (y1 - x0);
-      gradx1= (x2 - x1);
-      grady1= (y2 - y1);
-      gradx1 = 1 + (gradx + gradx1) / 2;
-      grady1 = 1 + (grady + grady1) / 2;
-
-      if ((2*across+MIN(gradx,gradx1) < 0) ||
-          (2*across+MAX(gradx,gradx1) >= st->bigwidth)) {
-        gradx = 0;
-        gradx1= 1;
-      }
-      if ((2*down+MIN(grady,grady1) < 0) ||
-          (2*down+MAX(grady,grady1) >= st->bigheight)) {
-        grady = 0;
-        grady1 = 1;
-      }
+  int i;
+  if (st->rmask == 0 || st->rmask != st->gmask || st->rmask != st->bmask)
+    return;
+  st->gray_lut = (unsigned long *)
+    malloc((3 * st->rmask + 1) * sizeof(*st->gray_lut));
+  if (!st->gray_lut) return;
+  for (i = 0; i <= 3 * st->rmask; i++) {
+    unsigned long g = i / 3;
+    st->gray_lut[i] = ((g << st->rshift) |
+                       (g << st->gshift) |
+                       (g << st->bshift));
+  }
+}
 
-      if ((gradx == 0 && gradx1 == 1 && grady == 0 && grady1 == 1)) {
-        if (dirty[pixel] > 0)
-          dirty[pixel]--;
-      } else
-        dirty[pixel] = DIRTY;
 
-      if (dirty[pixel] > 0) {
-        int dx;
+static void
+draw_transparent_light(struct state *st, short *src, int down)
+{
+  int across, pixel;
+  char *dirty = st->dirty_buffer;
 
-        /* light from top */
-        if (4-st->light >= 0)
-          dx = (grady + (src[pixel+st->width+1]-x1)) >> (4-st->light);
-        else
-          dx = (grady + (src[pixel+st->width+1]-x1)) << (st->light-4);
+  pixel = down * st->width;
+  for (across = 0; across < st->width-2; across++, pixel++) {
+    int gradx, grady, gradx1, grady1;
+    int x0, x1, x2, y1, y2;
+
+    x0 = src[pixel];
+    x1 = src[pixel + 1];
+    x2 = src[pixel + 2];
+    y1 = src[pixel + st->width];
+    y2 = src[pixel + 2*st->width];
+
+    gradx = (x1 - x0);
+    grady = (y1 - x0);
+    gradx1= (x2 - x1);
+    grady1= (y2 - y1);
+    gradx1 = 1 + (gradx + gradx1) / 2;
+    grady1 = 1 + (grady + grady1) / 2;
+
+    if ((2*across+MIN(gradx,gradx1) < 0) ||
+        (2*across+MAX(gradx,gradx1) >= st->bigwidth)) {
+      gradx = 0;
+      gradx1= 1;
+    }
+    if ((2*down+MIN(grady,grady1) < 0) ||
+        (2*down+MAX(grady,grady1) >= st->bigheight)) {
+      grady = 0;
+      grady1 = 1;
+    }
 
-        if (dx != 0) {
-          XPutPixel(st->buffer_map, (across<<1),  (down<<1),
-                    bright(st, dx, grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx, (down<<1) + grady))));
-          XPutPixel(st->buffer_map, (across<<1)+1,(down<<1),
-                    bright(st, dx, grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx1,(down<<1) + grady))));
-          XPutPixel(st->buffer_map, (across<<1),  (down<<1)+1,
-                    bright(st, dx, grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx, (down<<1) + grady1))));
-          XPutPixel(st->buffer_map, (across<<1)+1,(down<<1)+1,
-                    bright(st, dx, grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx1,(down<<1) + grady1))));
-        } else {
-          /* Could use XCopyArea, but XPutPixel is faster */
-          XPutPixel(st->buffer_map, (across<<1),  (down<<1),
-                    grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx, (down<<1) + grady)));
-          XPutPixel(st->buffer_map, (across<<1)+1,(down<<1),
-                    grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx1,(down<<1) + grady)));
-          XPutPixel(st->buffer_map, (across<<1),  (down<<1)+1,
-                    grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx, (down<<1) + grady1)));
-          XPutPixel(st->buffer_map, (across<<1)+1,(down<<1)+1,
-                    grayscale(st, XGetPixel(st->orig_map, (across<<1) + gradx1,(down<<1) + grady1)));
-        }
+    if ((gradx == 0 && gradx1 == 1 && grady == 0 && grady1 == 1)) {
+      if (dirty[pixel] > 0)
+        dirty[pixel]--;
+    } else
+      dirty[pixel] = DIRTY;
+
+    if (dirty[pixel] > 0) {
+      int dx;
+
+      /* light from top */
+      if (4-st->light >= 0)
+        dx = (grady + (src[pixel+st->width+1]-x1)) >> (4-st->light);
+      else
+        dx = (grady + (src[pixel+st->width+1]-x1)) << (st->light-4);
+
+      if (dx != 0) {
+        put_pixel(st, (across<<1),  (down<<1),
+                  bright(st, dx, grayscale(st, get_pixel(st, (across<<1) + gradx, (down<<1) + grady))));
+        put_pixel(st, (across<<1)+1,(down<<1),
+                  bright(st, dx, grayscale(st, get_pixel(st, (across<<1) + gradx1,(down<<1) + grady))));
+        put_pixel(st, (across<<1),  (down<<1)+1,
+                  bright(st, dx, grayscale(st, get_pixel(st, (across<<1) + gradx, (down<<1) + grady1))));
+        put_pixel(st, (across<<1)+1,(down<<1)+1,
+                  bright(st, dx, grayscale(st, get_pixel(st, (across<<1) + gradx1,(down<<1) + grady1))));
+      } else {
+        /* Could use XCopyArea, but XPutPixel is faster */
+        put_pixel(st, (across<<1),  (down<<1),
+                  grayscale(st, get_pixel(st, (across<<1) + gradx, (down<<1) + grady)));
+        put_pixel(st, (across<<1)+1,(down<<1),
+                  grayscale(st, get_pixel(st, (across<<1) + gradx1,(down<<1) + grady)));
+        put_pixel(st, (across<<1),  (down<<1)+1,
+                  grayscale(st, get_pixel(st, (across<<1) + gradx, (down<<1) + grady1)));
+        put_pixel(st, (across<<1)+1,(down<<1)+1,
+                  grayscale(st, get_pixel(st, (across<<1) + gradx1,(down<<1) + grady1)));
       }
     }
+  }
 }
 
 
@@ -794,6 +898,15 @@ init_ripples(struct state *st, int ndrops, int splash)
 
   st->dirty_buffer = (char *)calloc(st->width * st->height, sizeof(*st->dirty_buffer));
 
+  {
+    unsigned int local_order = (MSBFirst << 24) | (LSBFirst << 0);
+    st->fast32 = (st->buffer_map->bits_per_pixel == 32 &&
+                  st->buffer_map->byte_order == *(char *) &local_order &&
+                  (!st->transparent ||
+                   (st->orig_map->bits_per_pixel == 32 &&
+                    st->orig_map->byte_order == st->buffer_map->byte_order)));
+  }
+
   for (i = 0; i < ndrops; i++)
     add_drop(st, ripple_blob, splash);
 
@@ -861,65 +974,142 @@ init_ripples(struct state *st, int ndrops, int splash)
  n>4 (eg 8 or 12) more fluid, waves die out slowly
  */
 
+/* The rows of the height field are divided among the threads in bands.
+   Every cell of the new field only depends on the old one, so the bands
+   don't interact, except that smoothing needs the whole of `temp' to be
+   done first.  The inner loops are straight-line integer arithmetic on
+   arrays of shorts, which the compiler can vectorize.
+ */
+
 static void
-ripple(struct state *st)
+wave_row(short *out, const short *src, const short *dest, int w, int n)
 {
-  int across, down, pixel;
-  short *src, *dest;
+  int i;
+  for (i = 0; i < n; i++)
+    out[i] = (((src[i - 1] + src[i + 1] +
+                src[i - w] + src[i + w]) / 2)) - dest[i];
+}
 
+static void
+damped_wave_row(short *dest, const short *src, int w, int n, int fluidity)
+{
+  int i;
+  for (i = 0; i < n; i++) {
+    int damp = (((src[i - 1] + src[i + 1] +
+                  src[i - w] + src[i + w]) / 2)) - dest[i];
+    dest[i] = damp - (damp >> fluidity);
+  }
+}
+
+static void
+smooth_row(short *dest, const short *temp, int w, int n, int fluidity)
+{
+  int i;
+  for (i = 0; i < n; i++) {
+    int damp =
+      (temp[i - 1] + temp[i + 1] +
+       temp[i - w] + temp[i + w] +
+       temp[i - w - 1] + temp[i - w + 1] +
+       temp[i + w - 1] + temp[i + w + 1] +
+       temp[i]) / 9;
+    /* Close enough for government work */
+    dest[i] = (temp[i] != 0 ? damp - (damp >> fluidity) : 0);
+  }
+}
+
+
+static int
+ripples_thread_create(void *self, struct threadpool *pool, unsigned id)
+{
+  struct ripples_thread *t = (struct ripples_thread *) self;
+  t->st = GET_PARENT_OBJ(struct state, threadpool, pool);
+  t->id = id;
+  return 0;
+}
+
+static void
+ripples_thread_destroy(void *self)
+{
+}
+
+static void
+ripples_thread_run(void *self)
+{
+  struct ripples_thread *t = (struct ripples_thread *) self;
+  struct state *st = t->st;
+  int w = st->width;
+  int lo, hi, n, y0, y1, down;
+
+  if (st->phase == PHASE_DRAW) {
+    lo = 0;
+    hi = st->height - (st->transparent ? 2 : 1);
+  } else {
+    lo = 1;
+    hi = st->height - 1;
+  }
+  n = hi - lo;
+  y0 = lo + n * t->id       / st->threadpool.count;
+  y1 = lo + n * (t->id + 1) / st->threadpool.count;
+
+  for (down = y0; down < y1; down++) {
+    int p = down * w + 1;
+    switch (st->phase) {
+    case PHASE_TEMP:
+      wave_row(st->temp + p, st->src + p, st->dest + p, w, w - 2);
+      break;
+    case PHASE_SMOOTH:
+      smooth_row(st->dest + p, st->temp + p, w, w - 2, st->fluidity);
+      break;
+    case PHASE_WAVE:
+      damped_wave_row(st->dest + p, st->src + p, w, w - 2, st->fluidity);
+      break;
+    case PHASE_DRAW:
+      if (st->transparent)
+        st->draw_transparent(st, st->dest, down);
+      else
+        draw_ripple(st, st->dest, down);
+      break;
+    default:
+      abort();
+    }
+  }
+}
+
+static void
+run_phase(struct state *st, int phase)
+{
+  st->phase = phase;
+  threadpool_run(&st->threadpool, ripples_thread_run);
+  threadpool_wait(&st->threadpool);
+}
+
+
+static void
+ripple(struct state *st)
+{
   if (st->draw_toggle == 0) {
-    src = st->bufferA;
-    dest = st->bufferB;
+    st->src = st->bufferA;
+    st->dest = st->bufferB;
     st->draw_toggle = 1;
   } else {
-    src = st->bufferB;
-    dest = st->bufferA;
+    st->src = st->bufferB;
+    st->dest = st->bufferA;
     st->draw_toggle = 0;
   }
 
   switch (st->draw_count) {
   case 0: case 1:
-    pixel = 1 * st->width + 1;
-    for (down = 1; down < st->height - 1; down++, pixel += 2 * 1)
-      for (across = 1; across < st->width - 1; across++, pixel++) {
-        st->temp[pixel] =
-          (((src[pixel - 1] + src[pixel + 1] +
-             src[pixel - st->width] + src[pixel + st->width]) / 2)) - dest[pixel];
-      }
-
+    run_phase(st, PHASE_TEMP);
     /* Smooth the output */
-    pixel = 1 * st->width + 1;
-    for (down = 1; down < st->height - 1; down++, pixel += 2 * 1)
-      for (across = 1; across < st->width - 1; across++, pixel++) {
-        if (st->temp[pixel] != 0) { /* Close enough for government work */
-          int damp =
-            (st->temp[pixel - 1] + st->temp[pixel + 1] +
-             st->temp[pixel - st->width] + st->temp[pixel + st->width] +
-             st->temp[pixel - st->width - 1] + st->temp[pixel - st->width + 1] +
-             st->temp[pixel + st->width - 1] + st->temp[pixel + st->width + 1] +
-             st->temp[pixel]) / 9;
-          dest[pixel] = damp - (damp >> st->fluidity);
-        } else
-          dest[pixel] = 0;
-      }
+    run_phase(st, PHASE_SMOOTH);
     break;
   case 2: case 3:
-    pixel = 1 * st->width + 1;
-    for (down = 1; down < st->height - 1; down++, pixel += 2 * 1)
-      for (across = 1; across < st->width - 1; across++, pixel++) {
-        int damp =
-          (((src[pixel - 1] + src[pixel + 1] +
-             src[pixel - st->width] + src[pixel + st->width]) / 2)) - dest[pixel];
-        dest[pixel] = damp - (damp >> st->fluidity);
-      }
+    run_phase(st, PHASE_WAVE);
     break;
   }
   if (++st->draw_count > 3) st->draw_count = 0;
 
-  if (st->transparent)
-    st->draw_transparent(st, dest);
-  else
-    draw_ripple(st, dest);
+  run_phase(st, PHASE_DRAW);
 }
 
 
@@ -952,6 +1142,20 @@ ripples_init (Display *disp, Window win)
   init_cos_tab(st);
   setup_X(st);
 
+  {
+    static const struct threadpool_class cls = {
+      sizeof(struct ripples_thread),
+      ripples_thread_create,
+      ripples_thread_destroy
+    };
+    int err = threadpool_create(&st->threadpool, &cls, disp,
+                                hardware_concurrency(disp));
+    if (err) {
+      fprintf(stderr, "%s: threadpool: %s\n", progname, strerror(err));
+      exit(1);
+    }
+  }
+
   st->ncolors = get_integer_resource (disp, "colors", "Colors");
   if (0 == st->ncolors)		/* English spelling? */
     st->ncolors = get_integer_resource (disp, "colours", "Colors");
@@ -964,6 +1168,13 @@ ripples_init (Display *disp, Window win)
   else
     init_linear_colors(st);
 
+  {
+    int i;
+    for (i = 0; i <= SPLASH/4; i++)
+      st->ripple_lut[i] = st->ctab[MIN(st->ncolors,
+                                       st->ncolors * i / (SPLASH/4))];
+  }
+
   if (st->transparent && st->light > 0) {
     int maxbits;
     st->draw_transparent = draw_transparent_light;
@@ -973,6 +1184,8 @@ ripples_init (Display *disp, Window win)
     set_mask(&st->gmask, &st->gshift);
     set_mask(&st->bmask, &st->bshift);
     if (st->rmask == 0) st->draw_transparent = draw_transparent_vanilla;
+    else init_bright_lut(st);
+    if (st->grayscale_p) init_gray_lut(st);
 
     /* Adjust the shift value "light" when we don't have 8 bits per colour */
     maxbits = MIN(MIN(BITCOUNT(st->rmask), BITCOUNT(st->gmask)), BITCOUNT(st->bmask));
@@ -986,6 +1199,7 @@ ripples_init (Display *disp, Window win)
       set_mask(&st->rmask, &st->rshift);
       set_mask(&st->gmask, &st->gshift);
       set_mask(&st->bmask, &st->bshift);
+      init_gray_lut(st);
     }
     st->draw_transparent = draw_transparent_vanilla;
   }
@@ -1065,6 +1279,11 @@ static void
 ripples_free (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
+  int i;
+  threadpool_destroy (&st->threadpool);
+  for (i = 0; i < 3; i++)
+    if (st->bright_lut[i]) free (st->bright_lut[i]);
+  if (st->gray_lut) free (st->gray_lut);
   if (st->bufferA) free (st->bufferA);
   if (st->bufferB) free (st->bufferB);
   if (st->temp) free (st->temp);
@@ -1091,6 +1310,7 @@ static const char *ripples_defaults[] =
   "*fluidity: 		6",
   "*light: 		4",
   "*grayscale: 		False",
+  THREAD_DEFAULTS
 #ifdef HAVE_XSHM_EXTENSION
   "*useSHM: True",
 #else
@@ -1119,6 +1339,7 @@ static XrmOptionDescRec ripples_options[] =
   {"-grayscale",	".grayscale",	XrmoptionNoArg, "True"},
   {"-shm",	".useSHM",	XrmoptionNoArg, "True"},
   {"-no-shm",	".useSHM",	XrmoptionNoArg, "False"},
+  THREAD_OPTIONS
   {0, 0, 0, 0}
 };
 
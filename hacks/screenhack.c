@@ -120,12 +120,14 @@
 #define DEBUG_PAIR
 
 #include <stdio.h>
+#include <signal.h>
 #include <X11/Intrinsic.h>
 #include <X11/IntrinsicP.h>
 #include <X11/CoreP.h>
 #include <X11/Shell.h>
 #include <X11/StringDefs.h>
 #include <X11/keysym.h>
+#include <X11/Xlibint.h>	/* for XESetBeforeFlush */
 
 #ifdef __sgi
 # include <X11/SGIScheme.h>	/* for SgiUseSchemes() */
@@ -175,6 +177,8 @@ static XrmOptionDescRec default_options [] = {
   { "-window-id", ".windowID",		XrmoptionSepArg, 0 },
   { "-fps",	".doFPS",		XrmoptionNoArg, "True" },
   { "-no-fps",  ".doFPS",		XrmoptionNoArg, "False" },
+  { "-seed",	".randomSeed",		XrmoptionSepArg, 0 },
+  { "-x-traffic", ".xTraffic",		XrmoptionNoArg, "True" },
 
 # ifdef DEBUG_PAIR
   { "-pair",	".pair",		XrmoptionNoArg, "True" },
@@ -195,6 +199,8 @@ static char *default_defaults[] = {
   "*mono:		false",
   "*installColormap:	false",
   "*doFPS:		false",
+  "*randomSeed:		0",
+  "*xTraffic:		false",
   "*multiSample:	false",
   "*visualID:		default",
   "*windowID:		",
@@ -525,6 +531,166 @@ screenhack_table_handle_events (Display *dpy,
 }
 
 
+/* With -x-traffic, count the X requests, bytes and round trips that each
+   frame generates, show them under the frame rate, and print a summary on
+   exit.  This is for finding out which hacks are usable over a slow remote
+   X connection.
+
+   Requests are counted from the request sequence number, and bytes by a
+   hook that Xlib calls each time it writes its output buffer.  Round trips
+   are counted by an "after function", which Xlib calls at the end of each
+   request: if the last reply read was to the request just sent, it waited
+   for that reply.  That count is approximate: a call that waits for two
+   replies (XGetWindowAttributes) counts once, and an event that happens to
+   carry the same sequence number counts as a round trip.
+   Requests that a library sends through XCB directly (e.g. GLX) are
+   numbered but not hooked, so their bytes and round trips are missed.
+
+   Only draw_cb is measured: not the fps display, nor the XSync and event
+   handling between frames.  SIGINT and SIGTERM make it exit cleanly after
+   the current frame, so that the summary is still printed.
+ */
+typedef struct {
+  unsigned long requests, bytes, round_trips;
+} x_traffic;
+
+static struct {
+  Bool on_p;
+  pid_t pid;
+  int (*old_after) (Display *);
+
+  unsigned long bytes, round_trips;	/* running counts, from the hooks */
+  unsigned long last_read;		/* LastKnownRequestProcessed */
+
+  unsigned long frames;			/* since startup */
+  x_traffic total, max;
+
+  unsigned long window_frames;		/* since the fps display changed */
+  x_traffic window;
+  time_t window_start;
+} xtraffic;
+
+static volatile sig_atomic_t xtraffic_quit_p;
+
+
+static void
+xtraffic_before_flush (Display *dpy, XExtCodes *codes,
+                       const char *data, long len)
+{
+  xtraffic.bytes += len;
+}
+
+
+static int
+xtraffic_after (Display *dpy)
+{
+  unsigned long read = LastKnownRequestProcessed (dpy);
+  if (read != xtraffic.last_read && read == NextRequest (dpy) - 1)
+    xtraffic.round_trips++;
+  xtraffic.last_read = read;
+  return (xtraffic.old_after ? xtraffic.old_after (dpy) : 0);
+}
+
+
+static void
+xtraffic_report (void)
+{
+  double n = (xtraffic.frames ? xtraffic.frames : 1);
+
+  if (getpid() != xtraffic.pid)  /* a forked child exiting */
+    return;
+
+  fprintf (stderr, "%s: X traffic over %lu frames:\n"
+           "%s:   requests:    %10.1f per frame, max %lu, total %lu\n"
+           "%s:   bytes:       %10.1f per frame, max %lu, total %lu\n"
+           "%s:   round trips: %10.2f per frame, max %lu, total %lu\n",
+           progname, xtraffic.frames,
+           progname, xtraffic.total.requests / n,
+           xtraffic.max.requests, xtraffic.total.requests,
+           progname, xtraffic.total.bytes / n,
+           xtraffic.max.bytes, xtraffic.total.bytes,
+           progname, xtraffic.total.round_trips / n,
+           xtraffic.max.round_trips, xtraffic.total.round_trips);
+}
+
+
+static void
+xtraffic_signal (int sig)
+{
+  xtraffic_quit_p = 1;
+}
+
+
+static void
+xtraffic_init (Display *dpy)
+{
+  XExtCodes *codes = XAddExtension (dpy);
+  XESetBeforeFlush (dpy, codes->extension, xtraffic_before_flush);
+  xtraffic.old_after = XSetAfterFunction (dpy, xtraffic_after);
+  xtraffic.last_read = LastKnownRequestProcessed (dpy);
+  xtraffic.window_start = time ((time_t *) 0);
+  xtraffic.pid = getpid();
+  xtraffic.on_p = True;
+  atexit (xtraffic_report);
+  signal (SIGINT,  xtraffic_signal);
+  signal (SIGTERM, xtraffic_signal);
+}
+
+
+static void
+xtraffic_start_frame (Display *dpy, x_traffic *start)
+{
+  XFlush (dpy);  /* so that what was already queued doesn't count */
+  xtraffic.last_read = LastKnownRequestProcessed (dpy);  /* XSync'ed */
+  start->requests    = NextRequest (dpy);
+  start->bytes       = xtraffic.bytes;
+  start->round_trips = xtraffic.round_trips;
+}
+
+
+static void
+xtraffic_end_frame (Display *dpy, const x_traffic *start, fps_state *fpst)
+{
+  x_traffic f;
+  time_t now;
+
+  XFlush (dpy);
+  f.requests    = NextRequest (dpy) - start->requests;
+  f.bytes       = xtraffic.bytes - start->bytes;
+  f.round_trips = xtraffic.round_trips - start->round_trips;
+
+# define ADD(FIELD) \
+    xtraffic.total.FIELD  += f.FIELD; \
+    xtraffic.window.FIELD += f.FIELD; \
+    if (f.FIELD > xtraffic.max.FIELD) xtraffic.max.FIELD = f.FIELD
+  ADD (requests);
+  ADD (bytes);
+  ADD (round_trips);
+# undef ADD
+  xtraffic.frames++;
+  xtraffic.window_frames++;
+
+  /* Update the fps display about once a second. */
+  now = time ((time_t *) 0);
+  if (now != xtraffic.window_start)
+    {
+      if (fpst)
+        {
+          double n = xtraffic.window_frames;
+          char buf[100];
+          sprintf (buf, "Reqs:  %.1f \nBytes: %.0f \nRTTs:  %.2f ",
+                   xtraffic.window.requests / n,
+                   xtraffic.window.bytes / n,
+                   xtraffic.window.round_trips / n);
+          fps_extra (fpst, buf);
+        }
+      memset (&xtraffic.window, 0, sizeof(xtraffic.window));
+      xtraffic.window_frames = 0;
+      xtraffic.window_start = now;
+    }
+}
+
+
 static Boolean
 usleep_and_process_events (Display *dpy,
                            const struct xscreensaver_function_table *ft,
@@ -566,6 +732,9 @@ usleep_and_process_events (Display *dpy,
 #endif
                                           ))
       return False;
+
+    if (xtraffic_quit_p)
+      return False;
   } while (delay > 0);
 
   return True;
@@ -618,8 +787,13 @@ run_screenhack_table (Display *dpy,
 
   if (! fps_cb) fps_cb = screenhack_do_fps;
 
+  if (get_boolean_resource (dpy, "xTraffic", "Boolean"))
+    xtraffic_init (dpy);
+
   while (1)
     {
+      x_traffic start = { 0, 0, 0 };
+
       if (! usleep_and_process_events (dpy, ft,
                                        window, fpst, closure, delay
 #ifdef DEBUG_PAIR
@@ -631,7 +805,9 @@ run_screenhack_table (Display *dpy,
                                        ))
         break;
 
+      if (xtraffic.on_p) xtraffic_start_frame (dpy, &start);
       delay = ft->draw_cb (dpy, window, closure);
+      if (xtraffic.on_p) xtraffic_end_frame (dpy, &start, fpst);
 #ifdef DEBUG_PAIR
       delay2 = 0;
       if (window2) delay2 = ft->draw_cb (dpy, window2, closure2);
@@ -1022,9 +1198,10 @@ main (int argc, char **argv)
 
   /* This is the one and only place that the random-number generator is
      seeded in any screenhack.  You do not need to seed the RNG again,
-     it is done for you before your code is invoked. */
+     it is done for you before your code is invoked.  A nonzero
+     "-seed" makes the run repeatable, for benchmarking. */
 # undef ya_rand_init
-  ya_rand_init (0);
+  ya_rand_init (get_integer_resource (dpy, "randomSeed", "Integer"));
 
 
 #ifdef HAVE_RECORD_ANIM
@@ -39,6 +39,8 @@
 
 #include <math.h>
 #include "screenhack.h"
+#include "xshm.h"
+#include "pixwrite.h"
 
 /* #define VERBOSE */
 
@@ -52,6 +54,9 @@ static const char *shadebobs_defaults [] = {
   "*cycles:   10",
   "*ncolors:  64",    /* changing this doesn't work particularly well */
   "*delay:    10000",
+#ifdef HAVE_XSHM_EXTENSION
+  "*useSHM:   True",
+#endif
 #ifdef HAVE_MOBILE
   "*ignoreRotation: True",
 #endif
@@ -93,6 +98,9 @@ struct state {
   signed short iColorCount;
   int cycles;
   XImage *pImage;
+  XShmSegmentInfo shm_info;
+  pixel_lut lut;
+  unsigned char *aiIndex;	/* iWinWidth x iWinHeight color indexes */
   unsigned char nShadeBobCount, iShadeBob;
   SShadeBob *aShadeBobs;
   GC gc;
@@ -133,7 +141,7 @@ static void InitShadeBob( struct state *st, SShadeBob *pShadeBob, Bool bDark )
 			nDelta = 9 - ( ( sqrt( pow( iWidth+0.5, 2 ) + pow( iHeight+0.5, 2 ) ) / st->iBobRadius ) * 8 );
 			if( nDelta < 0 )  nDelta = 0;
 			if( bDark ) nDelta = -nDelta;
-			pShadeBob->anDeltaMap[ ( iWidth + st->iBobRadius ) * st->iBobDiameter + iHeight + st->iBobRadius ] = (char)nDelta;
+			pShadeBob->anDeltaMap[ ( iHeight + st->iBobRadius ) * st->iBobDiameter + iWidth + st->iBobRadius ] = (char)nDelta;
 		}
   
 	ResetShadeBob( st, pShadeBob );
@@ -174,43 +182,58 @@ static void MoveShadeBob( struct state *st, SShadeBob *pShadeBob )
 }
 
 
-static void Execute( struct state *st, SShadeBob *pShadeBob )
+/* Shades one rectangle of the window by the part of the delta map that
+ * starts at ( iBobX, iBobY ), and sends it to the screen.  The image holds
+ * color indexes rather than pixels, so no searching the palette. */
+static void ShadeRect( struct state *st, const signed char *anDeltaMap,
+                       int iX, int iY, int iBobX, int iBobY,
+                       int iWidth, int iHeight )
 {
-	unsigned long iColor;
-	short iColorVal;
-	int iPixelX, iPixelY;
-	unsigned int iWidth, iHeight;
+	int iRow, iCol;
+	int iMax = st->iColorCount - 1;
 
-	MoveShadeBob( st, pShadeBob );
-	
-	for( iHeight=0; iHeight<st->iBobDiameter; iHeight++ )
+	if( iWidth <= 0 || iHeight <= 0 )
+		return;
+
+	for( iRow=0; iRow<iHeight; iRow++ )
 	{
-		iPixelY = pShadeBob->nPosY + iHeight;
-		if( iPixelY >= st->iWinHeight )	iPixelY -= st->iWinHeight;
+		unsigned char *pIndex = st->aiIndex + ( iY + iRow ) * st->iWinWidth + iX;
+		const signed char *pDelta = anDeltaMap + ( iBobY + iRow ) * st->iBobDiameter + iBobX;
 
-		for( iWidth=0; iWidth<st->iBobDiameter; iWidth++ )
+		for( iCol=0; iCol<iWidth; iCol++ )
 		{
-			iPixelX = pShadeBob->nPosX + iWidth;
-			if( iPixelX >= st->iWinWidth )	iPixelX -= st->iWinWidth;
+			int iColorVal = pIndex[ iCol ] + pDelta[ iCol ];
+			pIndex[ iCol ] = ( iColorVal < 0 ? 0 : iColorVal > iMax ? iMax : iColorVal );
+		}
+	}
 
-			iColor = XGetPixel( st->pImage, iPixelX, iPixelY );
+	pixel_lut_expand( &st->lut, st->aiIndex + iY * st->iWinWidth + iX, st->iWinWidth,
+	                  iX, iY, iWidth, iHeight );
+	put_xshm_image( st->dpy, st->window, st->gc, st->pImage,
+	                iX, iY, iX, iY, iWidth, iHeight, &st->shm_info );
+}
 
-			/*  FIXME: Here is a loop I'd love to take out. */
-			for( iColorVal=0; iColorVal<st->iColorCount; iColorVal++ )
-				if( st->aiColorVals[ iColorVal ] == iColor )
-					break;
 
-			iColorVal += pShadeBob->anDeltaMap[ iWidth * st->iBobDiameter + iHeight ];
-			if( iColorVal >= st->iColorCount ) iColorVal = st->iColorCount - 1;
-			if( iColorVal < 0 )			   iColorVal = 0;
+static void Execute( struct state *st, SShadeBob *pShadeBob )
+{
+	int iX, iY, iWidth, iHeight;
+	int iDiameter = st->iBobDiameter;
 
-			XPutPixel( st->pImage, iPixelX, iPixelY, st->aiColorVals[ iColorVal ] );
-		}
-	}
+	MoveShadeBob( st, pShadeBob );
 
-	/* FIXME: if it's next to the top or left sides of screen this will break. However, it's not noticable. */
-	XPutImage( st->dpy, st->window, st->gc, st->pImage,
-             pShadeBob->nPosX, pShadeBob->nPosY, pShadeBob->nPosX, pShadeBob->nPosY, st->iBobDiameter, st->iBobDiameter );
+	/* The bob wraps around the edges of the screen, so it may be split
+	   into as many as four rectangles. */
+	iX = pShadeBob->nPosX;
+	iY = pShadeBob->nPosY;
+	iWidth  = st->iWinWidth  - iX;
+	iHeight = st->iWinHeight - iY;
+	if( iWidth  > iDiameter ) iWidth  = iDiameter;
+	if( iHeight > iDiameter ) iHeight = iDiameter;
+
+	ShadeRect( st, pShadeBob->anDeltaMap, iX, iY, 0,      0,       iWidth,             iHeight );
+	ShadeRect( st, pShadeBob->anDeltaMap, 0,  iY, iWidth, 0,       iDiameter - iWidth, iHeight );
+	ShadeRect( st, pShadeBob->anDeltaMap, iX, 0,  0,      iHeight, iWidth,             iDiameter - iHeight );
+	ShadeRect( st, pShadeBob->anDeltaMap, 0,  0,  iWidth, iHeight, iDiameter - iWidth, iDiameter - iHeight );
 }
 
 
@@ -326,12 +349,12 @@ static void Initialize( struct state *st )
 	/*  Create the GC. */
 	st->gc = XCreateGC( st->dpy, st->window, 0, &gcValues );
 
-	st->pImage = XCreateImage( st->dpy, XWinAttribs.visual, XWinAttribs.depth, ZPixmap, 0, NULL,
-							  XWinAttribs.width, XWinAttribs.height, 8 /*BitmapPad( st->dpy )*/, 0 );
-	st->pImage->data = calloc((st->pImage)->bytes_per_line, (st->pImage)->height);
+	st->pImage = create_xshm_image( st->dpy, XWinAttribs.visual, XWinAttribs.depth, ZPixmap,
+	                                &st->shm_info, XWinAttribs.width, XWinAttribs.height );
 
 	st->iWinWidth = XWinAttribs.width;
 	st->iWinHeight = XWinAttribs.height;
+	st->aiIndex = calloc( st->iWinWidth, st->iWinHeight );
 
 	/*  These are precalculations used in Execute(). */
 	st->iBobDiameter = ( ( st->iWinWidth < st->iWinHeight ) ? st->iWinWidth : st->iWinHeight ) / 25;
@@ -409,24 +432,16 @@ shadebobs_draw (Display *dpy, Window window, void *closure)
       XGetWindowAttributes( st->dpy, st->window, &XWinAttribs );
 
       st->draw_i = 0;
-#if 0
-      memset( st->pImage->data, 0, st->pImage->bytes_per_line * st->pImage->height );
-#else
-      {
-        /* fill the image with the actual value of the black pixel, not 0. */
-        unsigned long black = BlackPixelOfScreen (XWinAttribs.screen);
-        int x, y;
-        for (y = 0; y < XWinAttribs.height; y++)
-          for (x = 0; x < XWinAttribs.width; x++)
-            XPutPixel (st->pImage, x, y, black);
-      }
-#endif
+      /* Back to color 0, which is black.  The image is only ever sent
+         after the index buffer has been expanded into it. */
+      memset( st->aiIndex, 0, st->iWinWidth * st->iWinHeight );
 
       for( st->iShadeBob=0; st->iShadeBob<st->nShadeBobCount; st->iShadeBob++ )
         ResetShadeBob( st, &st->aShadeBobs[ st->iShadeBob ] );
       XFreeColors( st->dpy, XWinAttribs.colormap, st->aiColorVals, st->iColorCount, 0 );
       free( st->aiColorVals );
       st->aiColorVals = SetPalette( st );
+      pixel_lut_init( &st->lut, st->pImage, st->aiColorVals, st->iColorCount );
       XClearWindow( st->dpy, st->window );
     }
 
@@ -456,7 +471,8 @@ shadebobs_free (Display *dpy, Window window, void *closure)
 	free( st->anCosTable );
         if (st->sColor) free (st->sColor);
         XFreeGC (dpy, st->gc);
-	XDestroyImage( st->pImage );
+	destroy_xshm_image( dpy, st->pImage, &st->shm_info );
+	free( st->aiIndex );
 	for( st->iShadeBob=0; st->iShadeBob<st->nShadeBobCount; st->iShadeBob++ )
 		free( st->aShadeBobs[ st->iShadeBob ].anDeltaMap );
 	free( st->aShadeBobs );
@@ -221,6 +221,7 @@ typedef struct _ATTRACTOR {
 	int         Width, Height;
 	Pixmap      dbuf;	/* jwz */
 	GC          dbuf_gc;
+	ya_random_state Rnd;
 	#ifdef useAccumulator
 		int visualClass;
 		size_t alignedWidth;
@@ -243,7 +244,7 @@ static ATTRACTOR *Root = (ATTRACTOR *) NULL;
 #ifdef useAccumulator
 typedef struct _THREAD {
 	const ATTRACTOR *Attractor;
-	unsigned long Rnd;
+	ya_random_state Rnd;
 	size_t y0, y1, y2;
 
 	PIXEL0 **accMap;
@@ -479,18 +480,12 @@ free_strange(ModeInfo *mi)
 #endif
 }
 
-/* NRAND() is also in use; making three PRNGs in total here. */
-
-/* ISO/IEC 9899 suggests this one. Doesn't require 64-bit math. */
-#define GOODRND(seed) ((seed) = (((seed) * 1103515245 + 12345) & 0x7fffffff))
-#define GOODRND_BITS 31
-
-/* Extremely cheap entropy: this is often a single LEA instruction. */
-#define CHEAPRND(seed) ((seed) = (seed) * 5)
+/* Random jitter of -4 to 3 added to each point: the top 3 bits. */
+#define JITTER(r) ((PRM) ((r) >> 29) - 4)
 
 static void
 init_draw (const ATTRACTOR *A, PRM *x, PRM *y,
-           PRM *xmin, PRM *ymin, PRM *xmax, PRM *ymax, unsigned long *rnd)
+           PRM *xmin, PRM *ymin, PRM *xmax, PRM *ymax, ya_random_state *rnd)
 {
 	int         n;
 	PRM         xo, yo;
@@ -518,8 +513,8 @@ init_draw (const ATTRACTOR *A, PRM *x, PRM *y,
 		/* Can't use NRAND(), because that modifies global state in a
 		 * thread-unsafe way.
 		 */
-		*x = xo + (GOODRND(*rnd) >> (GOODRND_BITS - 3)) - 4;
-		*y = yo + (GOODRND(*rnd) >> (GOODRND_BITS - 3)) - 4;
+		*x = xo + JITTER(ya_random_r (rnd));
+		*y = yo + JITTER(ya_random_r (rnd));
 	}
 }
 
@@ -566,7 +561,7 @@ thread_create (void *Self_Raw, struct threadpool *pool, unsigned id)
 	T->Attractor = A;
 	A->threads[id] = T;
 
-	T->Rnd = random();
+	ya_random_init (&T->Rnd, id + 1);
 
 	/* The gap between y0 and y1 is to preheat the box blur. */
 	T->y1 = A->Height * id / pool->count;
@@ -623,7 +618,8 @@ points_thread (void *Self_Raw)
 	DBL         Lx, Ly;
 	PRM         iLx, iLy, cx, cy;
 	void        (*Iterate) (const ATTRACTOR *, PRM, PRM, PRM *, PRM *);
-	unsigned    Rnd;
+	unsigned    jitter[256];
+	unsigned    j = countof(jitter);
 	PRM         xmax, xmin, ymax, ymin;
 
 	Iterate = A->Iterate;
@@ -632,14 +628,9 @@ points_thread (void *Self_Raw)
 		memset (T->accMap[0], 0, sizeof(PIXEL0) * A->alignedWidth * A->Height);
 	}
 
-	/* Using CHEAPRND() by itself occasionally gets stuck at 0 mod 8, so seed it
-	 * from GOODRND().
-	 */
 	init_draw (A, &x, &y, &xmin, &ymin, &xmax, &ymax, &T->Rnd);
 	recalc_scale (A, xmin, ymin, xmax, ymax, &Lx, &Ly, &cx, &cy);
 
-	Rnd = GOODRND(T->Rnd);
-
 	iLx = Lx * (1 << L_Bits);
 	iLy = Ly * (1 << L_Bits);
 	if (!iLx) /* Can happen with small windows. */
@@ -671,9 +662,15 @@ points_thread (void *Self_Raw)
 		}
 		#endif
 
-		/* Skimp on the randomness. */
-		x = xo + (CHEAPRND(Rnd) >> (sizeof(Rnd) * 8 - 3)) - 4;
-		y = yo + (CHEAPRND(Rnd) >> (sizeof(Rnd) * 8 - 3)) - 4;
+		/* Generating the jitter in batches is much cheaper than one
+		 * number at a time.
+		 */
+		if (j == countof(jitter)) {
+			ya_random_fill (&T->Rnd, jitter, countof(jitter));
+			j = 0;
+		}
+		x = xo + JITTER(jitter[j++]);
+		y = yo + JITTER(jitter[j++]);
 	}
 }
 
@@ -904,7 +901,6 @@ draw_strange(ModeInfo * mi)
 	void        (*Iterate) (const ATTRACTOR *, PRM, PRM, PRM *, PRM *);
 	PRM         xmin, xmax, ymin, ymax;
 	ATTRACTOR  *A;
-	unsigned long Rnd = random();
 	int         cx, cy;
 
 	if (Root == NULL)
@@ -922,7 +918,7 @@ draw_strange(ModeInfo * mi)
 
 	/* We collect the accumulation of the orbits in the 2d int array field. */
 
-	init_draw (A, &x, &y, &xmin, &ymin, &xmax, &ymax, &Rnd);
+	init_draw (A, &x, &y, &xmin, &ymin, &xmax, &ymax, &A->Rnd);
 	recalc_scale (A, xmin, ymin, xmax, ymax, &Lx, &Ly, &cx, &cy);
 
 	A->Cur_Pt = 0;
@@ -1102,6 +1098,7 @@ init_strange(ModeInfo * mi)
 
 	MI_INIT (mi, Root);
 	Attractor = &Root[MI_SCREEN(mi)];
+	ya_random_init (&Attractor->Rnd, 0);
 
 	if (Attractor->Fold == NULL) {
 		int         i;
@@ -31,6 +31,7 @@
 
 #include <math.h>
 #include "screenhack.h"
+#include "xshm.h"
 
 /* this program goes faster if some functions are inline.  The following is
  * borrowed from ifs.c */
@@ -125,6 +126,12 @@ struct field {
     unsigned int seamless;
 };
 
+#define TILE_SHIFT 3		/* 8x8 tiles */
+
+typedef struct {
+  short x1, y1, x2, y2;		/* empty if x2 < x1 */
+} dirty_box;
+
 struct state {
   Display *dpy;
   Window window;
@@ -135,6 +142,17 @@ struct state {
   GC fgc;
   XWindowAttributes xgwa;
   XGCValues gcv;
+
+  /* A copy of off_img in the server's format.  The window is divided
+     into tiles, and at the end of each frame, the part of each tile that
+     changed is sent with XPutImage.  The cracks are scattered all over
+     the window, so one box around all of them would be most of it. */
+  XImage *image;
+  XShmSegmentInfo shm_info;
+  dirty_box *tiles;		/* tiles_w x tiles_h */
+  int tiles_w, tiles_h;
+  int *dirty;			/* indexes of the tiles that changed */
+  int ndirty;
 };
 
 
@@ -178,6 +196,52 @@ static struct field
 #define ref_pixel(f, x, y)   ((f)->off_img[(y) * (f)->width + (x)])
 #define ref_cgrid(f, x, y)   ((f)->cgrid[(y) * (f)->width + (x)])
 
+/* Stores a pixel in the offscreen map and the image, and if it changed,
+   grows the changed part of its tile. */
+static inline void
+set_pixel(struct state *st, int x, int y, unsigned long c)
+{
+    struct field *f = st->f;
+    int i = y * f->width + x;
+    int t;
+    dirty_box *b;
+
+    if (f->off_img[i] == c)
+        return;
+    f->off_img[i] = c;
+    XPutPixel(st->image, x, y, c);
+
+    t = (y >> TILE_SHIFT) * st->tiles_w + (x >> TILE_SHIFT);
+    b = &st->tiles[t];
+    if (b->x2 < b->x1) {
+        b->x1 = b->x2 = x;
+        b->y1 = b->y2 = y;
+        st->dirty[st->ndirty++] = t;
+    } else {
+        if (x < b->x1) b->x1 = x;
+        if (x > b->x2) b->x2 = x;
+        if (y < b->y1) b->y1 = y;
+        if (y > b->y2) b->y2 = y;
+    }
+}
+
+/* Sends the parts of the image that changed this frame. */
+static void
+draw_dirty(struct state *st)
+{
+    int i;
+    for (i = 0; i < st->ndirty; i++) {
+        dirty_box *b = &st->tiles[st->dirty[i]];
+        put_xshm_image(st->dpy, st->window, st->fgc, st->image,
+                       b->x1, b->y1, b->x1, b->y1,
+                       b->x2 - b->x1 + 1, b->y2 - b->y1 + 1,
+                       &st->shm_info);
+        b->x1 = 0;
+        b->x2 = -1;
+    }
+    st->ndirty = 0;
+}
+
 static inline void start_crack(struct field *f, crack *cr) 
 {
     /* synthesis of Crack::findStart() and crack::startCrack() */
@@ -351,7 +415,7 @@ trans_point(struct state *st,
 {
     if ((x1 >= 0) && (x1 < f->width) && (y1 >= 0) && (y1 < f->height)) {
         if (a >= 1.0) {
-            ref_pixel(f, x1, y1) = myc;
+            set_pixel(st, x1, y1, myc);
         } else {
             int or = 0, og = 0, ob = 0;
             int r = 0, g = 0, b = 0;
@@ -369,7 +433,7 @@ trans_point(struct state *st,
 
             c = rgb2point(f->visdepth, nr, ng, nb);
 
-            ref_pixel(f, x1, y1) = c;
+            set_pixel(st, x1, y1, c);
 
             return c;
         }
@@ -391,7 +455,6 @@ region_color(struct state *st, GC fgc, struct field *f, crack *cr)
     int grains, i;
     float w;
     float drawx, drawy;
-    unsigned long c;
 
     while (openspace) {
         /* move perpendicular to crack */
@@ -443,11 +506,7 @@ region_color(struct state *st, GC fgc, struct field *f, crack *cr)
         }
 
         /* Draw sand bit */
-        c = trans_point(st, drawx, drawy, cr->sandcolor, (0.1 - i / (grains * 10.0)), f);
-
-        XSetForeground(st->dpy, fgc, c);
-        XDrawPoint(st->dpy, st->window, fgc, (int) drawx, (int) drawy);
-        XSetForeground(st->dpy, fgc, f->fgcolor);
+        trans_point(st, drawx, drawy, cr->sandcolor, (0.1 - i / (grains * 10.0)), f);
     }
 }
 
@@ -537,8 +596,7 @@ movedrawcrack(struct state *st, GC fgc, struct field *f, int cracknum)
             region_color(st, fgc, f, cr);
 
         /* draw fgcolor crack */
-        ref_pixel(f, cx, cy) = f->fgcolor;
-        XDrawPoint(st->dpy, st->window, fgc, cx, cy);
+        set_pixel(st, cx, cy, f->fgcolor);
 
         if ( cr->curved && (cr->degrees_drawn > 360) ) {
             /* completed the circle, stop cracking */
@@ -573,6 +631,8 @@ movedrawcrack(struct state *st, GC fgc, struct field *f, int cracknum)
 static void build_img(Display *dpy, Window window, XWindowAttributes xgwa, GC fgc, 
                struct field *f) 
 {
+    int i;
+
     if (f->off_img) {
         free(f->off_img);
         f->off_img = NULL;
@@ -581,7 +641,50 @@ static void build_img(Display *dpy, Window window, XWindowAttributes xgwa, GC fg
     f->off_img = (unsigned long *) xrealloc(f->off_img, sizeof(unsigned long) * 
                                             f->width * f->height);
 
-    memset(f->off_img, f->bgcolor, sizeof(unsigned long) * f->width * f->height);
+    /* Not memset: that only works for colors whose bytes are all alike. */
+    for (i = 0; i < f->width * f->height; i++)
+        f->off_img[i] = f->bgcolor;
+}
+
+
+/* Makes the image match off_img, which has just been cleared. */
+static void build_image(struct state *st)
+{
+    struct field *f = st->f;
+    int x, y;
+
+    if (st->image &&
+        (st->image->width != f->width || st->image->height != f->height)) {
+        destroy_xshm_image(st->dpy, st->image, &st->shm_info);
+        st->image = 0;
+    }
+
+    if (!st->image) {
+        st->image = create_xshm_image(st->dpy, st->xgwa.visual,
+                                      st->xgwa.depth, ZPixmap, &st->shm_info,
+                                      f->width, f->height);
+        if (!st->image) {
+            fprintf(stderr, "%s: out of memory (%dx%d)\n", progname,
+                    f->width, f->height);
+            exit(1);
+        }
+    }
+
+    for (y = 0; y < f->height; y++)
+        for (x = 0; x < f->width; x++)
+            XPutPixel(st->image, x, y, ref_pixel(f, x, y));
+
+    st->tiles_w = (f->width  + (1 << TILE_SHIFT) - 1) >> TILE_SHIFT;
+    st->tiles_h = (f->height + (1 << TILE_SHIFT) - 1) >> TILE_SHIFT;
+    st->tiles = (dirty_box *) xrealloc(st->tiles, st->tiles_w * st->tiles_h *
+                                       sizeof(*st->tiles));
+    st->dirty = (int *) xrealloc(st->dirty, st->tiles_w * st->tiles_h *
+                                 sizeof(*st->dirty));
+    for (x = 0; x < st->tiles_w * st->tiles_h; x++) {
+        st->tiles[x].x1 = 0;
+        st->tiles[x].x2 = -1;
+    }
+    st->ndirty = 0;
 }
 
 
@@ -665,6 +768,7 @@ substrate_init (Display *dpy, Window window)
 
     /* Initialize stuff */
     build_img(st->dpy, st->window, st->xgwa, st->fgc, st->f);
+    build_image(st);
     build_substrate(st->f);
     
     return st;
@@ -688,6 +792,7 @@ substrate_draw (Display *dpy, Window window, void *closure)
 
       build_substrate(st->f);
       build_img(st->dpy, st->window, st->xgwa, st->fgc, st->f);
+      build_image(st);
       XSetForeground(st->dpy, st->fgc, st->gcv.background);
       XFillRectangle(st->dpy, st->window, st->fgc, 0, 0, st->xgwa.width, st->xgwa.height);
       XSetForeground(st->dpy, st->fgc, st->gcv.foreground);
@@ -698,11 +803,14 @@ substrate_draw (Display *dpy, Window window, void *closure)
     movedrawcrack(st, st->fgc, st->f, tempx);
   }
 
+  draw_dirty(st);
+
   st->f->cycles++;
 
   if (st->f->cycles >= st->max_cycles && st->max_cycles != 0) {
     build_substrate(st->f);
     build_img(st->dpy, st->window, st->xgwa, st->fgc, st->f);
+    build_image(st);
     XSetForeground(st->dpy, st->fgc, st->gcv.background);
     XFillRectangle(st->dpy, st->window, st->fgc, 0, 0, st->xgwa.width, st->xgwa.height);
     XSetForeground(st->dpy, st->fgc, st->gcv.foreground);
@@ -738,6 +846,9 @@ substrate_free (Display *dpy, Window window, void *closure)
   if (st->f->cgrid) free(st->f->cgrid);
   if (st->f->cracks) free(st->f->cracks);
   if (st->f->off_img) free(st->f->off_img);
+  if (st->image) destroy_xshm_image(dpy, st->image, &st->shm_info);
+  if (st->tiles) free(st->tiles);
+  if (st->dirty) free(st->dirty);
   if (st->f->parsedcolors) free(st->f->parsedcolors);
   XFreeGC (dpy, st->fgc);
   free (st->f);
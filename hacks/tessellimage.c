@@ -47,11 +47,6 @@ typedef struct {
   XPoint *p;
 } voronoi_polygon;
 
-typedef struct {
-  XPoint p;
-  double slope;
-} voronoi_pa;
-
 
 static void *
 tessellimage_init (Display *dpy, Window window)
@@ -440,106 +435,53 @@ small_cell_p (const voronoi_polygon *p)
 }
 
 
-static int
-cmp_ccw (const void *v1, const void *v2)
-{
-  const voronoi_pa *p1,*p2;
-  p1 = v1;
-  p2 = v2;
-  if      (p1->slope < p2->slope) return -1;
-  else if (p1->slope > p2->slope) return  1;
-  return 0;
-}
-
-static void
-sort_ccw (XPoint *ctr, XPoint *p, int npoints)
-{
-  voronoi_pa *pa = (void *) malloc (npoints * sizeof(*pa));
-  int i;
-  for (i = 0; i < npoints; i++)
-    {
-      pa[i].p = p[i];
-      pa[i].slope = atan2 (p[i].x - ctr->x, p[i].y - ctr->y);
-    }
-  qsort (pa, npoints, sizeof(*pa), cmp_ccw);
-  for (i = 0; i < npoints; i++)
-    p[i] = pa[i].p;
-  free (pa);
-}
-
+/* For every vertex, compose a polygon whose corners are the centers
+   of each triangle using that vertex, in order around it.  Skip any with
+   less than 3 points.
 
+   This is currently omitting the voronoi cells that should touch the edges
+   of the outer rectangle. Not sure exactly how to include those.
+ */
 static voronoi_polygon *
 delaunay_to_voronoi (int np, XYZ *p, int nv, ITRIANGLE *v, double scale)
 {
-  struct tri_list {
-    int count, size;
-    int *tri;
-  };
-
   int i, j;
-  struct tri_list *vert_to_tri = (struct tri_list *)
-    calloc (np + 1, sizeof(*vert_to_tri));
+  int *cells = (int *) malloc ((np + 1) * sizeof(*cells));
+  int *cell_tris = (int *) malloc ((3 * nv + 1) * sizeof(*cell_tris));
   voronoi_polygon *out = (voronoi_polygon *) calloc (np + 1, sizeof(*out));
 
-  /* Iterate the triangles to construct a map of vertices to the
-     triangles that contain them.
-   */
-  for (i = 0; i < nv; i++)
+  if (!cells || !cell_tris || !out ||
+      delaunay_cells (np, v, nv, cells, cell_tris))
     {
-      for (j = 0; j < 3; j++)	/* iterate points in each triangle */
-        {
-          int p = *((&v[i].p1) + j);
-          struct tri_list *t = &vert_to_tri[p];
-          if (p < 0 || p >= np) abort();
-          if (t->size <= t->count + 1)
-            {
-              t->size += 3;
-              t->size *= 1.3;
-              t->tri = realloc (t->tri, t->size * sizeof(*t->tri));
-              if (! t->tri) abort();
-            }
-          t->tri[t->count++] = i;
-        }
+      fprintf (stderr, "%s: out of memory\n", progname);
+      abort();
     }
 
-  /* For every vertex, compose a polygon whose corners are the centers
-     of each triangle using that vertex.  Skip any with less than 3 points.
-
-     This is currently omitting the voronoi cells that should touch the edges
-     of the outer rectangle. Not sure exactly how to include those.
-   */
   for (i = 0; i < np; i++)
     {
       long ctr_x = 0, ctr_y = 0;
-      struct tri_list *t = &vert_to_tri[i];
-      int n = t->count;
+      int *tris = cell_tris + cells[i];
+      int n = cells[i+1] - cells[i];
       if (n < 3) n = 0;
       out[i].npoints = n;
       if (n == 0) continue;
-      out[i].ctr.x = out[i].ctr.y = 0;
-      out[i].p = (n > 0
-                  ? (XPoint *) calloc (out[i].npoints + 1, sizeof (*out[i].p))
-                  : 0);
-      for (j = 0; j < out[i].npoints; j++)
+      out[i].p = (XPoint *) calloc (n + 1, sizeof (*out[i].p));
+      for (j = 0; j < n; j++)
         {
-          ITRIANGLE *tt = &v[t->tri[j]];
+          ITRIANGLE *tt = &v[tris[j]];
           out[i].p[j].x = scale * (p[tt->p1].x + p[tt->p2].x + p[tt->p3].x) / 3;
           out[i].p[j].y = scale * (p[tt->p1].y + p[tt->p2].y + p[tt->p3].y) / 3;
           ctr_x += out[i].p[j].x;
           ctr_y += out[i].p[j].y;
         }
-      out[i].ctr.x = ctr_x / out[i].npoints;  /* long -> short */
-      out[i].ctr.y = ctr_y / out[i].npoints;
+      out[i].ctr.x = ctr_x / n;  /* long -> short */
+      out[i].ctr.y = ctr_y / n;
       if (out[i].ctr.x < 0) abort();
       if (out[i].ctr.y < 0) abort();
-      sort_ccw (&out[i].ctr, out[i].p, out[i].npoints);
     }
 
-  for (i = 0; i < np+1; i++)
-    if (vert_to_tri[i].tri)
-      free (vert_to_tri[i].tri);
-  free (vert_to_tri);
-
+  free (cells);
+  free (cell_tris);
   return out;
 }
 
@@ -665,7 +607,6 @@ tessellate (struct state *st)
 
       if (nv != vsize) abort();
 
-      qsort (p, nv, sizeof(*p), delaunay_xyzcompare);
       if (delaunay (nv, p, v, &ntri))
         {
           fprintf (stderr, "%s: out of memory\n", progname);
@@ -16,6 +16,16 @@
    It is annoying that this requires libjpeg, but you may be surprised to
    learn that, massive as the GdkPixbuf library is, it has no facility for
    writing image files, only reading.
+
+   Run once per paste, this decodes and re-encodes the whole collage every
+   time.  With -server, it instead keeps the collage in memory and reads
+   commands on stdin, one per line; and it only writes the collage out as
+   a JPEG when asked to, or every N seconds.  Each command is answered with
+   a line on stdout, "ok" or "error".
+
+     paste scale opacity from-x from-y to-x to-y w h paste-file
+     write [file]     (default: the base file)
+     quit
  */
 
 #ifdef HAVE_CONFIG_H
@@ -29,8 +39,11 @@
 #include <math.h>
 #include <string.h>
 #include <time.h>
+#include <errno.h>
+#include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 
 # if (__GNUC__ >= 4)	/* Ignore useless warnings generated by GTK headers */
 #  pragma GCC diagnostic push
@@ -51,8 +64,9 @@ char *progname;
 static int verbose_p = 0;
 
 static void add_jpeg_comment (struct jpeg_compress_struct *cinfo);
-static void write_pixbuf (GdkPixbuf *pb, const char *file);
+static int write_pixbuf (GdkPixbuf *pb, const char *file);
 
+/* Returns 0 if the file couldn't be read. */
 static GdkPixbuf *
 load_pixbuf (const char *file)
 {
@@ -63,7 +77,6 @@ load_pixbuf (const char *file)
     {
       fprintf (stderr, "%s: %s\n", progname, err->message);
       g_error_free (err);
-      exit (1);
     }
 
   return pb;
@@ -172,22 +185,23 @@ bevel_image (GdkPixbuf **pbP, int bevel_pct,
 }
 
 
-static void
-paste (const char *paste_file,
-       const char *base_file,
-       double from_scale,
-       double opacity, int bevel_pct,
-       int from_x, int from_y, int to_x, int to_y,
-       int w, int h)
+/* Pastes the file into base_pb.  Returns 0 if the file couldn't be read.
+ */
+static int
+paste_pixbuf (GdkPixbuf *base_pb,
+              const char *paste_file,
+              double from_scale,
+              double opacity, int bevel_pct,
+              int from_x, int from_y, int to_x, int to_y,
+              int w, int h)
 {
   GdkPixbuf *paste_pb;
-  GdkPixbuf *base_pb;
 
   int paste_w, paste_h;
   int base_w, base_h;
 
   paste_pb = load_pixbuf (paste_file);
-  base_pb  = load_pixbuf (base_file);
+  if (!paste_pb) return 0;
 
   paste_w = gdk_pixbuf_get_width (paste_pb);
   paste_h = gdk_pixbuf_get_height (paste_pb);
@@ -196,12 +210,8 @@ paste (const char *paste_file,
   base_h = gdk_pixbuf_get_height (base_pb);
 
   if (verbose_p)
-    {
-      fprintf (stderr, "%s: loaded %s: %dx%d\n",
-               progname, base_file, base_w, base_h);
-      fprintf (stderr, "%s: loaded %s: %dx%d\n",
-               progname, paste_file, paste_w, paste_h);
-    }
+    fprintf (stderr, "%s: loaded %s: %dx%d\n",
+             progname, paste_file, paste_w, paste_h);
 
   if (from_scale != 1.0)
     {
@@ -328,7 +338,33 @@ paste (const char *paste_file,
              progname, paste_w, paste_h, from_x, from_y, to_x, to_y);
 
   g_object_unref (paste_pb);
-  write_pixbuf (base_pb, base_file);
+  return 1;
+}
+
+
+static void
+paste (const char *paste_file,
+       const char *base_file,
+       double from_scale,
+       double opacity, int bevel_pct,
+       int from_x, int from_y, int to_x, int to_y,
+       int w, int h)
+{
+  GdkPixbuf *base_pb = load_pixbuf (base_file);
+  if (!base_pb) exit (1);
+
+  if (verbose_p)
+    fprintf (stderr, "%s: loaded %s: %dx%d\n", progname, base_file,
+             gdk_pixbuf_get_width (base_pb),
+             gdk_pixbuf_get_height (base_pb));
+
+  if (! paste_pixbuf (base_pb, paste_file,
+                      from_scale, opacity, bevel_pct,
+                      from_x, from_y, to_x, to_y,
+                      w, h))
+    exit (1);
+  if (! write_pixbuf (base_pb, base_file))
+    exit (1);
   g_object_unref (base_pb);
 }
 
@@ -393,13 +429,15 @@ create (const char *color,
                                  w * 3,   /* rowstride */
                                  NULL, 0);
   if (!pb) abort();
-  write_pixbuf (pb, file);
+  if (! write_pixbuf (pb, file))
+    exit (1);
   g_object_unref (pb);
   free (bytes);
 }
 
 
-static void
+/* Returns 0 if the file couldn't be written. */
+static int
 write_pixbuf (GdkPixbuf *pb, const char *file)
 {
   int jpeg_quality = 85;
@@ -420,20 +458,19 @@ write_pixbuf (GdkPixbuf *pb, const char *file)
       exit (1);
     }
 
-  cinfo.err = jpeg_std_error (&jerr);
-  jpeg_create_compress (&cinfo);
-
   out = fopen (file, "wb");
   if (!out)
     {
       char buf[255];
       sprintf (buf, "%.100s: %.100s", progname, file);
       perror (buf);
-      exit (1);
+      return 0;
     }
   else if (verbose_p)
     fprintf (stderr, "%s: writing %s...", progname, file);
 
+  cinfo.err = jpeg_std_error (&jerr);
+  jpeg_create_compress (&cinfo);
   jpeg_stdio_dest (&cinfo, out);
 
   cinfo.image_width = w;
@@ -475,7 +512,14 @@ write_pixbuf (GdkPixbuf *pb, const char *file)
       fprintf (stderr, " %luK\n", ((unsigned long) st.st_size + 1023) / 1024);
     }
 
-  fclose (out);
+  if (fclose (out))
+    {
+      char buf[255];
+      sprintf (buf, "%.100s: %.100s", progname, file);
+      perror (buf);
+      return 0;
+    }
+  return 1;
 }
 
 
@@ -501,6 +545,165 @@ add_jpeg_comment (struct jpeg_compress_struct *cinfo)
 }
 
 
+/* Writes to a temporary file and renames it, so that anyone reading the
+   file at the moment the timer goes off, or a "write" command comes in,
+   gets either the old collage or the new one, never half of one.
+ */
+static int
+snapshot_pixbuf (GdkPixbuf *pb, const char *file)
+{
+  char *tmp = malloc (strlen (file) + 20);
+  int ok;
+  if (!tmp) abort();
+  sprintf (tmp, "%s.%lu.tmp", file, (unsigned long) getpid());
+  ok = write_pixbuf (pb, tmp);
+  if (ok && rename (tmp, file))
+    {
+      char buf[255];
+      sprintf (buf, "%.100s: %.100s", progname, file);
+      perror (buf);
+      ok = 0;
+    }
+  if (!ok)
+    unlink (tmp);
+  free (tmp);
+  return ok;
+}
+
+
+/* Waits until there is a line to read on stdin, or until `timeout'.
+   Returns 0 on timeout.
+ */
+static int
+await_command (time_t timeout)
+{
+  while (1)
+    {
+      fd_set fds;
+      struct timeval tv;
+      time_t now = time ((time_t *) 0);
+      int n;
+
+      if (now >= timeout) return 0;
+      tv.tv_sec = timeout - now;
+      tv.tv_usec = 0;
+      FD_ZERO (&fds);
+      FD_SET (fileno (stdin), &fds);
+      n = select (fileno (stdin) + 1, &fds, 0, 0, &tv);
+      if (n > 0) return 1;
+      if (n < 0 && errno != EINTR)
+        {
+          perror (progname);
+          exit (1);
+        }
+    }
+}
+
+
+static int
+serve_paste (GdkPixbuf *base_pb, char *args)
+{
+  double from_scale, opacity;
+  int from_x, from_y, to_x, to_y, w, h;
+  int n = 0;
+
+  if (8 != sscanf (args, " %lf %lf %d %d %d %d %d %d %n",
+                   &from_scale, &opacity,
+                   &from_x, &from_y, &to_x, &to_y, &w, &h, &n) ||
+      !n || !args[n] ||
+      from_scale <= 0 || from_scale > 100 ||
+      opacity <= 0 || opacity > 1 ||
+      w < 0 || h < 0)
+    {
+      fprintf (stderr, "%s: unparsable paste command: %s\n", progname, args);
+      return 0;
+    }
+
+  return paste_pixbuf (base_pb, args + n,
+                       from_scale, opacity, 10, /* #### */
+                       from_x, from_y, to_x, to_y,
+                       w, h);
+}
+
+
+static void
+serve (const char *base_file, int interval)
+{
+  GdkPixbuf *base_pb = load_pixbuf (base_file);
+  time_t next_snapshot = 0;
+  int dirty_p = 0;
+  char line[10240];
+
+  if (!base_pb) exit (1);
+  if (gdk_pixbuf_get_has_alpha (base_pb))
+    {
+      /* write_pixbuf wants RGB.  JPEGs never have alpha, but PNGs might. */
+      GdkPixbuf *pb2 = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8,
+                                       gdk_pixbuf_get_width (base_pb),
+                                       gdk_pixbuf_get_height (base_pb));
+      gdk_pixbuf_fill (pb2, 0);
+      gdk_pixbuf_composite (base_pb, pb2, 0, 0,
+                            gdk_pixbuf_get_width (base_pb),
+                            gdk_pixbuf_get_height (base_pb),
+                            0, 0, 1.0, 1.0, GDK_INTERP_NEAREST, 255);
+      g_object_unref (base_pb);
+      base_pb = pb2;
+    }
+
+  /* No stdio buffering on input: otherwise, select() can't tell whether
+     there is a command waiting, since it might already be in the buffer. */
+  setvbuf (stdin, 0, _IONBF, 0);
+
+  while (1)
+    {
+      char *s;
+      int ok = 0;
+
+      if (interval > 0 && dirty_p &&
+          !await_command (next_snapshot))
+        {
+          snapshot_pixbuf (base_pb, base_file);
+          dirty_p = 0;
+          continue;
+        }
+
+      if (! fgets (line, sizeof(line), stdin))
+        break;
+      s = line + strlen (line);
+      while (s > line && (s[-1] == '\n' || s[-1] == '\r'))
+        *(--s) = 0;
+
+      if (!strncmp (line, "paste ", 6))
+        {
+          ok = serve_paste (base_pb, line + 6);
+          if (ok && !dirty_p)
+            {
+              dirty_p = 1;
+              next_snapshot = time ((time_t *) 0) + interval;
+            }
+        }
+      else if (!strcmp (line, "write") || !strncmp (line, "write ", 6))
+        {
+          s = line + 5;
+          while (*s == ' ') s++;
+          if (*s)
+            ok = snapshot_pixbuf (base_pb, s);
+          else if ((ok = snapshot_pixbuf (base_pb, base_file)))
+            dirty_p = 0;
+        }
+      else if (!strcmp (line, "quit"))
+        break;
+      else
+        fprintf (stderr, "%s: unknown command: %s\n", progname, line);
+
+      fputs (ok ? "ok\n" : "error\n", stdout);
+      fflush (stdout);
+    }
+
+  g_object_unref (base_pb);
+}
+
+
 static void
 usage (void)
 {
@@ -514,8 +717,11 @@ usage (void)
            "\t scaling is applied first: coordinates apply to scaled image.\n"
            "\n"
            "usage: %s [-v] color width height output-file\n"
-           "\t Creates a new image of a solid color.\n\n",
-           progname, progname);
+           "\t Creates a new image of a solid color.\n"
+           "\n"
+           "usage: %s [-v] -server base-file [snapshot-secs]\n"
+           "\t Reads paste commands on stdin.\n\n",
+           progname, progname, progname);
   exit (1);
 }
 
@@ -538,7 +744,27 @@ main (int argc, char **argv)
   if (!strcmp(argv[i], "-v"))
     verbose_p++, i++;
 
-  if (argc == 11 || argc == 12)
+  if (i < argc && !strcmp (argv[i], "-server"))
+    {
+      int interval = 0;
+      i++;
+      if (argc - i != 1 && argc - i != 2) usage();
+      base_file = argv[i++];
+      if (*base_file == '-') usage();
+      if (i < argc)
+        {
+          s = argv[i];
+          if (1 != sscanf (s, " %d %c", &interval, &dummy)) usage();
+          if (interval < 0) usage();
+        }
+
+# if !GLIB_CHECK_VERSION(2, 36 ,0)
+      g_type_init ();
+# endif
+
+      serve (base_file, interval);
+    }
+  else if (argc == 11 || argc == 12)
     {
       paste_file = argv[i++];
       base_file = argv[i++];
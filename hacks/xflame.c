@@ -42,6 +42,8 @@
    * 4-Oct-99, jwz: added support for packed-24bpp (versus 32bpp.)
    * 16-Jan-2002, jwz: added gdk_pixbuf support.
    * 9-Oct-2016, Dave Odell <dmo2118@gmail.com>: Updated for new xshm.c.
+   * 2026: threaded the flame, and added -scale so that it can run at
+     full resolution.
 
  */
 
@@ -50,7 +52,9 @@
 
 #include "screenhack.h"
 #include "ximage-loader.h"
+#include "thread_util.h"
 #include <limits.h>
+#include <errno.h>
 
 # undef MAX
 # undef MIN
@@ -76,13 +80,22 @@ struct state {
   XImage          *xim;
   XShmSegmentInfo shminfo;
   GC              gc;
-  int             ctab[256];
+  unsigned int    ctab[256];
 
   unsigned char  *flame;
   unsigned char  *theim;
+  int             scale;	/* pixels per flame cell: 1 or 2 */
   int             fwidth;
   int             fheight;
   int             top;
+
+  unsigned char  *heat[2];	/* each row before it cooled off */
+  int             cur_heat;
+  int             lo, last_lo;	/* first row advanced, now and last frame */
+  unsigned char  *rowbuf;	/* two rows per thread */
+  unsigned int   *pixbuf;	/* two lines of the image per thread */
+  int            *band_used;	/* per thread */
+  struct threadpool threadpool;
   int             hspread;
   int             vspread;
   int             residual;
@@ -112,9 +125,9 @@ GetXInfo(struct state *st)
   st->width    = xwa.width;
   st->height   = xwa.height;
 
-  if (st->width%2)
+  if (st->width % st->scale)
     st->width++;
-  if (st->height%2)
+  if (st->height % st->scale)
     st->height++;
 }
 
@@ -178,7 +191,7 @@ InitColors(struct state *st)
 
       XAllocColor(st->dpy,st->colormap,&xcl);
 
-      st->ctab[j++] = (int)xcl.pixel;
+      st->ctab[j++] = (unsigned int)xcl.pixel;
     }
 }
 
@@ -186,23 +199,35 @@ InitColors(struct state *st)
 static void
 DisplayImage(struct state *st)
 {
-  put_xshm_image(st->dpy, st->window, st->gc, st->xim, 0,(st->top - 1) << 1, 0,
-                 (st->top - 1) << 1, st->width, st->height - ((st->top - 1) << 1),
-                 &st->shminfo);
+  int y = (st->top - 1) * st->scale;
+  put_xshm_image(st->dpy, st->window, st->gc, st->xim, 0, y, 0, y,
+                 st->width, st->height - y, &st->shminfo);
 }
 
 
 static void
 InitFlame(struct state *st)
 {
-  st->fwidth  = st->width / 2;
-  st->fheight = st->height / 2;
+  int cells;
 
-  if (st->flame) free (st->flame);
-  st->flame   = (unsigned char *) calloc((st->fwidth + 2) * (st->fheight + 2),
-                                         sizeof(unsigned char));
+  st->fwidth  = st->width / st->scale;
+  st->fheight = st->height / st->scale;
+  cells = (st->fwidth + 2) * (st->fheight + 2);
 
-  if (!st->flame)
+  if (st->flame) free (st->flame);
+  if (st->heat[0]) free (st->heat[0]);
+  if (st->rowbuf) free (st->rowbuf);
+  if (st->pixbuf) free (st->pixbuf);
+  st->flame   = (unsigned char *) calloc (cells, sizeof(unsigned char));
+  st->heat[0] = (unsigned char *) malloc (cells * 2);
+  st->heat[1] = st->heat[0] + cells;
+  st->rowbuf  = (unsigned char *)
+    malloc (st->threadpool.count * 2 * (st->fwidth + 3));
+  st->pixbuf  = (unsigned int *)
+    malloc (st->threadpool.count * 2 * st->width * sizeof(*st->pixbuf));
+  st->last_lo = st->fheight + 1;
+
+  if (!st->flame || !st->heat[0] || !st->rowbuf || !st->pixbuf)
     {
       fprintf(stderr,"%s: out of memory\n", progname);
       exit(1);
@@ -245,293 +270,269 @@ InitFlame(struct state *st)
 
 
 static void
-Flame2Image16(struct state *st)
+FlameActive(struct state *st)
 {
-  int x,y;
-  unsigned short *ptr;
+  int x,v1;
   unsigned char *ptr1;
-  int v1,v2,v3,v4;
+   
+  ptr1 = st->flame + ((st->fheight + 1) * (st->fwidth + 2));
 
-  ptr  = (unsigned short *)st->xim->data;
-  ptr += (st->top << 1) * st->width;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
+  for (x = 0; x < st->fwidth + 2; x++)
+    {
+      v1      = *ptr1;
+      v1     += ((random() % st->variance) - st->vartrend);
+      *ptr1++ = v1 % 255;
+    }
 
-  for(y = st->top; y < st->fheight; y++)
+  if (st->bloom)
     {
-      for( x = 0; x < st->fwidth; x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          *ptr++ = (unsigned short)st->ctab[v1];
-          *ptr   = (unsigned short)st->ctab[(v1 + v2) >> 1];
-          ptr   += st->width - 1;
-          *ptr++ = (unsigned short)st->ctab[(v1 + v3) >> 1];
-          *ptr   = (unsigned short)st->ctab[(v1 + v4) >> 1];
-          ptr   -= st->width - 1;
-        }
-      ptr  += st->width;
-      ptr1 += 2;
+      v1= (random() % 100);
+      if (v1 == 10)
+	st->residual += (random()%10);
+      else if (v1 == 20)
+	st->hspread += (random()%15);
+      else if (v1 == 30)
+	st->vspread += (random()%20);
     }
+
+  st->residual = ((st->iresidual* 10) + (st->residual *90)) / 100;
+  st->hspread  = ((st->ihspread * 10) + (st->hspread  *90)) / 100;
+  st->vspread  = ((st->ivspread * 10) + (st->vspread  *90)) / 100;
 }
 
-static void
-Flame2Image32(struct state *st)
-{
-  int x,y;
-  unsigned int *ptr;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
 
-  ptr  = (unsigned int *)st->xim->data;
-  ptr += (st->top << 1) * st->width;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
+/* The flame is advanced and drawn in horizontal bands of rows, one band
+   per thread.  Heat rises: each cell is fed by the three cells under it,
+   and those have already been fed by the cells under them in the same
+   frame, so within a band the update sweeps upward.  A band can't wait
+   for the band below it to finish, so for the row just below its bottom
+   edge -- the halo row -- it uses that row as it was last frame.  That
+   is why the un-decayed value of every row is kept, double-buffered, in
+   `heat'.
+ */
 
-  for( y = st->top; y < st->fheight; y++)
-    {
-      for( x = 0; x < st->fwidth; x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          *ptr++ = (unsigned int)st->ctab[v1];
-          *ptr   = (unsigned int)st->ctab[(v1 + v2) >> 1];
-          ptr   += st->width - 1;
-          *ptr++ = (unsigned int)st->ctab[(v1 + v3) >> 1];
-          *ptr   = (unsigned int)st->ctab[(v1 + v4) >> 1];
-          ptr   -= st->width - 1;
-        }
-      ptr  += st->width;
-      ptr1 += 2;
-    }
-}
+struct flame_thread {
+  struct state *st;
+  unsigned id;
+};
 
-static void
-Flame2Image24(struct state *st)
+
+static int
+flame_thread_create (void *self, struct threadpool *pool, unsigned id)
 {
-  int x,y;
-  unsigned char *ptr;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
+  struct flame_thread *t = (struct flame_thread *) self;
+  t->st = GET_PARENT_OBJ (struct state, threadpool, pool);
+  t->id = id;
+  return 0;
+}
 
-  ptr  = (unsigned char *)st->xim->data;
-  ptr += (st->top << 1) * st->xim->bytes_per_line;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
 
-  for( y = st->top; y < st->fheight; y++)
-    {
-      unsigned char *last_ptr = ptr;
-      for( x = 0; x < st->fwidth; x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
+static void
+flame_thread_destroy (void *self)
+{
+}
 
-          ptr[2] = ((unsigned int)st->ctab[v1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[v1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[v1] & 0x000000FF);
-          ptr += 3;
-
-          ptr[2] = ((unsigned int)st->ctab[(v1 + v2) >> 1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[(v1 + v2) >> 1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[(v1 + v2) >> 1] & 0x000000FF);
-          ptr += ((st->width - 1) * 3);
-
-          ptr[2] = ((unsigned int)st->ctab[(v1 + v3) >> 1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[(v1 + v3) >> 1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[(v1 + v3) >> 1] & 0x000000FF);
-          ptr += 3;
-
-          ptr[2] = ((unsigned int)st->ctab[(v1 + v4) >> 1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[(v1 + v4) >> 1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[(v1 + v4) >> 1] & 0x000000FF);
-          ptr -= ((st->width - 1) * 3);
-        }
 
-      ptr = last_ptr + (st->xim->bytes_per_line << 1);
-      ptr1 += 2;
-    }
+static void
+flame_band (struct state *st, unsigned id, int lo, int hi, int *y0, int *y1)
+{
+  int n = hi - lo;
+  *y0 = lo + n * id       / st->threadpool.count;
+  *y1 = lo + n * (id + 1) / st->threadpool.count;
 }
 
+
 static void
-Flame2Image8(struct state *st)
+flame_advance_run (void *self)
 {
-  int x,y;
-  unsigned char *ptr;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
-
-  ptr  = (unsigned char *)st->xim->data;
-  ptr += (st->top << 1) * st->width;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
+  struct flame_thread *t = (struct flame_thread *) self;
+  struct state *st = t->st;
+  int W = st->fwidth + 2;
+  unsigned char *below = st->rowbuf + t->id * 2 * (W + 1);
+  unsigned char *cur   = below + W + 1;
+  unsigned char *heat      = st->heat[st->cur_heat];
+  unsigned char *last_heat = st->heat[!st->cur_heat];
+  int vspread  = st->vspread;
+  int hspread  = st->hspread;
+  int residual = st->residual;
+  int x, y, y0, y1;
+
+  st->band_used[t->id] = INT_MAX;
+  flame_band (st, t->id, st->lo, st->fheight + 1, &y0, &y1);
+  if (y0 >= y1) return;
+
+  if (y1 == st->fheight + 1)
+    memcpy (below, st->flame + y1 * W, W);
+  else if (y1 >= st->last_lo)
+    memcpy (below, last_heat + y1 * W, W);
+  else
+    memset (below, 0, W);
 
-  for(y=st->top;y<st->fheight;y++)
+  for (y = y1 - 1; y >= y0; y--)
     {
-      for(x=0;x<st->fwidth;x++)
+      unsigned char *row = st->flame + y * W;
+      int any = 0;
+
+      /* The gutters feed nothing, and the right gutter must be able to
+         read one cell past itself. */
+      below[0] = below[W - 1] = below[W] = 0;
+      cur[0] = row[0];
+
+      for (x = 1; x < W; x++)
         {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          *ptr++ = (unsigned char)st->ctab[v1];
-          *ptr   = (unsigned char)st->ctab[(v1 + v2) >> 1];
-          ptr   += st->width - 1;
-          *ptr++ = (unsigned char)st->ctab[(v1 + v3) >> 1];
-          *ptr   = (unsigned char)st->ctab[(v1 + v4) >> 1];
-          ptr   -= st->width - 1;
+          int v = (row[x] +
+                   ((below[x]     * vspread) >> 8) +
+                   ((below[x - 1] * hspread) >> 8) +
+                   ((below[x + 1] * hspread) >> 8));
+          cur[x] = (v > MAX_VAL ? MAX_VAL : v);
         }
-      ptr  += st->width;
-      ptr1 += 2;
+
+      for (x = 1; x < W - 1; x++)
+        any |= cur[x];
+      if (any)
+        st->band_used[t->id] = y;
+
+      memcpy (heat + y * W, cur, W);
+      for (x = 1; x < W; x++)
+        row[x] = (cur[x] * residual) >> 8;
+
+      { unsigned char *swap = below; below = cur; cur = swap; }
     }
 }
 
+
 static void
-Flame2Image1234567(struct state *st)
+FlameAdvance(struct state *st)
 {
-  int x,y;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
+  int W = st->fwidth + 2;
+  unsigned char *bottom = st->flame + (st->fheight + 1) * W;
+  int x;
+  unsigned i;
+  int used = INT_MAX;
+
+  st->lo = MAX (0, st->top - 1);
+  threadpool_run (&st->threadpool, flame_advance_run);
+  threadpool_wait (&st->threadpool);
+
+  for (x = 1; x < W - 1; x++)
+    if (bottom[x])
+      {
+        used = st->fheight + 1;
+        break;
+      }
+  for (i = 0; i < st->threadpool.count; i++)
+    if (st->band_used[i] < used)
+      used = st->band_used[i];
 
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
+  /* The bottom row doesn't cool off, but its gutter does. */
+  bottom[W - 1] = (bottom[W - 1] * st->residual) >> 8;
 
-  for( y = st->top; y < st->fheight; y++)
-    {
-      for( x = 0; x < st->fwidth; x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          XPutPixel(st->xim,(x << 1),    (y << 1),    st->ctab[v1]);
-          XPutPixel(st->xim,(x << 1) + 1,(y << 1),    st->ctab[(v1 + v2) >> 1]);
-          XPutPixel(st->xim,(x << 1),    (y << 1) + 1,st->ctab[(v1 + v3) >> 1]);
-          XPutPixel(st->xim,(x << 1) + 1,(y << 1) + 1,st->ctab[(v1 + v4) >> 1]);
-        }
-    }
+  st->last_lo = st->lo;
+  st->cur_heat = !st->cur_heat;
+
+  st->top = (used == INT_MAX ? st->top : used - 1) - 1;
+  if (st->top < 1)
+    st->top = 1;
 }
 
+
+/* Writes one row of pixel values into the image. */
 static void
-Flame2Image(struct state *st)
+put_row (XImage *xim, int y, const unsigned int *pixels, int width)
 {
-  switch (st->xim->bits_per_pixel)
+  char *data = xim->data + y * xim->bytes_per_line;
+  int x;
+
+  switch (xim->bits_per_pixel)
     {
-    case 32: Flame2Image32(st); break;
-    case 24: Flame2Image24(st); break;
-    case 16: Flame2Image16(st); break;
-    case 8:  Flame2Image8(st);  break;
+    case 32:
+      if ((const unsigned int *) data != pixels)
+        memcpy (data, pixels, width * sizeof(*pixels));
+      break;
+    case 24:
+      for (x = 0; x < width; x++)
+        {
+          data[0] =  pixels[x]        & 0xFF;
+          data[1] = (pixels[x] >> 8)  & 0xFF;
+          data[2] = (pixels[x] >> 16) & 0xFF;
+          data += 3;
+        }
+      break;
+    case 16:
+      for (x = 0; x < width; x++)
+        ((unsigned short *) data)[x] = pixels[x];
+      break;
+    case 8:
+      for (x = 0; x < width; x++)
+        ((unsigned char *) data)[x] = pixels[x];
+      break;
     default:
-      if (st->xim->bits_per_pixel <= 7)
-        Flame2Image1234567(st);
-      else
+      if (xim->bits_per_pixel > 7)
         abort();
+      for (x = 0; x < width; x++)
+        XPutPixel (xim, x, y, pixels[x]);
       break;
     }
 }
 
 
 static void
-FlameActive(struct state *st)
+flame_image_run (void *self)
 {
-  int x,v1;
-  unsigned char *ptr1;
-   
-  ptr1 = st->flame + ((st->fheight + 1) * (st->fwidth + 2));
+  struct flame_thread *t = (struct flame_thread *) self;
+  struct state *st = t->st;
+  int W = st->fwidth + 2;
+  const unsigned int *ctab = st->ctab;
+  unsigned int *pix = st->pixbuf + t->id * 2 * st->width;
+  int x, y, y0, y1;
 
-  for (x = 0; x < st->fwidth + 2; x++)
-    {
-      v1      = *ptr1;
-      v1     += ((random() % st->variance) - st->vartrend);
-      *ptr1++ = v1 % 255;
-    }
+  flame_band (st, t->id, st->top, st->fheight, &y0, &y1);
 
-  if (st->bloom)
+  for (y = y0; y < y1; y++)
     {
-      v1= (random() % 100);
-      if (v1 == 10)
-	st->residual += (random()%10);
-      else if (v1 == 20)
-	st->hspread += (random()%15);
-      else if (v1 == 30)
-	st->vspread += (random()%20);
-    }
-
-  st->residual = ((st->iresidual* 10) + (st->residual *90)) / 100;
-  st->hspread  = ((st->ihspread * 10) + (st->hspread  *90)) / 100;
-  st->vspread  = ((st->ivspread * 10) + (st->vspread  *90)) / 100;
-}
-
-
-static void
-FlameAdvance(struct state *st)
-{
-  int x,y;
-  unsigned char *ptr2;
-  int newtop = st->top;
+      const unsigned char *f0 = st->flame + 1 + y * W;
+      const unsigned char *f1 = f0 + W;
 
-  for (y = st->fheight + 1; y >= st->top; y--)
-    {
-      int used = 0;
-      unsigned char *ptr1 = st->flame + 1 + (y * (st->fwidth + 2));
-      for (x = 0; x < st->fwidth; x++)
+      if (st->scale == 1)
         {
-          int v1 = (int)*ptr1;
-          int v2, v3;
-          if (v1 > 0)
+          unsigned int *p0 = (st->xim->bits_per_pixel == 32
+                              ? (unsigned int *)
+                                (st->xim->data + y * st->xim->bytes_per_line)
+                              : pix);
+          for (x = 0; x < st->fwidth; x++)
+            p0[x] = ctab[f0[x]];
+          put_row (st->xim, y, p0, st->width);
+        }
+      else
+        {
+          unsigned int *p0 = pix, *p1 = pix + st->width;
+          if (st->xim->bits_per_pixel == 32)
             {
-              used = 1;
-              ptr2 = ptr1 - st->fwidth - 2;
-              v3   = (v1 * st->vspread) >> 8;
-              v2   = (int)*(ptr2);
-              v2  += v3;
-              if (v2 > MAX_VAL) 
-                v2 = MAX_VAL;
-
-              *(ptr2) = (unsigned char)v2;
-              v3  = (v1 * st->hspread) >> 8;
-              v2  = (int)*(ptr2 + 1);
-              v2 += v3;
-              if (v2 > MAX_VAL) 
-                v2 = MAX_VAL;
-          
-              *(ptr2 + 1) = (unsigned char)v2;
-              v2          = (int)*(ptr2 - 1);
-              v2         += v3;
-              if (v2 > MAX_VAL) 
-                v2 = MAX_VAL;
-          
-              *(ptr2 - 1) = (unsigned char)v2;
-        
-              if (y < st->fheight + 1)
-                {
-                  v1    = (v1 * st->residual) >> 8;
-                  *ptr1 = (unsigned char)v1;
-                }
+              p0 = (unsigned int *)
+                (st->xim->data + 2 * y * st->xim->bytes_per_line);
+              p1 = (unsigned int *)
+                ((char *) p0 + st->xim->bytes_per_line);
             }
-          ptr1++;
-          if (used) 
-            newtop = y - 1;
+          for (x = 0; x < st->fwidth; x++)
+            {
+              int v1 = f0[x];
+              p0[2*x]   = ctab[v1];
+              p0[2*x+1] = ctab[(v1 + f0[x+1]) >> 1];
+              p1[2*x]   = ctab[(v1 + f1[x])   >> 1];
+              p1[2*x+1] = ctab[(v1 + f1[x+1]) >> 1];
+            }
+          put_row (st->xim, 2*y,   p0, st->width);
+          put_row (st->xim, 2*y+1, p1, st->width);
         }
- 
-      /* clean up the right gutter */
-      {
-        int v1 = (int)*ptr1;
-        v1 = (v1 * st->residual) >> 8;
-        *ptr1 = (unsigned char)v1;
-      }
     }
+}
 
-  st->top = newtop - 1;
 
-  if (st->top < 1)
-    st->top = 1;
+static void
+Flame2Image(struct state *st)
+{
+  threadpool_run (&st->threadpool, flame_image_run);
+  threadpool_wait (&st->threadpool);
 }
 
 
@@ -615,33 +616,49 @@ double_ximage (Display *dpy, Visual *visual, XImage *image)
 }
 
 
+/* One pass of a box blur along a line of n pixels, `stride' apart.  The
+   sum over the box is kept running, so the cost doesn't depend on the
+   radius.  Pixels past the ends repeat the end pixels.
+ */
+static void
+box_blur_line (const unsigned char *in, unsigned char *out,
+               int n, int stride, int r)
+{
+  int d = 2*r + 1;
+  int i, sum = 0;
+
+  for (i = -r; i <= r; i++)
+    sum += in[MIN(n-1, MAX(0, i)) * stride];
+  for (i = 0; i < n; i++)
+    {
+      out[i * stride] = (sum + d/2) / d;
+      sum += (in[MIN(n-1, i + r + 1) * stride] -
+              in[MAX(0,   i - r)     * stride]);
+    }
+}
+
+
+/* Three box blurs in a row come out close to a gaussian; and a box blur
+   is separable into a horizontal pass and a vertical pass.
+ */
 static unsigned char *
 gaussian_blur (unsigned char *in, int w, int h, double r)
 {
-  unsigned char *out = malloc(w * h);
-  int rs = (int) ((r * 2.57) + 0.5);
-  int i, j;
+  unsigned char *tmp = malloc (w * h);
+  int rb = (int) ((sqrt (4*r*r + 1) - 1) / 2 + 0.5);
+  int pass, i;
 
-  for (i = 0; i < h; i ++)
-    for (j = 0; j < w; j++) 
-      {
-        double val = 0, wsum = 0;
-        int ix, iy;
-        for (iy = i-rs; iy<i+rs+1; iy++)
-          for (ix = j-rs; ix<j+rs+1; ix++)
-            {
-              int x = MIN(w-1, MAX(0, ix));
-              int y = MIN(h-1, MAX(0, iy));
-              int dsq = (ix-j)*(ix-j)+(iy-i)*(iy-i);
-              double wght = exp (-dsq / (2*r*r)) / (M_PI*2*r*r);
-              val += in[y*w+x] * wght;
-              wsum += wght;
-            }
-        out[i*w+j] = val/wsum;            
-      }
+  if (!tmp) return in;
+  for (pass = 0; pass < 3; pass++)
+    {
+      for (i = 0; i < h; i++)
+        box_blur_line (in + i*w, tmp + i*w, w, 1, rb);
+      for (i = 0; i < w; i++)
+        box_blur_line (tmp + i, in + i, h, w, rb);
+    }
 
-  free (in);
-  return out;
+  free (tmp);
+  return in;
 }
 
 
@@ -672,8 +689,8 @@ loadBitmap (struct state *st)
 
   if (! image) return 0;
 
-  while (image->width  < st->width  / 10 &&
-         image->height < st->height / 10)
+  while (image->width  < st->width  / st->scale / 5 &&
+         image->height < st->height / st->scale / 5)
     {
       image = double_ximage (st->dpy, st->visual, image);
       blur++;
@@ -718,6 +735,26 @@ xflame_init (Display *dpy, Window win)
   st->xim      = NULL;
   st->top      = 1;
   st->flame    = NULL;
+  st->scale    = get_integer_resource (dpy, "scale", "Integer");
+  if (st->scale < 1) st->scale = 1;
+  if (st->scale > 2) st->scale = 2;
+
+  {
+    static const struct threadpool_class cls = {
+      sizeof(struct flame_thread),
+      flame_thread_create,
+      flame_thread_destroy
+    };
+    int err = threadpool_create (&st->threadpool, &cls, dpy,
+                                 hardware_concurrency (dpy));
+    if (err)
+      {
+        fprintf (stderr, "%s: threadpool: %s\n", progname, strerror (err));
+        exit (1);
+      }
+    st->band_used = (int *)
+      calloc (st->threadpool.count, sizeof(*st->band_used));
+  }
 
   GetXInfo(st);
   InitColors(st);
@@ -771,8 +808,13 @@ xflame_free (Display *dpy, Window window, void *closure)
   struct state *st = (struct state *) closure;
   if (st->xim)
     destroy_xshm_image (dpy, st->xim, &st->shminfo);
+  threadpool_destroy (&st->threadpool);
   free (st->theim);
   free (st->flame);
+  free (st->heat[0]);
+  free (st->rowbuf);
+  free (st->pixbuf);
+  free (st->band_used);
   XFreeGC (dpy, st->gc);
   free (st);
 }
@@ -794,6 +836,8 @@ static const char *xflame_defaults [] = {
   "*variance:       50",
   "*vartrend:       20",
   "*bloom:          True",   
+  "*scale:          2",
+  THREAD_DEFAULTS
 
 #ifdef HAVE_XSHM_EXTENSION
   "*useSHM: False",   /* xshm turns out not to help. */
@@ -814,10 +858,13 @@ static XrmOptionDescRec xflame_options [] = {
   { "-vartrend",  ".vartrend",       XrmoptionSepArg, 0 },
   { "-bloom",     ".bloom",          XrmoptionNoArg, "True" },
   { "-no-bloom",  ".bloom",          XrmoptionNoArg, "False" },
+  { "-scale",     ".scale",          XrmoptionSepArg, 0 },
+  { "-full-res",  ".scale",          XrmoptionNoArg, "1" },
 #ifdef HAVE_XSHM_EXTENSION
   { "-shm",       ".useSHM",         XrmoptionNoArg, "True" },
   { "-no-shm",    ".useSHM",         XrmoptionNoArg, "False" },
 #endif /* HAVE_XSHM_EXTENSION */
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
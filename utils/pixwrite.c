@@ -0,0 +1,181 @@
+/* xscreensaver, Copyright (c) 2026 Jamie Zawinski <jwz@jwz.org>
+ * Writing pixels directly into XImage rows.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+#include "utils.h"
+#include "pixwrite.h"
+
+void
+pixel_writer_init (pixel_writer *pw, XImage *image)
+{
+  unsigned int local_order = (MSBFirst << 24) | (LSBFirst << 0);
+
+  pw->image = image;
+  pw->swap_p = (image->byte_order != *(char *) &local_order);
+
+  if (image->format != ZPixmap)
+    pw->format = PIXEL_GENERIC;
+  else
+    switch (image->bits_per_pixel) {
+    case 8:  pw->format = PIXEL_8;  break;
+    case 16: pw->format = PIXEL_16; break;
+    case 24: pw->format = PIXEL_24; break;
+    case 32: pw->format = PIXEL_32; break;
+    default: pw->format = PIXEL_GENERIC; break;
+    }
+}
+
+
+unsigned long
+pixel_writer_value (const pixel_writer *pw, unsigned long p)
+{
+  if (!pw->swap_p)
+    return p;
+  switch (pw->format) {
+  case PIXEL_16:
+    return (((p >> 8) & 0x00FF) |
+            ((p << 8) & 0xFF00));
+  case PIXEL_32:
+    return (((p >> 24) & 0x000000FF) |
+            ((p >>  8) & 0x0000FF00) |
+            ((p <<  8) & 0x00FF0000) |
+            ((p << 24) & 0xFF000000));
+  default:
+    return p;
+  }
+}
+
+
+/* Packed 24-bit pixels are stored most or least significant byte first
+   according to the image, regardless of the local byte order. */
+static void
+put_24 (const pixel_writer *pw, unsigned char *out, unsigned long p)
+{
+  if (pw->image->byte_order == MSBFirst)
+    {
+      out[0] = p >> 16;
+      out[1] = p >> 8;
+      out[2] = p;
+    }
+  else
+    {
+      out[0] = p;
+      out[1] = p >> 8;
+      out[2] = p >> 16;
+    }
+}
+
+
+void
+pixel_writer_fill (const pixel_writer *pw,
+                   int x, int y, int width, int height,
+                   unsigned long pixel)
+{
+  unsigned long v = pixel_writer_value (pw, pixel);
+  int i, j;
+
+  for (j = y; j < y + height; j++)
+    {
+      char *row = pixel_writer_row (pw, j);
+      switch (pw->format) {
+      case PIXEL_8:
+        memset (row + x, v, width);
+        break;
+      case PIXEL_16:
+        {
+          unsigned short *out = (unsigned short *) row + x;
+          for (i = 0; i < width; i++)
+            out[i] = v;
+        }
+        break;
+      case PIXEL_24:
+        for (i = 0; i < width; i++)
+          put_24 (pw, (unsigned char *) row + (x + i) * 3, v);
+        break;
+      case PIXEL_32:
+        {
+          unsigned int *out = (unsigned int *) row + x;
+          for (i = 0; i < width; i++)
+            out[i] = v;
+        }
+        break;
+      default:
+        for (i = 0; i < width; i++)
+          XPutPixel (pw->image, x + i, j, v);
+        break;
+      }
+    }
+}
+
+
+void
+pixel_lut_init (pixel_lut *lut, XImage *image,
+                const unsigned long *pixels, int npixels)
+{
+  int i;
+  pixel_writer_init (&lut->pw, image);
+  for (i = 0; i < 256; i++)
+    lut->lut[i] = pixel_writer_value (&lut->pw,
+                                      pixels[i < npixels ? i : npixels-1]);
+}
+
+
+/* The inner loops here are table lookups with no dependencies between
+   pixels; the compiler unrolls them, and uses vector gathers where the
+   target has them. */
+void
+pixel_lut_expand (const pixel_lut *lut,
+                  const unsigned char *src, int src_stride,
+                  int x, int y, int width, int height)
+{
+  const pixel_writer *pw = &lut->pw;
+  const unsigned int *table = lut->lut;
+  int i, j;
+
+  for (j = 0; j < height; j++, src += src_stride)
+    {
+      char *row = pixel_writer_row (pw, y + j);
+      switch (pw->format) {
+      case PIXEL_8:
+        {
+          unsigned char *out = (unsigned char *) row + x;
+          for (i = 0; i < width; i++)
+            out[i] = table[src[i]];
+        }
+        break;
+      case PIXEL_16:
+        {
+          unsigned short *out = (unsigned short *) row + x;
+          for (i = 0; i < width; i++)
+            out[i] = table[src[i]];
+        }
+        break;
+      case PIXEL_24:
+        {
+          unsigned char *out = (unsigned char *) row + x * 3;
+          for (i = 0; i < width; i++)
+            put_24 (pw, out + i * 3, table[src[i]]);
+        }
+        break;
+      case PIXEL_32:
+        {
+          unsigned int *out = (unsigned int *) row + x;
+          for (i = 0; i < width; i++)
+            out[i] = table[src[i]];
+        }
+        break;
+      default:
+        for (i = 0; i < width; i++)
+          XPutPixel (pw->image, x + i, y + j, table[src[i]]);
+        break;
+      }
+    }
+}
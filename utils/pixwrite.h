@@ -0,0 +1,76 @@
+/* xscreensaver, Copyright (c) 2026 Jamie Zawinski <jwz@jwz.org>
+ * Writing pixels directly into XImage rows.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ *
+ * XPutPixel is a function call through a pointer, with a switch on the
+ * image format inside it, for every pixel.  These routines work out the
+ * image's format once, and then let the caller store pixels into each row
+ * with a plain array assignment of the right width, already in the image's
+ * byte order.
+ */
+
+#ifndef __XSCREENSAVER_PIXWRITE_H__
+#define __XSCREENSAVER_PIXWRITE_H__
+
+enum pixel_format {
+  PIXEL_GENERIC,	/* anything else: use XPutPixel */
+  PIXEL_8,		/* unsigned char per pixel */
+  PIXEL_16,		/* unsigned short per pixel */
+  PIXEL_24,		/* 3 bytes per pixel, in image byte order */
+  PIXEL_32		/* unsigned int per pixel */
+};
+
+typedef struct {
+  XImage *image;
+  enum pixel_format format;
+  Bool swap_p;		/* image byte order is not the local byte order */
+} pixel_writer;
+
+/* Expands 8-bit color indexes into pixels. */
+typedef struct {
+  pixel_writer pw;
+  unsigned int lut[256];	/* stored pixel values, already swapped */
+} pixel_lut;
+
+
+extern void pixel_writer_init (pixel_writer *, XImage *);
+
+/* Returns the pixel value in the form that it should be stored into a
+   PIXEL_16 or PIXEL_32 row: that is, byte-swapped if necessary.  For
+   the other formats, returns it unchanged. */
+extern unsigned long pixel_writer_value (const pixel_writer *,
+                                         unsigned long pixel);
+
+/* The first byte of row `y'.  Cast it to the type that goes with the
+   format: e.g., for PIXEL_32,
+     ((unsigned int *) pixel_writer_row (pw, y))[x] =
+       pixel_writer_value (pw, pixel);
+ */
+#define pixel_writer_row(PW,Y) \
+  ((void *) ((PW)->image->data + (Y) * (PW)->image->bytes_per_line))
+
+/* Fills a rectangle of the image with one pixel value. */
+extern void pixel_writer_fill (const pixel_writer *,
+                               int x, int y, int width, int height,
+                               unsigned long pixel);
+
+
+/* `pixels' are the X pixel values of color indexes 0 through npixels-1;
+   indexes past the end map to the last one. */
+extern void pixel_lut_init (pixel_lut *, XImage *,
+                            const unsigned long *pixels, int npixels);
+
+/* Writes a width x height rectangle of color indexes into the image at
+   (x, y).  Consecutive rows of `src' are `src_stride' bytes apart. */
+extern void pixel_lut_expand (const pixel_lut *,
+                              const unsigned char *src, int src_stride,
+                              int x, int y, int width, int height);
+
+#endif /* __XSCREENSAVER_PIXWRITE_H__ */
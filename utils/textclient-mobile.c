@@ -801,6 +801,20 @@ textclient_getc (text_data *d)
 }
 
 
+int
+textclient_read (text_data *d, char *buf, int n)
+{
+  int i = 0;
+  while (i < n) {
+    int c = textclient_getc (d);
+    if (c <= 0) break;
+    buf[i++] = c;
+    if (!d->fp || !*d->fp) break;  // don't start the next buffer
+  }
+  return i;
+}
+
+
 Bool
 textclient_puts (text_data *d, const char *s)
 {
@@ -35,9 +35,15 @@
 #endif
 
 #include <stdio.h>
+#include <errno.h>
 
 #include <signal.h>
 #include <sys/wait.h>
+#include <sys/time.h>
+
+#ifdef HAVE_SYS_SELECT_H
+# include <sys/select.h>
+#endif /* HAVE_SYS_SELECT_H */
 
 #ifdef HAVE_UNISTD_H
 # include <unistd.h>
@@ -61,6 +67,9 @@
 
 extern const char *progname;
 
+#define RING_SIZE (64 * 1024)	/* must be a power of 2 */
+#define EOF_PAD   4		/* room for the "\r\n\r\n" at EOF */
+
 struct text_data {
   Display *dpy;
   char *program;
@@ -82,7 +91,14 @@ struct text_data {
   unsigned int meta_mask;
 
   const char *out_buffer;
-  int out_column;
+
+  /* Bytes read from the pipe but not yet returned.  We read as much as
+     is available whenever the fd is readable, rather than one byte per
+     read() call. */
+  unsigned char ring[RING_SIZE];
+  unsigned int ring_head;	/* index of the next byte to return */
+  unsigned int ring_count;	/* number of bytes buffered */
+  int last_read_c;		/* last byte that went into the ring */
 };
 
 
@@ -183,6 +199,21 @@ selftest (void)
 
 static void start_timer (text_data *, Bool);
 
+/* Whether a read() on the fd would return without blocking.  The fd
+   itself stays blocking, since with a pty, textclient_puts writes
+   keystrokes to the same stream, and those must not be dropped.
+ */
+static Bool
+readable_p (int fd)
+{
+  fd_set fds;
+  struct timeval tv = { 0, 0 };
+  FD_ZERO (&fds);
+  FD_SET (fd, &fds);
+  return (select (fd + 1, &fds, 0, 0, &tv) > 0);
+}
+
+
 static void
 launch_text_generator (text_data *d)
 {
@@ -535,6 +566,8 @@ textclient_reshape (text_data *d,
 # endif
       close_pipe (d);
       d->input_available_p = False;
+      d->ring_head = d->ring_count = 0;
+      d->last_read_c = 0;
       start_timer (d, False);
     }
 }
@@ -660,58 +693,128 @@ textclient_close (text_data *d)
   free (d);
 }
 
-int
-textclient_getc (text_data *d)
+/* Appends bytes to the ring buffer.  The caller makes sure they fit. */
+static void
+ring_push (text_data *d, const unsigned char *s, unsigned int n)
 {
-  XtAppContext app = XtDisplayToApplicationContext (d->dpy);
-  int ret = -1;
-
-  if (XtAppPending (app) & (XtIMTimer|XtIMAlternateInput))
-    XtAppProcessEvent (app, XtIMTimer|XtIMAlternateInput);
-
-  if (d->out_buffer && *d->out_buffer)
+  while (n--)
     {
-      ret = *d->out_buffer;
-      d->out_buffer++;
+      d->ring[(d->ring_head + d->ring_count) & (RING_SIZE-1)] = *s;
+      d->last_read_c = *s++;
+      d->ring_count++;
     }
-  else if (d->input_available_p && d->pipe)
+}
+
+
+/* The subprocess exited: reap it, and schedule the next one.
+ */
+static void
+handle_eof (text_data *d)
+{
+  if (d->pid)
     {
-      unsigned char s[2];
-      int n = read (fileno (d->pipe), (void *) s, 1);
-      if (n > 0)
-        ret = s[0];
-      else		/* EOF */
-        {
-	  if (d->pid)
-	    {
 # ifdef DEBUG
-              fprintf (stderr, "%s: textclient: waitpid %d\n",
-                       progname, d->pid);
+      fprintf (stderr, "%s: textclient: waitpid %d\n", progname, d->pid);
 # endif
-	      waitpid (d->pid, NULL, 0);
-              d->pid = 0;
-	    }
+      waitpid (d->pid, NULL, 0);
+      d->pid = 0;
+    }
 
-          close_pipe (d);
+  close_pipe (d);
 
-          if (d->out_column > 0)
-            {
+  /* If the output didn't end with a newline, add a blank line, after
+     whatever is still buffered. */
+  if (d->last_read_c && d->last_read_c != '\r' && d->last_read_c != '\n')
+    {
 # ifdef DEBUG
-              fprintf (stderr, "%s: textclient: adding blank line at EOF\n",
-                       progname);
+      fprintf (stderr, "%s: textclient: adding blank line at EOF\n",
+               progname);
 # endif
-              d->out_buffer = "\r\n\r\n";
-            }
+      ring_push (d, (const unsigned char *) "\r\n\r\n", EOF_PAD);
+    }
+  d->last_read_c = 0;
+
+  start_timer (d, False);
+}
+
+
+/* Read everything the subprocess has written so far, or as much of it
+   as fits, without ever waiting for more.
+ */
+static void
+fill_ring (text_data *d)
+{
+  if (! (d->input_available_p && d->pipe))
+    return;
+
+  while (d->ring_count < RING_SIZE - EOF_PAD)
+    {
+      /* Read into the contiguous free space after the tail. */
+      unsigned int tail = (d->ring_head + d->ring_count) & (RING_SIZE-1);
+      unsigned int room = RING_SIZE - EOF_PAD - d->ring_count;
+      int n;
+      if (room > RING_SIZE - tail)
+        room = RING_SIZE - tail;
+
+      if (! readable_p (fileno (d->pipe)))
+        break;
 
-          start_timer (d, False);
+      n = read (fileno (d->pipe), (void *) (d->ring + tail), room);
+      if (n > 0)
+        {
+          d->ring_count += n;
+          d->last_read_c = d->ring[(tail + n - 1) & (RING_SIZE-1)];
+        }
+      else if (n < 0 && errno == EINTR)
+        break;
+      else		/* EOF, or EIO from a pty whose child is gone */
+        {
+          handle_eof (d);
+          break;
         }
-      d->input_available_p = False;
     }
 
-  if (ret == '\r' || ret == '\n')
-    d->out_column = 0;
-  else if (ret > 0)
-    d->out_column++;
+  /* If the ring filled up, there may be more to read: leave the flag set
+     so that we come back without waiting for another select(). */
+  if (d->ring_count < RING_SIZE - EOF_PAD)
+    d->input_available_p = False;
+}
+
+
+/* Called when we have nothing buffered: runs any pending timers and
+   input callbacks, then reads whatever the subprocess has for us.
+ */
+static void
+refill (text_data *d)
+{
+  XtAppContext app = XtDisplayToApplicationContext (d->dpy);
+
+  if (XtAppPending (app) & (XtIMTimer|XtIMAlternateInput))
+    XtAppProcessEvent (app, XtIMTimer|XtIMAlternateInput);
+
+  fill_ring (d);
+}
+
+
+int
+textclient_getc (text_data *d)
+{
+  int ret = -1;
+
+  if (! (d->out_buffer && *d->out_buffer) && d->ring_count == 0)
+    refill (d);
+
+  if (d->out_buffer && *d->out_buffer)
+    {
+      ret = *d->out_buffer;
+      d->out_buffer++;
+    }
+  else if (d->ring_count > 0)
+    {
+      ret = d->ring[d->ring_head];
+      d->ring_head = (d->ring_head + 1) & (RING_SIZE-1);
+      d->ring_count--;
+    }
 
 # ifdef DEBUG
   if (ret <= 0)
@@ -726,6 +829,40 @@ textclient_getc (text_data *d)
 }
 
 
+int
+textclient_read (text_data *d, char *buf, int n)
+{
+  int i = 0;
+
+  if (n <= 0) return 0;
+
+  if (! (d->out_buffer && *d->out_buffer) && d->ring_count == 0)
+    refill (d);
+
+  while (i < n && d->out_buffer && *d->out_buffer)
+    buf[i++] = *d->out_buffer++;
+
+  while (i < n && d->ring_count > 0)
+    {
+      /* Copy the contiguous run up to the end of the ring, then wrap. */
+      unsigned int run = RING_SIZE - d->ring_head;
+      if (run > d->ring_count) run = d->ring_count;
+      if (run > n - i) run = n - i;
+      memcpy (buf + i, d->ring + d->ring_head, run);
+      d->ring_head = (d->ring_head + run) & (RING_SIZE-1);
+      d->ring_count -= run;
+      i += run;
+    }
+
+# ifdef DEBUG
+  if (i > 0)
+    fprintf (stderr, "%s: textclient: read: %d bytes\n", progname, i);
+# endif
+
+  return i;
+}
+
+
 /* The interpretation of the ModN modifiers is dependent on what keys
    are bound to them: Mod1 does not necessarily mean "meta".  It only
    means "meta" if Meta_L or Meta_R are bound to it.  If Meta_L is on
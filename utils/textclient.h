@@ -27,6 +27,10 @@ extern void textclient_reshape (text_data *,
                                 int char_w, int char_h,
                                 int max_lines);
 extern int textclient_getc (text_data *);
+
+/* Copies up to n bytes of pending output into buf without blocking, and
+   returns how many there were: 0 if nothing is available right now. */
+extern int textclient_read (text_data *, char *buf, int n);
 extern Bool textclient_puts (text_data *, const char *);
 extern Bool textclient_putc_event (text_data *, XKeyEvent *);
 
@@ -0,0 +1,311 @@
+/* xscreensaver, Copyright (c) 2026 Jamie Zawinski <jwz@jwz.org>
+ * Collecting points, lines, rectangles and arcs, and sending them in bulk.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+#include "utils.h"
+#include "xbatch.h"
+
+extern const char *progname;
+
+enum xbatch_kind {
+  XBATCH_POINTS, XBATCH_SEGMENTS, XBATCH_RECTANGLES, XBATCH_ARCS
+};
+
+static const size_t item_size[] = {
+  sizeof(XPoint), sizeof(XSegment), sizeof(XRectangle), sizeof(XArc)
+};
+
+typedef struct {
+  GC gc;
+  enum xbatch_kind kind;
+  Bool color_p;			/* whether `pixel' was set */
+  unsigned long pixel;
+  char *items;
+  int count;
+  size_t bytes;			/* allocated size of `items' */
+} xbatch_list;
+
+typedef struct {
+  GC gc;
+  unsigned long pixel;
+} xbatch_color;
+
+struct xbatch {
+  Display *dpy;
+
+  /* The lists, in the order they were started.  Lists past `nlists' are
+     unused, but keep their memory for the next frame. */
+  xbatch_list *lists;
+  int nlists, lists_size;
+  int last;			/* the list most recently added to, or -1 */
+
+  int *table;			/* hash of lists by key; -1 if empty */
+  unsigned int table_size;	/* a power of 2 */
+
+  xbatch_color *colors;		/* from xbatch_set_foreground */
+  int ncolors;
+};
+
+
+static void
+xbatch_oom (void)
+{
+  fprintf (stderr, "%s: out of memory\n", progname);
+  exit (1);
+}
+
+
+xbatch *
+xbatch_create (Display *dpy)
+{
+  xbatch *b = (xbatch *) calloc (1, sizeof(*b));
+  if (!b) xbatch_oom();
+  b->dpy = dpy;
+  b->last = -1;
+  return b;
+}
+
+
+void
+xbatch_free (xbatch *b)
+{
+  int i;
+  if (!b) return;
+  for (i = 0; i < b->lists_size; i++)
+    free (b->lists[i].items);
+  free (b->lists);
+  free (b->table);
+  free (b->colors);
+  free (b);
+}
+
+
+void
+xbatch_set_foreground (xbatch *b, GC gc, unsigned long pixel)
+{
+  int i;
+  for (i = 0; i < b->ncolors; i++)
+    if (b->colors[i].gc == gc)
+      {
+        b->colors[i].pixel = pixel;
+        return;
+      }
+
+  b->colors = (xbatch_color *)
+    realloc (b->colors, (b->ncolors + 1) * sizeof(*b->colors));
+  if (!b->colors) xbatch_oom();
+  b->colors[b->ncolors].gc = gc;
+  b->colors[b->ncolors].pixel = pixel;
+  b->ncolors++;
+}
+
+
+static unsigned int
+list_hash (GC gc, enum xbatch_kind kind, unsigned long pixel)
+{
+  unsigned long h = (unsigned long) gc;
+  h = (h >> 4) * 2654435761UL;
+  h ^= pixel * 40503UL;
+  h ^= kind;
+  return (unsigned int) (h ^ (h >> 16));
+}
+
+
+/* Makes the table at least four times the number of lists, and re-files
+   the lists in it. */
+static void
+grow_table (xbatch *b)
+{
+  unsigned int size = (b->table_size ? b->table_size * 2 : 64);
+  unsigned int mask = size - 1;
+  int i;
+
+  free (b->table);
+  b->table = (int *) malloc (size * sizeof(*b->table));
+  if (!b->table) xbatch_oom();
+  b->table_size = size;
+  memset (b->table, -1, size * sizeof(*b->table));
+
+  for (i = 0; i < b->nlists; i++)
+    {
+      xbatch_list *L = &b->lists[i];
+      unsigned int h = list_hash (L->gc, L->kind, L->pixel) & mask;
+      while (b->table[h] >= 0)
+        h = (h + 1) & mask;
+      b->table[h] = i;
+    }
+}
+
+
+static xbatch_list *
+find_list (xbatch *b, GC gc, enum xbatch_kind kind)
+{
+  Bool color_p = False;
+  unsigned long pixel = 0;
+  xbatch_list *L;
+  unsigned int h, mask;
+  int i;
+
+  for (i = 0; i < b->ncolors; i++)
+    if (b->colors[i].gc == gc)
+      {
+        color_p = True;
+        pixel = b->colors[i].pixel;
+        break;
+      }
+
+# define MATCH(L) \
+    ((L)->gc == gc && (L)->kind == kind && \
+     (L)->color_p == color_p && (L)->pixel == pixel)
+
+  /* Usually the same as last time. */
+  if (b->last >= 0 && MATCH (&b->lists[b->last]))
+    return &b->lists[b->last];
+
+  if ((unsigned int) b->nlists * 4 >= b->table_size)
+    grow_table (b);
+
+  mask = b->table_size - 1;
+  for (h = list_hash (gc, kind, pixel) & mask;
+       b->table[h] >= 0;
+       h = (h + 1) & mask)
+    if (MATCH (&b->lists[b->table[h]]))
+      {
+        b->last = b->table[h];
+        return &b->lists[b->last];
+      }
+# undef MATCH
+
+  /* Start a new list. */
+  if (b->nlists >= b->lists_size)
+    {
+      int n = (b->lists_size ? b->lists_size * 2 : 16);
+      b->lists = (xbatch_list *) realloc (b->lists, n * sizeof(*b->lists));
+      if (!b->lists) xbatch_oom();
+      memset (b->lists + b->lists_size, 0,
+              (n - b->lists_size) * sizeof(*b->lists));
+      b->lists_size = n;
+    }
+
+  L = &b->lists[b->nlists];
+  L->gc      = gc;
+  L->kind    = kind;
+  L->color_p = color_p;
+  L->pixel   = pixel;
+  L->count   = 0;
+  b->table[h] = b->nlists;
+  b->last = b->nlists++;
+  return L;
+}
+
+
+static void *
+add_item (xbatch *b, GC gc, enum xbatch_kind kind)
+{
+  xbatch_list *L = find_list (b, gc, kind);
+  size_t size = item_size[kind];
+
+  if ((L->count + 1) * size > L->bytes)
+    {
+      size_t n = (L->bytes ? L->bytes * 2 : size * 64);
+      L->items = (char *) realloc (L->items, n);
+      if (!L->items) xbatch_oom();
+      L->bytes = n;
+    }
+
+  return L->items + size * L->count++;
+}
+
+
+void
+xbatch_point (xbatch *b, GC gc, int x, int y)
+{
+  XPoint *p = (XPoint *) add_item (b, gc, XBATCH_POINTS);
+  p->x = x;
+  p->y = y;
+}
+
+
+void
+xbatch_segment (xbatch *b, GC gc, int x1, int y1, int x2, int y2)
+{
+  XSegment *s = (XSegment *) add_item (b, gc, XBATCH_SEGMENTS);
+  s->x1 = x1;
+  s->y1 = y1;
+  s->x2 = x2;
+  s->y2 = y2;
+}
+
+
+void
+xbatch_fill_rectangle (xbatch *b, GC gc, int x, int y,
+                       unsigned int w, unsigned int h)
+{
+  XRectangle *r = (XRectangle *) add_item (b, gc, XBATCH_RECTANGLES);
+  r->x = x;
+  r->y = y;
+  r->width  = w;
+  r->height = h;
+}
+
+
+void
+xbatch_fill_arc (xbatch *b, GC gc, int x, int y,
+                 unsigned int w, unsigned int h, int angle1, int angle2)
+{
+  XArc *a = (XArc *) add_item (b, gc, XBATCH_ARCS);
+  a->x = x;
+  a->y = y;
+  a->width  = w;
+  a->height = h;
+  a->angle1 = angle1;
+  a->angle2 = angle2;
+}
+
+
+void
+xbatch_flush (xbatch *b, Drawable d)
+{
+  int i;
+
+  for (i = 0; i < b->nlists; i++)
+    {
+      xbatch_list *L = &b->lists[i];
+      if (L->color_p)
+        XSetForeground (b->dpy, L->gc, L->pixel);
+      switch (L->kind) {
+      case XBATCH_POINTS:
+        XDrawPoints (b->dpy, d, L->gc, (XPoint *) L->items, L->count,
+                     CoordModeOrigin);
+        break;
+      case XBATCH_SEGMENTS:
+        XDrawSegments (b->dpy, d, L->gc, (XSegment *) L->items, L->count);
+        break;
+      case XBATCH_RECTANGLES:
+        XFillRectangles (b->dpy, d, L->gc, (XRectangle *) L->items,
+                         L->count);
+        break;
+      case XBATCH_ARCS:
+        XFillArcs (b->dpy, d, L->gc, (XArc *) L->items, L->count);
+        break;
+      }
+      L->count = 0;
+    }
+
+  /* Leave each GC with the color that was set on it most recently. */
+  for (i = 0; i < b->ncolors; i++)
+    XSetForeground (b->dpy, b->colors[i].gc, b->colors[i].pixel);
+
+  b->nlists = 0;
+  b->last = -1;
+  if (b->table)
+    memset (b->table, -1, b->table_size * sizeof(*b->table));
+}
@@ -0,0 +1,55 @@
+/* xscreensaver, Copyright (c) 2026 Jamie Zawinski <jwz@jwz.org>
+ * Collecting points, lines, rectangles and arcs, and sending them in bulk.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ *
+ * Over a remote X connection, or VNC, what limits the frame rate is the
+ * number of requests, not the number of pixels, and a hack that calls
+ * XDrawPoint in its inner loop sends a request for every pixel.  Shapes
+ * added to an xbatch are kept in lists by GC, color and kind of shape, and
+ * xbatch_flush sends each list with XDrawPoints, XDrawSegments,
+ * XFillRectangles or XFillArcs, which Xlib packs into as few requests as
+ * the server allows.
+ *
+ * The lists are drawn in the order in which each was started, so shapes in
+ * different lists are not necessarily drawn in the order they were added.
+ * Where that matters (opaque shapes of different colors that overlap),
+ * flush in between.
+ */
+
+#ifndef __XSCREENSAVER_XBATCH_H__
+#define __XSCREENSAVER_XBATCH_H__
+
+typedef struct xbatch xbatch;
+
+extern xbatch *xbatch_create (Display *);
+extern void xbatch_free (xbatch *);
+
+/* Use this instead of XSetForeground on a GC that is used with the batch:
+   shapes added with this GC from now on will be drawn in this color.
+   When the batch is flushed, the GC is left with the last color set.
+   Shapes added with a GC that has never had its color set this way are
+   drawn with whatever the GC's foreground is when the batch is flushed.
+ */
+extern void xbatch_set_foreground (xbatch *, GC, unsigned long pixel);
+
+extern void xbatch_point (xbatch *, GC, int x, int y);
+extern void xbatch_segment (xbatch *, GC, int x1, int y1, int x2, int y2);
+extern void xbatch_fill_rectangle (xbatch *, GC, int x, int y,
+                                   unsigned int w, unsigned int h);
+extern void xbatch_fill_arc (xbatch *, GC, int x, int y,
+                             unsigned int w, unsigned int h,
+                             int angle1, int angle2);
+
+/* Draws everything that has been added onto the drawable, and empties the
+   batch.  Other GC settings (function, line width, clipping) are those
+   the GC has at the time of the flush. */
+extern void xbatch_flush (xbatch *, Drawable);
+
+#endif /* __XSCREENSAVER_XBATCH_H__ */
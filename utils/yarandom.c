@@ -60,6 +60,8 @@
 #endif
 #include <sys/time.h> /* for gettimeofday() */
 
+#include <string.h>
+
 #include "yarandom.h"
 # undef ya_rand_init
 
@@ -85,6 +87,7 @@ static unsigned int a[VectorSize] = {
 };
 
 static int i1, i2;
+static unsigned int ya_seed;
 
 unsigned int
 ya_random (void)
@@ -124,6 +127,7 @@ ya_rand_init(unsigned int seed)
       seed = ROT (seed, 13);
     }
 
+  ya_seed = seed;
   a[0] += seed;
   for (i = 1; i < VectorSize; i++)
     {
@@ -137,3 +141,96 @@ ya_rand_init(unsigned int seed)
   i1 = a[0] % VectorSize;
   i2 = (i1 + 24) % VectorSize;
 }
+
+
+/* The state is the last 55 numbers generated, oldest first.  The next 55
+   are generated in place: x[n] = x[n-55] + x[n-31], which is the same as
+   ya_random() computes with i1 and i2.  In the first loop, each number
+   read is one that has not been replaced yet; in the second, each is one
+   replaced 31 steps earlier.  So there is no dependency between adjacent
+   elements, and the compiler can vectorize both loops.
+ */
+static void
+ya_random_refill (ya_random_state *st)
+{
+  unsigned int *a = st->a;
+  int k;
+  for (k = 0; k < VectorSize - 24; k++)
+    a[k] += a[k + 24];
+  for (k = VectorSize - 24; k < VectorSize; k++)
+    a[k] += a[k - (VectorSize - 24)];
+  st->pos = 0;
+}
+
+
+void
+ya_random_init (ya_random_state *st, unsigned int stream)
+{
+  unsigned int s = ya_seed ^ (stream * 0x9E3779B9U);
+  int i;
+
+  /* Scramble the seed into every word with a hash finalizer, so that
+     nearby streams don't start out looking alike. */
+  for (i = 0; i < VectorSize; i++)
+    {
+      unsigned int z = (s += 0x9E3779B9U);
+      z ^= z >> 16;
+      z *= 0x85EBCA6BU;
+      z ^= z >> 13;
+      z *= 0xC2B2AE35U;
+      z ^= z >> 16;
+      st->a[i] = z;
+    }
+
+  /* If every word were even, the low bit would stay 0 forever. */
+  st->a[0] |= 1;
+
+  for (i = 0; i < 4; i++)
+    ya_random_refill (st);
+  st->pos = VectorSize;
+}
+
+
+unsigned int
+ya_random_r (ya_random_state *st)
+{
+  if (st->pos >= VectorSize)
+    ya_random_refill (st);
+  return st->a[st->pos++];
+}
+
+
+void
+ya_random_fill (ya_random_state *st, unsigned int *buf, int n)
+{
+  int i;
+
+  /* Use up what's left of the current batch. */
+  while (n > 0 && st->pos < VectorSize)
+    {
+      *buf++ = st->a[st->pos++];
+      n--;
+    }
+
+  if (n <= 0)
+    return;
+  else if (n < VectorSize)
+    {
+      ya_random_refill (st);
+      memcpy (buf, st->a, n * sizeof(*buf));
+      st->pos = n;
+      return;
+    }
+
+  /* Run the recurrence directly in the output buffer, and keep the last
+     55 numbers as the new state. */
+  for (i = 0; i < VectorSize - 24; i++)
+    buf[i] = st->a[i] + st->a[i + 24];
+  for (; i < VectorSize; i++)
+    buf[i] = st->a[i] + buf[i - (VectorSize - 24)];
+  for (; i < n; i++)
+    buf[i] = buf[i - VectorSize] + buf[i - (VectorSize - 24)];
+
+  memcpy (st->a, buf + n - VectorSize, VectorSize * sizeof(*buf));
+  st->pos = VectorSize;
+}
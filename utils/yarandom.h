@@ -51,6 +51,28 @@
 extern unsigned int ya_random (void);
 extern void ya_rand_init (unsigned int);
 
+/* random() is not thread-safe: its state is global.  Threads should each
+   use one of these instead.  It is the same generator, and it produces its
+   numbers in batches, which is where its speed comes from.
+ */
+typedef struct {
+  unsigned int a[55];
+  int pos;
+} ya_random_state;
+
+/* Seeds a generator from the seed that random() was seeded with, and
+   `stream', e.g. a thread number.  Different streams give unrelated
+   sequences, and the same seed and stream always give the same one: run a
+   screenhack with "-seed N" to make every run of it the same.
+ */
+extern void ya_random_init (ya_random_state *, unsigned int stream);
+extern unsigned int ya_random_r (ya_random_state *);
+
+/* Fills `buf' with `n' random numbers.  For large n, this is several times
+   faster per number than calling ya_random_r.
+ */
+extern void ya_random_fill (ya_random_state *, unsigned int *buf, int n);
+
 #define random()   ya_random()
 #define RAND_MAX   0xFFFFFFFF
 